@@ -1,15 +1,15 @@
-/**
-  \file    stm8s_itc.h 
-  \brief   Заголовочный файл контроллера прерываний ядра STM8S
-  \author  JavaLandau
-  \version 1.0
-  \date    20.12.2017 
-*/
-
-#ifndef __STM8S_ITC__
-#define __STM8S_ITC__
-
-/**Включить обработку прерываний*/
-void stm8s_itc_InterruptsEnable(void);
-
+/**
+  \file    stm8s_itc.h 
+  \brief   Заголовочный файл контроллера прерываний ядра STM8S
+  \author  JavaLandau
+  \version 1.0
+  \date    20.12.2017 
+*/
+
+#ifndef __STM8S_ITC__
+#define __STM8S_ITC__
+
+/**Включить обработку прерываний*/
+void stm8s_itc_InterruptsEnable(void);
+
 #endif
\ No newline at end of file
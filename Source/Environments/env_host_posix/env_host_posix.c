@@ -0,0 +1,164 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+#include <errno.h>
+#include "jhal_environment.h"
+#include "jhal_os.h"
+#include "env_host_posix.h"
+
+/* All simulated interrupts are serviced by one thread in due order, the same way
+   a single core runs its ISRs. irq_mutex is held while a handler runs, so taking
+   it from the application masks interrupts */
+static pthread_once_t irq_once = PTHREAD_ONCE_INIT;
+static pthread_t irq_thread;
+static pthread_mutex_t queue_mutex;
+static pthread_cond_t queue_cond;
+static pthread_mutex_t irq_mutex;
+static env_host_posix_irq_event* pqueue_top = NULL;
+
+static void prv_queue_remove(env_host_posix_irq_event* pevent)
+{
+  env_host_posix_irq_event** ppevent = &pqueue_top;
+  while(*ppevent != NULL)
+  {
+    if(*ppevent == pevent)
+    {
+      *ppevent = pevent->pnext;
+      break;
+    }
+    ppevent = &(*ppevent)->pnext;
+  }
+  pevent->pending = 0;
+}
+
+static void* prv_irq_thread(void* parg)
+{
+  (void)parg;
+  
+  pthread_mutex_lock(&queue_mutex);
+  while(1)
+  {
+    if(pqueue_top == NULL)
+    {
+      pthread_cond_wait(&queue_cond, &queue_mutex);
+      continue;
+    }
+    
+    uint64_t now_ns = env_host_posix_time_ns();
+    if(pqueue_top->due_ns > now_ns)
+    {
+      struct timespec deadline;
+      deadline.tv_sec = pqueue_top->due_ns / ENV_HOST_POSIX_NS_IN_S;
+      deadline.tv_nsec = pqueue_top->due_ns % ENV_HOST_POSIX_NS_IN_S;
+      pthread_cond_timedwait(&queue_cond, &queue_mutex, &deadline);
+      continue;
+    }
+    
+    env_host_posix_irq_event* pevent = pqueue_top;
+    pqueue_top = pevent->pnext;
+    pevent->pending = 0;
+    pthread_mutex_unlock(&queue_mutex);
+    
+    pthread_mutex_lock(&irq_mutex);
+#if (USE_JHAL_OS == 1)
+    jhal_os_isr_enter();
+#endif
+    pevent->pfunc_handler(pevent);
+#if (USE_JHAL_OS == 1)
+    jhal_os_isr_exit();
+#endif
+    pthread_mutex_unlock(&irq_mutex);
+    
+    pthread_mutex_lock(&queue_mutex);
+  }
+  
+  return NULL;
+}
+
+static void prv_irq_start(void)
+{
+  pthread_condattr_t cond_attr;
+  pthread_condattr_init(&cond_attr);
+  pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+  pthread_cond_init(&queue_cond, &cond_attr);
+  pthread_condattr_destroy(&cond_attr);
+  
+  pthread_mutexattr_t mutex_attr;
+  pthread_mutexattr_init(&mutex_attr);
+  pthread_mutexattr_settype(&mutex_attr, PTHREAD_MUTEX_RECURSIVE);
+  pthread_mutex_init(&irq_mutex, &mutex_attr);
+  pthread_mutexattr_destroy(&mutex_attr);
+  
+  pthread_mutex_init(&queue_mutex, NULL);
+  pthread_create(&irq_thread, NULL, prv_irq_thread, NULL);
+}
+
+uint64_t env_host_posix_time_ns(void)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  
+  return (uint64_t)now.tv_sec * ENV_HOST_POSIX_NS_IN_S + now.tv_nsec;
+}
+
+void env_host_posix_sleep_ns(uint64_t amount_ns)
+{
+  struct timespec delay;
+  delay.tv_sec = amount_ns / ENV_HOST_POSIX_NS_IN_S;
+  delay.tv_nsec = amount_ns % ENV_HOST_POSIX_NS_IN_S;
+  
+  while(nanosleep(&delay, &delay) && errno == EINTR);
+}
+
+void env_host_posix_irq_event_init(env_host_posix_irq_event* pevent, env_host_posix_irq_handler pfunc_handler, void* pcontext)
+{
+  pthread_once(&irq_once, prv_irq_start);
+  
+  pevent->pnext = NULL;
+  pevent->due_ns = 0;
+  pevent->pfunc_handler = pfunc_handler;
+  pevent->pcontext = pcontext;
+  pevent->pending = 0;
+}
+
+void env_host_posix_irq_post(env_host_posix_irq_event* pevent, uint64_t delay_ns)
+{
+  pthread_mutex_lock(&queue_mutex);
+  
+  if(pevent->pending)
+    prv_queue_remove(pevent);
+  
+  pevent->due_ns = env_host_posix_time_ns() + delay_ns;
+  pevent->pending = 1;
+  
+  env_host_posix_irq_event** ppevent = &pqueue_top;
+  while(*ppevent != NULL && (*ppevent)->due_ns <= pevent->due_ns)
+    ppevent = &(*ppevent)->pnext;
+  
+  pevent->pnext = *ppevent;
+  *ppevent = pevent;
+  
+  pthread_cond_signal(&queue_cond);
+  pthread_mutex_unlock(&queue_mutex);
+}
+
+void env_host_posix_irq_cancel(env_host_posix_irq_event* pevent)
+{
+  pthread_mutex_lock(&queue_mutex);
+  
+  if(pevent->pending)
+    prv_queue_remove(pevent);
+  
+  pthread_mutex_unlock(&queue_mutex);
+}
+
+void env_host_posix_irq_lock(void)
+{
+  pthread_once(&irq_once, prv_irq_start);
+  pthread_mutex_lock(&irq_mutex);
+}
+
+void env_host_posix_irq_unlock(void)
+{
+  pthread_mutex_unlock(&irq_mutex);
+}
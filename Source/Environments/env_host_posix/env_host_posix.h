@@ -0,0 +1,57 @@
+#ifndef __ENV_HOST_POSIX__
+#define __ENV_HOST_POSIX__
+
+/* Selected by JHAL_MCU=host and JHAL_LIB=posix, runs on Linux and other POSIX
+   hosts. Neither token is a predefined macro, so GNU modes build as well */
+
+#include <stdint.h>
+#include <pthread.h>
+
+#ifndef __WEAK
+  #define __WEAK                                        __attribute__((weak))
+#endif
+
+#define ENV_HOST_POSIX_NS_IN_US                         1000ULL
+#define ENV_HOST_POSIX_NS_IN_MS                         1000000ULL
+#define ENV_HOST_POSIX_NS_IN_S                          1000000000ULL
+
+/* Software model of the device on the other side of a bus. ptxdata is what the
+   host drives onto the wire (NULL - idle line), prxdata receives what the peer
+   drives back (NULL - ignored). Returns JHAL_RES_TIMEOUT if the peer has no data
+   yet, any other failure models a corrupted frame and ends an IT or DMA transfer
+   with the error callback (JHAL_SPI_ERROR_FRAME, JHAL_UART_ERROR_FRAMING) */
+typedef uint8_t (*env_host_posix_exchange)(void* ppeer, const uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
+
+#define ENV_HOST_POSIX_OPERATION_TX                     1U
+#define ENV_HOST_POSIX_OPERATION_RX                     2U
+#define ENV_HOST_POSIX_OPERATION_TXRX                   3U
+
+typedef struct {
+  env_host_posix_exchange       pfunc_exchange;
+  void*                         ppeer;
+  uint32_t                      ns_per_byte;
+} env_host_posix_bus_config;
+
+struct _env_host_posix_irq_event;
+typedef void (*env_host_posix_irq_handler)(struct _env_host_posix_irq_event*);
+
+struct _env_host_posix_irq_event {
+  struct _env_host_posix_irq_event*     pnext;
+  uint64_t                              due_ns;
+  env_host_posix_irq_handler            pfunc_handler;
+  void*                                 pcontext;
+  uint8_t                               pending;
+};
+
+typedef struct _env_host_posix_irq_event env_host_posix_irq_event;
+
+uint64_t env_host_posix_time_ns(void);
+void env_host_posix_sleep_ns(uint64_t amount_ns);
+
+void env_host_posix_irq_event_init(env_host_posix_irq_event* pevent, env_host_posix_irq_handler pfunc_handler, void* pcontext);
+void env_host_posix_irq_post(env_host_posix_irq_event* pevent, uint64_t delay_ns);
+void env_host_posix_irq_cancel(env_host_posix_irq_event* pevent);
+void env_host_posix_irq_lock(void);
+void env_host_posix_irq_unlock(void);
+
+#endif
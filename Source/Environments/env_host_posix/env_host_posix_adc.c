@@ -0,0 +1,166 @@
+#include <string.h>
+#include "jhal_adc.h"
+#include "env_host_posix_adc.h"
+
+#define ADC_OPERATION_SCAN              1U
+#define ADC_OPERATION_STREAM            2U
+
+static void prv_adc_scan(env_host_posix_adc* padc, uint16_t* pvalues, uint32_t amount_scans)
+{
+  for(uint32_t scan = 0; scan < amount_scans; scan++, padc->index++)
+  {
+    for(uint8_t i = 0; i < padc->amount_channels; i++)
+    {
+      uint16_t value = (uint16_t)((padc->value_max + 1U) / 2U);
+      
+      if(padc->config.pfunc_sample != NULL)
+        value = padc->config.pfunc_sample(padc->config.ppeer, padc->channels[i], padc->index);
+      
+      *pvalues++ = (value > padc->value_max) ? padc->value_max : value;
+    }
+  }
+}
+
+/* A stream wakes once per half with the samples of all its scans, rearmed from
+   the ideal due time so the sample rate does not drift with handler latency */
+static void prv_adc_complete_handler(env_host_posix_irq_event* pevent)
+{
+  env_host_posix_adc* padc = (env_host_posix_adc*)pevent->pcontext;
+  uint8_t operation = padc->operation;
+  
+  /* Stopped while the handler was waiting for the irq lock */
+  if(!operation)
+    return;
+  
+  if(operation == ADC_OPERATION_SCAN)
+  {
+    padc->operation = 0;
+    prv_adc_scan(padc, padc->pbuffer, 1);
+    jhal_adc_conversion_complete_callback(padc, padc->pbuffer, padc->amount_channels);
+    return;
+  }
+  
+  uint16_t size_half = padc->size / 2U;
+  uint16_t* psamples = padc->pbuffer + (padc->half ? size_half : 0);
+  uint32_t amount_scans = size_half / padc->amount_channels;
+  
+  uint64_t next_ns = pevent->due_ns + (uint64_t)padc->config.ns_per_scan * amount_scans;
+  uint64_t now_ns = env_host_posix_time_ns();
+  env_host_posix_irq_post(&padc->event_complete, (next_ns > now_ns) ? next_ns - now_ns : 0);
+  
+  prv_adc_scan(padc, psamples, amount_scans);
+  
+  if(padc->half)
+    jhal_adc_full_complete_callback(padc, psamples, size_half);
+  else
+    jhal_adc_half_complete_callback(padc, psamples, size_half);
+  
+  padc->half ^= 1U;
+}
+
+uint32_t env_host_posix_adc_size_drv(void)
+{
+  return env_host_posix_adc_size_drv_static;
+}
+
+uint8_t env_host_posix_adc_init(void* pinstance, jhal_adc_params* pparams)
+{
+  env_host_posix_adc* padc = (env_host_posix_adc*)pinstance;
+  
+  if(pparams->amount_channels > ENV_HOST_POSIX_ADC_CHANNELS_MAX)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  switch(pparams->resolution)
+  {
+    case JHAL_ADC_RESOLUTION_12BIT:     padc->value_max = 0x0FFFU; break;
+    case JHAL_ADC_RESOLUTION_10BIT:     padc->value_max = 0x03FFU; break;
+    case JHAL_ADC_RESOLUTION_8BIT:      padc->value_max = 0x00FFU; break;
+    case JHAL_ADC_RESOLUTION_6BIT:      padc->value_max = 0x003FU; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  if(pparams->plib_data != NULL)
+    padc->config = *((env_host_posix_adc_config*)pparams->plib_data);
+  else
+    memset(&padc->config, 0, sizeof(padc->config));
+  
+  if(!padc->config.ns_per_scan)
+    padc->config.ns_per_scan = ENV_HOST_POSIX_ADC_NS_PER_SCAN_DEFAULT;
+  
+  for(uint8_t i = 0; i < pparams->amount_channels; i++)
+    padc->channels[i] = pparams->pchannels[i].channel;
+  
+  padc->amount_channels = pparams->amount_channels;
+  padc->operation = 0;
+  padc->index = 0;
+  env_host_posix_irq_event_init(&padc->event_complete, prv_adc_complete_handler, padc);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_adc_deinit(void* pinstance)
+{
+  return env_host_posix_adc_stop(pinstance);
+}
+
+uint8_t env_host_posix_adc_convert(void* pinstance, uint16_t* pvalues, uint32_t timeout)
+{
+  env_host_posix_adc* padc = (env_host_posix_adc*)pinstance;
+  (void)timeout;
+  
+  if(padc->operation)
+    return JHAL_RES_ERROR;
+  
+  env_host_posix_sleep_ns(padc->config.ns_per_scan);
+  prv_adc_scan(padc, pvalues, 1);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_adc_convert_it(void* pinstance, uint16_t* pvalues)
+{
+  env_host_posix_adc* padc = (env_host_posix_adc*)pinstance;
+  
+  if(padc->operation)
+    return JHAL_RES_ERROR;
+  
+  padc->operation = ADC_OPERATION_SCAN;
+  padc->pbuffer = pvalues;
+  env_host_posix_irq_post(&padc->event_complete, padc->config.ns_per_scan);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* There is no bus master on the host, the samples are written by the handler */
+uint8_t env_host_posix_adc_start_dma(void* pinstance, uint16_t* pbuffer, uint16_t size, void* pinstance_dma)
+{
+  env_host_posix_adc* padc = (env_host_posix_adc*)pinstance;
+  (void)pinstance_dma;
+  
+  if(padc->operation)
+    return JHAL_RES_ERROR;
+  
+  if(size % (2U * padc->amount_channels))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  padc->operation = ADC_OPERATION_STREAM;
+  padc->pbuffer = pbuffer;
+  padc->size = size;
+  padc->half = 0;
+  env_host_posix_irq_post(&padc->event_complete, (uint64_t)padc->config.ns_per_scan * (size / 2U / padc->amount_channels));
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_adc_stop(void* pinstance)
+{
+  env_host_posix_adc* padc = (env_host_posix_adc*)pinstance;
+  
+  /* Masked, so a running stream handler cannot rearm the event behind the cancel */
+  env_host_posix_irq_lock();
+  env_host_posix_irq_cancel(&padc->event_complete);
+  padc->operation = 0;
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
@@ -0,0 +1,46 @@
+#ifndef __ENV_HOST_POSIX_ADC__
+#define __ENV_HOST_POSIX_ADC__
+
+#include "env_host_posix.h"
+
+#define ENV_HOST_POSIX_ADC_CHANNELS_MAX                 16U
+#define ENV_HOST_POSIX_ADC_NS_PER_SCAN_DEFAULT          1000U
+
+/* Software model of the analog inputs: the code of channel at scan number
+   index from the start of the conversions, clipped to the resolution */
+typedef uint16_t (*env_host_posix_adc_sample)(void* ppeer, uint8_t channel, uint32_t index);
+
+/* plib_data of jhal_adc_params may point to env_host_posix_adc_config. Without
+   a model the inputs are at the middle of the scale. ns_per_scan is the time of
+   one scan, i.e. the period of the trigger timer or the rate of the free
+   running conversions, ENV_HOST_POSIX_ADC_NS_PER_SCAN_DEFAULT if 0 */
+typedef struct {
+  env_host_posix_adc_sample     pfunc_sample;
+  void*                         ppeer;
+  uint32_t                      ns_per_scan;
+} env_host_posix_adc_config;
+
+typedef struct {
+  env_host_posix_adc_config     config;
+  env_host_posix_irq_event      event_complete;
+  uint8_t                       channels[ENV_HOST_POSIX_ADC_CHANNELS_MAX];
+  uint8_t                       amount_channels;
+  uint16_t                      value_max;
+  uint8_t                       operation;
+  uint8_t                       half;
+  uint16_t*                     pbuffer;
+  uint16_t                      size;
+  uint32_t                      index;
+} env_host_posix_adc;
+
+#define env_host_posix_adc_size_drv_static              sizeof(env_host_posix_adc)
+
+uint32_t env_host_posix_adc_size_drv(void);
+uint8_t env_host_posix_adc_init(void* pinstance, jhal_adc_params* pparams);
+uint8_t env_host_posix_adc_deinit(void* pinstance);
+uint8_t env_host_posix_adc_convert(void* pinstance, uint16_t* pvalues, uint32_t timeout);
+uint8_t env_host_posix_adc_convert_it(void* pinstance, uint16_t* pvalues);
+uint8_t env_host_posix_adc_start_dma(void* pinstance, uint16_t* pbuffer, uint16_t size, void* pinstance_dma);
+uint8_t env_host_posix_adc_stop(void* pinstance);
+
+#endif
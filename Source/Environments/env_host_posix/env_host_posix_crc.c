@@ -0,0 +1,7 @@
+#include "jhal_crc.h"
+#include "env_host_posix_crc.h"
+
+uint32_t env_host_posix_crc_size_drv(void)
+{
+  return env_host_posix_crc_size_drv_static;
+}
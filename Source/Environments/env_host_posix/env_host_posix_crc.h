@@ -0,0 +1,12 @@
+#ifndef __ENV_HOST_POSIX_CRC__
+#define __ENV_HOST_POSIX_CRC__
+
+#include "env_host_posix.h"
+
+/* The host has no CRC unit: init is left to the weak default of jhal_crc and
+   every instance runs the software calculation */
+#define env_host_posix_crc_size_drv_static              sizeof(uint32_t)
+
+uint32_t env_host_posix_crc_size_drv(void);
+
+#endif
@@ -0,0 +1,130 @@
+#include <string.h>
+#include "jhal_dma.h"
+#include "env_host_posix_dma.h"
+
+static uint8_t prv_dma_item_size(jhal_dma_data_size data_size)
+{
+  switch(data_size)
+  {
+    case JHAL_DMA_DATA_SIZE_16BIT:      return 2;
+    case JHAL_DMA_DATA_SIZE_32BIT:      return 4;
+    default:                            return 1;
+  }
+}
+
+static void prv_dma_transfer(env_host_posix_dma* pdma)
+{
+  uint8_t* psrc = (uint8_t*)pdma->srcaddress;
+  uint8_t* pdst = (uint8_t*)pdma->dstaddress;
+  uint8_t size_item = (pdma->src_item_size < pdma->dst_item_size) ? pdma->src_item_size : pdma->dst_item_size;
+  
+  if(pdma->src_increment && pdma->dst_increment && pdma->src_item_size == pdma->dst_item_size)
+  {
+    memcpy(pdst, psrc, (size_t)pdma->size * size_item);
+    return;
+  }
+  
+  for(uint32_t i = 0; i < pdma->size; i++)
+  {
+    memset(pdst, 0, pdma->dst_item_size);
+    memcpy(pdst, psrc, size_item);
+    
+    if(pdma->src_increment)
+      psrc += pdma->src_item_size;
+    if(pdma->dst_increment)
+      pdst += pdma->dst_item_size;
+  }
+}
+
+static void prv_dma_complete_handler(env_host_posix_irq_event* pevent)
+{
+  env_host_posix_dma* pdma = (env_host_posix_dma*)pevent->pcontext;
+  
+  prv_dma_transfer(pdma);
+  jhal_dma_transfer_complete_callback(pdma);
+}
+
+uint32_t env_host_posix_dma_size_drv(void)
+{
+  return env_host_posix_dma_size_drv_static;
+}
+
+uint8_t env_host_posix_dma_init(void* pinstance, jhal_dma_params* pparams)
+{
+  env_host_posix_dma* pdma = (env_host_posix_dma*)pinstance;
+  
+  if(pparams->plib_data != NULL)
+    pdma->config = *((env_host_posix_dma_config*)pparams->plib_data);
+  else
+    memset(&pdma->config, 0, sizeof(pdma->config));
+  
+  pdma->src_item_size = prv_dma_item_size(pparams->source_data_size);
+  pdma->dst_item_size = prv_dma_item_size(pparams->destination_data_size);
+  pdma->src_increment = (pparams->source_increment_type == JHAL_DMA_INCREMENT_TYPE_ENABLE);
+  pdma->dst_increment = (pparams->destination_increment_type == JHAL_DMA_INCREMENT_TYPE_ENABLE);
+  env_host_posix_irq_event_init(&pdma->event_complete, prv_dma_complete_handler, pdma);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_dma_deinit(void* pinstance)
+{
+  env_host_posix_dma* pdma = (env_host_posix_dma*)pinstance;
+  
+  env_host_posix_irq_lock();
+  env_host_posix_irq_cancel(&pdma->event_complete);
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_dma_start(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size)
+{
+  env_host_posix_dma* pdma = (env_host_posix_dma*)pinstance;
+  
+  if(pdma->event_complete.pending)
+    return JHAL_RES_ERROR;
+  
+  pdma->srcaddress = srcaddress;
+  pdma->dstaddress = dstaddress;
+  pdma->size = size;
+  
+  env_host_posix_sleep_ns((uint64_t)pdma->config.ns_per_item * size);
+  prv_dma_transfer(pdma);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_dma_stop(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_dma_start_it(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size)
+{
+  env_host_posix_dma* pdma = (env_host_posix_dma*)pinstance;
+  
+  if(pdma->event_complete.pending)
+    return JHAL_RES_ERROR;
+  
+  pdma->srcaddress = srcaddress;
+  pdma->dstaddress = dstaddress;
+  pdma->size = size;
+  
+  env_host_posix_irq_post(&pdma->event_complete, (uint64_t)pdma->config.ns_per_item * size);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_dma_stop_it(void* pinstance)
+{
+  env_host_posix_dma* pdma = (env_host_posix_dma*)pinstance;
+  
+  env_host_posix_irq_lock();
+  env_host_posix_irq_cancel(&pdma->event_complete);
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
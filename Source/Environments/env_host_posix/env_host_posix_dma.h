@@ -0,0 +1,34 @@
+#ifndef __ENV_HOST_POSIX_DMA__
+#define __ENV_HOST_POSIX_DMA__
+
+#include "env_host_posix.h"
+
+/* plib_data of jhal_dma_params may point to env_host_posix_dma_config to set the
+   time of one data item transfer, by default the transfer is instant */
+typedef struct {
+  uint32_t                      ns_per_item;
+} env_host_posix_dma_config;
+
+typedef struct {
+  env_host_posix_dma_config     config;
+  env_host_posix_irq_event      event_complete;
+  uint8_t                       src_item_size;
+  uint8_t                       dst_item_size;
+  uint8_t                       src_increment;
+  uint8_t                       dst_increment;
+  uintptr_t                     srcaddress;
+  uintptr_t                     dstaddress;
+  uint32_t                      size;
+} env_host_posix_dma;
+
+#define env_host_posix_dma_size_drv_static              sizeof(env_host_posix_dma)
+
+uint32_t env_host_posix_dma_size_drv(void);
+uint8_t env_host_posix_dma_init(void* pinstance, jhal_dma_params* pparams);
+uint8_t env_host_posix_dma_deinit(void* pinstance);
+uint8_t env_host_posix_dma_start(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size);
+uint8_t env_host_posix_dma_stop(void* pinstance);
+uint8_t env_host_posix_dma_start_it(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size);
+uint8_t env_host_posix_dma_stop_it(void* pinstance);
+
+#endif
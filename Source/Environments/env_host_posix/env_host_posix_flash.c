@@ -0,0 +1,346 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <string.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "jhal_flash.h"
+#include "env_host_posix_flash.h"
+
+#define FLASH_OPERATION_ERASE           1U
+#define FLASH_OPERATION_PROGRAM         2U
+
+#define FLASH_ERASED_VALUE              0xFFU
+
+static uint8_t prv_flash_in_range(env_host_posix_flash* pflash, uint32_t address, uint32_t size)
+{
+  return address >= pflash->config.address && size <= pflash->config.size && address - pflash->config.address <= pflash->config.size - size;
+}
+
+/* Without banks every read waits for the operation, with them only the reads
+   that touch the bank of the operation */
+static uint8_t prv_flash_busy(env_host_posix_flash* pflash, uint32_t address, uint32_t size)
+{
+  if(!pflash->operation)
+    return 0;
+  
+  if(!pflash->config.size_bank)
+    return 1;
+  
+  uint32_t bank = (pflash->address - pflash->config.address) / pflash->config.size_bank;
+  uint32_t first = (address - pflash->config.address) / pflash->config.size_bank;
+  uint32_t last = (address - pflash->config.address + size - 1U) / pflash->config.size_bank;
+  
+  return first <= bank && bank <= last;
+}
+
+static uint8_t prv_flash_check_erase(env_host_posix_flash* pflash, uint32_t address)
+{
+  if(!prv_flash_in_range(pflash, address, pflash->config.size_sector) || (address - pflash->config.address) % pflash->config.size_sector)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_flash_check_program(env_host_posix_flash* pflash, uint32_t address, uint16_t size)
+{
+  if(!prv_flash_in_range(pflash, address, size) || (address - pflash->config.address) % pflash->config.program_width || size % pflash->config.program_width)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* Takes the operation under the irq lock, the buffers of the driver start
+   their programming from the completions as well */
+static uint8_t prv_flash_start(env_host_posix_flash* pflash, uint8_t operation, uint32_t address, const uint8_t* pdata, uint16_t size)
+{
+  env_host_posix_irq_lock();
+  
+  if(pflash->operation)
+  {
+    env_host_posix_irq_unlock();
+    return JHAL_RES_BUSY;
+  }
+  
+  pflash->operation = operation;
+  pflash->address = address;
+  pflash->pdata = pdata;
+  pflash->size = size;
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static void prv_flash_erase(env_host_posix_flash* pflash, uint32_t address)
+{
+  memset(pflash->pimage + (address - pflash->config.address), FLASH_ERASED_VALUE, pflash->config.size_sector);
+}
+
+/* The programming only clears bits. Without overwrite the units have to be
+   erased, as the parts with ECC check, and nothing is written otherwise */
+static uint8_t prv_flash_program(env_host_posix_flash* pflash, uint32_t address, const uint8_t* pdata, uint16_t size)
+{
+  uint8_t* pimage = pflash->pimage + (address - pflash->config.address);
+  
+  if(!pflash->config.overwrite)
+  {
+    for(uint16_t i = 0; i < size; i++)
+    {
+      if(pimage[i] != FLASH_ERASED_VALUE)
+        return JHAL_RES_ERROR;
+    }
+  }
+  
+  for(uint16_t i = 0; i < size; i++)
+    pimage[i] &= pdata[i];
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* The callbacks may start the next operation, so it is released before them */
+static void prv_flash_complete_handler(env_host_posix_irq_event* pevent)
+{
+  env_host_posix_flash* pflash = (env_host_posix_flash*)pevent->pcontext;
+  uint8_t operation = pflash->operation;
+  uint32_t address = pflash->address;
+  uint16_t size = pflash->size;
+  
+  /* Deinitialized while the handler was waiting for the irq lock */
+  if(!operation)
+    return;
+  
+  if(operation == FLASH_OPERATION_ERASE)
+  {
+    prv_flash_erase(pflash, address);
+    pflash->operation = 0;
+    jhal_flash_erase_complete_callback(pflash, address);
+    return;
+  }
+  
+  uint8_t res = prv_flash_program(pflash, address, pflash->pdata, size);
+  pflash->operation = 0;
+  
+  if(res == JHAL_RES_NO_ERRORS)
+    jhal_flash_program_complete_callback(pflash, address, size);
+  else
+    jhal_flash_error_callback(pflash, address, JHAL_FLASH_ERROR_PROGRAM);
+}
+
+uint32_t env_host_posix_flash_size_drv(void)
+{
+  return env_host_posix_flash_size_drv_static;
+}
+
+uint8_t env_host_posix_flash_init(void* pinstance, jhal_flash_params* pparams)
+{
+  env_host_posix_flash* pflash = (env_host_posix_flash*)pinstance;
+  
+  if(pparams->plib_data != NULL)
+    pflash->config = *((env_host_posix_flash_config*)pparams->plib_data);
+  else
+    memset(&pflash->config, 0, sizeof(pflash->config));
+  
+  if(!pflash->config.size)
+    pflash->config.size = ENV_HOST_POSIX_FLASH_SIZE_DEFAULT;
+  if(!pflash->config.size_sector)
+    pflash->config.size_sector = ENV_HOST_POSIX_FLASH_SIZE_SECTOR_DEFAULT;
+  if(!pflash->config.program_width)
+    pflash->config.program_width = ENV_HOST_POSIX_FLASH_PROGRAM_WIDTH_DEFAULT;
+  if(!pflash->config.ns_erase)
+    pflash->config.ns_erase = ENV_HOST_POSIX_FLASH_NS_ERASE_DEFAULT;
+  if(!pflash->config.ns_program)
+    pflash->config.ns_program = ENV_HOST_POSIX_FLASH_NS_PROGRAM_DEFAULT;
+  
+  if(pflash->config.size % pflash->config.size_sector || pflash->config.size_sector % pflash->config.program_width)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(pflash->config.size_bank && (pflash->config.size % pflash->config.size_bank || pflash->config.size_bank % pflash->config.size_sector))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  pflash->fd = -1;
+  
+  if(pflash->config.ppath == NULL)
+  {
+    pflash->pimage = (uint8_t*)malloc(pflash->config.size);
+  
+    if(pflash->pimage == NULL)
+      return JHAL_RES_ALLOC_ERROR;
+  
+    memset(pflash->pimage, FLASH_ERASED_VALUE, pflash->config.size);
+  }
+  else
+  {
+    struct stat status;
+  
+    pflash->fd = open(pflash->config.ppath, O_RDWR | O_CREAT, 0644);
+  
+    if(pflash->fd < 0)
+      return JHAL_RES_ERROR;
+  
+    if(fstat(pflash->fd, &status) || (status.st_size < (off_t)pflash->config.size && ftruncate(pflash->fd, pflash->config.size)))
+    {
+      close(pflash->fd);
+      return JHAL_RES_ERROR;
+    }
+  
+    pflash->pimage = (uint8_t*)mmap(NULL, pflash->config.size, PROT_READ | PROT_WRITE, MAP_SHARED, pflash->fd, 0);
+  
+    if(pflash->pimage == MAP_FAILED)
+    {
+      close(pflash->fd);
+      return JHAL_RES_ERROR;
+    }
+  
+    if(status.st_size < (off_t)pflash->config.size)
+      memset(pflash->pimage + status.st_size, FLASH_ERASED_VALUE, pflash->config.size - (uint32_t)status.st_size);
+  }
+  
+  pflash->operation = 0;
+  env_host_posix_irq_event_init(&pflash->event_complete, prv_flash_complete_handler, pflash);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* An operation that runs is dropped, its sector or units keep the old contents */
+uint8_t env_host_posix_flash_deinit(void* pinstance)
+{
+  env_host_posix_flash* pflash = (env_host_posix_flash*)pinstance;
+  
+  env_host_posix_irq_lock();
+  env_host_posix_irq_cancel(&pflash->event_complete);
+  pflash->operation = 0;
+  env_host_posix_irq_unlock();
+  
+  if(pflash->fd < 0)
+    free(pflash->pimage);
+  else
+  {
+    munmap(pflash->pimage, pflash->config.size);
+    close(pflash->fd);
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_flash_get_info(void* pinstance, jhal_flash_info* pinfo)
+{
+  env_host_posix_flash* pflash = (env_host_posix_flash*)pinstance;
+  
+  pinfo->address = pflash->config.address;
+  pinfo->size = pflash->config.size;
+  pinfo->program_width = pflash->config.program_width;
+  pinfo->erased_value = FLASH_ERASED_VALUE;
+  pinfo->read_while_busy = pflash->config.size_bank && pflash->config.size_bank < pflash->config.size;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_flash_get_sector(void* pinstance, uint32_t address, uint32_t* pstart, uint32_t* psize)
+{
+  env_host_posix_flash* pflash = (env_host_posix_flash*)pinstance;
+  
+  if(!prv_flash_in_range(pflash, address, 1))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  *pstart = address - (address - pflash->config.address) % pflash->config.size_sector;
+  *psize = pflash->config.size_sector;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_flash_read(void* pinstance, uint32_t address, uint8_t* pdata, uint16_t size)
+{
+  env_host_posix_flash* pflash = (env_host_posix_flash*)pinstance;
+  
+  if(!prv_flash_in_range(pflash, address, size))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  env_host_posix_irq_lock();
+  
+  if(prv_flash_busy(pflash, address, size))
+  {
+    env_host_posix_irq_unlock();
+    return JHAL_RES_BUSY;
+  }
+  
+  memcpy(pdata, pflash->pimage + (address - pflash->config.address), size);
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* The blocking operations hold the flash for their time without the handler,
+   the timeout is not needed as the time is known */
+uint8_t env_host_posix_flash_erase(void* pinstance, uint32_t address, uint32_t timeout)
+{
+  env_host_posix_flash* pflash = (env_host_posix_flash*)pinstance;
+  (void)timeout;
+  
+  if(prv_flash_check_erase(pflash, address) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(prv_flash_start(pflash, FLASH_OPERATION_ERASE, address, NULL, 0) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_BUSY;
+  
+  env_host_posix_sleep_ns(pflash->config.ns_erase);
+  
+  env_host_posix_irq_lock();
+  prv_flash_erase(pflash, address);
+  pflash->operation = 0;
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_flash_erase_it(void* pinstance, uint32_t address)
+{
+  env_host_posix_flash* pflash = (env_host_posix_flash*)pinstance;
+  
+  if(prv_flash_check_erase(pflash, address) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(prv_flash_start(pflash, FLASH_OPERATION_ERASE, address, NULL, 0) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_BUSY;
+  
+  env_host_posix_irq_post(&pflash->event_complete, pflash->config.ns_erase);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_flash_program(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size, uint32_t timeout)
+{
+  env_host_posix_flash* pflash = (env_host_posix_flash*)pinstance;
+  (void)timeout;
+  
+  if(prv_flash_check_program(pflash, address, size) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(prv_flash_start(pflash, FLASH_OPERATION_PROGRAM, address, pdata, size) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_BUSY;
+  
+  env_host_posix_sleep_ns((uint64_t)pflash->config.ns_program * (size / pflash->config.program_width));
+  
+  env_host_posix_irq_lock();
+  uint8_t res = prv_flash_program(pflash, address, pdata, size);
+  pflash->operation = 0;
+  env_host_posix_irq_unlock();
+  
+  return res;
+}
+
+uint8_t env_host_posix_flash_program_it(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size)
+{
+  env_host_posix_flash* pflash = (env_host_posix_flash*)pinstance;
+  
+  if(prv_flash_check_program(pflash, address, size) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(prv_flash_start(pflash, FLASH_OPERATION_PROGRAM, address, pdata, size) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_BUSY;
+  
+  env_host_posix_irq_post(&pflash->event_complete, (uint64_t)pflash->config.ns_program * (size / pflash->config.program_width));
+  
+  return JHAL_RES_NO_ERRORS;
+}
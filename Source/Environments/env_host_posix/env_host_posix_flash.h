@@ -0,0 +1,58 @@
+#ifndef __ENV_HOST_POSIX_FLASH__
+#define __ENV_HOST_POSIX_FLASH__
+
+#include "env_host_posix.h"
+
+#define ENV_HOST_POSIX_FLASH_SIZE_DEFAULT               0x10000U
+#define ENV_HOST_POSIX_FLASH_SIZE_SECTOR_DEFAULT        0x1000U
+#define ENV_HOST_POSIX_FLASH_PROGRAM_WIDTH_DEFAULT      8U
+#define ENV_HOST_POSIX_FLASH_NS_ERASE_DEFAULT           1000000U
+#define ENV_HOST_POSIX_FLASH_NS_PROGRAM_DEFAULT         10000U
+
+/* plib_data of jhal_flash_params may point to env_host_posix_flash_config, the
+   zero fields take the defaults. The image of the flash is the file at ppath,
+   which keeps the contents between the runs, a new or shorter file is extended
+   with erased bytes. ppath = NULL keeps the image in the memory. The flash
+   takes size bytes from address, the sectors are size_sector bytes.
+   size_bank > 0 splits it into banks that are read while another one is
+   busy. ns_erase is the time of a sector erase, ns_program the time of one
+   program unit of program_width bytes. As on the parts with ECC, programming
+   a unit that is not erased fails, overwrite = 1 lets it clear more bits of
+   the unit instead */
+typedef struct {
+  const char*                   ppath;
+  uint32_t                      address;
+  uint32_t                      size;
+  uint32_t                      size_sector;
+  uint32_t                      size_bank;
+  uint16_t                      program_width;
+  uint8_t                       overwrite;
+  uint32_t                      ns_erase;
+  uint32_t                      ns_program;
+} env_host_posix_flash_config;
+
+typedef struct {
+  env_host_posix_flash_config   config;
+  env_host_posix_irq_event      event_complete;
+  int                           fd;
+  uint8_t*                      pimage;
+  uint8_t                       operation;
+  uint32_t                      address;
+  const uint8_t*                pdata;
+  uint16_t                      size;
+} env_host_posix_flash;
+
+#define env_host_posix_flash_size_drv_static            sizeof(env_host_posix_flash)
+
+uint32_t env_host_posix_flash_size_drv(void);
+uint8_t env_host_posix_flash_init(void* pinstance, jhal_flash_params* pparams);
+uint8_t env_host_posix_flash_deinit(void* pinstance);
+uint8_t env_host_posix_flash_get_info(void* pinstance, jhal_flash_info* pinfo);
+uint8_t env_host_posix_flash_get_sector(void* pinstance, uint32_t address, uint32_t* pstart, uint32_t* psize);
+uint8_t env_host_posix_flash_read(void* pinstance, uint32_t address, uint8_t* pdata, uint16_t size);
+uint8_t env_host_posix_flash_erase(void* pinstance, uint32_t address, uint32_t timeout);
+uint8_t env_host_posix_flash_erase_it(void* pinstance, uint32_t address);
+uint8_t env_host_posix_flash_program(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size, uint32_t timeout);
+uint8_t env_host_posix_flash_program_it(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size);
+
+#endif
@@ -0,0 +1,152 @@
+#include "jhal_gpio.h"
+#include "env_host_posix_gpio.h"
+
+static uint64_t Banks[ENV_HOST_POSIX_GPIO_BANKS] = {0};
+static env_host_posix_gpio* Instances[ENV_HOST_POSIX_GPIO_INSTANCES] = {0};
+
+static void prv_gpio_input_handler(env_host_posix_irq_event* pevent)
+{
+  env_host_posix_gpio* pgpio = (env_host_posix_gpio*)pevent->pcontext;
+  uint64_t pins_changed = pgpio->pins_changed;
+  pgpio->pins_changed = 0;
+  
+  for(uint8_t pin = 0; pins_changed; pin++, pins_changed >>= 1)
+  {
+    if(pins_changed & 1)
+      jhal_gpio_input_callback(pgpio, pin, (Banks[pgpio->num_module - 1] >> pin) & 1);
+  }
+}
+
+uint32_t env_host_posix_gpio_size_drv(void)
+{
+  return env_host_posix_gpio_size_drv_static;
+}
+
+uint8_t env_host_posix_gpio_init(void* pinstance, jhal_gpio_params* pparams)
+{
+  env_host_posix_gpio* pgpio = (env_host_posix_gpio*)pinstance;
+  
+  if(!pparams->num_module || pparams->num_module > ENV_HOST_POSIX_GPIO_BANKS)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint8_t i = 0;
+  for(; i < ENV_HOST_POSIX_GPIO_INSTANCES; i++)
+  {
+    if(Instances[i] == NULL)
+      break;
+  }
+  
+  if(i == ENV_HOST_POSIX_GPIO_INSTANCES)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  pgpio->num_module = pparams->num_module;
+  pgpio->mode = pparams->mode;
+  pgpio->int_type = pparams->int_type;
+  pgpio->pins = pparams->pins;
+  pgpio->pins_changed = 0;
+  env_host_posix_irq_event_init(&pgpio->event_input, prv_gpio_input_handler, pgpio);
+  
+  if(pparams->mode == JHAL_GPIO_MODE_INPUT)
+  {
+    env_host_posix_irq_lock();
+    if(pparams->pull_type == JHAL_GPIO_PULL_TYPE_PULLUP)
+      Banks[pgpio->num_module - 1] |= pgpio->pins;
+    else if(pparams->pull_type == JHAL_GPIO_PULL_TYPE_PULLDOWN)
+      Banks[pgpio->num_module - 1] &= ~pgpio->pins;
+    env_host_posix_irq_unlock();
+  }
+  
+  Instances[i] = pgpio;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_gpio_deinit(void* pinstance)
+{
+  env_host_posix_gpio* pgpio = (env_host_posix_gpio*)pinstance;
+  
+  env_host_posix_irq_lock();
+  env_host_posix_irq_cancel(&pgpio->event_input);
+  
+  for(uint8_t i = 0; i < ENV_HOST_POSIX_GPIO_INSTANCES; i++)
+  {
+    if(Instances[i] == pgpio)
+      Instances[i] = NULL;
+  }
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_gpio_set(void* pinstance, uint64_t pins, uint8_t value)
+{
+  env_host_posix_gpio* pgpio = (env_host_posix_gpio*)pinstance;
+  
+  if(pgpio->mode == JHAL_GPIO_MODE_INPUT || (pins & ~pgpio->pins))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  return env_host_posix_gpio_drive(pgpio->num_module, pins, value);
+}
+
+uint8_t env_host_posix_gpio_get(void* pinstance, uint64_t pins, uint8_t* pvalue)
+{
+  env_host_posix_gpio* pgpio = (env_host_posix_gpio*)pinstance;
+  
+  *pvalue = (Banks[pgpio->num_module - 1] & pins) ? 1 : 0;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* Drives pins of a bank from outside, e.g. by a software model of a device.
+   Input instances configured with interrupts on these pins get their callbacks
+   from the simulated interrupt thread */
+uint8_t env_host_posix_gpio_drive(uint8_t num_module, uint64_t pins, uint8_t value)
+{
+  if(!num_module || num_module > ENV_HOST_POSIX_GPIO_BANKS)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  env_host_posix_irq_lock();
+  
+  uint64_t prev = Banks[num_module - 1];
+  if(value)
+    Banks[num_module - 1] |= pins;
+  else
+    Banks[num_module - 1] &= ~pins;
+  
+  uint64_t changed = prev ^ Banks[num_module - 1];
+  
+  for(uint8_t i = 0; changed && i < ENV_HOST_POSIX_GPIO_INSTANCES; i++)
+  {
+    env_host_posix_gpio* pgpio = Instances[i];
+    if(pgpio == NULL || pgpio->num_module != num_module || pgpio->mode != JHAL_GPIO_MODE_INPUT)
+      continue;
+    
+    uint64_t pins_irq = changed & pgpio->pins;
+    switch(pgpio->int_type)
+    {
+      case JHAL_GPIO_INT_TYPE_RISING_EDGE:
+      case JHAL_GPIO_INT_TYPE_HIGH_LEVEL:
+        pins_irq &= Banks[num_module - 1];
+      break;
+      case JHAL_GPIO_INT_TYPE_FALLING_EDGE:
+      case JHAL_GPIO_INT_TYPE_LOW_LEVEL:
+        pins_irq &= ~Banks[num_module - 1];
+      break;
+      case JHAL_GPIO_INT_TYPE_BOTH_EDGES:
+      break;
+      default:
+        pins_irq = 0;
+      break;
+    }
+    
+    if(pins_irq)
+    {
+      pgpio->pins_changed |= pins_irq;
+      env_host_posix_irq_post(&pgpio->event_input, 0);
+    }
+  }
+  
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
@@ -0,0 +1,28 @@
+#ifndef __ENV_HOST_POSIX_GPIO__
+#define __ENV_HOST_POSIX_GPIO__
+
+#include "env_host_posix.h"
+
+#define ENV_HOST_POSIX_GPIO_BANKS                       11
+#define ENV_HOST_POSIX_GPIO_INSTANCES                   16
+
+typedef struct {
+  uint8_t                       num_module;
+  jhal_gpio_mode                mode;
+  jhal_gpio_int_type            int_type;
+  uint64_t                      pins;
+  env_host_posix_irq_event      event_input;
+  uint64_t                      pins_changed;
+} env_host_posix_gpio;
+
+#define env_host_posix_gpio_size_drv_static             sizeof(env_host_posix_gpio)
+
+uint32_t env_host_posix_gpio_size_drv(void);
+uint8_t env_host_posix_gpio_init(void* pinstance, jhal_gpio_params* pparams);
+uint8_t env_host_posix_gpio_deinit(void* pinstance);
+uint8_t env_host_posix_gpio_set(void* pinstance, uint64_t pins, uint8_t value);
+uint8_t env_host_posix_gpio_get(void* pinstance, uint64_t pins, uint8_t* pvalue);
+
+uint8_t env_host_posix_gpio_drive(uint8_t num_module, uint64_t pins, uint8_t value);
+
+#endif
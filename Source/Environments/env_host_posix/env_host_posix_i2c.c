@@ -0,0 +1,189 @@
+#include <string.h>
+#include "jhal_i2c.h"
+#include "env_host_posix_i2c.h"
+
+static uint8_t prv_i2c_no_device(void* ppeer, uint16_t address, const uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx)
+{
+  (void)ppeer;
+  (void)address;
+  (void)ptxdata;
+  (void)size_tx;
+  (void)prxdata;
+  (void)size_rx;
+  
+  return JHAL_I2C_ERROR_NACK;
+}
+
+/* The address byte goes before each part, the second one after the repeated start */
+static uint64_t prv_i2c_duration_ns(env_host_posix_i2c* pi2c, uint16_t size_tx, uint16_t size_rx)
+{
+  uint32_t amount_bytes = (size_tx ? 1U + size_tx : 0) + (size_rx ? 1U + size_rx : 0);
+  
+  return (uint64_t)pi2c->config.ns_per_byte * amount_bytes;
+}
+
+static void prv_i2c_complete_handler(env_host_posix_irq_event* pevent)
+{
+  env_host_posix_i2c* pi2c = (env_host_posix_i2c*)pevent->pcontext;
+  uint8_t operation = pi2c->operation;
+  
+  /* Aborted while the handler was waiting for the irq lock */
+  if(!operation)
+    return;
+  
+  pi2c->operation = 0;
+  
+  uint8_t error = pi2c->config.pfunc_transfer(pi2c->config.ppeer, pi2c->address, pi2c->ptxdata, pi2c->size_tx, pi2c->prxdata, pi2c->size_rx);
+  
+  if(error != JHAL_RES_NO_ERRORS)
+  {
+    jhal_i2c_error_callback(pi2c, error);
+    return;
+  }
+  
+  switch(operation)
+  {
+    case ENV_HOST_POSIX_OPERATION_TX:
+      jhal_i2c_tx_complete_callback(pi2c);
+    break;
+    case ENV_HOST_POSIX_OPERATION_RX:
+      jhal_i2c_rx_complete_callback(pi2c, pi2c->prxdata, pi2c->size_rx);
+    break;
+    case ENV_HOST_POSIX_OPERATION_TXRX:
+      jhal_i2c_write_read_complete_callback(pi2c, pi2c->prxdata, pi2c->size_rx);
+    break;
+  }
+}
+
+static uint8_t prv_i2c_start(env_host_posix_i2c* pi2c, uint8_t operation, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx)
+{
+  if(pi2c->operation)
+    return JHAL_RES_ERROR;
+  
+  pi2c->operation = operation;
+  pi2c->address = address;
+  pi2c->ptxdata = ptxdata;
+  pi2c->size_tx = size_tx;
+  pi2c->prxdata = prxdata;
+  pi2c->size_rx = size_rx;
+  
+  env_host_posix_irq_post(&pi2c->event_complete, prv_i2c_duration_ns(pi2c, size_tx, size_rx));
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_i2c_transfer(env_host_posix_i2c* pi2c, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx)
+{
+  if(pi2c->operation)
+    return JHAL_RES_ERROR;
+  
+  env_host_posix_sleep_ns(prv_i2c_duration_ns(pi2c, size_tx, size_rx));
+  
+  if(pi2c->config.pfunc_transfer(pi2c->config.ppeer, address, ptxdata, size_tx, prxdata, size_rx) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_ERROR;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint32_t env_host_posix_i2c_size_drv(void)
+{
+  return env_host_posix_i2c_size_drv_static;
+}
+
+uint8_t env_host_posix_i2c_init(void* pinstance, jhal_i2c_params* pparams)
+{
+  env_host_posix_i2c* pi2c = (env_host_posix_i2c*)pinstance;
+  
+  if(pparams->plib_data != NULL)
+    pi2c->config = *((env_host_posix_i2c_config*)pparams->plib_data);
+  else
+    memset(&pi2c->config, 0, sizeof(pi2c->config));
+  
+  if(pi2c->config.pfunc_transfer == NULL)
+    pi2c->config.pfunc_transfer = prv_i2c_no_device;
+  
+  /* 8 data bits and the acknowledge bit */
+  if(!pi2c->config.ns_per_byte && pparams->clock_speed)
+    pi2c->config.ns_per_byte = (uint32_t)(9 * ENV_HOST_POSIX_NS_IN_S / pparams->clock_speed);
+  
+  pi2c->operation = 0;
+  env_host_posix_irq_event_init(&pi2c->event_complete, prv_i2c_complete_handler, pi2c);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_i2c_deinit(void* pinstance)
+{
+  env_host_posix_i2c* pi2c = (env_host_posix_i2c*)pinstance;
+  
+  env_host_posix_irq_lock();
+  env_host_posix_irq_cancel(&pi2c->event_complete);
+  pi2c->operation = 0;
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_i2c_transmit(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+  (void)timeout;
+  return prv_i2c_transfer((env_host_posix_i2c*)pinstance, address, ptxdata, size, NULL, 0);
+}
+
+uint8_t env_host_posix_i2c_receive(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  (void)timeout;
+  return prv_i2c_transfer((env_host_posix_i2c*)pinstance, address, NULL, 0, prxdata, size);
+}
+
+uint8_t env_host_posix_i2c_write_read(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, uint32_t timeout)
+{
+  (void)timeout;
+  return prv_i2c_transfer((env_host_posix_i2c*)pinstance, address, ptxdata, size_tx, prxdata, size_rx);
+}
+
+uint8_t env_host_posix_i2c_transmit_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size)
+{
+  return prv_i2c_start((env_host_posix_i2c*)pinstance, ENV_HOST_POSIX_OPERATION_TX, address, ptxdata, size, NULL, 0);
+}
+
+uint8_t env_host_posix_i2c_receive_it(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size)
+{
+  return prv_i2c_start((env_host_posix_i2c*)pinstance, ENV_HOST_POSIX_OPERATION_RX, address, NULL, 0, prxdata, size);
+}
+
+uint8_t env_host_posix_i2c_write_read_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx)
+{
+  return prv_i2c_start((env_host_posix_i2c*)pinstance, ENV_HOST_POSIX_OPERATION_TXRX, address, ptxdata, size_tx, prxdata, size_rx);
+}
+
+/* There is no bus master on the host, DMA transfers complete the same way as IT ones */
+uint8_t env_host_posix_i2c_transmit_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance_dma;
+  return env_host_posix_i2c_transmit_it(pinstance, address, ptxdata, size);
+}
+
+uint8_t env_host_posix_i2c_receive_dma(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance_dma;
+  return env_host_posix_i2c_receive_it(pinstance, address, prxdata, size);
+}
+
+uint8_t env_host_posix_i2c_write_read_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, void* pinstance_dma)
+{
+  (void)pinstance_dma;
+  return env_host_posix_i2c_write_read_it(pinstance, address, ptxdata, size_tx, prxdata, size_rx);
+}
+
+uint8_t env_host_posix_i2c_abort(void* pinstance)
+{
+  env_host_posix_i2c* pi2c = (env_host_posix_i2c*)pinstance;
+  
+  env_host_posix_irq_lock();
+  env_host_posix_irq_cancel(&pi2c->event_complete);
+  pi2c->operation = 0;
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
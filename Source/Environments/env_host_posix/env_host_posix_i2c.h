@@ -0,0 +1,47 @@
+#ifndef __ENV_HOST_POSIX_I2C__
+#define __ENV_HOST_POSIX_I2C__
+
+#include "env_host_posix.h"
+
+/* Software model of the devices on the bus. One call is one transaction: the
+   address phase, size_tx bytes of ptxdata and, after a repeated start, size_rx
+   bytes to prxdata (size_tx or size_rx may be 0). Returns JHAL_RES_NO_ERRORS or
+   the JHAL_I2C_ERROR_* code of the condition that ended the transaction */
+typedef uint8_t (*env_host_posix_i2c_transfer)(void* ppeer, uint16_t address, const uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx);
+
+/* plib_data of jhal_i2c_params may point to env_host_posix_i2c_config. Without
+   a peer no device answers, ns_per_byte = 0 derives timing from clock_speed */
+typedef struct {
+  env_host_posix_i2c_transfer   pfunc_transfer;
+  void*                         ppeer;
+  uint32_t                      ns_per_byte;
+} env_host_posix_i2c_config;
+
+typedef struct {
+  env_host_posix_i2c_config     config;
+  env_host_posix_irq_event      event_complete;
+  uint8_t                       operation;
+  uint16_t                      address;
+  uint8_t*                      ptxdata;
+  uint16_t                      size_tx;
+  uint8_t*                      prxdata;
+  uint16_t                      size_rx;
+} env_host_posix_i2c;
+
+#define env_host_posix_i2c_size_drv_static              sizeof(env_host_posix_i2c)
+
+uint32_t env_host_posix_i2c_size_drv(void);
+uint8_t env_host_posix_i2c_init(void* pinstance, jhal_i2c_params* pparams);
+uint8_t env_host_posix_i2c_deinit(void* pinstance);
+uint8_t env_host_posix_i2c_transmit(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+uint8_t env_host_posix_i2c_receive(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_host_posix_i2c_write_read(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, uint32_t timeout);
+uint8_t env_host_posix_i2c_transmit_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size);
+uint8_t env_host_posix_i2c_receive_it(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size);
+uint8_t env_host_posix_i2c_write_read_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx);
+uint8_t env_host_posix_i2c_transmit_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_host_posix_i2c_receive_dma(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_host_posix_i2c_write_read_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, void* pinstance_dma);
+uint8_t env_host_posix_i2c_abort(void* pinstance);
+
+#endif
@@ -0,0 +1,176 @@
+#include <string.h>
+#include "jhal_spi.h"
+#include "env_host_posix_spi.h"
+
+static uint8_t prv_spi_loopback(void* ppeer, const uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  (void)ppeer;
+  
+  if(prxdata != NULL)
+  {
+    if(ptxdata != NULL)
+      memcpy(prxdata, ptxdata, size);
+    else
+      memset(prxdata, 0xFF, size);
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static void prv_spi_complete_handler(env_host_posix_irq_event* pevent)
+{
+  env_host_posix_spi* pspi = (env_host_posix_spi*)pevent->pcontext;
+  uint8_t operation = pspi->operation;
+  
+  /* Aborted while the handler was waiting for the irq lock */
+  if(!operation)
+    return;
+  
+  pspi->operation = 0;
+  
+  if(pspi->config.pfunc_exchange(pspi->config.ppeer, pspi->ptxdata, pspi->prxdata, pspi->size) != JHAL_RES_NO_ERRORS)
+  {
+    jhal_spi_error_callback(pspi, JHAL_SPI_ERROR_FRAME);
+    return;
+  }
+  
+  switch(operation)
+  {
+    case ENV_HOST_POSIX_OPERATION_TX:
+      jhal_spi_tx_complete_callback(pspi);
+    break;
+    case ENV_HOST_POSIX_OPERATION_RX:
+      jhal_spi_rx_complete_callback(pspi, pspi->prxdata, pspi->size);
+    break;
+    case ENV_HOST_POSIX_OPERATION_TXRX:
+      jhal_spi_txrx_complete_callback(pspi, pspi->prxdata, pspi->size);
+    break;
+  }
+}
+
+static uint8_t prv_spi_start(env_host_posix_spi* pspi, uint8_t operation, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  if(pspi->operation)
+    return JHAL_RES_ERROR;
+  
+  pspi->operation = operation;
+  pspi->ptxdata = ptxdata;
+  pspi->prxdata = prxdata;
+  pspi->size = size;
+  
+  env_host_posix_irq_post(&pspi->event_complete, (uint64_t)pspi->config.ns_per_byte * size);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_spi_exchange(env_host_posix_spi* pspi, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  if(pspi->operation)
+    return JHAL_RES_ERROR;
+  
+  env_host_posix_sleep_ns((uint64_t)pspi->config.ns_per_byte * size);
+  
+  return pspi->config.pfunc_exchange(pspi->config.ppeer, ptxdata, prxdata, size);
+}
+
+uint32_t env_host_posix_spi_size_drv(void)
+{
+  return env_host_posix_spi_size_drv_static;
+}
+
+uint8_t env_host_posix_spi_init(void* pinstance, jhal_spi_params* pparams)
+{
+  env_host_posix_spi* pspi = (env_host_posix_spi*)pinstance;
+  
+  if(pparams->plib_data != NULL)
+    pspi->config = *((env_host_posix_bus_config*)pparams->plib_data);
+  else
+    memset(&pspi->config, 0, sizeof(pspi->config));
+  
+  if(pspi->config.pfunc_exchange == NULL)
+    pspi->config.pfunc_exchange = prv_spi_loopback;
+  
+  if(!pspi->config.ns_per_byte && pparams->baudrate)
+    pspi->config.ns_per_byte = (uint32_t)(8 * ENV_HOST_POSIX_NS_IN_S / pparams->baudrate);
+  
+  pspi->operation = 0;
+  env_host_posix_irq_event_init(&pspi->event_complete, prv_spi_complete_handler, pspi);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_spi_deinit(void* pinstance)
+{
+  env_host_posix_spi* pspi = (env_host_posix_spi*)pinstance;
+  
+  env_host_posix_irq_lock();
+  env_host_posix_irq_cancel(&pspi->event_complete);
+  pspi->operation = 0;
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+  (void)timeout;
+  return prv_spi_exchange((env_host_posix_spi*)pinstance, ptxdata, NULL, size);
+}
+
+uint8_t env_host_posix_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  (void)timeout;
+  return prv_spi_exchange((env_host_posix_spi*)pinstance, NULL, prxdata, size);
+}
+
+uint8_t env_host_posix_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  (void)timeout;
+  return prv_spi_exchange((env_host_posix_spi*)pinstance, ptxdata, prxdata, size);
+}
+
+uint8_t env_host_posix_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size)
+{
+  return prv_spi_start((env_host_posix_spi*)pinstance, ENV_HOST_POSIX_OPERATION_TX, ptxdata, NULL, size);
+}
+
+uint8_t env_host_posix_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+  return prv_spi_start((env_host_posix_spi*)pinstance, ENV_HOST_POSIX_OPERATION_RX, NULL, prxdata, size);
+}
+
+uint8_t env_host_posix_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  return prv_spi_start((env_host_posix_spi*)pinstance, ENV_HOST_POSIX_OPERATION_TXRX, ptxdata, prxdata, size);
+}
+
+/* There is no bus master on the host, DMA transfers complete the same way as IT ones */
+uint8_t env_host_posix_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance_dma;
+  return env_host_posix_spi_transmit_it(pinstance, ptxdata, size);
+}
+
+uint8_t env_host_posix_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance_dma;
+  return env_host_posix_spi_receive_it(pinstance, prxdata, size);
+}
+
+uint8_t env_host_posix_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance_dma;
+  return env_host_posix_spi_transmitreceive_it(pinstance, ptxdata, prxdata, size);
+}
+
+uint8_t env_host_posix_spi_abort(void* pinstance)
+{
+  env_host_posix_spi* pspi = (env_host_posix_spi*)pinstance;
+  
+  env_host_posix_irq_lock();
+  env_host_posix_irq_cancel(&pspi->event_complete);
+  pspi->operation = 0;
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
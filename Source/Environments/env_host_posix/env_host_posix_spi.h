@@ -0,0 +1,33 @@
+#ifndef __ENV_HOST_POSIX_SPI__
+#define __ENV_HOST_POSIX_SPI__
+
+#include "env_host_posix.h"
+
+/* plib_data of jhal_spi_params may point to env_host_posix_bus_config. Without
+   a peer MOSI is looped back to MISO, ns_per_byte = 0 derives timing from baudrate */
+typedef struct {
+  env_host_posix_bus_config     config;
+  env_host_posix_irq_event      event_complete;
+  uint8_t                       operation;
+  uint8_t*                      ptxdata;
+  uint8_t*                      prxdata;
+  uint16_t                      size;
+} env_host_posix_spi;
+
+#define env_host_posix_spi_size_drv_static              sizeof(env_host_posix_spi)
+
+uint32_t env_host_posix_spi_size_drv(void);
+uint8_t env_host_posix_spi_init(void* pinstance, jhal_spi_params* pparams);
+uint8_t env_host_posix_spi_deinit(void* pinstance);
+uint8_t env_host_posix_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+uint8_t env_host_posix_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_host_posix_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_host_posix_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size);
+uint8_t env_host_posix_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size);
+uint8_t env_host_posix_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
+uint8_t env_host_posix_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_host_posix_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_host_posix_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_host_posix_spi_abort(void* pinstance);
+
+#endif
@@ -0,0 +1,48 @@
+#include "jhal_tick.h"
+#include "env_host_posix_tick.h"
+
+uint32_t env_host_posix_tick_init(void)
+{
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint32_t env_host_posix_tick(uint32_t delay)
+{
+  /* Spin like the DWT based wait on target, a sleep would add scheduler latency */
+  uint64_t deadline_ns = env_host_posix_time_ns() + delay * ENV_HOST_POSIX_NS_IN_US;
+  while(env_host_posix_time_ns() < deadline_ns);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* Nanoseconds stand in for core cycles, the trace dump is made with 1 GHz */
+uint32_t env_host_posix_tick_cycles(void)
+{
+  return (uint32_t)env_host_posix_time_ns();
+}
+
+/* The clock is 64 bits wide already, so the time base never depends on a
+   read per wrap of the 32-bit counter */
+uint64_t env_host_posix_tick_cycles64(void)
+{
+  return env_host_posix_time_ns();
+}
+
+uint32_t env_host_posix_tick_cycles_hz(void)
+{
+  return (uint32_t)ENV_HOST_POSIX_NS_IN_S;
+}
+
+/* Masks the simulated interrupts, the irq lock is recursive so sections nest */
+uint32_t env_host_posix_critical_enter(void)
+{
+  env_host_posix_irq_lock();
+  
+  return 0;
+}
+
+void env_host_posix_critical_exit(uint32_t state)
+{
+  (void)state;
+  env_host_posix_irq_unlock();
+}
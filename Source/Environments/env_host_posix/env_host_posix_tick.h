@@ -0,0 +1,14 @@
+#ifndef __ENV_HOST_POSIX_TICK__
+#define __ENV_HOST_POSIX_TICK__
+
+#include "env_host_posix.h"
+
+uint32_t env_host_posix_tick_init(void);
+uint32_t env_host_posix_tick(uint32_t delay);
+uint32_t env_host_posix_tick_cycles(void);
+uint64_t env_host_posix_tick_cycles64(void);
+uint32_t env_host_posix_tick_cycles_hz(void);
+uint32_t env_host_posix_critical_enter(void);
+void env_host_posix_critical_exit(uint32_t state);
+
+#endif
@@ -0,0 +1,102 @@
+#include "jhal_tim_base.h"
+#include "env_host_posix_tim_base.h"
+
+static void prv_tim_base_period_handler(env_host_posix_irq_event* pevent)
+{
+  env_host_posix_tim_base* ptim = (env_host_posix_tim_base*)pevent->pcontext;
+  
+  /* Rearm from the ideal due time so the period does not drift with handler latency */
+  uint64_t next_ns = pevent->due_ns + ptim->period_ns;
+  uint64_t now_ns = env_host_posix_time_ns();
+  env_host_posix_irq_post(&ptim->event_period, (next_ns > now_ns) ? next_ns - now_ns : 0);
+  
+  jhal_tim_base_period_ellapsed_callback(ptim);
+}
+
+uint32_t env_host_posix_tim_base_size_drv(void)
+{
+  return env_host_posix_tim_base_size_drv_static;
+}
+
+uint8_t env_host_posix_tim_base_init(void* pinstance, jhal_tim_base_params* pparams)
+{
+  env_host_posix_tim_base* ptim = (env_host_posix_tim_base*)pinstance;
+  
+  uint32_t clock_hz = ENV_HOST_POSIX_TIM_BASE_CLOCK_DEFAULT;
+  if(pparams->plib_data != NULL && ((env_host_posix_tim_base_config*)pparams->plib_data)->clock_hz)
+    clock_hz = ((env_host_posix_tim_base_config*)pparams->plib_data)->clock_hz;
+  
+  ptim->period_ns = ((uint64_t)pparams->prescaler + 1) * ((uint64_t)pparams->period + 1) * ENV_HOST_POSIX_NS_IN_S / clock_hz;
+  if(!ptim->period_ns)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  ptim->running = 0;
+  env_host_posix_irq_event_init(&ptim->event_period, prv_tim_base_period_handler, ptim);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_tim_base_deinit(void* pinstance)
+{
+  return env_host_posix_tim_base_stop_it(pinstance);
+}
+
+uint8_t env_host_posix_tim_base_start(void* pinstance)
+{
+  env_host_posix_tim_base* ptim = (env_host_posix_tim_base*)pinstance;
+  
+  ptim->start_ns = env_host_posix_time_ns();
+  ptim->running = 1;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_tim_base_stop(void* pinstance)
+{
+  env_host_posix_tim_base* ptim = (env_host_posix_tim_base*)pinstance;
+  
+  ptim->running = 0;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_tim_base_start_it(void* pinstance)
+{
+  env_host_posix_tim_base* ptim = (env_host_posix_tim_base*)pinstance;
+  
+  env_host_posix_tim_base_start(pinstance);
+  env_host_posix_irq_post(&ptim->event_period, ptim->period_ns);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_tim_base_stop_it(void* pinstance)
+{
+  env_host_posix_tim_base* ptim = (env_host_posix_tim_base*)pinstance;
+  
+  /* Masked, so a running period handler cannot rearm the event behind the cancel */
+  env_host_posix_irq_lock();
+  env_host_posix_irq_cancel(&ptim->event_period);
+  env_host_posix_irq_unlock();
+  
+  return env_host_posix_tim_base_stop(pinstance);
+}
+
+/* The simulated timer has no update request line to a DMA channel */
+uint8_t env_host_posix_tim_base_start_dma(void* pinstance, uint8_t* pdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)pdata;
+  (void)size;
+  (void)pinstance_dma;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+uint8_t env_host_posix_tim_base_stop_dma(void* pinstance, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)pinstance_dma;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
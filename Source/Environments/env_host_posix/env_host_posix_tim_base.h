@@ -0,0 +1,33 @@
+#ifndef __ENV_HOST_POSIX_TIM_BASE__
+#define __ENV_HOST_POSIX_TIM_BASE__
+
+#include "env_host_posix.h"
+
+#define ENV_HOST_POSIX_TIM_BASE_CLOCK_DEFAULT           1000000U
+
+/* plib_data of jhal_tim_base_params may point to env_host_posix_tim_base_config
+   to set the timer input clock, ENV_HOST_POSIX_TIM_BASE_CLOCK_DEFAULT otherwise */
+typedef struct {
+  uint32_t                      clock_hz;
+} env_host_posix_tim_base_config;
+
+typedef struct {
+  env_host_posix_irq_event      event_period;
+  uint64_t                      period_ns;
+  uint64_t                      start_ns;
+  uint8_t                       running;
+} env_host_posix_tim_base;
+
+#define env_host_posix_tim_base_size_drv_static         sizeof(env_host_posix_tim_base)
+
+uint32_t env_host_posix_tim_base_size_drv(void);
+uint8_t env_host_posix_tim_base_init(void* pinstance, jhal_tim_base_params* pparams);
+uint8_t env_host_posix_tim_base_deinit(void* pinstance);
+uint8_t env_host_posix_tim_base_start(void* pinstance);
+uint8_t env_host_posix_tim_base_stop(void* pinstance);
+uint8_t env_host_posix_tim_base_start_it(void* pinstance);
+uint8_t env_host_posix_tim_base_stop_it(void* pinstance);
+uint8_t env_host_posix_tim_base_start_dma(void* pinstance, uint8_t* pdata, uint16_t size, void* pinstance_dma);
+uint8_t env_host_posix_tim_base_stop_dma(void* pinstance, void* pinstance_dma);
+
+#endif
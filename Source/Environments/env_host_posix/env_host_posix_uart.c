@@ -0,0 +1,332 @@
+#include <string.h>
+#include "jhal_uart.h"
+#include "env_host_posix_uart.h"
+
+static uint32_t prv_uart_baudrate(jhal_uart_baudrate baudrate)
+{
+  switch(baudrate)
+  {
+    case JHAL_UART_BAUDRATE_300:        return 300;
+    case JHAL_UART_BAUDRATE_600:        return 600;
+    case JHAL_UART_BAUDRATE_1200:       return 1200;
+    case JHAL_UART_BAUDRATE_2400:       return 2400;
+    case JHAL_UART_BAUDRATE_4800:       return 4800;
+    case JHAL_UART_BAUDRATE_9600:       return 9600;
+    case JHAL_UART_BAUDRATE_19200:      return 19200;
+    case JHAL_UART_BAUDRATE_38400:      return 38400;
+    case JHAL_UART_BAUDRATE_57600:      return 57600;
+    case JHAL_UART_BAUDRATE_115200:     return 115200;
+    case JHAL_UART_BAUDRATE_230400:     return 230400;
+    case JHAL_UART_BAUDRATE_460800:     return 460800;
+    case JHAL_UART_BAUDRATE_921600:     return 921600;
+    default:                            return 0;
+  }
+}
+
+static uint32_t prv_uart_frame_bits(jhal_uart_params* pparams)
+{
+  uint32_t frame_bits = 1;
+  
+  switch(pparams->data_size)
+  {
+    case JHAL_UART_DATA_SIZE_5BIT: frame_bits += 5; break;
+    case JHAL_UART_DATA_SIZE_6BIT: frame_bits += 6; break;
+    case JHAL_UART_DATA_SIZE_7BIT: frame_bits += 7; break;
+    case JHAL_UART_DATA_SIZE_9BIT: frame_bits += 9; break;
+    default:                       frame_bits += 8; break;
+  }
+  
+  if(pparams->parity != JHAL_UART_PARITY_NONE)
+    frame_bits++;
+  
+  frame_bits += (pparams->stop_bits == JHAL_UART_STOP_BITS_1BIT) ? 1 : 2;
+  
+  return frame_bits;
+}
+
+static uint8_t prv_uart_loopback(void* ppeer, const uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  env_host_posix_uart* puart = (env_host_posix_uart*)ppeer;
+  uint8_t res = JHAL_RES_NO_ERRORS;
+  
+  env_host_posix_irq_lock();
+  if(ptxdata != NULL)
+  {
+    for(uint16_t i = 0; i < size && puart->loopback_count < ENV_HOST_POSIX_UART_LOOPBACK_SIZE; i++)
+      puart->loopback[(puart->loopback_head + puart->loopback_count++) % ENV_HOST_POSIX_UART_LOOPBACK_SIZE] = ptxdata[i];
+  }
+  
+  if(prxdata != NULL)
+  {
+    if(puart->loopback_count < size)
+      res = JHAL_RES_TIMEOUT;
+    else
+    {
+      for(uint16_t i = 0; i < size; i++)
+      {
+        prxdata[i] = puart->loopback[puart->loopback_head];
+        puart->loopback_head = (puart->loopback_head + 1) % ENV_HOST_POSIX_UART_LOOPBACK_SIZE;
+      }
+      puart->loopback_count -= size;
+    }
+  }
+  env_host_posix_irq_unlock();
+  
+  return res;
+}
+
+static uint64_t prv_uart_poll_ns(env_host_posix_uart* puart)
+{
+  return puart->config.ns_per_byte ? puart->config.ns_per_byte : ENV_HOST_POSIX_NS_IN_US;
+}
+
+/* An error ends both sides like on the hardware envs */
+static void prv_uart_failed(env_host_posix_uart* puart)
+{
+  env_host_posix_irq_cancel(&puart->event_tx);
+  env_host_posix_irq_cancel(&puart->event_rx);
+  puart->operation_tx = 0;
+  puart->operation_rx = 0;
+  
+  jhal_uart_error_callback(puart, JHAL_UART_ERROR_FRAMING);
+}
+
+static void prv_uart_rx_handler(env_host_posix_irq_event* pevent)
+{
+  env_host_posix_uart* puart = (env_host_posix_uart*)pevent->pcontext;
+  
+  if(!puart->operation_rx)
+    return;
+  
+  /* The line stays idle until the peer has enough data, keep polling it byte by byte */
+  uint8_t res = puart->config.pfunc_exchange(puart->config.ppeer, NULL, puart->prxdata, puart->size_rx);
+  
+  if(res == JHAL_RES_TIMEOUT)
+  {
+    env_host_posix_irq_post(&puart->event_rx, prv_uart_poll_ns(puart));
+    return;
+  }
+  
+  uint8_t operation = puart->operation_rx;
+  puart->operation_rx = 0;
+  
+  if(res != JHAL_RES_NO_ERRORS)
+  {
+    prv_uart_failed(puart);
+    return;
+  }
+  
+  if(operation == ENV_HOST_POSIX_OPERATION_TXRX)
+    jhal_uart_txrx_complete_callback(puart, puart->prxdata, puart->size_rx);
+  else
+    jhal_uart_rx_complete_callback(puart, puart->prxdata, puart->size_rx);
+}
+
+static void prv_uart_tx_handler(env_host_posix_irq_event* pevent)
+{
+  env_host_posix_uart* puart = (env_host_posix_uart*)pevent->pcontext;
+  uint8_t operation = puart->operation_tx;
+  
+  if(!operation)
+    return;
+  
+  puart->operation_tx = 0;
+  
+  if(puart->config.pfunc_exchange(puart->config.ppeer, puart->ptxdata, NULL, puart->size_tx) != JHAL_RES_NO_ERRORS)
+  {
+    prv_uart_failed(puart);
+    return;
+  }
+  
+  if(operation == ENV_HOST_POSIX_OPERATION_TXRX)
+    env_host_posix_irq_post(&puart->event_rx, (uint64_t)puart->config.ns_per_byte * puart->size_rx);
+  else
+    jhal_uart_tx_complete_callback(puart);
+}
+
+static uint8_t prv_uart_start(env_host_posix_uart* puart, uint8_t operation, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  if((ptxdata && puart->operation_tx) || (prxdata && puart->operation_rx))
+    return JHAL_RES_ERROR;
+  
+  if(prxdata != NULL)
+  {
+    puart->operation_rx = operation;
+    puart->prxdata = prxdata;
+    puart->size_rx = size;
+  }
+  
+  if(ptxdata != NULL)
+  {
+    puart->operation_tx = operation;
+    puart->ptxdata = ptxdata;
+    puart->size_tx = size;
+    env_host_posix_irq_post(&puart->event_tx, (uint64_t)puart->config.ns_per_byte * size);
+  } else
+    env_host_posix_irq_post(&puart->event_rx, (uint64_t)puart->config.ns_per_byte * size);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint32_t env_host_posix_uart_size_drv(void)
+{
+  return env_host_posix_uart_size_drv_static;
+}
+
+uint8_t env_host_posix_uart_init(void* pinstance, jhal_uart_params* pparams)
+{
+  env_host_posix_uart* puart = (env_host_posix_uart*)pinstance;
+  
+  if(pparams->plib_data != NULL)
+    puart->config = *((env_host_posix_bus_config*)pparams->plib_data);
+  else
+    memset(&puart->config, 0, sizeof(puart->config));
+  
+  if(puart->config.pfunc_exchange == NULL)
+  {
+    puart->config.pfunc_exchange = prv_uart_loopback;
+    puart->config.ppeer = puart;
+  }
+  
+  uint32_t baudrate = prv_uart_baudrate(pparams->baudrate);
+  if(!baudrate)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  puart->frame_bits = prv_uart_frame_bits(pparams);
+  puart->timing_by_baudrate = !puart->config.ns_per_byte;
+  
+  if(puart->timing_by_baudrate)
+    puart->config.ns_per_byte = (uint32_t)(puart->frame_bits * ENV_HOST_POSIX_NS_IN_S / baudrate);
+  
+  puart->operation_tx = 0;
+  puart->operation_rx = 0;
+  puart->loopback_head = 0;
+  puart->loopback_count = 0;
+  env_host_posix_irq_event_init(&puart->event_tx, prv_uart_tx_handler, puart);
+  env_host_posix_irq_event_init(&puart->event_rx, prv_uart_rx_handler, puart);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_uart_deinit(void* pinstance)
+{
+  env_host_posix_uart* puart = (env_host_posix_uart*)pinstance;
+  
+  env_host_posix_irq_lock();
+  env_host_posix_irq_cancel(&puart->event_tx);
+  env_host_posix_irq_cancel(&puart->event_rx);
+  puart->operation_tx = 0;
+  puart->operation_rx = 0;
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_uart_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+  env_host_posix_uart* puart = (env_host_posix_uart*)pinstance;
+  (void)timeout;
+  
+  if(puart->operation_tx)
+    return JHAL_RES_ERROR;
+  
+  env_host_posix_sleep_ns((uint64_t)puart->config.ns_per_byte * size);
+  
+  return puart->config.pfunc_exchange(puart->config.ppeer, ptxdata, NULL, size);
+}
+
+uint8_t env_host_posix_uart_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  env_host_posix_uart* puart = (env_host_posix_uart*)pinstance;
+  
+  if(puart->operation_rx)
+    return JHAL_RES_ERROR;
+  
+  uint64_t deadline_ns = env_host_posix_time_ns() + timeout * ENV_HOST_POSIX_NS_IN_MS;
+  
+  env_host_posix_sleep_ns((uint64_t)puart->config.ns_per_byte * size);
+  while(puart->config.pfunc_exchange(puart->config.ppeer, NULL, prxdata, size) != JHAL_RES_NO_ERRORS)
+  {
+    if(env_host_posix_time_ns() >= deadline_ns)
+      return JHAL_RES_TIMEOUT;
+    
+    env_host_posix_sleep_ns(prv_uart_poll_ns(puart));
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_host_posix_uart_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  uint8_t res = env_host_posix_uart_transmit(pinstance, ptxdata, size, timeout);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  return env_host_posix_uart_receive(pinstance, prxdata, size, timeout);
+}
+
+uint8_t env_host_posix_uart_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size)
+{
+  return prv_uart_start((env_host_posix_uart*)pinstance, ENV_HOST_POSIX_OPERATION_TX, ptxdata, NULL, size);
+}
+
+uint8_t env_host_posix_uart_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+  return prv_uart_start((env_host_posix_uart*)pinstance, ENV_HOST_POSIX_OPERATION_RX, NULL, prxdata, size);
+}
+
+uint8_t env_host_posix_uart_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  return prv_uart_start((env_host_posix_uart*)pinstance, ENV_HOST_POSIX_OPERATION_TXRX, ptxdata, prxdata, size);
+}
+
+/* There is no bus master on the host, DMA transfers complete the same way as IT ones */
+uint8_t env_host_posix_uart_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance_dma;
+  return env_host_posix_uart_transmit_it(pinstance, ptxdata, size);
+}
+
+uint8_t env_host_posix_uart_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance_dma;
+  return env_host_posix_uart_receive_it(pinstance, prxdata, size);
+}
+
+uint8_t env_host_posix_uart_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance_dma;
+  return env_host_posix_uart_transmitreceive_it(pinstance, ptxdata, prxdata, size);
+}
+
+uint8_t env_host_posix_uart_abort(void* pinstance)
+{
+  env_host_posix_uart* puart = (env_host_posix_uart*)pinstance;
+  
+  env_host_posix_irq_lock();
+  env_host_posix_irq_cancel(&puart->event_tx);
+  env_host_posix_irq_cancel(&puart->event_rx);
+  puart->operation_tx = 0;
+  puart->operation_rx = 0;
+  env_host_posix_irq_unlock();
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* A fixed ns_per_byte of the config stays as it is */
+uint8_t env_host_posix_uart_set_baudrate(void* pinstance, jhal_uart_baudrate baudrate)
+{
+  env_host_posix_uart* puart = (env_host_posix_uart*)pinstance;
+  uint32_t value = prv_uart_baudrate(baudrate);
+  
+  if(!value)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(puart->operation_tx || puart->operation_rx)
+    return JHAL_RES_ERROR;
+  
+  if(puart->timing_by_baudrate)
+    puart->config.ns_per_byte = (uint32_t)(puart->frame_bits * ENV_HOST_POSIX_NS_IN_S / value);
+  
+  return JHAL_RES_NO_ERRORS;
+}
@@ -0,0 +1,45 @@
+#ifndef __ENV_HOST_POSIX_UART__
+#define __ENV_HOST_POSIX_UART__
+
+#include "env_host_posix.h"
+
+#define ENV_HOST_POSIX_UART_LOOPBACK_SIZE               256
+
+/* plib_data of jhal_uart_params may point to env_host_posix_bus_config. Without
+   a peer TX is looped back to RX through a FIFO, ns_per_byte = 0 derives timing
+   from baudrate and frame format. Timeouts of blocking calls are in milliseconds */
+typedef struct {
+  env_host_posix_bus_config     config;
+  env_host_posix_irq_event      event_tx;
+  env_host_posix_irq_event      event_rx;
+  uint8_t                       operation_tx;
+  uint8_t                       operation_rx;
+  uint8_t*                      ptxdata;
+  uint8_t*                      prxdata;
+  uint16_t                      size_tx;
+  uint16_t                      size_rx;
+  uint8_t                       loopback[ENV_HOST_POSIX_UART_LOOPBACK_SIZE];
+  uint16_t                      loopback_head;
+  uint16_t                      loopback_count;
+  uint32_t                      frame_bits;
+  uint8_t                       timing_by_baudrate;
+} env_host_posix_uart;
+
+#define env_host_posix_uart_size_drv_static             sizeof(env_host_posix_uart)
+
+uint32_t env_host_posix_uart_size_drv(void);
+uint8_t env_host_posix_uart_init(void* pinstance, jhal_uart_params* pparams);
+uint8_t env_host_posix_uart_deinit(void* pinstance);
+uint8_t env_host_posix_uart_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+uint8_t env_host_posix_uart_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_host_posix_uart_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_host_posix_uart_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size);
+uint8_t env_host_posix_uart_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size);
+uint8_t env_host_posix_uart_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
+uint8_t env_host_posix_uart_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_host_posix_uart_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_host_posix_uart_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_host_posix_uart_abort(void* pinstance);
+uint8_t env_host_posix_uart_set_baudrate(void* pinstance, jhal_uart_baudrate baudrate);
+
+#endif
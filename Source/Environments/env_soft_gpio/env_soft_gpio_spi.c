@@ -0,0 +1,247 @@
+#include "jhal_gpio.h"
+#include "jhal_spi.h"
+#include "jhal_tick.h"
+#include "env_soft_gpio_spi.h"
+
+#define SOFT_GPIO_SCK                   0
+#define SOFT_GPIO_MOSI                  1
+#define SOFT_GPIO_MISO                  2
+
+static uint8_t prv_gpio_line_init(void** ppgpio, uint64_t* pmem, env_soft_gpio_line* pline, jhal_gpio_mode mode, uint8_t value)
+{
+  jhal_gpio_params gpio_params = {0};
+  
+  gpio_params.num_module = pline->num_module;
+  gpio_params.mode = mode;
+  gpio_params.int_type = JHAL_GPIO_INT_TYPE_NOT_SET;
+  gpio_params.pull_type = JHAL_GPIO_PULL_TYPE_NOT_PULL;
+  gpio_params.pins = pline->pin;
+  
+  *ppgpio = NULL;
+  uint8_t res = jhal_gpio_init_static(ppgpio, &gpio_params, pmem, JHAL_GPIO_SIZE_STATIC);
+  
+  if(res == JHAL_RES_NO_ERRORS && mode != JHAL_GPIO_MODE_INPUT)
+    res = jhal_gpio_set(*ppgpio, pline->pin, value);
+  
+  return res;
+}
+
+static void prv_spi_delay(env_soft_gpio_spi* pspi)
+{
+  if(pspi->half_period_us)
+    jhal_tick(pspi->half_period_us);
+}
+
+/* CPHA = 0: data is put before the leading edge and sampled on it,
+   CPHA = 1: data is put on the leading edge and sampled on the trailing one */
+static uint8_t prv_spi_transfer_byte(env_soft_gpio_spi* pspi, uint8_t txbyte)
+{
+  uint8_t rxbyte = 0;
+  uint8_t bit = 0;
+  
+  for(uint8_t i = 0; i < 8; i++)
+  {
+    uint8_t shift = pspi->lsb_first ? i : 7 - i;
+    
+    if(!pspi->cpha && pspi->pgpio_mosi)
+      jhal_gpio_set(pspi->pgpio_mosi, pspi->pin_mosi, (txbyte >> shift) & 0x1);
+    
+    prv_spi_delay(pspi);
+    jhal_gpio_set(pspi->pgpio_sck, pspi->pin_sck, !pspi->idle_sck);
+    
+    if(pspi->cpha && pspi->pgpio_mosi)
+      jhal_gpio_set(pspi->pgpio_mosi, pspi->pin_mosi, (txbyte >> shift) & 0x1);
+    else if(!pspi->cpha && pspi->pgpio_miso)
+      jhal_gpio_get(pspi->pgpio_miso, pspi->pin_miso, &bit);
+    
+    prv_spi_delay(pspi);
+    jhal_gpio_set(pspi->pgpio_sck, pspi->pin_sck, pspi->idle_sck);
+    
+    if(pspi->cpha && pspi->pgpio_miso)
+      jhal_gpio_get(pspi->pgpio_miso, pspi->pin_miso, &bit);
+    
+    rxbyte |= (uint8_t)(bit << shift);
+  }
+  
+  return rxbyte;
+}
+
+static void prv_spi_exchange(env_soft_gpio_spi* pspi, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  for(uint16_t i = 0; i < size; i++)
+  {
+    uint8_t rxbyte = prv_spi_transfer_byte(pspi, ptxdata ? ptxdata[i] : 0xFF);
+    
+    if(prxdata)
+      prxdata[i] = rxbyte;
+  }
+}
+
+uint32_t env_soft_gpio_spi_size_drv(void)
+{
+  return env_soft_gpio_spi_size_drv_static;
+}
+
+uint8_t env_soft_gpio_spi_init(void* pinstance, jhal_spi_params* pparams)
+{
+  env_soft_gpio_spi* pspi = (env_soft_gpio_spi*)pinstance;
+  env_soft_gpio_spi_config* pconfig = (env_soft_gpio_spi_config*)pparams->plib_data;
+  
+  if(!pconfig || !pconfig->sck.pin)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(pparams->mode != JHAL_SPI_MODE_MASTER || pparams->data_size != JHAL_SPI_DATA_SIZE_8BIT)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  pspi->pgpio_sck = NULL;
+  pspi->pgpio_mosi = NULL;
+  pspi->pgpio_miso = NULL;
+  pspi->pin_sck = pconfig->sck.pin;
+  pspi->pin_mosi = pconfig->mosi.pin;
+  pspi->pin_miso = pconfig->miso.pin;
+  pspi->idle_sck = (pparams->cpol == JHAL_SPI_CPOL_HIGH) ? 1 : 0;
+  pspi->cpha = (pparams->cpha == JHAL_SPI_CPHA_HIGH) ? 1 : 0;
+  pspi->lsb_first = (pparams->first_bit == JHAL_SPI_FIRST_BIT_LSB) ? 1 : 0;
+  pspi->half_period_us = pparams->baudrate ? 500000U / pparams->baudrate : 0;
+  
+  uint8_t res = prv_gpio_line_init(&pspi->pgpio_sck, pspi->mem_gpio[SOFT_GPIO_SCK], &pconfig->sck, JHAL_GPIO_MODE_OUTPUT, pspi->idle_sck);
+  
+  if(res == JHAL_RES_NO_ERRORS && pconfig->mosi.pin)
+    res = prv_gpio_line_init(&pspi->pgpio_mosi, pspi->mem_gpio[SOFT_GPIO_MOSI], &pconfig->mosi, JHAL_GPIO_MODE_OUTPUT, 1);
+  
+  if(res == JHAL_RES_NO_ERRORS && pconfig->miso.pin)
+    res = prv_gpio_line_init(&pspi->pgpio_miso, pspi->mem_gpio[SOFT_GPIO_MISO], &pconfig->miso, JHAL_GPIO_MODE_INPUT, 0);
+  
+  if(res != JHAL_RES_NO_ERRORS)
+    env_soft_gpio_spi_deinit(pinstance);
+  
+  return res;
+}
+
+uint8_t env_soft_gpio_spi_deinit(void* pinstance)
+{
+  env_soft_gpio_spi* pspi = (env_soft_gpio_spi*)pinstance;
+  
+  if(pspi->pgpio_sck)
+    jhal_gpio_deinit(pspi->pgpio_sck);
+  
+  if(pspi->pgpio_mosi)
+    jhal_gpio_deinit(pspi->pgpio_mosi);
+  
+  if(pspi->pgpio_miso)
+    jhal_gpio_deinit(pspi->pgpio_miso);
+  
+  pspi->pgpio_sck = NULL;
+  pspi->pgpio_mosi = NULL;
+  pspi->pgpio_miso = NULL;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* Bit-banging cannot stall, so timeouts are not used */
+uint8_t env_soft_gpio_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+  (void)timeout;
+  prv_spi_exchange((env_soft_gpio_spi*)pinstance, ptxdata, NULL, size);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_soft_gpio_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  (void)timeout;
+  prv_spi_exchange((env_soft_gpio_spi*)pinstance, NULL, prxdata, size);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_soft_gpio_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  (void)timeout;
+  prv_spi_exchange((env_soft_gpio_spi*)pinstance, ptxdata, prxdata, size);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* There is no interrupt source, the transfer is done in place and the
+   completion callback is called before return */
+uint8_t env_soft_gpio_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size)
+{
+  prv_spi_exchange((env_soft_gpio_spi*)pinstance, ptxdata, NULL, size);
+  jhal_spi_tx_complete_callback(pinstance);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_soft_gpio_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+  prv_spi_exchange((env_soft_gpio_spi*)pinstance, NULL, prxdata, size);
+  jhal_spi_rx_complete_callback(pinstance, prxdata, size);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_soft_gpio_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  prv_spi_exchange((env_soft_gpio_spi*)pinstance, ptxdata, prxdata, size);
+  jhal_spi_txrx_complete_callback(pinstance, prxdata, size);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_soft_gpio_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)ptxdata;
+  (void)size;
+  (void)pinstance_dma;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+uint8_t env_soft_gpio_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)prxdata;
+  (void)size;
+  (void)pinstance_dma;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+uint8_t env_soft_gpio_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)ptxdata;
+  (void)prxdata;
+  (void)size;
+  (void)pinstance_dma;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+/* Transfers never outlive the call */
+uint8_t env_soft_gpio_spi_abort(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+#if (USE_JHAL_OPS == 1)
+const jhal_spi_ops env_soft_gpio_spi_ops = {
+  env_soft_gpio_spi_size_drv,
+  env_soft_gpio_spi_init,
+  env_soft_gpio_spi_deinit,
+  env_soft_gpio_spi_transmit,
+  env_soft_gpio_spi_receive,
+  env_soft_gpio_spi_transmitreceive,
+  env_soft_gpio_spi_transmit_it,
+  env_soft_gpio_spi_receive_it,
+  env_soft_gpio_spi_transmitreceive_it,
+  env_soft_gpio_spi_transmit_dma,
+  env_soft_gpio_spi_receive_dma,
+  env_soft_gpio_spi_transmitreceive_dma,
+  env_soft_gpio_spi_abort
+};
+#endif
@@ -0,0 +1,60 @@
+#ifndef __ENV_SOFT_GPIO_SPI__
+#define __ENV_SOFT_GPIO_SPI__
+
+#include "jhal_gpio.h"
+#include "jhal_spi.h"
+
+/* SPI master bit-banged on jhal_gpio lines of the default gpio backend. Meant to be
+   selected per instance through env_soft_gpio_spi_ops (USE_JHAL_OPS), so slow
+   devices can share one image with the hardware SPI backend */
+
+#define ENV_SOFT_GPIO_SPI_SIZE_GPIO     ((JHAL_GPIO_SIZE_STATIC + sizeof(uint64_t) - 1) / sizeof(uint64_t))
+
+typedef struct {
+  uint8_t                       num_module;
+  uint64_t                      pin;
+} env_soft_gpio_line;
+
+/* plib_data of jhal_spi_params must point to this config, pin = 0 marks an unused
+   MOSI or MISO line */
+typedef struct {
+  env_soft_gpio_line            sck;
+  env_soft_gpio_line            mosi;
+  env_soft_gpio_line            miso;
+} env_soft_gpio_spi_config;
+
+typedef struct {
+  void*                         pgpio_sck;
+  void*                         pgpio_mosi;
+  void*                         pgpio_miso;
+  uint64_t                      pin_sck;
+  uint64_t                      pin_mosi;
+  uint64_t                      pin_miso;
+  uint8_t                       idle_sck;
+  uint8_t                       cpha;
+  uint8_t                       lsb_first;
+  uint32_t                      half_period_us;
+  uint64_t                      mem_gpio[3][ENV_SOFT_GPIO_SPI_SIZE_GPIO];
+} env_soft_gpio_spi;
+
+#define env_soft_gpio_spi_size_drv_static               sizeof(env_soft_gpio_spi)
+
+uint32_t env_soft_gpio_spi_size_drv(void);
+uint8_t env_soft_gpio_spi_init(void* pinstance, jhal_spi_params* pparams);
+uint8_t env_soft_gpio_spi_deinit(void* pinstance);
+uint8_t env_soft_gpio_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+uint8_t env_soft_gpio_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_soft_gpio_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_soft_gpio_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size);
+uint8_t env_soft_gpio_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size);
+uint8_t env_soft_gpio_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
+uint8_t env_soft_gpio_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_soft_gpio_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_soft_gpio_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_soft_gpio_spi_abort(void* pinstance);
+
+#if (USE_JHAL_OPS == 1)
+extern const jhal_spi_ops env_soft_gpio_spi_ops;
+#endif
+
+#endif
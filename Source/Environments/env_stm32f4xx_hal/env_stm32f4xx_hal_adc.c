@@ -0,0 +1,364 @@
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "jhal_adc.h"
+#include "jhal_dma.h"
+#include "env_stm32f4xx_hal_adc.h"
+
+#define ADC_OPERATION_SCAN              1U
+#define ADC_OPERATION_STREAM            2U
+
+#define ADC_AMOUNT_MODULES              3U
+#define ADC_IRQ_PRIORITY                5U
+#define ADC_CHANNEL_NUMBER_MAX          18U
+
+static env_stm32f4xx_hal_adc* ADCInstances[ADC_AMOUNT_MODULES] = {NULL};
+
+static const uint16_t ADCSampleCycles[] = {3, 15, 28, 56, 84, 112, 144, 480};
+static const uint32_t ADCSampleTimes[] = {ADC_SAMPLETIME_3CYCLES, ADC_SAMPLETIME_15CYCLES, ADC_SAMPLETIME_28CYCLES, ADC_SAMPLETIME_56CYCLES,
+                                          ADC_SAMPLETIME_84CYCLES, ADC_SAMPLETIME_112CYCLES, ADC_SAMPLETIME_144CYCLES, ADC_SAMPLETIME_480CYCLES};
+
+static uint8_t prv_adc_result(HAL_StatusTypeDef status)
+{
+  switch(status)
+  {
+    case HAL_OK:
+      return JHAL_RES_NO_ERRORS;
+    case HAL_TIMEOUT:
+      return JHAL_RES_TIMEOUT;
+    default:
+      return JHAL_RES_ERROR;
+  }
+}
+
+static env_stm32f4xx_hal_adc* prv_adc_by_handle(ADC_HandleTypeDef* phandle)
+{
+  for(uint8_t i = 0; i < ADC_AMOUNT_MODULES; i++)
+  {
+    if(ADCInstances[i] != NULL && &ADCInstances[i]->handle == phandle)
+      return ADCInstances[i];
+  }
+  
+  return NULL;
+}
+
+static uint32_t prv_adc_sample_time(uint32_t cycles)
+{
+  for(uint8_t i = 0; i < sizeof(ADCSampleCycles) / sizeof(ADCSampleCycles[0]); i++)
+  {
+    if(ADCSampleCycles[i] >= cycles)
+      return ADCSampleTimes[i];
+  }
+  
+  return ADC_SAMPLETIME_480CYCLES;
+}
+
+/* The free running scans of the software trigger need the continuous mode,
+   which is kept off for the single scans */
+static void prv_adc_continuous(env_stm32f4xx_hal_adc* padc, uint8_t enable)
+{
+  if(!padc->continuous)
+    return;
+  
+  if(enable)
+    SET_BIT(padc->handle.Instance->CR2, ADC_CR2_CONT);
+  else
+    CLEAR_BIT(padc->handle.Instance->CR2, ADC_CR2_CONT);
+}
+
+uint32_t env_stm32f4xx_hal_adc_size_drv(void)
+{
+  return env_stm32f4xx_hal_adc_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_hal_adc_init(void* pinstance, jhal_adc_params* pparams)
+{
+  env_stm32f4xx_hal_adc* padc = (env_stm32f4xx_hal_adc*)pinstance;
+  
+  memset(padc, 0, sizeof(env_stm32f4xx_hal_adc));
+  
+  if(pparams->num_module < 1 || pparams->num_module > ADC_AMOUNT_MODULES || ADCInstances[pparams->num_module - 1] != NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(pparams->amount_channels > ENV_STM32F4XX_HAL_ADC_CHANNELS_MAX)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  switch(pparams->num_module)
+  {
+#ifdef ADC1
+    case 1:
+      __HAL_RCC_ADC1_CLK_ENABLE();
+      padc->handle.Instance = ADC1;
+      padc->dma.Instance = DMA2_Stream0;
+      padc->dma.Init.Channel = DMA_CHANNEL_0;
+    break;
+#endif
+#ifdef ADC2
+    case 2:
+      __HAL_RCC_ADC2_CLK_ENABLE();
+      padc->handle.Instance = ADC2;
+      padc->dma.Instance = DMA2_Stream2;
+      padc->dma.Init.Channel = DMA_CHANNEL_1;
+    break;
+#endif
+#ifdef ADC3
+    case 3:
+      __HAL_RCC_ADC3_CLK_ENABLE();
+      padc->handle.Instance = ADC3;
+      padc->dma.Instance = DMA2_Stream1;
+      padc->dma.Init.Channel = DMA_CHANNEL_2;
+    break;
+#endif
+    default:
+      return JHAL_RES_NOT_SUPPORTED;
+  }
+  
+  switch(pparams->resolution)
+  {
+    case JHAL_ADC_RESOLUTION_12BIT:     padc->handle.Init.Resolution = ADC_RESOLUTION_12B; break;
+    case JHAL_ADC_RESOLUTION_10BIT:     padc->handle.Init.Resolution = ADC_RESOLUTION_10B; break;
+    case JHAL_ADC_RESOLUTION_8BIT:      padc->handle.Init.Resolution = ADC_RESOLUTION_8B; break;
+    case JHAL_ADC_RESOLUTION_6BIT:      padc->handle.Init.Resolution = ADC_RESOLUTION_6B; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->trigger)
+  {
+    case JHAL_ADC_TRIGGER_SOFTWARE:
+      padc->handle.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+      padc->handle.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
+      padc->continuous = 1;
+    break;
+    case JHAL_ADC_TRIGGER_TIMER:
+      if(pparams->trigger_module == 2)
+        padc->handle.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T2_TRGO;
+      else if(pparams->trigger_module == 3)
+        padc->handle.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T3_TRGO;
+      else if(pparams->trigger_module == 8)
+        padc->handle.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T8_TRGO;
+      else
+        return JHAL_RES_NOT_SUPPORTED;
+      padc->handle.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_RISING;
+    break;
+    default:
+      return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  /* End of conversion after every channel, so the IT scan reads each of them */
+  padc->handle.Init.ClockPrescaler = ADC_CLOCK_SYNC_PCLK_DIV4;
+  padc->handle.Init.DataAlign = ADC_DATAALIGN_RIGHT;
+  padc->handle.Init.ScanConvMode = (pparams->amount_channels > 1) ? ENABLE : DISABLE;
+  padc->handle.Init.EOCSelection = ADC_EOC_SINGLE_CONV;
+  padc->handle.Init.ContinuousConvMode = DISABLE;
+  padc->handle.Init.NbrOfConversion = pparams->amount_channels;
+  padc->handle.Init.DiscontinuousConvMode = DISABLE;
+  padc->handle.Init.NbrOfDiscConversion = 0;
+  padc->handle.Init.DMAContinuousRequests = ENABLE;
+  
+  if(HAL_ADC_Init(&padc->handle) != HAL_OK)
+    return JHAL_RES_ERROR;
+  
+  for(uint8_t i = 0; i < pparams->amount_channels; i++)
+  {
+    ADC_ChannelConfTypeDef config_channel = {0};
+    
+    if(pparams->pchannels[i].channel > ADC_CHANNEL_NUMBER_MAX)
+      return JHAL_RES_INVALID_PARAMS;
+    
+    config_channel.Channel = pparams->pchannels[i].channel;
+    config_channel.Rank = i + 1U;
+    config_channel.SamplingTime = prv_adc_sample_time(pparams->pchannels[i].sample_time);
+    
+    if(HAL_ADC_ConfigChannel(&padc->handle, &config_channel) != HAL_OK)
+      return JHAL_RES_ERROR;
+  }
+  
+  __HAL_RCC_DMA2_CLK_ENABLE();
+  padc->dma.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  padc->dma.Init.PeriphInc = DMA_PINC_DISABLE;
+  padc->dma.Init.MemInc = DMA_MINC_ENABLE;
+  padc->dma.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+  padc->dma.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+  padc->dma.Init.Mode = DMA_CIRCULAR;
+  padc->dma.Init.Priority = DMA_PRIORITY_HIGH;
+  padc->dma.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  
+  if(env_stm32f4xx_hal_dma_attach(&padc->dma) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_ERROR;
+  
+  if(HAL_DMA_Init(&padc->dma) != HAL_OK)
+  {
+    env_stm32f4xx_hal_dma_detach(&padc->dma);
+    return JHAL_RES_ERROR;
+  }
+  
+  __HAL_LINKDMA(&padc->handle, DMA_Handle, padc->dma);
+  
+  padc->amount_channels = pparams->amount_channels;
+  ADCInstances[pparams->num_module - 1] = padc;
+  
+  HAL_NVIC_SetPriority(ADC_IRQn, ADC_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(ADC_IRQn);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_hal_adc_deinit(void* pinstance)
+{
+  env_stm32f4xx_hal_adc* padc = (env_stm32f4xx_hal_adc*)pinstance;
+  
+  env_stm32f4xx_hal_adc_stop(pinstance);
+  
+  for(uint8_t i = 0; i < ADC_AMOUNT_MODULES; i++)
+  {
+    if(ADCInstances[i] == padc)
+      ADCInstances[i] = NULL;
+  }
+  
+  env_stm32f4xx_hal_dma_detach(&padc->dma);
+  HAL_DMA_DeInit(&padc->dma);
+  
+  return prv_adc_result(HAL_ADC_DeInit(&padc->handle));
+}
+
+/* With the timer trigger the scan waits for the next update of the timer */
+uint8_t env_stm32f4xx_hal_adc_convert(void* pinstance, uint16_t* pvalues, uint32_t timeout)
+{
+  env_stm32f4xx_hal_adc* padc = (env_stm32f4xx_hal_adc*)pinstance;
+  
+  if(padc->operation)
+    return JHAL_RES_ERROR;
+  
+  HAL_StatusTypeDef status = HAL_ADC_Start(&padc->handle);
+  
+  for(uint8_t i = 0; i < padc->amount_channels && status == HAL_OK; i++)
+  {
+    status = HAL_ADC_PollForConversion(&padc->handle, timeout);
+    if(status == HAL_OK)
+      pvalues[i] = (uint16_t)HAL_ADC_GetValue(&padc->handle);
+  }
+  
+  HAL_ADC_Stop(&padc->handle);
+  
+  return prv_adc_result(status);
+}
+
+uint8_t env_stm32f4xx_hal_adc_convert_it(void* pinstance, uint16_t* pvalues)
+{
+  env_stm32f4xx_hal_adc* padc = (env_stm32f4xx_hal_adc*)pinstance;
+  
+  if(padc->operation)
+    return JHAL_RES_ERROR;
+  
+  padc->operation = ADC_OPERATION_SCAN;
+  padc->pbuffer = pvalues;
+  padc->index = 0;
+  
+  HAL_StatusTypeDef status = HAL_ADC_Start_IT(&padc->handle);
+  if(status != HAL_OK)
+    padc->operation = 0;
+  
+  return prv_adc_result(status);
+}
+
+/* The stream of the module is linked to the handle in init, pinstance_dma is
+   not used */
+uint8_t env_stm32f4xx_hal_adc_start_dma(void* pinstance, uint16_t* pbuffer, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_hal_adc* padc = (env_stm32f4xx_hal_adc*)pinstance;
+  (void)pinstance_dma;
+  
+  if(padc->operation)
+    return JHAL_RES_ERROR;
+  
+  if(size % (2U * padc->amount_channels))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  padc->operation = ADC_OPERATION_STREAM;
+  padc->pbuffer = pbuffer;
+  padc->size = size;
+  
+  prv_adc_continuous(padc, 1);
+  
+  HAL_StatusTypeDef status = HAL_ADC_Start_DMA(&padc->handle, (uint32_t*)(void*)pbuffer, size);
+  if(status != HAL_OK)
+  {
+    prv_adc_continuous(padc, 0);
+    padc->operation = 0;
+  }
+  
+  return prv_adc_result(status);
+}
+
+uint8_t env_stm32f4xx_hal_adc_stop(void* pinstance)
+{
+  env_stm32f4xx_hal_adc* padc = (env_stm32f4xx_hal_adc*)pinstance;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint8_t operation = padc->operation;
+  
+  padc->operation = 0;
+  
+  if(operation == ADC_OPERATION_STREAM)
+  {
+    status = HAL_ADC_Stop_DMA(&padc->handle);
+    prv_adc_continuous(padc, 0);
+  }
+  else if(operation == ADC_OPERATION_SCAN)
+    status = HAL_ADC_Stop_IT(&padc->handle);
+  
+  return prv_adc_result(status);
+}
+
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* phandle)
+{
+  env_stm32f4xx_hal_adc* padc = prv_adc_by_handle(phandle);
+  
+  if(padc == NULL)
+    return;
+  
+  switch(padc->operation)
+  {
+    case ADC_OPERATION_SCAN:
+      padc->pbuffer[padc->index++] = (uint16_t)HAL_ADC_GetValue(phandle);
+      if(padc->index < padc->amount_channels)
+        break;
+      HAL_ADC_Stop_IT(phandle);
+      padc->operation = 0;
+      jhal_adc_conversion_complete_callback(padc, padc->pbuffer, padc->amount_channels);
+    break;
+    case ADC_OPERATION_STREAM:
+      jhal_adc_full_complete_callback(padc, padc->pbuffer + padc->size / 2U, padc->size / 2U);
+    break;
+  }
+}
+
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef* phandle)
+{
+  env_stm32f4xx_hal_adc* padc = prv_adc_by_handle(phandle);
+  
+  if(padc != NULL && padc->operation == ADC_OPERATION_STREAM)
+    jhal_adc_half_complete_callback(padc, padc->pbuffer, padc->size / 2U);
+}
+
+/* An overrun stops the requests of the ADC to the stream, the conversions are
+   stopped and the application starts them again */
+void HAL_ADC_ErrorCallback(ADC_HandleTypeDef* phandle)
+{
+  env_stm32f4xx_hal_adc* padc = prv_adc_by_handle(phandle);
+  
+  if(padc == NULL || !padc->operation)
+    return;
+  
+  uint8_t error = (HAL_ADC_GetError(phandle) & HAL_ADC_ERROR_DMA) ? JHAL_ADC_ERROR_DMA : JHAL_ADC_ERROR_OVERRUN;
+  
+  env_stm32f4xx_hal_adc_stop(padc);
+  jhal_adc_error_callback(padc, error);
+}
+
+void ADC_IRQHandler(void)
+{
+  for(uint8_t i = 0; i < ADC_AMOUNT_MODULES; i++)
+  {
+    if(ADCInstances[i] != NULL)
+      HAL_ADC_IRQHandler(&ADCInstances[i]->handle);
+  }
+}
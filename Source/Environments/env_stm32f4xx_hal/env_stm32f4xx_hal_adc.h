@@ -0,0 +1,37 @@
+#ifndef __ENV_STM32F4XX_HAL_ADC__
+#define __ENV_STM32F4XX_HAL_ADC__
+
+#include "stm32f4xx_hal.h"
+
+#define ENV_STM32F4XX_HAL_ADC_CHANNELS_MAX              16U
+
+/* num_module 1..3 selects ADC1..ADC3, the analog pins are set up by
+   HAL_ADC_MspInit of the application. The timer trigger takes the TRGO of
+   TIM2, TIM3 or TIM8 (trigger_module), the application sets the master mode of
+   the timer to the update event. The env runs the fixed DMA2 stream of the
+   module in the circular mode (ADC1 - stream 0, ADC2 - stream 2, ADC3 -
+   stream 1), attached to the DMA env that routes its interrupt, so no jhal_dma
+   instance may take that stream. The env owns the ADC interrupt and the HAL
+   ADC callbacks */
+typedef struct {
+  ADC_HandleTypeDef             handle;
+  DMA_HandleTypeDef             dma;
+  uint8_t                       operation;
+  uint8_t                       amount_channels;
+  uint8_t                       index;
+  uint8_t                       continuous;
+  uint16_t*                     pbuffer;
+  uint16_t                      size;
+} env_stm32f4xx_hal_adc;
+
+#define env_stm32f4xx_hal_adc_size_drv_static           sizeof(env_stm32f4xx_hal_adc)
+
+uint32_t env_stm32f4xx_hal_adc_size_drv(void);
+uint8_t env_stm32f4xx_hal_adc_init(void* pinstance, jhal_adc_params* pparams);
+uint8_t env_stm32f4xx_hal_adc_deinit(void* pinstance);
+uint8_t env_stm32f4xx_hal_adc_convert(void* pinstance, uint16_t* pvalues, uint32_t timeout);
+uint8_t env_stm32f4xx_hal_adc_convert_it(void* pinstance, uint16_t* pvalues);
+uint8_t env_stm32f4xx_hal_adc_start_dma(void* pinstance, uint16_t* pbuffer, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_hal_adc_stop(void* pinstance);
+
+#endif
@@ -0,0 +1,355 @@
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "jhal_dma.h"
+#include "env_stm32f4xx_hal_dma.h"
+
+#define DMA_AMOUNT_STREAMS              16U
+#define DMA_STREAMS_PER_MODULE          8U
+#define DMA_IRQ_PRIORITY                5U
+
+static DMA_HandleTypeDef* DMAHandles[DMA_AMOUNT_STREAMS] = {NULL};
+
+static DMA_Stream_TypeDef* const DMAStreams[DMA_AMOUNT_STREAMS] = {
+  DMA1_Stream0, DMA1_Stream1, DMA1_Stream2, DMA1_Stream3, DMA1_Stream4, DMA1_Stream5, DMA1_Stream6, DMA1_Stream7,
+  DMA2_Stream0, DMA2_Stream1, DMA2_Stream2, DMA2_Stream3, DMA2_Stream4, DMA2_Stream5, DMA2_Stream6, DMA2_Stream7};
+
+static const IRQn_Type DMAIRQs[DMA_AMOUNT_STREAMS] = {
+  DMA1_Stream0_IRQn, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn, 
+  DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, DMA1_Stream7_IRQn,
+  DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn, 
+  DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn};
+
+static const uint32_t DMAPriorities[] = {DMA_PRIORITY_LOW, DMA_PRIORITY_LOW, DMA_PRIORITY_MEDIUM, DMA_PRIORITY_HIGH, DMA_PRIORITY_VERY_HIGH};
+
+static uint8_t prv_dma_result(HAL_StatusTypeDef status)
+{
+  switch(status)
+  {
+    case HAL_OK:
+      return JHAL_RES_NO_ERRORS;
+    case HAL_TIMEOUT:
+      return JHAL_RES_TIMEOUT;
+    default:
+      return JHAL_RES_ERROR;
+  }
+}
+
+static uint8_t prv_dma_index(DMA_Stream_TypeDef* pstream)
+{
+  for(uint8_t i = 0; i < DMA_AMOUNT_STREAMS; i++)
+  {
+    if(DMAStreams[i] == pstream)
+      return i;
+  }
+  
+  return DMA_AMOUNT_STREAMS;
+}
+
+static uint32_t prv_dma_periph_alignment(jhal_dma_data_size data_size)
+{
+  switch(data_size)
+  {
+    case JHAL_DMA_DATA_SIZE_16BIT:      return DMA_PDATAALIGN_HALFWORD;
+    case JHAL_DMA_DATA_SIZE_32BIT:      return DMA_PDATAALIGN_WORD;
+    default:                            return DMA_PDATAALIGN_BYTE;
+  }
+}
+
+static uint32_t prv_dma_mem_alignment(jhal_dma_data_size data_size)
+{
+  switch(data_size)
+  {
+    case JHAL_DMA_DATA_SIZE_16BIT:      return DMA_MDATAALIGN_HALFWORD;
+    case JHAL_DMA_DATA_SIZE_32BIT:      return DMA_MDATAALIGN_WORD;
+    default:                            return DMA_MDATAALIGN_BYTE;
+  }
+}
+
+static void prv_dma_transfer_complete(DMA_HandleTypeDef* phandle)
+{
+  jhal_dma_transfer_complete_callback(phandle->Parent);
+}
+
+uint32_t env_stm32f4xx_hal_dma_size_drv(void)
+{
+  return env_stm32f4xx_hal_dma_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_hal_dma_init(void* pinstance, jhal_dma_params* pparams)
+{
+  env_stm32f4xx_hal_dma* pdma = (env_stm32f4xx_hal_dma*)pinstance;
+  uint32_t inc_src = (pparams->source_increment_type == JHAL_DMA_INCREMENT_TYPE_ENABLE);
+  uint32_t inc_dst = (pparams->destination_increment_type == JHAL_DMA_INCREMENT_TYPE_ENABLE);
+  uint8_t request = 0;
+  
+  memset(pdma, 0, sizeof(env_stm32f4xx_hal_dma));
+  
+  if(pparams->num_module < 1 || pparams->num_module > 2 || pparams->num_channel >= DMA_STREAMS_PER_MODULE)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(pparams->plib_data != NULL)
+    request = ((env_stm32f4xx_hal_dma_config*)pparams->plib_data)->request;
+  
+  if(request >= 8U)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  /* The peripheral port is the source of the memory to memory transfers */
+  switch(pparams->direction)
+  {
+    case JHAL_DMA_DIRECTION_PERIPH_TO_MEM:
+    case JHAL_DMA_DIRECTION_MEM_TO_MEM:
+      pdma->handle.Init.Direction = (pparams->direction == JHAL_DMA_DIRECTION_MEM_TO_MEM) ? DMA_MEMORY_TO_MEMORY : DMA_PERIPH_TO_MEMORY;
+      pdma->handle.Init.PeriphInc = inc_src ? DMA_PINC_ENABLE : DMA_PINC_DISABLE;
+      pdma->handle.Init.MemInc = inc_dst ? DMA_MINC_ENABLE : DMA_MINC_DISABLE;
+      pdma->handle.Init.PeriphDataAlignment = prv_dma_periph_alignment(pparams->source_data_size);
+      pdma->handle.Init.MemDataAlignment = prv_dma_mem_alignment(pparams->destination_data_size);
+    break;
+    case JHAL_DMA_DIRECTION_MEM_TO_PERIPH:
+      pdma->handle.Init.Direction = DMA_MEMORY_TO_PERIPH;
+      pdma->handle.Init.PeriphInc = inc_dst ? DMA_PINC_ENABLE : DMA_PINC_DISABLE;
+      pdma->handle.Init.MemInc = inc_src ? DMA_MINC_ENABLE : DMA_MINC_DISABLE;
+      pdma->handle.Init.PeriphDataAlignment = prv_dma_periph_alignment(pparams->destination_data_size);
+      pdma->handle.Init.MemDataAlignment = prv_dma_mem_alignment(pparams->source_data_size);
+    break;
+    default:
+      return JHAL_RES_NOT_SUPPORTED;
+  }
+  
+  if(pparams->direction == JHAL_DMA_DIRECTION_MEM_TO_MEM && pparams->num_module != 2)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  /* Packing of different sizes and the memory to memory mode need the FIFO */
+  if(pparams->source_data_size != pparams->destination_data_size || pparams->direction == JHAL_DMA_DIRECTION_MEM_TO_MEM)
+  {
+    pdma->handle.Init.FIFOMode = DMA_FIFOMODE_ENABLE;
+    pdma->handle.Init.FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+  }
+  else
+    pdma->handle.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  
+  pdma->handle.Init.Channel = (uint32_t)request << DMA_SxCR_CHSEL_Pos;
+  pdma->handle.Init.Mode = DMA_NORMAL;
+  pdma->handle.Init.Priority = DMAPriorities[(pparams->priority > JHAL_DMA_PRIORITY_HIGHEST) ? JHAL_DMA_PRIORITY_HIGHEST : pparams->priority];
+  pdma->handle.Init.MemBurst = DMA_MBURST_SINGLE;
+  pdma->handle.Init.PeriphBurst = DMA_PBURST_SINGLE;
+  pdma->handle.Instance = DMAStreams[(pparams->num_module - 1U) * DMA_STREAMS_PER_MODULE + pparams->num_channel];
+  
+  if(env_stm32f4xx_hal_dma_attach(&pdma->handle) != JHAL_RES_NO_ERRORS)
+  {
+    pdma->handle.Instance = NULL;
+    return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  if(pparams->num_module == 1)
+    __HAL_RCC_DMA1_CLK_ENABLE();
+  else
+    __HAL_RCC_DMA2_CLK_ENABLE();
+  
+  if(HAL_DMA_Init(&pdma->handle) != HAL_OK)
+  {
+    env_stm32f4xx_hal_dma_detach(&pdma->handle);
+    pdma->handle.Instance = NULL;
+    return JHAL_RES_ERROR;
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_hal_dma_deinit(void* pinstance)
+{
+  env_stm32f4xx_hal_dma* pdma = (env_stm32f4xx_hal_dma*)pinstance;
+  
+  if(pdma->handle.Instance == NULL)
+    return JHAL_RES_NO_ERRORS;
+  
+  HAL_DMA_Abort(&pdma->handle);
+  env_stm32f4xx_hal_dma_detach(&pdma->handle);
+  
+  return prv_dma_result(HAL_DMA_DeInit(&pdma->handle));
+}
+
+uint8_t env_stm32f4xx_hal_dma_start(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size)
+{
+  env_stm32f4xx_hal_dma* pdma = (env_stm32f4xx_hal_dma*)pinstance;
+  
+  HAL_StatusTypeDef status = HAL_DMA_Start(&pdma->handle, (uint32_t)srcaddress, (uint32_t)dstaddress, size);
+  if(status != HAL_OK)
+    return prv_dma_result(status);
+  
+  return prv_dma_result(HAL_DMA_PollForTransfer(&pdma->handle, HAL_DMA_FULL_TRANSFER, HAL_MAX_DELAY));
+}
+
+uint8_t env_stm32f4xx_hal_dma_stop(void* pinstance)
+{
+  env_stm32f4xx_hal_dma* pdma = (env_stm32f4xx_hal_dma*)pinstance;
+  
+  return prv_dma_result(HAL_DMA_Abort(&pdma->handle));
+}
+
+/* jhal_dma has no error callback, a transfer error ends the transfer the same
+   way as the completion */
+uint8_t env_stm32f4xx_hal_dma_start_it(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size)
+{
+  env_stm32f4xx_hal_dma* pdma = (env_stm32f4xx_hal_dma*)pinstance;
+  
+  if(pdma->handle.State != HAL_DMA_STATE_READY)
+    return JHAL_RES_ERROR;
+  
+  pdma->handle.Parent = pdma;
+  pdma->handle.XferCpltCallback = prv_dma_transfer_complete;
+  pdma->handle.XferHalfCpltCallback = NULL;
+  pdma->handle.XferErrorCallback = prv_dma_transfer_complete;
+  pdma->handle.XferAbortCallback = NULL;
+  
+  return prv_dma_result(HAL_DMA_Start_IT(&pdma->handle, (uint32_t)srcaddress, (uint32_t)dstaddress, size));
+}
+
+uint8_t env_stm32f4xx_hal_dma_stop_it(void* pinstance)
+{
+  env_stm32f4xx_hal_dma* pdma = (env_stm32f4xx_hal_dma*)pinstance;
+  
+  return prv_dma_result(HAL_DMA_Abort(&pdma->handle));
+}
+
+uint8_t env_stm32f4xx_hal_dma_attach(DMA_HandleTypeDef* phandle)
+{
+  uint8_t index = prv_dma_index(phandle->Instance);
+  
+  if(index >= DMA_AMOUNT_STREAMS || (DMAHandles[index] != NULL && DMAHandles[index] != phandle))
+    return JHAL_RES_ERROR;
+  
+  DMAHandles[index] = phandle;
+  
+  HAL_NVIC_SetPriority(DMAIRQs[index], DMA_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(DMAIRQs[index]);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+void env_stm32f4xx_hal_dma_detach(DMA_HandleTypeDef* phandle)
+{
+  uint8_t index = prv_dma_index(phandle->Instance);
+  
+  if(index >= DMA_AMOUNT_STREAMS || DMAHandles[index] != phandle)
+    return;
+  
+  HAL_NVIC_DisableIRQ(DMAIRQs[index]);
+  DMAHandles[index] = NULL;
+}
+
+/* The stream is set up again only when the transfer differs from the last one
+   it ran, so the peripherals that keep their setup pay for HAL_DMA_Init once */
+DMA_HandleTypeDef* env_stm32f4xx_hal_dma_link(void* pinstance_dma, uint32_t direction, uint32_t periph_alignment, uint32_t mem_alignment)
+{
+  env_stm32f4xx_hal_dma* pdma = (env_stm32f4xx_hal_dma*)pinstance_dma;
+  
+  if(pdma == NULL || pdma->handle.Instance == NULL || pdma->handle.State != HAL_DMA_STATE_READY)
+    return NULL;
+  
+  DMA_InitTypeDef* pinit = &pdma->handle.Init;
+  uint32_t fifo = (periph_alignment >> DMA_SxCR_PSIZE_Pos) != (mem_alignment >> DMA_SxCR_MSIZE_Pos) ? DMA_FIFOMODE_ENABLE : DMA_FIFOMODE_DISABLE;
+  
+  if(pinit->Direction != direction || pinit->PeriphInc != DMA_PINC_DISABLE || pinit->MemInc != DMA_MINC_ENABLE || pinit->Mode != DMA_NORMAL || 
+     pinit->PeriphDataAlignment != periph_alignment || pinit->MemDataAlignment != mem_alignment || pinit->FIFOMode != fifo)
+  {
+    pinit->Direction = direction;
+    pinit->PeriphInc = DMA_PINC_DISABLE;
+    pinit->MemInc = DMA_MINC_ENABLE;
+    pinit->Mode = DMA_NORMAL;
+    pinit->PeriphDataAlignment = periph_alignment;
+    pinit->MemDataAlignment = mem_alignment;
+    pinit->FIFOMode = fifo;
+    pinit->FIFOThreshold = DMA_FIFO_THRESHOLD_FULL;
+    
+    if(HAL_DMA_Init(&pdma->handle) != HAL_OK)
+      return NULL;
+  }
+  
+  return &pdma->handle;
+}
+
+static void prv_dma_irq(uint8_t index)
+{
+  if(DMAHandles[index] != NULL)
+    HAL_DMA_IRQHandler(DMAHandles[index]);
+}
+
+void DMA1_Stream0_IRQHandler(void)
+{
+  prv_dma_irq(0);
+}
+
+void DMA1_Stream1_IRQHandler(void)
+{
+  prv_dma_irq(1);
+}
+
+void DMA1_Stream2_IRQHandler(void)
+{
+  prv_dma_irq(2);
+}
+
+void DMA1_Stream3_IRQHandler(void)
+{
+  prv_dma_irq(3);
+}
+
+void DMA1_Stream4_IRQHandler(void)
+{
+  prv_dma_irq(4);
+}
+
+void DMA1_Stream5_IRQHandler(void)
+{
+  prv_dma_irq(5);
+}
+
+void DMA1_Stream6_IRQHandler(void)
+{
+  prv_dma_irq(6);
+}
+
+void DMA1_Stream7_IRQHandler(void)
+{
+  prv_dma_irq(7);
+}
+
+void DMA2_Stream0_IRQHandler(void)
+{
+  prv_dma_irq(8);
+}
+
+void DMA2_Stream1_IRQHandler(void)
+{
+  prv_dma_irq(9);
+}
+
+void DMA2_Stream2_IRQHandler(void)
+{
+  prv_dma_irq(10);
+}
+
+void DMA2_Stream3_IRQHandler(void)
+{
+  prv_dma_irq(11);
+}
+
+void DMA2_Stream4_IRQHandler(void)
+{
+  prv_dma_irq(12);
+}
+
+void DMA2_Stream5_IRQHandler(void)
+{
+  prv_dma_irq(13);
+}
+
+void DMA2_Stream6_IRQHandler(void)
+{
+  prv_dma_irq(14);
+}
+
+void DMA2_Stream7_IRQHandler(void)
+{
+  prv_dma_irq(15);
+}
@@ -0,0 +1,39 @@
+#ifndef __ENV_STM32F4XX_HAL_DMA__
+#define __ENV_STM32F4XX_HAL_DMA__
+
+#include "stm32f4xx_hal.h"
+
+/* num_module 1..2 selects DMA1..DMA2 and num_channel 0..7 the stream, one
+   instance per stream. plib_data of jhal_dma_params may point to
+   env_stm32f4xx_hal_dma_config to select the request channel of the stream,
+   channel 0 by default. The env owns the interrupts of all streams and routes
+   them to the handles attached to it, the instances of jhal_dma and the
+   streams the other modules of the env run themselves */
+typedef struct {
+  uint8_t                       request;
+} env_stm32f4xx_hal_dma_config;
+
+typedef struct {
+  DMA_HandleTypeDef             handle;
+} env_stm32f4xx_hal_dma;
+
+#define env_stm32f4xx_hal_dma_size_drv_static           sizeof(env_stm32f4xx_hal_dma)
+
+uint32_t env_stm32f4xx_hal_dma_size_drv(void);
+uint8_t env_stm32f4xx_hal_dma_init(void* pinstance, jhal_dma_params* pparams);
+uint8_t env_stm32f4xx_hal_dma_deinit(void* pinstance);
+uint8_t env_stm32f4xx_hal_dma_start(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size);
+uint8_t env_stm32f4xx_hal_dma_stop(void* pinstance);
+uint8_t env_stm32f4xx_hal_dma_start_it(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size);
+uint8_t env_stm32f4xx_hal_dma_stop_it(void* pinstance);
+
+/* Used by the modules of the env: attach takes the stream of phandle->Instance
+   for phandle, the stream of another handle is busy. link gives the handle of
+   instance pinstance_dma set up for a transfer of a peripheral with the HAL
+   direction and data alignments (the memory side is incremented), it returns
+   NULL if the stream is busy or can not be set up */
+uint8_t env_stm32f4xx_hal_dma_attach(DMA_HandleTypeDef* phandle);
+void env_stm32f4xx_hal_dma_detach(DMA_HandleTypeDef* phandle);
+DMA_HandleTypeDef* env_stm32f4xx_hal_dma_link(void* pinstance_dma, uint32_t direction, uint32_t periph_alignment, uint32_t mem_alignment);
+
+#endif
@@ -0,0 +1,408 @@
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "jhal_flash.h"
+#include "env_stm32f4xx_hal_flash.h"
+#include "env_stm32f4xx_hal_tick.h"
+
+#define FLASH_OPERATION_ERASE           1U
+#define FLASH_OPERATION_PROGRAM         2U
+
+#define FLASH_EVENT_DONE                1U
+#define FLASH_EVENT_ERROR               2U
+
+#define FLASH_IRQ_PRIORITY              5U
+#define FLASH_ERASED_VALUE              0xFFU
+#define FLASH_SECTORS_IN_BANK           12U
+#define FLASH_SIZE_DUAL_BANK            0x200000U
+#define FLASH_FLAGS_ERROR               (FLASH_FLAG_EOP | FLASH_FLAG_OPERR | FLASH_FLAG_WRPERR | FLASH_FLAG_PGAERR | FLASH_FLAG_PGPERR | FLASH_FLAG_PGSERR)
+
+static env_stm32f4xx_hal_flash* FlashInstance = NULL;
+static volatile uint8_t FlashEvent = 0;
+
+static const uint32_t FlashTypesProgram[] = {FLASH_TYPEPROGRAM_BYTE, FLASH_TYPEPROGRAM_HALFWORD, FLASH_TYPEPROGRAM_WORD, FLASH_TYPEPROGRAM_DOUBLEWORD};
+
+static uint8_t prv_flash_result(HAL_StatusTypeDef status)
+{
+  switch(status)
+  {
+    case HAL_OK:
+      return JHAL_RES_NO_ERRORS;
+    case HAL_TIMEOUT:
+      return JHAL_RES_TIMEOUT;
+    case HAL_BUSY:
+      return JHAL_RES_BUSY;
+    default:
+      return JHAL_RES_ERROR;
+  }
+}
+
+static uint8_t prv_flash_error(uint32_t error_hal)
+{
+  if(error_hal & HAL_FLASH_ERROR_WRP)
+    return JHAL_FLASH_ERROR_PROTECT;
+  
+  if(error_hal & (HAL_FLASH_ERROR_PGA | HAL_FLASH_ERROR_PGP | HAL_FLASH_ERROR_PGS))
+    return JHAL_FLASH_ERROR_PROGRAM;
+  
+  return JHAL_FLASH_ERROR_OPERATION;
+}
+
+static uint8_t prv_flash_in_range(env_stm32f4xx_hal_flash* pflash, uint32_t address, uint32_t size)
+{
+  return address >= FLASH_BASE && size <= pflash->size && address - FLASH_BASE <= pflash->size - size;
+}
+
+/* Sectors 0-3 are 16 KiB, 4 is 64 KiB and the rest 128 KiB in every bank, the
+   sectors of bank 2 are numbered from 12 */
+static uint32_t prv_flash_sector(env_stm32f4xx_hal_flash* pflash, uint32_t address, uint32_t* pstart, uint32_t* psize)
+{
+  uint32_t offset = address - FLASH_BASE;
+  uint32_t base = FLASH_BASE;
+  uint32_t sector = 0;
+  
+  if(pflash->size_bank && offset >= pflash->size_bank)
+  {
+    offset -= pflash->size_bank;
+    base += pflash->size_bank;
+    sector = FLASH_SECTORS_IN_BANK;
+  }
+  
+  if(offset < 0x10000U)
+  {
+    sector += offset / 0x4000U;
+    *pstart = base + (offset & ~0x3FFFU);
+    *psize = 0x4000U;
+  }
+  else if(offset < 0x20000U)
+  {
+    sector += 4U;
+    *pstart = base + 0x10000U;
+    *psize = 0x10000U;
+  }
+  else
+  {
+    sector += 4U + offset / 0x20000U;
+    *pstart = base + (offset & ~0x1FFFFU);
+    *psize = 0x20000U;
+  }
+  
+  return sector;
+}
+
+/* An operation that the env does not know about (option bytes) blocks all
+   reads, the own ones only those of their bank */
+static uint8_t prv_flash_busy(env_stm32f4xx_hal_flash* pflash, uint32_t address, uint32_t size)
+{
+  if(!pflash->operation)
+    return __HAL_FLASH_GET_FLAG(FLASH_FLAG_BSY) ? 1U : 0U;
+  
+  if(!pflash->size_bank)
+    return 1;
+  
+  uint32_t bank = (pflash->address - FLASH_BASE) / pflash->size_bank;
+  
+  return (address - FLASH_BASE) / pflash->size_bank <= bank && bank <= (address - FLASH_BASE + size - 1U) / pflash->size_bank;
+}
+
+static uint8_t prv_flash_start(env_stm32f4xx_hal_flash* pflash, uint8_t operation, uint32_t address, const uint8_t* pdata, uint16_t size)
+{
+  uint32_t primask = env_stm32f4xx_hal_critical_enter();
+  
+  if(pflash->operation)
+  {
+    env_stm32f4xx_hal_critical_exit(primask);
+    return JHAL_RES_BUSY;
+  }
+  
+  pflash->operation = operation;
+  env_stm32f4xx_hal_critical_exit(primask);
+  
+  pflash->address = address;
+  pflash->pdata = pdata;
+  pflash->size_data = size;
+  pflash->done = 0;
+  FlashEvent = 0;
+  
+  HAL_FLASH_Unlock();
+  __HAL_FLASH_CLEAR_FLAG(FLASH_FLAGS_ERROR);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static void prv_flash_end(env_stm32f4xx_hal_flash* pflash)
+{
+  HAL_FLASH_Lock();
+  pflash->operation = 0;
+}
+
+static HAL_StatusTypeDef prv_flash_program_unit(env_stm32f4xx_hal_flash* pflash, uint8_t it)
+{
+  uint64_t data = 0;
+  uint32_t address = pflash->address + pflash->done;
+  
+  memcpy(&data, pflash->pdata + pflash->done, pflash->program_width);
+  
+  if(it)
+    return HAL_FLASH_Program_IT(pflash->type_program, address, data);
+  
+  return HAL_FLASH_Program(pflash->type_program, address, data);
+}
+
+static uint8_t prv_flash_check_program(env_stm32f4xx_hal_flash* pflash, uint32_t address, uint16_t size)
+{
+  if(!prv_flash_in_range(pflash, address, size) || address % pflash->program_width || size % pflash->program_width)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_flash_erase_init(env_stm32f4xx_hal_flash* pflash, uint32_t address, FLASH_EraseInitTypeDef* pinit)
+{
+  uint32_t start;
+  uint32_t size;
+  
+  if(!prv_flash_in_range(pflash, address, 1))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  memset(pinit, 0, sizeof(FLASH_EraseInitTypeDef));
+  pinit->TypeErase = FLASH_TYPEERASE_SECTORS;
+  pinit->Sector = prv_flash_sector(pflash, address, &start, &size);
+  pinit->NbSectors = 1;
+  pinit->VoltageRange = pflash->voltage_range;
+  
+  return (start == address) ? JHAL_RES_NO_ERRORS : JHAL_RES_INVALID_PARAMS;
+}
+
+uint32_t env_stm32f4xx_hal_flash_size_drv(void)
+{
+  return env_stm32f4xx_hal_flash_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_hal_flash_init(void* pinstance, jhal_flash_params* pparams)
+{
+  env_stm32f4xx_hal_flash* pflash = (env_stm32f4xx_hal_flash*)pinstance;
+  
+  memset(pflash, 0, sizeof(env_stm32f4xx_hal_flash));
+  
+  if(pparams->num_module != 1 || FlashInstance != NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  pflash->voltage_range = FLASH_VOLTAGE_RANGE_3;
+  
+  if(pparams->plib_data != NULL)
+    pflash->voltage_range = ((env_stm32f4xx_hal_flash_config*)pparams->plib_data)->voltage_range;
+  
+  if(pflash->voltage_range > FLASH_VOLTAGE_RANGE_4)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  pflash->type_program = FlashTypesProgram[pflash->voltage_range];
+  pflash->program_width = (uint16_t)(1U << pflash->voltage_range);
+  pflash->size = (uint32_t)(*(const uint16_t*)FLASHSIZE_BASE) * 1024U;
+#if defined(FLASH_BANK_2)
+  if(pflash->size == FLASH_SIZE_DUAL_BANK)
+    pflash->size_bank = pflash->size / 2U;
+#endif
+  
+  FlashInstance = pflash;
+  HAL_NVIC_SetPriority(FLASH_IRQn, FLASH_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(FLASH_IRQn);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* A running operation of the flash cannot be stopped, it ends without the callback */
+uint8_t env_stm32f4xx_hal_flash_deinit(void* pinstance)
+{
+  env_stm32f4xx_hal_flash* pflash = (env_stm32f4xx_hal_flash*)pinstance;
+  
+  HAL_NVIC_DisableIRQ(FLASH_IRQn);
+  FlashInstance = NULL;
+  pflash->operation = 0;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_hal_flash_get_info(void* pinstance, jhal_flash_info* pinfo)
+{
+  env_stm32f4xx_hal_flash* pflash = (env_stm32f4xx_hal_flash*)pinstance;
+  
+  pinfo->address = FLASH_BASE;
+  pinfo->size = pflash->size;
+  pinfo->program_width = pflash->program_width;
+  pinfo->erased_value = FLASH_ERASED_VALUE;
+  pinfo->read_while_busy = pflash->size_bank ? 1U : 0U;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_hal_flash_get_sector(void* pinstance, uint32_t address, uint32_t* pstart, uint32_t* psize)
+{
+  env_stm32f4xx_hal_flash* pflash = (env_stm32f4xx_hal_flash*)pinstance;
+  
+  if(!prv_flash_in_range(pflash, address, 1))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  prv_flash_sector(pflash, address, pstart, psize);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_hal_flash_read(void* pinstance, uint32_t address, uint8_t* pdata, uint16_t size)
+{
+  env_stm32f4xx_hal_flash* pflash = (env_stm32f4xx_hal_flash*)pinstance;
+  
+  if(!prv_flash_in_range(pflash, address, size))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(prv_flash_busy(pflash, address, size))
+    return JHAL_RES_BUSY;
+  
+  memcpy(pdata, (const void*)(uintptr_t)address, size);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* The HAL waits for the erase with its own timeout, which is longer than the
+   erase of the largest sector */
+uint8_t env_stm32f4xx_hal_flash_erase(void* pinstance, uint32_t address, uint32_t timeout)
+{
+  env_stm32f4xx_hal_flash* pflash = (env_stm32f4xx_hal_flash*)pinstance;
+  FLASH_EraseInitTypeDef init;
+  uint32_t sector_error;
+  (void)timeout;
+  
+  if(prv_flash_erase_init(pflash, address, &init) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(prv_flash_start(pflash, FLASH_OPERATION_ERASE, address, NULL, 0) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_BUSY;
+  
+  HAL_StatusTypeDef status = HAL_FLASHEx_Erase(&init, &sector_error);
+  prv_flash_end(pflash);
+  
+  return prv_flash_result(status);
+}
+
+uint8_t env_stm32f4xx_hal_flash_erase_it(void* pinstance, uint32_t address)
+{
+  env_stm32f4xx_hal_flash* pflash = (env_stm32f4xx_hal_flash*)pinstance;
+  FLASH_EraseInitTypeDef init;
+  
+  if(prv_flash_erase_init(pflash, address, &init) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(prv_flash_start(pflash, FLASH_OPERATION_ERASE, address, NULL, 0) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_BUSY;
+  
+  HAL_StatusTypeDef status = HAL_FLASHEx_Erase_IT(&init);
+  
+  if(status != HAL_OK)
+    prv_flash_end(pflash);
+  
+  return prv_flash_result(status);
+}
+
+uint8_t env_stm32f4xx_hal_flash_program(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size, uint32_t timeout)
+{
+  env_stm32f4xx_hal_flash* pflash = (env_stm32f4xx_hal_flash*)pinstance;
+  HAL_StatusTypeDef status = HAL_OK;
+  
+  if(prv_flash_check_program(pflash, address, size) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(prv_flash_start(pflash, FLASH_OPERATION_PROGRAM, address, pdata, size) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_BUSY;
+  
+  uint32_t tickstart = HAL_GetTick();
+  
+  while(pflash->done < size && status == HAL_OK)
+  {
+    status = prv_flash_program_unit(pflash, 0);
+    pflash->done += pflash->program_width;
+  
+    if(status == HAL_OK && pflash->done < size && HAL_GetTick() - tickstart >= timeout)
+      status = HAL_TIMEOUT;
+  }
+  
+  prv_flash_end(pflash);
+  
+  return prv_flash_result(status);
+}
+
+/* The units are programmed one by one, each started from the interrupt of the
+   previous one */
+uint8_t env_stm32f4xx_hal_flash_program_it(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size)
+{
+  env_stm32f4xx_hal_flash* pflash = (env_stm32f4xx_hal_flash*)pinstance;
+  
+  if(prv_flash_check_program(pflash, address, size) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(prv_flash_start(pflash, FLASH_OPERATION_PROGRAM, address, pdata, size) != JHAL_RES_NO_ERRORS)
+    return JHAL_RES_BUSY;
+  
+  HAL_StatusTypeDef status = prv_flash_program_unit(pflash, 1);
+  
+  if(status != HAL_OK)
+    prv_flash_end(pflash);
+  
+  return prv_flash_result(status);
+}
+
+void HAL_FLASH_EndOfOperationCallback(uint32_t ReturnValue)
+{
+  (void)ReturnValue;
+  FlashEvent = FLASH_EVENT_DONE;
+}
+
+void HAL_FLASH_OperationErrorCallback(uint32_t ReturnValue)
+{
+  (void)ReturnValue;
+  FlashEvent = FLASH_EVENT_ERROR;
+}
+
+/* The HAL holds its lock until HAL_FLASH_IRQHandler returns, so the next unit
+   and the callbacks, which may start another operation, run after it */
+void FLASH_IRQHandler(void)
+{
+  HAL_FLASH_IRQHandler();
+  
+  env_stm32f4xx_hal_flash* pflash = FlashInstance;
+  uint8_t event = FlashEvent;
+  FlashEvent = 0;
+  
+  if(pflash == NULL || !pflash->operation || !event)
+    return;
+  
+  uint32_t address = pflash->address;
+  uint16_t size = pflash->size_data;
+  
+  if(event == FLASH_EVENT_ERROR)
+  {
+    prv_flash_end(pflash);
+    jhal_flash_error_callback(pflash, address, prv_flash_error(HAL_FLASH_GetError()));
+    return;
+  }
+  
+  if(pflash->operation == FLASH_OPERATION_ERASE)
+  {
+    prv_flash_end(pflash);
+    jhal_flash_erase_complete_callback(pflash, address);
+    return;
+  }
+  
+  pflash->done += pflash->program_width;
+  
+  if(pflash->done < size)
+  {
+    if(prv_flash_program_unit(pflash, 1) == HAL_OK)
+      return;
+  
+    prv_flash_end(pflash);
+    jhal_flash_error_callback(pflash, address, JHAL_FLASH_ERROR_OPERATION);
+    return;
+  }
+  
+  prv_flash_end(pflash);
+  jhal_flash_program_complete_callback(pflash, address, size);
+}
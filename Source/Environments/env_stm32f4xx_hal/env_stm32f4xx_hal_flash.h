@@ -0,0 +1,47 @@
+#ifndef __ENV_STM32F4XX_HAL_FLASH__
+#define __ENV_STM32F4XX_HAL_FLASH__
+
+#include "stm32f4xx_hal.h"
+
+/* plib_data of jhal_flash_params may point to env_stm32f4xx_hal_flash_config.
+   voltage_range is FLASH_VOLTAGE_RANGE_1..4 of the supply, which sets the
+   program width to a byte, a half-word, a word or a double word (range 4
+   needs VPP), FLASH_VOLTAGE_RANGE_3 without the config */
+typedef struct {
+  uint32_t                      voltage_range;
+} env_stm32f4xx_hal_flash_config;
+
+/* num_module 1 is the flash from FLASH_BASE with the size of the part, in
+   sectors of 16, 64 and 128 KiB. The parts with 2 MiB have two banks and a
+   bank is read while the other one is programmed or erased, read returns
+   JHAL_RES_BUSY for the bank that is busy. On the single bank parts every
+   fetch from the flash stalls while it is busy, so the code that has to run
+   during an erase (the interrupts and the main loop) is placed in RAM. The env
+   owns the FLASH interrupt and the HAL FLASH callbacks */
+typedef struct {
+  uint32_t                      voltage_range;
+  uint32_t                      type_program;
+  uint16_t                      program_width;
+  uint32_t                      size;
+  uint32_t                      size_bank;
+  uint8_t                       operation;
+  uint32_t                      address;
+  const uint8_t*                pdata;
+  uint16_t                      size_data;
+  uint16_t                      done;
+} env_stm32f4xx_hal_flash;
+
+#define env_stm32f4xx_hal_flash_size_drv_static         sizeof(env_stm32f4xx_hal_flash)
+
+uint32_t env_stm32f4xx_hal_flash_size_drv(void);
+uint8_t env_stm32f4xx_hal_flash_init(void* pinstance, jhal_flash_params* pparams);
+uint8_t env_stm32f4xx_hal_flash_deinit(void* pinstance);
+uint8_t env_stm32f4xx_hal_flash_get_info(void* pinstance, jhal_flash_info* pinfo);
+uint8_t env_stm32f4xx_hal_flash_get_sector(void* pinstance, uint32_t address, uint32_t* pstart, uint32_t* psize);
+uint8_t env_stm32f4xx_hal_flash_read(void* pinstance, uint32_t address, uint8_t* pdata, uint16_t size);
+uint8_t env_stm32f4xx_hal_flash_erase(void* pinstance, uint32_t address, uint32_t timeout);
+uint8_t env_stm32f4xx_hal_flash_erase_it(void* pinstance, uint32_t address);
+uint8_t env_stm32f4xx_hal_flash_program(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_hal_flash_program_it(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size);
+
+#endif
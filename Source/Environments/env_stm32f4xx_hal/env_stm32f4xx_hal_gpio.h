@@ -1,9 +1,31 @@
-#ifndef __ENV_STM32F4XX_HAL_GPIO__
-#define __ENV_STM32F4XX_HAL_GPIO__
-
-uint32_t env_stm32f4xx_hal_gpio_size_drv(void);
-uint8_t env_stm32f4xx_hal_gpio_init(void* pInstance, jhal_gpio_params* pParams);
-uint8_t env_stm32f4xx_hal_gpio_set(void* pinstance, uint64_t pins, uint8_t value);
-uint8_t env_stm32f4xx_hal_gpio_get(void* pinstance, uint64_t pins, uint8_t* pValue);
-
+#ifndef __ENV_STM32F4XX_HAL_GPIO__
+#define __ENV_STM32F4XX_HAL_GPIO__
+
+#include "stm32f4xx_hal.h"
+
+#define env_stm32f4xx_hal_gpio_size_drv_static          sizeof(GPIO_TypeDef*)
+
+uint32_t env_stm32f4xx_hal_gpio_size_drv(void);
+uint8_t env_stm32f4xx_hal_gpio_init(void* pInstance, jhal_gpio_params* pParams);
+uint8_t env_stm32f4xx_hal_gpio_deinit(void* pinstance);
+#if (USE_JHAL_INLINE == 0)
+uint8_t env_stm32f4xx_hal_gpio_set(void* pinstance, uint64_t pins, uint8_t value);
+uint8_t env_stm32f4xx_hal_gpio_get(void* pinstance, uint64_t pins, uint8_t* pValue);
+#else
+/* Pins are validated by env_stm32f4xx_hal_gpio_init, so the hot path is a single port access */
+static inline uint8_t env_stm32f4xx_hal_gpio_set(void* pinstance, uint64_t pins, uint8_t value)
+{
+  (*((GPIO_TypeDef**)pinstance))->BSRR = value ? (uint32_t)pins : (uint32_t)pins << 16U;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static inline uint8_t env_stm32f4xx_hal_gpio_get(void* pinstance, uint64_t pins, uint8_t* pValue)
+{
+  *pValue = ((*((GPIO_TypeDef**)pinstance))->IDR & (uint32_t)pins) ? 1 : 0;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+#endif
+
 #endif
\ No newline at end of file
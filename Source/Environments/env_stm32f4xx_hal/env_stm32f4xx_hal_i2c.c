@@ -0,0 +1,437 @@
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "jhal_i2c.h"
+#include "jhal_dma.h"
+#include "env_stm32f4xx_hal_i2c.h"
+
+#define I2C_OPERATION_TX                1U
+#define I2C_OPERATION_RX                2U
+#define I2C_OPERATION_WRITE             3U
+#define I2C_OPERATION_READ              4U
+#define I2C_OPERATION_WRITE_DMA         5U
+#define I2C_OPERATION_READ_DMA          6U
+
+#define I2C_AMOUNT_MODULES              3U
+#define I2C_IRQ_PRIORITY                5U
+
+static env_stm32f4xx_hal_i2c* I2CInstances[I2C_AMOUNT_MODULES] = {NULL};
+
+static uint8_t prv_i2c_result(HAL_StatusTypeDef status)
+{
+  switch(status)
+  {
+    case HAL_OK:
+      return JHAL_RES_NO_ERRORS;
+    case HAL_TIMEOUT:
+      return JHAL_RES_TIMEOUT;
+    default:
+      return JHAL_RES_ERROR;
+  }
+}
+
+static env_stm32f4xx_hal_i2c* prv_i2c_by_handle(I2C_HandleTypeDef* phandle)
+{
+  for(uint8_t i = 0; i < I2C_AMOUNT_MODULES; i++)
+  {
+    if(I2CInstances[i] != NULL && &I2CInstances[i]->handle == phandle)
+      return I2CInstances[i];
+  }
+  
+  return NULL;
+}
+
+static uint8_t prv_i2c_start(env_stm32f4xx_hal_i2c* pi2c, uint8_t operation, uint16_t address, uint8_t* prxdata, uint16_t size_rx)
+{
+  if(pi2c->operation)
+    return JHAL_RES_ERROR;
+  
+  pi2c->operation = operation;
+  pi2c->address = (uint16_t)(address << pi2c->shift_address);
+  pi2c->prxdata = prxdata;
+  pi2c->size_rx = size_rx;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_i2c_started(env_stm32f4xx_hal_i2c* pi2c, HAL_StatusTypeDef status)
+{
+  if(status != HAL_OK)
+    pi2c->operation = 0;
+  
+  return prv_i2c_result(status);
+}
+
+/* Links the streams of a DMA transfer to the handle, write_read needs the
+   transmit stream of the config as well */
+static uint8_t prv_i2c_link_dma(env_stm32f4xx_hal_i2c* pi2c, void* pinstance_dma_tx, void* pinstance_dma_rx)
+{
+  pi2c->handle.hdmatx = NULL;
+  pi2c->handle.hdmarx = NULL;
+  
+  if(pinstance_dma_rx != NULL)
+  {
+    pi2c->handle.hdmarx = env_stm32f4xx_hal_dma_link(pinstance_dma_rx, DMA_PERIPH_TO_MEMORY, DMA_PDATAALIGN_BYTE, DMA_MDATAALIGN_BYTE);
+    if(pi2c->handle.hdmarx == NULL)
+      return JHAL_RES_ERROR;
+    pi2c->handle.hdmarx->Parent = &pi2c->handle;
+  }
+  
+  if(pinstance_dma_tx != NULL)
+  {
+    pi2c->handle.hdmatx = env_stm32f4xx_hal_dma_link(pinstance_dma_tx, DMA_MEMORY_TO_PERIPH, DMA_PDATAALIGN_BYTE, DMA_MDATAALIGN_BYTE);
+    if(pi2c->handle.hdmatx == NULL)
+      return JHAL_RES_ERROR;
+    pi2c->handle.hdmatx->Parent = &pi2c->handle;
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint32_t env_stm32f4xx_hal_i2c_size_drv(void)
+{
+  return env_stm32f4xx_hal_i2c_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_hal_i2c_init(void* pinstance, jhal_i2c_params* pparams)
+{
+  env_stm32f4xx_hal_i2c* pi2c = (env_stm32f4xx_hal_i2c*)pinstance;
+  IRQn_Type irq_event, irq_error;
+  
+  memset(pi2c, 0, sizeof(env_stm32f4xx_hal_i2c));
+  
+  if(pparams->num_module < 1 || pparams->num_module > I2C_AMOUNT_MODULES || I2CInstances[pparams->num_module - 1] != NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  switch(pparams->num_module)
+  {
+#ifdef I2C1
+    case 1:
+      __HAL_RCC_I2C1_CLK_ENABLE();
+      pi2c->handle.Instance = I2C1;
+      irq_event = I2C1_EV_IRQn;
+      irq_error = I2C1_ER_IRQn;
+    break;
+#endif
+#ifdef I2C2
+    case 2:
+      __HAL_RCC_I2C2_CLK_ENABLE();
+      pi2c->handle.Instance = I2C2;
+      irq_event = I2C2_EV_IRQn;
+      irq_error = I2C2_ER_IRQn;
+    break;
+#endif
+#ifdef I2C3
+    case 3:
+      __HAL_RCC_I2C3_CLK_ENABLE();
+      pi2c->handle.Instance = I2C3;
+      irq_event = I2C3_EV_IRQn;
+      irq_error = I2C3_ER_IRQn;
+    break;
+#endif
+    default:
+      return JHAL_RES_NOT_SUPPORTED;
+  }
+  
+  switch(pparams->addressing)
+  {
+    case JHAL_I2C_ADDRESSING_7BIT:
+      pi2c->handle.Init.AddressingMode = I2C_ADDRESSINGMODE_7BIT;
+      pi2c->shift_address = 1;
+    break;
+    case JHAL_I2C_ADDRESSING_10BIT:
+      pi2c->handle.Init.AddressingMode = I2C_ADDRESSINGMODE_10BIT;
+      pi2c->shift_address = 0;
+    break;
+    default:
+      return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  if(!pparams->clock_speed || pparams->clock_speed > 400000U)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  pi2c->handle.Init.ClockSpeed = pparams->clock_speed;
+  pi2c->handle.Init.DutyCycle = I2C_DUTYCYCLE_2;
+  pi2c->handle.Init.OwnAddress1 = 0;
+  pi2c->handle.Init.DualAddressMode = I2C_DUALADDRESS_DISABLE;
+  pi2c->handle.Init.OwnAddress2 = 0;
+  pi2c->handle.Init.GeneralCallMode = I2C_GENERALCALL_DISABLE;
+  pi2c->handle.Init.NoStretchMode = I2C_NOSTRETCH_DISABLE;
+  
+  if(pparams->plib_data != NULL)
+    pi2c->config = *((env_stm32f4xx_hal_i2c_config*)pparams->plib_data);
+  
+  if(HAL_I2C_Init(&pi2c->handle) != HAL_OK)
+    return JHAL_RES_ERROR;
+  
+  I2CInstances[pparams->num_module - 1] = pi2c;
+  
+  HAL_NVIC_SetPriority(irq_event, I2C_IRQ_PRIORITY, 0);
+  HAL_NVIC_SetPriority(irq_error, I2C_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(irq_event);
+  HAL_NVIC_EnableIRQ(irq_error);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_hal_i2c_deinit(void* pinstance)
+{
+  env_stm32f4xx_hal_i2c* pi2c = (env_stm32f4xx_hal_i2c*)pinstance;
+  
+  for(uint8_t i = 0; i < I2C_AMOUNT_MODULES; i++)
+  {
+    if(I2CInstances[i] == pi2c)
+      I2CInstances[i] = NULL;
+  }
+  
+  pi2c->operation = 0;
+  
+  return prv_i2c_result(HAL_I2C_DeInit(&pi2c->handle));
+}
+
+uint8_t env_stm32f4xx_hal_i2c_transmit(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+  env_stm32f4xx_hal_i2c* pi2c = (env_stm32f4xx_hal_i2c*)pinstance;
+  
+  return prv_i2c_result(HAL_I2C_Master_Transmit(&pi2c->handle, (uint16_t)(address << pi2c->shift_address), ptxdata, size, timeout));
+}
+
+uint8_t env_stm32f4xx_hal_i2c_receive(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  env_stm32f4xx_hal_i2c* pi2c = (env_stm32f4xx_hal_i2c*)pinstance;
+  
+  return prv_i2c_result(HAL_I2C_Master_Receive(&pi2c->handle, (uint16_t)(address << pi2c->shift_address), prxdata, size, timeout));
+}
+
+/* The polling HAL has the repeated start only for the register reads of
+   memories, so the written part is limited to a 1 or 2 byte register address */
+uint8_t env_stm32f4xx_hal_i2c_write_read(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, uint32_t timeout)
+{
+  env_stm32f4xx_hal_i2c* pi2c = (env_stm32f4xx_hal_i2c*)pinstance;
+  
+  if(size_tx > 2)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  uint16_t mem_address = (size_tx == 2) ? (uint16_t)((ptxdata[0] << 8) | ptxdata[1]) : ptxdata[0];
+  uint16_t mem_size = (size_tx == 2) ? I2C_MEMADD_SIZE_16BIT : I2C_MEMADD_SIZE_8BIT;
+  
+  return prv_i2c_result(HAL_I2C_Mem_Read(&pi2c->handle, (uint16_t)(address << pi2c->shift_address), mem_address, mem_size, prxdata, size_rx, timeout));
+}
+
+uint8_t env_stm32f4xx_hal_i2c_transmit_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size)
+{
+  env_stm32f4xx_hal_i2c* pi2c = (env_stm32f4xx_hal_i2c*)pinstance;
+  
+  uint8_t res = prv_i2c_start(pi2c, I2C_OPERATION_TX, address, NULL, 0);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  return prv_i2c_started(pi2c, HAL_I2C_Master_Transmit_IT(&pi2c->handle, pi2c->address, ptxdata, size));
+}
+
+uint8_t env_stm32f4xx_hal_i2c_receive_it(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size)
+{
+  env_stm32f4xx_hal_i2c* pi2c = (env_stm32f4xx_hal_i2c*)pinstance;
+  
+  uint8_t res = prv_i2c_start(pi2c, I2C_OPERATION_RX, address, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  return prv_i2c_started(pi2c, HAL_I2C_Master_Receive_IT(&pi2c->handle, pi2c->address, prxdata, size));
+}
+
+/* The written part is the first frame of a sequence and ends without a stop,
+   its completion starts the read part with a repeated start */
+uint8_t env_stm32f4xx_hal_i2c_write_read_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx)
+{
+  env_stm32f4xx_hal_i2c* pi2c = (env_stm32f4xx_hal_i2c*)pinstance;
+  
+  uint8_t res = prv_i2c_start(pi2c, I2C_OPERATION_WRITE, address, prxdata, size_rx);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  return prv_i2c_started(pi2c, HAL_I2C_Master_Seq_Transmit_IT(&pi2c->handle, pi2c->address, ptxdata, size_tx, I2C_FIRST_FRAME));
+}
+
+uint8_t env_stm32f4xx_hal_i2c_transmit_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_hal_i2c* pi2c = (env_stm32f4xx_hal_i2c*)pinstance;
+  
+  uint8_t res = prv_i2c_start(pi2c, I2C_OPERATION_TX, address, NULL, 0);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  if(prv_i2c_link_dma(pi2c, pinstance_dma, NULL) != JHAL_RES_NO_ERRORS)
+    return prv_i2c_started(pi2c, HAL_ERROR);
+  
+  return prv_i2c_started(pi2c, HAL_I2C_Master_Transmit_DMA(&pi2c->handle, pi2c->address, ptxdata, size));
+}
+
+uint8_t env_stm32f4xx_hal_i2c_receive_dma(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_hal_i2c* pi2c = (env_stm32f4xx_hal_i2c*)pinstance;
+  
+  uint8_t res = prv_i2c_start(pi2c, I2C_OPERATION_RX, address, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  if(prv_i2c_link_dma(pi2c, NULL, pinstance_dma) != JHAL_RES_NO_ERRORS)
+    return prv_i2c_started(pi2c, HAL_ERROR);
+  
+  return prv_i2c_started(pi2c, HAL_I2C_Master_Receive_DMA(&pi2c->handle, pi2c->address, prxdata, size));
+}
+
+/* Like write_read_it, the completion of the written part starts the read
+   part on the receive stream */
+uint8_t env_stm32f4xx_hal_i2c_write_read_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, void* pinstance_dma)
+{
+  env_stm32f4xx_hal_i2c* pi2c = (env_stm32f4xx_hal_i2c*)pinstance;
+  
+  if(pi2c->config.pinstance_dma_tx == NULL)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  uint8_t res = prv_i2c_start(pi2c, I2C_OPERATION_WRITE_DMA, address, prxdata, size_rx);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  if(prv_i2c_link_dma(pi2c, pi2c->config.pinstance_dma_tx, pinstance_dma) != JHAL_RES_NO_ERRORS)
+    return prv_i2c_started(pi2c, HAL_ERROR);
+  
+  return prv_i2c_started(pi2c, HAL_I2C_Master_Seq_Transmit_DMA(&pi2c->handle, pi2c->address, ptxdata, size_tx, I2C_FIRST_FRAME));
+}
+
+/* The abort completion of the HAL comes later and is dropped, operation is
+   cleared before it */
+uint8_t env_stm32f4xx_hal_i2c_abort(void* pinstance)
+{
+  env_stm32f4xx_hal_i2c* pi2c = (env_stm32f4xx_hal_i2c*)pinstance;
+  
+  if(!pi2c->operation)
+    return JHAL_RES_NO_ERRORS;
+  
+  pi2c->operation = 0;
+  
+  return prv_i2c_result(HAL_I2C_Master_Abort_IT(&pi2c->handle, pi2c->address));
+}
+
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef* phandle)
+{
+  env_stm32f4xx_hal_i2c* pi2c = prv_i2c_by_handle(phandle);
+  
+  if(pi2c == NULL)
+    return;
+  
+  switch(pi2c->operation)
+  {
+    case I2C_OPERATION_TX:
+      pi2c->operation = 0;
+      jhal_i2c_tx_complete_callback(pi2c);
+    break;
+    case I2C_OPERATION_WRITE:
+      pi2c->operation = I2C_OPERATION_READ;
+      if(HAL_I2C_Master_Seq_Receive_IT(phandle, pi2c->address, pi2c->prxdata, pi2c->size_rx, I2C_LAST_FRAME) != HAL_OK)
+      {
+        pi2c->operation = 0;
+        jhal_i2c_error_callback(pi2c, JHAL_I2C_ERROR_BUS);
+      }
+    break;
+    case I2C_OPERATION_WRITE_DMA:
+      pi2c->operation = I2C_OPERATION_READ_DMA;
+      if(HAL_I2C_Master_Seq_Receive_DMA(phandle, pi2c->address, pi2c->prxdata, pi2c->size_rx, I2C_LAST_FRAME) != HAL_OK)
+      {
+        pi2c->operation = 0;
+        jhal_i2c_error_callback(pi2c, JHAL_I2C_ERROR_BUS);
+      }
+    break;
+  }
+}
+
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef* phandle)
+{
+  env_stm32f4xx_hal_i2c* pi2c = prv_i2c_by_handle(phandle);
+  
+  if(pi2c == NULL)
+    return;
+  
+  uint8_t operation = pi2c->operation;
+  pi2c->operation = 0;
+  
+  switch(operation)
+  {
+    case I2C_OPERATION_RX:
+      jhal_i2c_rx_complete_callback(pi2c, pi2c->prxdata, pi2c->size_rx);
+    break;
+    case I2C_OPERATION_READ:
+    case I2C_OPERATION_READ_DMA:
+      jhal_i2c_write_read_complete_callback(pi2c, pi2c->prxdata, pi2c->size_rx);
+    break;
+  }
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef* phandle)
+{
+  env_stm32f4xx_hal_i2c* pi2c = prv_i2c_by_handle(phandle);
+  
+  if(pi2c == NULL || !pi2c->operation)
+    return;
+  
+  uint32_t error_hal = HAL_I2C_GetError(phandle);
+  uint8_t error = JHAL_I2C_ERROR_BUS;
+  
+  if(error_hal & HAL_I2C_ERROR_AF)
+    error = JHAL_I2C_ERROR_NACK;
+  else if(error_hal & HAL_I2C_ERROR_ARLO)
+    error = JHAL_I2C_ERROR_ARBITRATION;
+  else if(error_hal & HAL_I2C_ERROR_OVR)
+    error = JHAL_I2C_ERROR_OVERRUN;
+  
+  pi2c->operation = 0;
+  jhal_i2c_error_callback(pi2c, error);
+}
+
+static void prv_i2c_irq_event(uint8_t index)
+{
+  if(I2CInstances[index] != NULL)
+    HAL_I2C_EV_IRQHandler(&I2CInstances[index]->handle);
+}
+
+static void prv_i2c_irq_error(uint8_t index)
+{
+  if(I2CInstances[index] != NULL)
+    HAL_I2C_ER_IRQHandler(&I2CInstances[index]->handle);
+}
+
+#ifdef I2C1
+void I2C1_EV_IRQHandler(void)
+{
+  prv_i2c_irq_event(0);
+}
+
+void I2C1_ER_IRQHandler(void)
+{
+  prv_i2c_irq_error(0);
+}
+#endif
+
+#ifdef I2C2
+void I2C2_EV_IRQHandler(void)
+{
+  prv_i2c_irq_event(1);
+}
+
+void I2C2_ER_IRQHandler(void)
+{
+  prv_i2c_irq_error(1);
+}
+#endif
+
+#ifdef I2C3
+void I2C3_EV_IRQHandler(void)
+{
+  prv_i2c_irq_event(2);
+}
+
+void I2C3_ER_IRQHandler(void)
+{
+  prv_i2c_irq_error(2);
+}
+#endif
@@ -0,0 +1,44 @@
+#ifndef __ENV_STM32F4XX_HAL_I2C__
+#define __ENV_STM32F4XX_HAL_I2C__
+
+#include "stm32f4xx_hal.h"
+
+/* The write part of write_read_dma runs on the transmit stream and the read
+   part on the receive one, so plib_data of jhal_i2c_params may point to
+   env_stm32f4xx_hal_i2c_config with the DMA instance of the transmit side.
+   pinstance_dma of transmit_dma is the transmit stream, of receive_dma and
+   write_read_dma the receive stream */
+typedef struct {
+  void*                         pinstance_dma_tx;
+} env_stm32f4xx_hal_i2c_config;
+
+/* num_module 1..3 selects I2C1..I2C3, the pins are set up by HAL_I2C_MspInit of
+   the application. The env owns the event and error interrupts of the modules
+   and the HAL I2C callbacks, handles of other code are passed over by them */
+typedef struct {
+  I2C_HandleTypeDef             handle;
+  env_stm32f4xx_hal_i2c_config  config;
+  uint8_t                       operation;
+  uint8_t                       shift_address;
+  uint16_t                      address;
+  uint8_t*                      prxdata;
+  uint16_t                      size_rx;
+} env_stm32f4xx_hal_i2c;
+
+#define env_stm32f4xx_hal_i2c_size_drv_static           sizeof(env_stm32f4xx_hal_i2c)
+
+uint32_t env_stm32f4xx_hal_i2c_size_drv(void);
+uint8_t env_stm32f4xx_hal_i2c_init(void* pinstance, jhal_i2c_params* pparams);
+uint8_t env_stm32f4xx_hal_i2c_deinit(void* pinstance);
+uint8_t env_stm32f4xx_hal_i2c_transmit(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_hal_i2c_receive(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_hal_i2c_write_read(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, uint32_t timeout);
+uint8_t env_stm32f4xx_hal_i2c_transmit_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size);
+uint8_t env_stm32f4xx_hal_i2c_receive_it(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size);
+uint8_t env_stm32f4xx_hal_i2c_write_read_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx);
+uint8_t env_stm32f4xx_hal_i2c_transmit_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_hal_i2c_receive_dma(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_hal_i2c_write_read_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, void* pinstance_dma);
+uint8_t env_stm32f4xx_hal_i2c_abort(void* pinstance);
+
+#endif
@@ -0,0 +1,492 @@
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "jhal_spi.h"
+#include "jhal_dma.h"
+#include "env_stm32f4xx_hal_spi.h"
+
+#define SPI_OPERATION_TX                1U
+#define SPI_OPERATION_RX                2U
+#define SPI_OPERATION_TXRX              3U
+
+#define SPI_AMOUNT_MODULES              6U
+#define SPI_IRQ_PRIORITY                5U
+#define SPI_FRAME_IDLE                  0xFFU
+
+static env_stm32f4xx_hal_spi* SPIInstances[SPI_AMOUNT_MODULES] = {NULL};
+
+static uint8_t prv_spi_result(HAL_StatusTypeDef status)
+{
+  switch(status)
+  {
+    case HAL_OK:
+      return JHAL_RES_NO_ERRORS;
+    case HAL_TIMEOUT:
+      return JHAL_RES_TIMEOUT;
+    default:
+      return JHAL_RES_ERROR;
+  }
+}
+
+static env_stm32f4xx_hal_spi* prv_spi_by_handle(SPI_HandleTypeDef* phandle)
+{
+  for(uint8_t i = 0; i < SPI_AMOUNT_MODULES; i++)
+  {
+    if(SPIInstances[i] != NULL && &SPIInstances[i]->handle == phandle)
+      return SPIInstances[i];
+  }
+  
+  return NULL;
+}
+
+/* The HAL master clocks a receive with the receive buffer as the transmitted
+   data, it is filled with idle frames first */
+static void prv_spi_fill_idle(env_stm32f4xx_hal_spi* pspi, uint8_t* prxdata, uint16_t size)
+{
+  memset(prxdata, SPI_FRAME_IDLE, (size_t)size * pspi->frame_size);
+}
+
+static uint8_t prv_spi_start(env_stm32f4xx_hal_spi* pspi, uint8_t operation, uint8_t* prxdata, uint16_t size)
+{
+  if(pspi->operation)
+    return JHAL_RES_ERROR;
+  
+  pspi->operation = operation;
+  pspi->prxdata = prxdata;
+  pspi->size = size;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_spi_started(env_stm32f4xx_hal_spi* pspi, HAL_StatusTypeDef status)
+{
+  if(status != HAL_OK)
+    pspi->operation = 0;
+  
+  return prv_spi_result(status);
+}
+
+static uint32_t prv_spi_periph_alignment(env_stm32f4xx_hal_spi* pspi)
+{
+  return (pspi->frame_size == 2) ? DMA_PDATAALIGN_HALFWORD : DMA_PDATAALIGN_BYTE;
+}
+
+static uint32_t prv_spi_mem_alignment(env_stm32f4xx_hal_spi* pspi)
+{
+  return (pspi->frame_size == 2) ? DMA_MDATAALIGN_HALFWORD : DMA_MDATAALIGN_BYTE;
+}
+
+/* Links the streams of a DMA transfer to the handle, the master receive needs
+   the transmit stream of the config as well */
+static uint8_t prv_spi_link_dma(env_stm32f4xx_hal_spi* pspi, void* pinstance_dma_tx, void* pinstance_dma_rx)
+{
+  pspi->handle.hdmatx = NULL;
+  pspi->handle.hdmarx = NULL;
+  
+  if(pinstance_dma_rx != NULL)
+  {
+    pspi->handle.hdmarx = env_stm32f4xx_hal_dma_link(pinstance_dma_rx, DMA_PERIPH_TO_MEMORY, prv_spi_periph_alignment(pspi), prv_spi_mem_alignment(pspi));
+    if(pspi->handle.hdmarx == NULL)
+      return JHAL_RES_ERROR;
+    pspi->handle.hdmarx->Parent = &pspi->handle;
+  }
+  
+  if(pinstance_dma_tx != NULL)
+  {
+    pspi->handle.hdmatx = env_stm32f4xx_hal_dma_link(pinstance_dma_tx, DMA_MEMORY_TO_PERIPH, prv_spi_periph_alignment(pspi), prv_spi_mem_alignment(pspi));
+    if(pspi->handle.hdmatx == NULL)
+      return JHAL_RES_ERROR;
+    pspi->handle.hdmatx->Parent = &pspi->handle;
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint32_t env_stm32f4xx_hal_spi_size_drv(void)
+{
+  return env_stm32f4xx_hal_spi_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_hal_spi_init(void* pinstance, jhal_spi_params* pparams)
+{
+  env_stm32f4xx_hal_spi* pspi = (env_stm32f4xx_hal_spi*)pinstance;
+  uint32_t pclk;
+  IRQn_Type irq;
+  
+  memset(pspi, 0, sizeof(env_stm32f4xx_hal_spi));
+  
+  if(pparams->num_module < 1 || pparams->num_module > SPI_AMOUNT_MODULES || SPIInstances[pparams->num_module - 1] != NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(!pparams->baudrate)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  switch(pparams->mode)
+  {
+    case JHAL_SPI_MODE_MASTER:
+      pspi->handle.Init.Mode = SPI_MODE_MASTER;
+      pspi->handle.Init.NSS = SPI_NSS_SOFT;
+    break;
+    case JHAL_SPI_MODE_SLAVE:
+      pspi->handle.Init.Mode = SPI_MODE_SLAVE;
+      pspi->handle.Init.NSS = SPI_NSS_HARD_INPUT;
+    break;
+    default:
+      return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->data_size)
+  {
+    case JHAL_SPI_DATA_SIZE_8BIT:       pspi->handle.Init.DataSize = SPI_DATASIZE_8BIT; pspi->frame_size = 1; break;
+    case JHAL_SPI_DATA_SIZE_16BIT:      pspi->handle.Init.DataSize = SPI_DATASIZE_16BIT; pspi->frame_size = 2; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->cpol)
+  {
+    case JHAL_SPI_CPOL_LOW:             pspi->handle.Init.CLKPolarity = SPI_POLARITY_LOW; break;
+    case JHAL_SPI_CPOL_HIGH:            pspi->handle.Init.CLKPolarity = SPI_POLARITY_HIGH; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->cpha)
+  {
+    case JHAL_SPI_CPHA_LOW:             pspi->handle.Init.CLKPhase = SPI_PHASE_1EDGE; break;
+    case JHAL_SPI_CPHA_HIGH:            pspi->handle.Init.CLKPhase = SPI_PHASE_2EDGE; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->first_bit)
+  {
+    case JHAL_SPI_FIRST_BIT_MSB:        pspi->handle.Init.FirstBit = SPI_FIRSTBIT_MSB; break;
+    case JHAL_SPI_FIRST_BIT_LSB:        pspi->handle.Init.FirstBit = SPI_FIRSTBIT_LSB; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->num_module)
+  {
+#ifdef SPI1
+    case 1:
+      __HAL_RCC_SPI1_CLK_ENABLE();
+      pspi->handle.Instance = SPI1;
+      pclk = HAL_RCC_GetPCLK2Freq();
+      irq = SPI1_IRQn;
+    break;
+#endif
+#ifdef SPI2
+    case 2:
+      __HAL_RCC_SPI2_CLK_ENABLE();
+      pspi->handle.Instance = SPI2;
+      pclk = HAL_RCC_GetPCLK1Freq();
+      irq = SPI2_IRQn;
+    break;
+#endif
+#ifdef SPI3
+    case 3:
+      __HAL_RCC_SPI3_CLK_ENABLE();
+      pspi->handle.Instance = SPI3;
+      pclk = HAL_RCC_GetPCLK1Freq();
+      irq = SPI3_IRQn;
+    break;
+#endif
+#ifdef SPI4
+    case 4:
+      __HAL_RCC_SPI4_CLK_ENABLE();
+      pspi->handle.Instance = SPI4;
+      pclk = HAL_RCC_GetPCLK2Freq();
+      irq = SPI4_IRQn;
+    break;
+#endif
+#ifdef SPI5
+    case 5:
+      __HAL_RCC_SPI5_CLK_ENABLE();
+      pspi->handle.Instance = SPI5;
+      pclk = HAL_RCC_GetPCLK2Freq();
+      irq = SPI5_IRQn;
+    break;
+#endif
+#ifdef SPI6
+    case 6:
+      __HAL_RCC_SPI6_CLK_ENABLE();
+      pspi->handle.Instance = SPI6;
+      pclk = HAL_RCC_GetPCLK2Freq();
+      irq = SPI6_IRQn;
+    break;
+#endif
+    default:
+      return JHAL_RES_NOT_SUPPORTED;
+  }
+  
+  /* The fastest clock of PCLK / 2^(BR + 1) that does not exceed baudrate */
+  uint32_t br = 0;
+  while(br < 7U && (pclk >> (br + 1U)) > pparams->baudrate)
+    br++;
+  
+  pspi->handle.Init.BaudRatePrescaler = br << SPI_CR1_BR_Pos;
+  pspi->handle.Init.Direction = SPI_DIRECTION_2LINES;
+  pspi->handle.Init.TIMode = SPI_TIMODE_DISABLE;
+  pspi->handle.Init.CRCCalculation = SPI_CRCCALCULATION_DISABLE;
+  pspi->handle.Init.CRCPolynomial = 7;
+  
+  if(HAL_SPI_Init(&pspi->handle) != HAL_OK)
+    return JHAL_RES_ERROR;
+  
+  if(pparams->plib_data != NULL)
+    pspi->config = *((env_stm32f4xx_hal_spi_config*)pparams->plib_data);
+  
+  SPIInstances[pparams->num_module - 1] = pspi;
+  
+  HAL_NVIC_SetPriority(irq, SPI_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(irq);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_hal_spi_deinit(void* pinstance)
+{
+  env_stm32f4xx_hal_spi* pspi = (env_stm32f4xx_hal_spi*)pinstance;
+  
+  env_stm32f4xx_hal_spi_abort(pinstance);
+  
+  for(uint8_t i = 0; i < SPI_AMOUNT_MODULES; i++)
+  {
+    if(SPIInstances[i] == pspi)
+      SPIInstances[i] = NULL;
+  }
+  
+  return prv_spi_result(HAL_SPI_DeInit(&pspi->handle));
+}
+
+uint8_t env_stm32f4xx_hal_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+  env_stm32f4xx_hal_spi* pspi = (env_stm32f4xx_hal_spi*)pinstance;
+  
+  return prv_spi_result(HAL_SPI_Transmit(&pspi->handle, ptxdata, size, timeout));
+}
+
+uint8_t env_stm32f4xx_hal_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  env_stm32f4xx_hal_spi* pspi = (env_stm32f4xx_hal_spi*)pinstance;
+  
+  prv_spi_fill_idle(pspi, prxdata, size);
+  
+  return prv_spi_result(HAL_SPI_Receive(&pspi->handle, prxdata, size, timeout));
+}
+
+uint8_t env_stm32f4xx_hal_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  env_stm32f4xx_hal_spi* pspi = (env_stm32f4xx_hal_spi*)pinstance;
+  
+  return prv_spi_result(HAL_SPI_TransmitReceive(&pspi->handle, ptxdata, prxdata, size, timeout));
+}
+
+uint8_t env_stm32f4xx_hal_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size)
+{
+  env_stm32f4xx_hal_spi* pspi = (env_stm32f4xx_hal_spi*)pinstance;
+  
+  uint8_t res = prv_spi_start(pspi, SPI_OPERATION_TX, NULL, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  return prv_spi_started(pspi, HAL_SPI_Transmit_IT(&pspi->handle, ptxdata, size));
+}
+
+uint8_t env_stm32f4xx_hal_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+  env_stm32f4xx_hal_spi* pspi = (env_stm32f4xx_hal_spi*)pinstance;
+  
+  uint8_t res = prv_spi_start(pspi, SPI_OPERATION_RX, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  prv_spi_fill_idle(pspi, prxdata, size);
+  
+  return prv_spi_started(pspi, HAL_SPI_Receive_IT(&pspi->handle, prxdata, size));
+}
+
+uint8_t env_stm32f4xx_hal_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  env_stm32f4xx_hal_spi* pspi = (env_stm32f4xx_hal_spi*)pinstance;
+  
+  uint8_t res = prv_spi_start(pspi, SPI_OPERATION_TXRX, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  return prv_spi_started(pspi, HAL_SPI_TransmitReceive_IT(&pspi->handle, ptxdata, prxdata, size));
+}
+
+uint8_t env_stm32f4xx_hal_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_hal_spi* pspi = (env_stm32f4xx_hal_spi*)pinstance;
+  
+  uint8_t res = prv_spi_start(pspi, SPI_OPERATION_TX, NULL, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  if(prv_spi_link_dma(pspi, pinstance_dma, NULL) != JHAL_RES_NO_ERRORS)
+    return prv_spi_started(pspi, HAL_ERROR);
+  
+  return prv_spi_started(pspi, HAL_SPI_Transmit_DMA(&pspi->handle, ptxdata, size));
+}
+
+uint8_t env_stm32f4xx_hal_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_hal_spi* pspi = (env_stm32f4xx_hal_spi*)pinstance;
+  void* pinstance_dma_tx = (pspi->handle.Init.Mode == SPI_MODE_MASTER) ? pspi->config.pinstance_dma_tx : NULL;
+  
+  if(pspi->handle.Init.Mode == SPI_MODE_MASTER && pinstance_dma_tx == NULL)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  uint8_t res = prv_spi_start(pspi, SPI_OPERATION_RX, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  if(prv_spi_link_dma(pspi, pinstance_dma_tx, pinstance_dma) != JHAL_RES_NO_ERRORS)
+    return prv_spi_started(pspi, HAL_ERROR);
+  
+  prv_spi_fill_idle(pspi, prxdata, size);
+  
+  return prv_spi_started(pspi, HAL_SPI_Receive_DMA(&pspi->handle, prxdata, size));
+}
+
+uint8_t env_stm32f4xx_hal_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_hal_spi* pspi = (env_stm32f4xx_hal_spi*)pinstance;
+  
+  if(pspi->config.pinstance_dma_tx == NULL)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  uint8_t res = prv_spi_start(pspi, SPI_OPERATION_TXRX, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  if(prv_spi_link_dma(pspi, pspi->config.pinstance_dma_tx, pinstance_dma) != JHAL_RES_NO_ERRORS)
+    return prv_spi_started(pspi, HAL_ERROR);
+  
+  return prv_spi_started(pspi, HAL_SPI_TransmitReceive_DMA(&pspi->handle, ptxdata, prxdata, size));
+}
+
+/* Cleared before the HAL abort, so nothing is reported for the aborted transfer */
+uint8_t env_stm32f4xx_hal_spi_abort(void* pinstance)
+{
+  env_stm32f4xx_hal_spi* pspi = (env_stm32f4xx_hal_spi*)pinstance;
+  
+  if(!pspi->operation)
+    return JHAL_RES_NO_ERRORS;
+  
+  pspi->operation = 0;
+  
+  return prv_spi_result(HAL_SPI_Abort(&pspi->handle));
+}
+
+static void prv_spi_complete(SPI_HandleTypeDef* phandle)
+{
+  env_stm32f4xx_hal_spi* pspi = prv_spi_by_handle(phandle);
+  
+  if(pspi == NULL)
+    return;
+  
+  uint8_t operation = pspi->operation;
+  pspi->operation = 0;
+  
+  switch(operation)
+  {
+    case SPI_OPERATION_TX:
+      jhal_spi_tx_complete_callback(pspi);
+    break;
+    case SPI_OPERATION_RX:
+      jhal_spi_rx_complete_callback(pspi, pspi->prxdata, pspi->size);
+    break;
+    case SPI_OPERATION_TXRX:
+      jhal_spi_txrx_complete_callback(pspi, pspi->prxdata, pspi->size);
+    break;
+  }
+}
+
+void HAL_SPI_TxCpltCallback(SPI_HandleTypeDef* phandle)
+{
+  prv_spi_complete(phandle);
+}
+
+void HAL_SPI_RxCpltCallback(SPI_HandleTypeDef* phandle)
+{
+  prv_spi_complete(phandle);
+}
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef* phandle)
+{
+  prv_spi_complete(phandle);
+}
+
+static uint8_t prv_spi_error(uint32_t error_code)
+{
+  if(error_code & HAL_SPI_ERROR_OVR)
+    return JHAL_SPI_ERROR_OVERRUN;
+  if(error_code & HAL_SPI_ERROR_MODF)
+    return JHAL_SPI_ERROR_MODE;
+  if(error_code & HAL_SPI_ERROR_CRC)
+    return JHAL_SPI_ERROR_CRC;
+  if(error_code & HAL_SPI_ERROR_FRE)
+    return JHAL_SPI_ERROR_FRAME;
+  
+  return JHAL_SPI_ERROR_DMA;
+}
+
+/* The HAL has stopped the transfer and both streams before the call */
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef* phandle)
+{
+  env_stm32f4xx_hal_spi* pspi = prv_spi_by_handle(phandle);
+  
+  if(pspi == NULL || !pspi->operation)
+    return;
+  
+  pspi->operation = 0;
+  jhal_spi_error_callback(pspi, prv_spi_error(phandle->ErrorCode));
+}
+
+static void prv_spi_irq(uint8_t index)
+{
+  if(SPIInstances[index] != NULL)
+    HAL_SPI_IRQHandler(&SPIInstances[index]->handle);
+}
+
+#ifdef SPI1
+void SPI1_IRQHandler(void)
+{
+  prv_spi_irq(0);
+}
+#endif
+
+#ifdef SPI2
+void SPI2_IRQHandler(void)
+{
+  prv_spi_irq(1);
+}
+#endif
+
+#ifdef SPI3
+void SPI3_IRQHandler(void)
+{
+  prv_spi_irq(2);
+}
+#endif
+
+#ifdef SPI4
+void SPI4_IRQHandler(void)
+{
+  prv_spi_irq(3);
+}
+#endif
+
+#ifdef SPI5
+void SPI5_IRQHandler(void)
+{
+  prv_spi_irq(4);
+}
+#endif
+
+#ifdef SPI6
+void SPI6_IRQHandler(void)
+{
+  prv_spi_irq(5);
+}
+#endif
@@ -0,0 +1,44 @@
+#ifndef __ENV_STM32F4XX_HAL_SPI__
+#define __ENV_STM32F4XX_HAL_SPI__
+
+#include "stm32f4xx_hal.h"
+
+/* The HAL master clocks a receive by DMA with its transmit stream, so
+   plib_data of jhal_spi_params may point to env_stm32f4xx_hal_spi_config with
+   the DMA instance of the transmit side. pinstance_dma of transmit_dma is the
+   transmit stream, of receive_dma and transmitreceive_dma the receive stream */
+typedef struct {
+  void*                         pinstance_dma_tx;
+} env_stm32f4xx_hal_spi_config;
+
+/* num_module 1..6 selects SPI1..SPI6, the pins are set up by HAL_SPI_MspInit
+   of the application, the master drives NSS by software. With 16-bit frames
+   size counts the frames. A receive sends 0xFF frames. The env owns the SPI
+   interrupts and the HAL SPI callbacks, handles of other code are passed over
+   by them */
+typedef struct {
+  SPI_HandleTypeDef             handle;
+  env_stm32f4xx_hal_spi_config  config;
+  uint8_t                       operation;
+  uint8_t                       frame_size;
+  uint8_t*                      prxdata;
+  uint16_t                      size;
+} env_stm32f4xx_hal_spi;
+
+#define env_stm32f4xx_hal_spi_size_drv_static           sizeof(env_stm32f4xx_hal_spi)
+
+uint32_t env_stm32f4xx_hal_spi_size_drv(void);
+uint8_t env_stm32f4xx_hal_spi_init(void* pinstance, jhal_spi_params* pparams);
+uint8_t env_stm32f4xx_hal_spi_deinit(void* pinstance);
+uint8_t env_stm32f4xx_hal_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_hal_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_hal_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_hal_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size);
+uint8_t env_stm32f4xx_hal_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size);
+uint8_t env_stm32f4xx_hal_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
+uint8_t env_stm32f4xx_hal_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_hal_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_hal_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_hal_spi_abort(void* pinstance);
+
+#endif
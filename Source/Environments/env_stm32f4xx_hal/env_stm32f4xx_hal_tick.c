@@ -1,32 +1,62 @@
-#include "stm32f4xx_hal.h"
-#include "jhal_tick.h"
-
-#define STM32F4XX_FREQ          180000000
-
-#define    DWT_CYCCNT    *(volatile uint32_t *)0xE0001004
-#define    DWT_CONTROL   *(volatile uint32_t *)0xE0001000
-#define    SCB_DEMCR     *(volatile uint32_t *)0xE000EDFC
-
-static uint32_t DWT_Get(void)
-{
-    return DWT_CYCCNT;
-}
-
-uint32_t env_stm32f4xx_hal_tick_init(void)
-{
-  if( !(DWT_CONTROL & 1) )
-  {
-    SCB_DEMCR |= 0x01000000;
-    DWT_CONTROL |= 1;
-  }      
-  
-  return JHAL_RES_NO_ERRORS;
-}
-
-uint32_t env_stm32f4xx_hal_tick(uint32_t delay)
-{
-    int32_t tp = DWT_Get() + delay * (STM32F4XX_FREQ / 1000000);
-    while((((int32_t)DWT_Get() - tp) < 0));
-    
-    return JHAL_RES_NO_ERRORS;
-}
+#include "stm32f4xx_hal.h"
+#include "jhal_tick.h"
+
+/* The F4 starts on the 16 MHz HSI, the clock of the waits until tick_init */
+#define STM32F4XX_RESET_FREQ_MHZ        16U
+
+#define    DWT_CYCCNT    *(volatile uint32_t *)0xE0001004
+#define    DWT_CONTROL   *(volatile uint32_t *)0xE0001000
+#define    SCB_DEMCR     *(volatile uint32_t *)0xE000EDFC
+
+static uint32_t TickCyclesInUs = STM32F4XX_RESET_FREQ_MHZ;
+
+static uint32_t DWT_Get(void)
+{
+    return DWT_CYCCNT;
+}
+
+/* Also called by jhal_tick_clock_changed, the core clock is read from the
+   HAL, which follows it through SystemCoreClock */
+uint32_t env_stm32f4xx_hal_tick_init(void)
+{
+  if( !(DWT_CONTROL & 1) )
+  {
+    SCB_DEMCR |= 0x01000000;
+    DWT_CONTROL |= 1;
+  }      
+  
+  TickCyclesInUs = HAL_RCC_GetHCLKFreq() / 1000000U;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint32_t env_stm32f4xx_hal_tick(uint32_t delay)
+{
+    int32_t tp = DWT_Get() + delay * TickCyclesInUs;
+    while((((int32_t)DWT_Get() - tp) < 0));
+    
+    return JHAL_RES_NO_ERRORS;
+}
+
+uint32_t env_stm32f4xx_hal_tick_cycles(void)
+{
+  return DWT_Get();
+}
+
+uint32_t env_stm32f4xx_hal_tick_cycles_hz(void)
+{
+  return HAL_RCC_GetHCLKFreq();
+}
+
+uint32_t env_stm32f4xx_hal_critical_enter(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  
+  return primask;
+}
+
+void env_stm32f4xx_hal_critical_exit(uint32_t state)
+{
+  __set_PRIMASK(state);
+}
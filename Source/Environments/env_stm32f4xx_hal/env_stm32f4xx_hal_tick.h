@@ -1,7 +1,11 @@
-#ifndef __ENV_STM32F4XX_HAL_TICK__
-#define __ENV_STM32F4XX_HAL_TICK__
-
-uint32_t env_stm32f4xx_hal_tick(uint32_t delay);
-uint32_t env_stm32f4xx_hal_tick(uint32_t delay);
-
+#ifndef __ENV_STM32F4XX_HAL_TICK__
+#define __ENV_STM32F4XX_HAL_TICK__
+
+uint32_t env_stm32f4xx_hal_tick_init(void);
+uint32_t env_stm32f4xx_hal_tick(uint32_t delay);
+uint32_t env_stm32f4xx_hal_tick_cycles(void);
+uint32_t env_stm32f4xx_hal_tick_cycles_hz(void);
+uint32_t env_stm32f4xx_hal_critical_enter(void);
+void env_stm32f4xx_hal_critical_exit(uint32_t state);
+
 #endif
\ No newline at end of file
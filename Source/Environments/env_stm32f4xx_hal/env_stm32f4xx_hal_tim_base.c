@@ -0,0 +1,374 @@
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "jhal_tim_base.h"
+#include "jhal_dma.h"
+#include "jhal_tick.h"
+#include "env_stm32f4xx_hal_tim_base.h"
+
+#define TIM_AMOUNT_MODULES              14U
+#define TIM_IRQ_PRIORITY                5U
+
+static env_stm32f4xx_hal_tim_base* TIMInstances[TIM_AMOUNT_MODULES] = {NULL};
+static TIM_HandleTypeDef* TIMForeign[TIM_AMOUNT_MODULES] = {NULL};
+
+static uint8_t prv_tim_base_index(TIM_TypeDef* pmodule)
+{
+  TIM_TypeDef* const modules[TIM_AMOUNT_MODULES] = {TIM1, TIM2, TIM3, TIM4, TIM5, TIM6, TIM7, TIM8, TIM9, TIM10, TIM11, TIM12, TIM13, TIM14};
+  
+  for(uint8_t i = 0; i < TIM_AMOUNT_MODULES; i++)
+  {
+    if(modules[i] == pmodule)
+      return i;
+  }
+  
+  return TIM_AMOUNT_MODULES;
+}
+
+/* The timers with the direction bit, the others only count up */
+static uint8_t prv_tim_base_has_dir(uint8_t num_module)
+{
+  return (num_module >= 1U && num_module <= 5U) || num_module == 8U;
+}
+
+static uint8_t prv_tim_base_result(HAL_StatusTypeDef status)
+{
+  switch(status)
+  {
+    case HAL_OK:
+      return JHAL_RES_NO_ERRORS;
+    case HAL_TIMEOUT:
+      return JHAL_RES_TIMEOUT;
+    default:
+      return JHAL_RES_ERROR;
+  }
+}
+
+static env_stm32f4xx_hal_tim_base* prv_tim_base_by_handle(TIM_HandleTypeDef* phandle)
+{
+  for(uint8_t i = 0; i < TIM_AMOUNT_MODULES; i++)
+  {
+    if(TIMInstances[i] != NULL && &TIMInstances[i]->handle == phandle)
+      return TIMInstances[i];
+  }
+  
+  return NULL;
+}
+
+uint32_t env_stm32f4xx_hal_tim_base_size_drv(void)
+{
+  return env_stm32f4xx_hal_tim_base_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_hal_tim_base_init(void* pinstance, jhal_tim_base_params* pparams)
+{
+  env_stm32f4xx_hal_tim_base* ptim = (env_stm32f4xx_hal_tim_base*)pinstance;
+  IRQn_Type irq;
+  
+  memset(ptim, 0, sizeof(env_stm32f4xx_hal_tim_base));
+  
+  if(pparams->num_module < 1 || pparams->num_module > TIM_AMOUNT_MODULES || TIMInstances[pparams->num_module - 1] != NULL || TIMForeign[pparams->num_module - 1] != NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(pparams->clock_source != 0 && pparams->clock_source != JHAL_TIM_CLOCK_SOURCE_INTERNAL)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  if(pparams->prescaler > 0xFFFFU)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  /* TIM2 and TIM5 are the 32-bit ones */
+  if(pparams->num_module != 2U && pparams->num_module != 5U && (pparams->period > 0xFFFFU || pparams->counter > 0xFFFFU))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  switch(pparams->clock_prescaler)
+  {
+    case 0:
+    case 1:                             ptim->handle.Init.ClockDivision = TIM_CLOCKDIVISION_DIV1; break;
+    case 2:                             ptim->handle.Init.ClockDivision = TIM_CLOCKDIVISION_DIV2; break;
+    case 4:                             ptim->handle.Init.ClockDivision = TIM_CLOCKDIVISION_DIV4; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->type_counter)
+  {
+    case JHAL_TIM_BASE_TYPE_COUNTER_UP:
+      ptim->handle.Init.CounterMode = TIM_COUNTERMODE_UP;
+    break;
+    case JHAL_TIM_BASE_TYPE_COUNTER_DOWN:
+      if(!prv_tim_base_has_dir(pparams->num_module))
+        return JHAL_RES_NOT_SUPPORTED;
+      ptim->handle.Init.CounterMode = TIM_COUNTERMODE_DOWN;
+    break;
+    default:
+      return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->num_module)
+  {
+#ifdef TIM1
+    case 1:   __HAL_RCC_TIM1_CLK_ENABLE();  ptim->handle.Instance = TIM1;  irq = TIM1_UP_TIM10_IRQn;       break;
+#endif
+#ifdef TIM2
+    case 2:   __HAL_RCC_TIM2_CLK_ENABLE();  ptim->handle.Instance = TIM2;  irq = TIM2_IRQn;                break;
+#endif
+#ifdef TIM3
+    case 3:   __HAL_RCC_TIM3_CLK_ENABLE();  ptim->handle.Instance = TIM3;  irq = TIM3_IRQn;                break;
+#endif
+#ifdef TIM4
+    case 4:   __HAL_RCC_TIM4_CLK_ENABLE();  ptim->handle.Instance = TIM4;  irq = TIM4_IRQn;                break;
+#endif
+#ifdef TIM5
+    case 5:   __HAL_RCC_TIM5_CLK_ENABLE();  ptim->handle.Instance = TIM5;  irq = TIM5_IRQn;                break;
+#endif
+#ifdef TIM6
+    case 6:   __HAL_RCC_TIM6_CLK_ENABLE();  ptim->handle.Instance = TIM6;  irq = TIM6_DAC_IRQn;            break;
+#endif
+#ifdef TIM7
+    case 7:   __HAL_RCC_TIM7_CLK_ENABLE();  ptim->handle.Instance = TIM7;  irq = TIM7_IRQn;                break;
+#endif
+#ifdef TIM8
+    case 8:   __HAL_RCC_TIM8_CLK_ENABLE();  ptim->handle.Instance = TIM8;  irq = TIM8_UP_TIM13_IRQn;       break;
+#endif
+#ifdef TIM9
+    case 9:   __HAL_RCC_TIM9_CLK_ENABLE();  ptim->handle.Instance = TIM9;  irq = TIM1_BRK_TIM9_IRQn;       break;
+#endif
+#ifdef TIM10
+    case 10:  __HAL_RCC_TIM10_CLK_ENABLE(); ptim->handle.Instance = TIM10; irq = TIM1_UP_TIM10_IRQn;       break;
+#endif
+#ifdef TIM11
+    case 11:  __HAL_RCC_TIM11_CLK_ENABLE(); ptim->handle.Instance = TIM11; irq = TIM1_TRG_COM_TIM11_IRQn;  break;
+#endif
+#ifdef TIM12
+    case 12:  __HAL_RCC_TIM12_CLK_ENABLE(); ptim->handle.Instance = TIM12; irq = TIM8_BRK_TIM12_IRQn;      break;
+#endif
+#ifdef TIM13
+    case 13:  __HAL_RCC_TIM13_CLK_ENABLE(); ptim->handle.Instance = TIM13; irq = TIM8_UP_TIM13_IRQn;       break;
+#endif
+#ifdef TIM14
+    case 14:  __HAL_RCC_TIM14_CLK_ENABLE(); ptim->handle.Instance = TIM14; irq = TIM8_TRG_COM_TIM14_IRQn;  break;
+#endif
+    default:
+      return JHAL_RES_NOT_SUPPORTED;
+  }
+  
+  ptim->handle.Init.Prescaler = pparams->prescaler;
+  ptim->handle.Init.Period = pparams->period;
+  ptim->handle.Init.RepetitionCounter = 0;
+  ptim->handle.Init.AutoReloadPreload = pparams->preload_value ? TIM_AUTORELOAD_PRELOAD_ENABLE : TIM_AUTORELOAD_PRELOAD_DISABLE;
+  
+  if(HAL_TIM_Base_Init(&ptim->handle) != HAL_OK)
+    return JHAL_RES_ERROR;
+  
+  /* The update event of the init loads PSC and sets the flag, which must not
+     be taken for a period elapsed */
+  __HAL_TIM_CLEAR_FLAG(&ptim->handle, TIM_FLAG_UPDATE);
+  __HAL_TIM_SET_COUNTER(&ptim->handle, pparams->counter);
+  
+  ptim->index = pparams->num_module - 1U;
+  TIMInstances[ptim->index] = ptim;
+  
+  HAL_NVIC_SetPriority(irq, TIM_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(irq);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_hal_tim_base_deinit(void* pinstance)
+{
+  env_stm32f4xx_hal_tim_base* ptim = (env_stm32f4xx_hal_tim_base*)pinstance;
+  
+  if(ptim->handle.Instance == NULL)
+    return JHAL_RES_NO_ERRORS;
+  
+  HAL_TIM_Base_Stop_IT(&ptim->handle);
+  if(ptim->handle.hdma[TIM_DMA_ID_UPDATE] != NULL)
+    HAL_TIM_Base_Stop_DMA(&ptim->handle);
+  
+  TIMInstances[ptim->index] = NULL;
+  
+  return prv_tim_base_result(HAL_TIM_Base_DeInit(&ptim->handle));
+}
+
+uint8_t env_stm32f4xx_hal_tim_base_start(void* pinstance)
+{
+  env_stm32f4xx_hal_tim_base* ptim = (env_stm32f4xx_hal_tim_base*)pinstance;
+  
+  return prv_tim_base_result(HAL_TIM_Base_Start(&ptim->handle));
+}
+
+uint8_t env_stm32f4xx_hal_tim_base_stop(void* pinstance)
+{
+  env_stm32f4xx_hal_tim_base* ptim = (env_stm32f4xx_hal_tim_base*)pinstance;
+  
+  return prv_tim_base_result(HAL_TIM_Base_Stop(&ptim->handle));
+}
+
+uint8_t env_stm32f4xx_hal_tim_base_start_it(void* pinstance)
+{
+  env_stm32f4xx_hal_tim_base* ptim = (env_stm32f4xx_hal_tim_base*)pinstance;
+  
+  __HAL_TIM_CLEAR_FLAG(&ptim->handle, TIM_FLAG_UPDATE);
+  
+  return prv_tim_base_result(HAL_TIM_Base_Start_IT(&ptim->handle));
+}
+
+uint8_t env_stm32f4xx_hal_tim_base_stop_it(void* pinstance)
+{
+  env_stm32f4xx_hal_tim_base* ptim = (env_stm32f4xx_hal_tim_base*)pinstance;
+  
+  return prv_tim_base_result(HAL_TIM_Base_Stop_IT(&ptim->handle));
+}
+
+/* pdata holds size words that the update events load into ARR one by one,
+   pinstance_dma is the stream of the update request of the timer. The HAL
+   reports the end of the stream as a period elapsed */
+uint8_t env_stm32f4xx_hal_tim_base_start_dma(void* pinstance, uint8_t* pdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_hal_tim_base* ptim = (env_stm32f4xx_hal_tim_base*)pinstance;
+  
+  if(pdata == NULL || !size || pinstance_dma == NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  DMA_HandleTypeDef* phandle_dma = env_stm32f4xx_hal_dma_link(pinstance_dma, DMA_MEMORY_TO_PERIPH, DMA_PDATAALIGN_WORD, DMA_MDATAALIGN_WORD);
+  if(phandle_dma == NULL)
+    return JHAL_RES_ERROR;
+  
+  phandle_dma->Parent = &ptim->handle;
+  ptim->handle.hdma[TIM_DMA_ID_UPDATE] = phandle_dma;
+  
+  return prv_tim_base_result(HAL_TIM_Base_Start_DMA(&ptim->handle, (uint32_t*)pdata, size));
+}
+
+uint8_t env_stm32f4xx_hal_tim_base_stop_dma(void* pinstance, void* pinstance_dma)
+{
+  env_stm32f4xx_hal_tim_base* ptim = (env_stm32f4xx_hal_tim_base*)pinstance;
+  (void)pinstance_dma;
+  
+  if(ptim->handle.hdma[TIM_DMA_ID_UPDATE] == NULL)
+    return JHAL_RES_NO_ERRORS;
+  
+  HAL_StatusTypeDef status = HAL_TIM_Base_Stop_DMA(&ptim->handle);
+  ptim->handle.hdma[TIM_DMA_ID_UPDATE] = NULL;
+  
+  return prv_tim_base_result(status);
+}
+
+/* The IRQ of the module stays enabled after detach, it may be shared with a
+   module of jhal_tim_base */
+uint8_t env_stm32f4xx_hal_tim_base_attach(TIM_HandleTypeDef* phandle)
+{
+  uint8_t index = prv_tim_base_index(phandle->Instance);
+  
+  if(index >= TIM_AMOUNT_MODULES || TIMInstances[index] != NULL || (TIMForeign[index] != NULL && TIMForeign[index] != phandle))
+    return JHAL_RES_ERROR;
+  
+  TIMForeign[index] = phandle;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+void env_stm32f4xx_hal_tim_base_detach(TIM_HandleTypeDef* phandle)
+{
+  uint8_t index = prv_tim_base_index(phandle->Instance);
+  
+  if(index < TIM_AMOUNT_MODULES && TIMForeign[index] == phandle)
+    TIMForeign[index] = NULL;
+}
+
+__WEAK void env_stm32f4xx_hal_tim_base_foreign_callback(TIM_HandleTypeDef* phandle)
+{
+  (void)phandle;
+}
+
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef* phandle)
+{
+  env_stm32f4xx_hal_tim_base* ptim = prv_tim_base_by_handle(phandle);
+  
+  if(ptim != NULL)
+  {
+    jhal_tim_base_period_ellapsed_callback(ptim);
+    return;
+  }
+  
+  /* An attached timer is usually the timebase of the HAL tick, its period
+     keeps the 64-bit extension of the DWT counter alive */
+  jhal_tick_keepalive();
+  env_stm32f4xx_hal_tim_base_foreign_callback(phandle);
+}
+
+static void prv_tim_base_irq(uint8_t index)
+{
+  if(TIMInstances[index] != NULL)
+    HAL_TIM_IRQHandler(&TIMInstances[index]->handle);
+  else if(TIMForeign[index] != NULL)
+    HAL_TIM_IRQHandler(TIMForeign[index]);
+}
+
+void TIM1_UP_TIM10_IRQHandler(void)
+{
+  prv_tim_base_irq(0);
+  prv_tim_base_irq(9);
+}
+
+void TIM2_IRQHandler(void)
+{
+  prv_tim_base_irq(1);
+}
+
+void TIM3_IRQHandler(void)
+{
+  prv_tim_base_irq(2);
+}
+
+void TIM4_IRQHandler(void)
+{
+  prv_tim_base_irq(3);
+}
+
+#ifdef TIM5
+void TIM5_IRQHandler(void)
+{
+  prv_tim_base_irq(4);
+}
+#endif
+
+#ifdef TIM6
+void TIM6_DAC_IRQHandler(void)
+{
+  prv_tim_base_irq(5);
+}
+#endif
+
+#ifdef TIM7
+void TIM7_IRQHandler(void)
+{
+  prv_tim_base_irq(6);
+}
+#endif
+
+void TIM1_BRK_TIM9_IRQHandler(void)
+{
+  prv_tim_base_irq(8);
+}
+
+void TIM1_TRG_COM_TIM11_IRQHandler(void)
+{
+  prv_tim_base_irq(10);
+}
+
+#ifdef TIM8
+void TIM8_UP_TIM13_IRQHandler(void)
+{
+  prv_tim_base_irq(7);
+  prv_tim_base_irq(12);
+}
+
+void TIM8_BRK_TIM12_IRQHandler(void)
+{
+  prv_tim_base_irq(11);
+}
+
+void TIM8_TRG_COM_TIM14_IRQHandler(void)
+{
+  prv_tim_base_irq(13);
+}
+#endif
@@ -0,0 +1,41 @@
+#ifndef __ENV_STM32F4XX_HAL_TIM_BASE__
+#define __ENV_STM32F4XX_HAL_TIM_BASE__
+
+#include "stm32f4xx_hal.h"
+
+/* num_module 1..14 selects TIM1..TIM14 on the internal clock, prescaler and
+   period go to PSC and ARR as they are. clock_prescaler 1, 2 or 4 is the
+   dead-time and filter clock division, a nonzero preload_value buffers ARR.
+   The env owns the update interrupts, including the ones TIM1 and TIM8 share
+   with TIM9..TIM14, and HAL_TIM_PeriodElapsedCallback. A timer the
+   application runs itself through the HAL, e.g. the TIM timebase of the HAL
+   tick, is attached with env_stm32f4xx_hal_tim_base_attach instead of a
+   TIMx_IRQHandler of its own; the env then services its interrupt and
+   passes its period elapsed to env_stm32f4xx_hal_tim_base_foreign_callback */
+typedef struct {
+  TIM_HandleTypeDef             handle;
+  uint8_t                       index;
+} env_stm32f4xx_hal_tim_base;
+
+#define env_stm32f4xx_hal_tim_base_size_drv_static      sizeof(env_stm32f4xx_hal_tim_base)
+
+uint32_t env_stm32f4xx_hal_tim_base_size_drv(void);
+uint8_t env_stm32f4xx_hal_tim_base_init(void* pinstance, jhal_tim_base_params* pparams);
+uint8_t env_stm32f4xx_hal_tim_base_deinit(void* pinstance);
+uint8_t env_stm32f4xx_hal_tim_base_start(void* pinstance);
+uint8_t env_stm32f4xx_hal_tim_base_stop(void* pinstance);
+uint8_t env_stm32f4xx_hal_tim_base_start_it(void* pinstance);
+uint8_t env_stm32f4xx_hal_tim_base_stop_it(void* pinstance);
+uint8_t env_stm32f4xx_hal_tim_base_start_dma(void* pinstance, uint8_t* pdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_hal_tim_base_stop_dma(void* pinstance, void* pinstance_dma);
+
+/* attach hands the interrupt of the module of phandle->Instance to the HAL
+   handle of the application, the module must not be a jhal_tim_base instance */
+uint8_t env_stm32f4xx_hal_tim_base_attach(TIM_HandleTypeDef* phandle);
+void env_stm32f4xx_hal_tim_base_detach(TIM_HandleTypeDef* phandle);
+
+/* Weak, the period elapsed of an attached handle, e.g. the TIM timebase of the
+   HAL tick, which the application calls HAL_IncTick from */
+void env_stm32f4xx_hal_tim_base_foreign_callback(TIM_HandleTypeDef* phandle);
+
+#endif
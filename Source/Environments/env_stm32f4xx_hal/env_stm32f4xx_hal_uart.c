@@ -0,0 +1,570 @@
+#include <string.h>
+#include "stm32f4xx_hal.h"
+#include "jhal_uart.h"
+#include "jhal_dma.h"
+#include "env_stm32f4xx_hal_uart.h"
+
+#define UART_OPERATION_TX               1U
+#define UART_OPERATION_RX               2U
+#define UART_OPERATION_TXRX             3U
+
+#define UART_AMOUNT_MODULES             8U
+#define UART_IRQ_PRIORITY               5U
+
+static env_stm32f4xx_hal_uart* UARTInstances[UART_AMOUNT_MODULES] = {NULL};
+
+static uint32_t prv_uart_baudrate(jhal_uart_baudrate baudrate)
+{
+  switch(baudrate)
+  {
+    case JHAL_UART_BAUDRATE_300:        return 300U;
+    case JHAL_UART_BAUDRATE_600:        return 600U;
+    case JHAL_UART_BAUDRATE_1200:       return 1200U;
+    case JHAL_UART_BAUDRATE_2400:       return 2400U;
+    case JHAL_UART_BAUDRATE_4800:       return 4800U;
+    case JHAL_UART_BAUDRATE_9600:       return 9600U;
+    case JHAL_UART_BAUDRATE_19200:      return 19200U;
+    case JHAL_UART_BAUDRATE_38400:      return 38400U;
+    case JHAL_UART_BAUDRATE_57600:      return 57600U;
+    case JHAL_UART_BAUDRATE_115200:     return 115200U;
+    case JHAL_UART_BAUDRATE_230400:     return 230400U;
+    case JHAL_UART_BAUDRATE_460800:     return 460800U;
+    case JHAL_UART_BAUDRATE_921600:     return 921600U;
+    default:                            return 0;
+  }
+}
+
+static uint8_t prv_uart_result(HAL_StatusTypeDef status)
+{
+  switch(status)
+  {
+    case HAL_OK:
+      return JHAL_RES_NO_ERRORS;
+    case HAL_TIMEOUT:
+      return JHAL_RES_TIMEOUT;
+    default:
+      return JHAL_RES_ERROR;
+  }
+}
+
+static env_stm32f4xx_hal_uart* prv_uart_by_handle(UART_HandleTypeDef* phandle)
+{
+  for(uint8_t i = 0; i < UART_AMOUNT_MODULES; i++)
+  {
+    if(UARTInstances[i] != NULL && &UARTInstances[i]->handle == phandle)
+      return UARTInstances[i];
+  }
+  
+  return NULL;
+}
+
+/* The HAL drops the parity bit of 7-bit frames in the IT mode only */
+static void prv_uart_mask(env_stm32f4xx_hal_uart* puart)
+{
+  if(puart->mask == 0xFFU)
+    return;
+  
+  for(uint16_t i = 0; i < puart->size_rx; i++)
+    puart->prxdata[i] &= puart->mask;
+}
+
+/* The sides of transmitreceive finish on their own, the transfer is reported
+   by the one that finishes last */
+static void prv_uart_tx_done(env_stm32f4xx_hal_uart* puart)
+{
+  uint8_t operation = puart->operation_tx;
+  
+  puart->operation_tx = 0;
+  
+  if(operation == UART_OPERATION_TX)
+    jhal_uart_tx_complete_callback(puart);
+  else if(operation == UART_OPERATION_TXRX && !puart->operation_rx)
+    jhal_uart_txrx_complete_callback(puart, puart->prxdata, puart->size_rx);
+}
+
+static void prv_uart_rx_done(env_stm32f4xx_hal_uart* puart)
+{
+  uint8_t operation = puart->operation_rx;
+  
+  puart->operation_rx = 0;
+  prv_uart_mask(puart);
+  
+  if(operation == UART_OPERATION_RX)
+    jhal_uart_rx_complete_callback(puart, puart->prxdata, puart->size_rx);
+  else if(operation == UART_OPERATION_TXRX && !puart->operation_tx)
+    jhal_uart_txrx_complete_callback(puart, puart->prxdata, puart->size_rx);
+}
+
+static uint8_t prv_uart_start(env_stm32f4xx_hal_uart* puart, uint8_t operation, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  if((ptxdata != NULL && puart->operation_tx) || (prxdata != NULL && puart->operation_rx))
+    return JHAL_RES_ERROR;
+  
+  if(ptxdata != NULL)
+    puart->operation_tx = operation;
+  
+  if(prxdata != NULL)
+  {
+    puart->operation_rx = operation;
+    puart->prxdata = prxdata;
+    puart->size_rx = size;
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* A side that failed to start is dropped, for transmitreceive the receive
+   that is already running is aborted too */
+static uint8_t prv_uart_started(env_stm32f4xx_hal_uart* puart, uint8_t operation, HAL_StatusTypeDef status)
+{
+  if(status == HAL_OK)
+    return JHAL_RES_NO_ERRORS;
+  
+  if(operation == UART_OPERATION_TXRX)
+    HAL_UART_AbortReceive(&puart->handle);
+  
+  if(operation != UART_OPERATION_RX)
+    puart->operation_tx = 0;
+  if(operation != UART_OPERATION_TX)
+    puart->operation_rx = 0;
+  
+  return prv_uart_result(status);
+}
+
+static uint8_t prv_uart_link_dma_tx(env_stm32f4xx_hal_uart* puart, void* pinstance_dma)
+{
+  puart->handle.hdmatx = env_stm32f4xx_hal_dma_link(pinstance_dma, DMA_MEMORY_TO_PERIPH, DMA_PDATAALIGN_BYTE, DMA_MDATAALIGN_BYTE);
+  if(puart->handle.hdmatx == NULL)
+    return JHAL_RES_ERROR;
+  
+  puart->handle.hdmatx->Parent = &puart->handle;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_uart_link_dma_rx(env_stm32f4xx_hal_uart* puart, void* pinstance_dma)
+{
+  puart->handle.hdmarx = env_stm32f4xx_hal_dma_link(pinstance_dma, DMA_PERIPH_TO_MEMORY, DMA_PDATAALIGN_BYTE, DMA_MDATAALIGN_BYTE);
+  if(puart->handle.hdmarx == NULL)
+    return JHAL_RES_ERROR;
+  
+  puart->handle.hdmarx->Parent = &puart->handle;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint32_t env_stm32f4xx_hal_uart_size_drv(void)
+{
+  return env_stm32f4xx_hal_uart_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_hal_uart_init(void* pinstance, jhal_uart_params* pparams)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  uint32_t baudrate = prv_uart_baudrate(pparams->baudrate);
+  uint8_t flow_ctrl = 0;
+  IRQn_Type irq;
+  
+  memset(puart, 0, sizeof(env_stm32f4xx_hal_uart));
+  
+  if(pparams->num_module < 1 || pparams->num_module > UART_AMOUNT_MODULES || UARTInstances[pparams->num_module - 1] != NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(!baudrate)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  switch(pparams->parity)
+  {
+    case JHAL_UART_PARITY_NONE:         puart->handle.Init.Parity = UART_PARITY_NONE; break;
+    case JHAL_UART_PARITY_EVEN:         puart->handle.Init.Parity = UART_PARITY_EVEN; break;
+    case JHAL_UART_PARITY_ODD:          puart->handle.Init.Parity = UART_PARITY_ODD; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  /* The parity bit is a part of the HAL word length */
+  puart->mask = 0xFFU;
+  switch(pparams->data_size)
+  {
+    case JHAL_UART_DATA_SIZE_7BIT:
+      if(pparams->parity == JHAL_UART_PARITY_NONE)
+        return JHAL_RES_NOT_SUPPORTED;
+      puart->handle.Init.WordLength = UART_WORDLENGTH_8B;
+      puart->mask = 0x7FU;
+    break;
+    case JHAL_UART_DATA_SIZE_8BIT:
+      puart->handle.Init.WordLength = (pparams->parity == JHAL_UART_PARITY_NONE) ? UART_WORDLENGTH_8B : UART_WORDLENGTH_9B;
+    break;
+    case JHAL_UART_DATA_SIZE_5BIT:
+    case JHAL_UART_DATA_SIZE_6BIT:
+    case JHAL_UART_DATA_SIZE_9BIT:
+      return JHAL_RES_NOT_SUPPORTED;
+    default:
+      return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->stop_bits)
+  {
+    case JHAL_UART_STOP_BITS_1BIT:      puart->handle.Init.StopBits = UART_STOPBITS_1; break;
+    case JHAL_UART_STOP_BITS_2BIT:      puart->handle.Init.StopBits = UART_STOPBITS_2; break;
+    case JHAL_UART_STOP_BITS_15BIT:     return JHAL_RES_NOT_SUPPORTED;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->hwr_flow_ctrl)
+  {
+    case JHAL_UART_HWR_FLOW_CTRL_NOT_USE:       puart->handle.Init.HwFlowCtl = UART_HWCONTROL_NONE; break;
+    case JHAL_UART_HWR_FLOW_CTRL_USE:           puart->handle.Init.HwFlowCtl = UART_HWCONTROL_RTS_CTS; break;
+    default:                                    return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->num_module)
+  {
+#ifdef USART1
+    case 1:   __HAL_RCC_USART1_CLK_ENABLE();  puart->handle.Instance = USART1;  irq = USART1_IRQn;  flow_ctrl = 1;  break;
+#endif
+#ifdef USART2
+    case 2:   __HAL_RCC_USART2_CLK_ENABLE();  puart->handle.Instance = USART2;  irq = USART2_IRQn;  flow_ctrl = 1;  break;
+#endif
+#ifdef USART3
+    case 3:   __HAL_RCC_USART3_CLK_ENABLE();  puart->handle.Instance = USART3;  irq = USART3_IRQn;  flow_ctrl = 1;  break;
+#endif
+#ifdef UART4
+    case 4:   __HAL_RCC_UART4_CLK_ENABLE();   puart->handle.Instance = UART4;   irq = UART4_IRQn;                  break;
+#endif
+#ifdef UART5
+    case 5:   __HAL_RCC_UART5_CLK_ENABLE();   puart->handle.Instance = UART5;   irq = UART5_IRQn;                  break;
+#endif
+#ifdef USART6
+    case 6:   __HAL_RCC_USART6_CLK_ENABLE();  puart->handle.Instance = USART6;  irq = USART6_IRQn;  flow_ctrl = 1;  break;
+#endif
+#ifdef UART7
+    case 7:   __HAL_RCC_UART7_CLK_ENABLE();   puart->handle.Instance = UART7;   irq = UART7_IRQn;                  break;
+#endif
+#ifdef UART8
+    case 8:   __HAL_RCC_UART8_CLK_ENABLE();   puart->handle.Instance = UART8;   irq = UART8_IRQn;                  break;
+#endif
+    default:
+      return JHAL_RES_NOT_SUPPORTED;
+  }
+  
+  if(puart->handle.Init.HwFlowCtl != UART_HWCONTROL_NONE && !flow_ctrl)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  puart->handle.Init.BaudRate = baudrate;
+  puart->handle.Init.Mode = UART_MODE_TX_RX;
+  puart->handle.Init.OverSampling = UART_OVERSAMPLING_16;
+  
+  if(HAL_UART_Init(&puart->handle) != HAL_OK)
+    return JHAL_RES_ERROR;
+  
+  if(pparams->plib_data != NULL)
+    puart->config = *((env_stm32f4xx_hal_uart_config*)pparams->plib_data);
+  
+  UARTInstances[pparams->num_module - 1] = puart;
+  
+  HAL_NVIC_SetPriority(irq, UART_IRQ_PRIORITY, 0);
+  HAL_NVIC_EnableIRQ(irq);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_hal_uart_deinit(void* pinstance)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  
+  env_stm32f4xx_hal_uart_abort(pinstance);
+  
+  for(uint8_t i = 0; i < UART_AMOUNT_MODULES; i++)
+  {
+    if(UARTInstances[i] == puart)
+      UARTInstances[i] = NULL;
+  }
+  
+  return prv_uart_result(HAL_UART_DeInit(&puart->handle));
+}
+
+uint8_t env_stm32f4xx_hal_uart_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  
+  return prv_uart_result(HAL_UART_Transmit(&puart->handle, ptxdata, size, timeout));
+}
+
+uint8_t env_stm32f4xx_hal_uart_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  
+  return prv_uart_result(HAL_UART_Receive(&puart->handle, prxdata, size, timeout));
+}
+
+/* The HAL has no blocking full-duplex transfer, the registers are run in
+   lockstep here so no received byte is lost while transmitting. ptxdata and
+   prxdata may be the same buffer */
+uint8_t env_stm32f4xx_hal_uart_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  USART_TypeDef* pregs = puart->handle.Instance;
+  uint32_t tickstart = HAL_GetTick();
+  uint16_t count_tx = 0;
+  uint16_t count_rx = 0;
+  
+  if(puart->handle.gState != HAL_UART_STATE_READY || puart->handle.RxState != HAL_UART_STATE_READY)
+    return JHAL_RES_ERROR;
+  
+  if(pregs->SR & (USART_SR_RXNE | USART_SR_ORE))
+    (void)pregs->DR;
+  
+  while(count_tx < size || count_rx < size || !(pregs->SR & USART_SR_TC))
+  {
+    uint32_t sr = pregs->SR;
+    
+    if(count_rx < size && (sr & USART_SR_RXNE))
+    {
+      prxdata[count_rx++] = (uint8_t)pregs->DR & puart->mask;
+      continue;
+    }
+    
+    if(count_tx < size && (sr & USART_SR_TXE))
+    {
+      pregs->DR = ptxdata[count_tx++];
+      continue;
+    }
+    
+    if(timeout != HAL_MAX_DELAY && (HAL_GetTick() - tickstart) > timeout)
+      return JHAL_RES_TIMEOUT;
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_hal_uart_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  
+  uint8_t res = prv_uart_start(puart, UART_OPERATION_TX, ptxdata, NULL, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  return prv_uart_started(puart, UART_OPERATION_TX, HAL_UART_Transmit_IT(&puart->handle, ptxdata, size));
+}
+
+uint8_t env_stm32f4xx_hal_uart_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  
+  uint8_t res = prv_uart_start(puart, UART_OPERATION_RX, NULL, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  return prv_uart_started(puart, UART_OPERATION_RX, HAL_UART_Receive_IT(&puart->handle, prxdata, size));
+}
+
+/* The receive is started first so the echo of the first byte is not missed */
+uint8_t env_stm32f4xx_hal_uart_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  
+  uint8_t res = prv_uart_start(puart, UART_OPERATION_TXRX, ptxdata, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  HAL_StatusTypeDef status = HAL_UART_Receive_IT(&puart->handle, prxdata, size);
+  if(status == HAL_OK)
+    status = HAL_UART_Transmit_IT(&puart->handle, ptxdata, size);
+  
+  return prv_uart_started(puart, UART_OPERATION_TXRX, status);
+}
+
+uint8_t env_stm32f4xx_hal_uart_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  
+  uint8_t res = prv_uart_start(puart, UART_OPERATION_TX, ptxdata, NULL, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  if(prv_uart_link_dma_tx(puart, pinstance_dma) != JHAL_RES_NO_ERRORS)
+    return prv_uart_started(puart, UART_OPERATION_TX, HAL_ERROR);
+  
+  return prv_uart_started(puart, UART_OPERATION_TX, HAL_UART_Transmit_DMA(&puart->handle, ptxdata, size));
+}
+
+uint8_t env_stm32f4xx_hal_uart_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  
+  uint8_t res = prv_uart_start(puart, UART_OPERATION_RX, NULL, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  if(prv_uart_link_dma_rx(puart, pinstance_dma) != JHAL_RES_NO_ERRORS)
+    return prv_uart_started(puart, UART_OPERATION_RX, HAL_ERROR);
+  
+  return prv_uart_started(puart, UART_OPERATION_RX, HAL_UART_Receive_DMA(&puart->handle, prxdata, size));
+}
+
+uint8_t env_stm32f4xx_hal_uart_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  
+  if(puart->config.pinstance_dma_tx == NULL)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  uint8_t res = prv_uart_start(puart, UART_OPERATION_TXRX, ptxdata, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  if(prv_uart_link_dma_rx(puart, pinstance_dma) != JHAL_RES_NO_ERRORS || prv_uart_link_dma_tx(puart, puart->config.pinstance_dma_tx) != JHAL_RES_NO_ERRORS)
+  {
+    puart->operation_tx = 0;
+    puart->operation_rx = 0;
+    return JHAL_RES_ERROR;
+  }
+  
+  HAL_StatusTypeDef status = HAL_UART_Receive_DMA(&puart->handle, prxdata, size);
+  if(status == HAL_OK)
+    status = HAL_UART_Transmit_DMA(&puart->handle, ptxdata, size);
+  
+  return prv_uart_started(puart, UART_OPERATION_TXRX, status);
+}
+
+/* Cleared before the HAL abort, so nothing is reported for the aborted transfer */
+uint8_t env_stm32f4xx_hal_uart_abort(void* pinstance)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  
+  if(!puart->operation_tx && !puart->operation_rx)
+    return JHAL_RES_NO_ERRORS;
+  
+  puart->operation_tx = 0;
+  puart->operation_rx = 0;
+  
+  return prv_uart_result(HAL_UART_Abort(&puart->handle));
+}
+
+uint8_t env_stm32f4xx_hal_uart_set_baudrate(void* pinstance, jhal_uart_baudrate baudrate)
+{
+  env_stm32f4xx_hal_uart* puart = (env_stm32f4xx_hal_uart*)pinstance;
+  uint32_t value = prv_uart_baudrate(baudrate);
+  
+  if(!value)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(puart->operation_tx || puart->operation_rx)
+    return JHAL_RES_ERROR;
+  
+  puart->handle.Init.BaudRate = value;
+  
+  return prv_uart_result(HAL_UART_Init(&puart->handle));
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef* phandle)
+{
+  env_stm32f4xx_hal_uart* puart = prv_uart_by_handle(phandle);
+  
+  if(puart != NULL)
+    prv_uart_tx_done(puart);
+}
+
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef* phandle)
+{
+  env_stm32f4xx_hal_uart* puart = prv_uart_by_handle(phandle);
+  
+  if(puart != NULL)
+    prv_uart_rx_done(puart);
+}
+
+static uint8_t prv_uart_error(uint32_t error_code)
+{
+  if(error_code & HAL_UART_ERROR_ORE)
+    return JHAL_UART_ERROR_OVERRUN;
+  if(error_code & HAL_UART_ERROR_FE)
+    return JHAL_UART_ERROR_FRAMING;
+  if(error_code & HAL_UART_ERROR_NE)
+    return JHAL_UART_ERROR_NOISE;
+  if(error_code & HAL_UART_ERROR_PE)
+    return JHAL_UART_ERROR_PARITY;
+  
+  return JHAL_UART_ERROR_DMA;
+}
+
+/* The HAL keeps receiving after a parity, framing or noise error and stops on
+   an overrun or a DMA error. Either way the data of the transfer is lost, so
+   both sides are stopped and the transfer ends with the error */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef* phandle)
+{
+  env_stm32f4xx_hal_uart* puart = prv_uart_by_handle(phandle);
+  
+  if(puart == NULL || (!puart->operation_tx && !puart->operation_rx))
+    return;
+  
+  uint8_t error = prv_uart_error(phandle->ErrorCode);
+  
+  puart->operation_tx = 0;
+  puart->operation_rx = 0;
+  HAL_UART_Abort(phandle);
+  
+  jhal_uart_error_callback(puart, error);
+}
+
+static void prv_uart_irq(uint8_t index)
+{
+  if(UARTInstances[index] != NULL)
+    HAL_UART_IRQHandler(&UARTInstances[index]->handle);
+}
+
+#ifdef USART1
+void USART1_IRQHandler(void)
+{
+  prv_uart_irq(0);
+}
+#endif
+
+#ifdef USART2
+void USART2_IRQHandler(void)
+{
+  prv_uart_irq(1);
+}
+#endif
+
+#ifdef USART3
+void USART3_IRQHandler(void)
+{
+  prv_uart_irq(2);
+}
+#endif
+
+#ifdef UART4
+void UART4_IRQHandler(void)
+{
+  prv_uart_irq(3);
+}
+#endif
+
+#ifdef UART5
+void UART5_IRQHandler(void)
+{
+  prv_uart_irq(4);
+}
+#endif
+
+#ifdef USART6
+void USART6_IRQHandler(void)
+{
+  prv_uart_irq(5);
+}
+#endif
+
+#ifdef UART7
+void UART7_IRQHandler(void)
+{
+  prv_uart_irq(6);
+}
+#endif
+
+#ifdef UART8
+void UART8_IRQHandler(void)
+{
+  prv_uart_irq(7);
+}
+#endif
@@ -0,0 +1,45 @@
+#ifndef __ENV_STM32F4XX_HAL_UART__
+#define __ENV_STM32F4XX_HAL_UART__
+
+#include "stm32f4xx_hal.h"
+
+/* plib_data of jhal_uart_params may point to env_stm32f4xx_hal_uart_config
+   with the DMA instance of the transmit side for transmitreceive_dma, whose
+   pinstance_dma is the receive stream */
+typedef struct {
+  void*                         pinstance_dma_tx;
+} env_stm32f4xx_hal_uart_config;
+
+/* num_module 1..8 selects USART1..3, UART4..5, USART6, UART7..8, the pins are
+   set up by HAL_UART_MspInit of the application, the flow control is on
+   USART1..3 and USART6 only. 9-bit data and 1.5 stop bits are not supported.
+   The env owns the UART interrupts and the HAL UART callbacks, handles of
+   other code are passed over by them */
+typedef struct {
+  UART_HandleTypeDef            handle;
+  env_stm32f4xx_hal_uart_config config;
+  uint8_t                       mask;
+  uint8_t                       operation_tx;
+  uint8_t                       operation_rx;
+  uint8_t*                      prxdata;
+  uint16_t                      size_rx;
+} env_stm32f4xx_hal_uart;
+
+#define env_stm32f4xx_hal_uart_size_drv_static          sizeof(env_stm32f4xx_hal_uart)
+
+uint32_t env_stm32f4xx_hal_uart_size_drv(void);
+uint8_t env_stm32f4xx_hal_uart_init(void* pinstance, jhal_uart_params* pparams);
+uint8_t env_stm32f4xx_hal_uart_deinit(void* pinstance);
+uint8_t env_stm32f4xx_hal_uart_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_hal_uart_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_hal_uart_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_hal_uart_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size);
+uint8_t env_stm32f4xx_hal_uart_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size);
+uint8_t env_stm32f4xx_hal_uart_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
+uint8_t env_stm32f4xx_hal_uart_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_hal_uart_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_hal_uart_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_hal_uart_abort(void* pinstance);
+uint8_t env_stm32f4xx_hal_uart_set_baudrate(void* pinstance, jhal_uart_baudrate baudrate);
+
+#endif
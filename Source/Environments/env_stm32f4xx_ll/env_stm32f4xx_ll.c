@@ -0,0 +1,56 @@
+#include "jhal_environment.h"
+#include "env_stm32f4xx_ll.h"
+
+static const uint8_t APBShifts[8] = {0, 0, 0, 0, 1, 2, 3, 4};
+
+uint32_t env_stm32f4xx_ll_pclk_hz(uint8_t bus)
+{
+  uint32_t ppre;
+  
+  if(bus == ENV_STM32F4XX_LL_BUS_APB2)
+    ppre = (RCC->CFGR & RCC_CFGR_PPRE2) >> RCC_CFGR_PPRE2_Pos;
+  else
+    ppre = (RCC->CFGR & RCC_CFGR_PPRE1) >> RCC_CFGR_PPRE1_Pos;
+  
+  return SystemCoreClock >> APBShifts[ppre];
+}
+
+void env_stm32f4xx_ll_irq_enable(IRQn_Type irq)
+{
+  NVIC_SetPriority(irq, ENV_STM32F4XX_LL_IRQ_PRIORITY);
+  NVIC_ClearPendingIRQ(irq);
+  NVIC_EnableIRQ(irq);
+}
+
+void env_stm32f4xx_ll_timeout_start(env_stm32f4xx_ll_timeout* ptimeout, uint32_t timeout)
+{
+  ptimeout->cycles_last = DWT->CYCCNT;
+  ptimeout->cycles = 0;
+  ptimeout->timeout = timeout;
+}
+
+/* The elapsed cycles are taken in steps, so the 32-bit counter may wrap any
+   number of times during a long timeout */
+uint8_t env_stm32f4xx_ll_timeout_expired(env_stm32f4xx_ll_timeout* ptimeout)
+{
+  uint32_t cycles_ms = SystemCoreClock / 1000U;
+  uint32_t cycles_now = DWT->CYCCNT;
+  
+  if(ptimeout->timeout == ENV_STM32F4XX_LL_TIMEOUT_MAX)
+    return 0;
+  
+  if(!ptimeout->timeout)
+    return 1;
+  
+  ptimeout->cycles += cycles_now - ptimeout->cycles_last;
+  ptimeout->cycles_last = cycles_now;
+  
+  while(ptimeout->cycles >= cycles_ms)
+  {
+    ptimeout->cycles -= cycles_ms;
+    if(!--ptimeout->timeout)
+      return 1;
+  }
+  
+  return 0;
+}
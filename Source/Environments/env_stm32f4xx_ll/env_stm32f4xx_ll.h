@@ -0,0 +1,31 @@
+#ifndef __ENV_STM32F4XX_LL__
+#define __ENV_STM32F4XX_LL__
+
+/* Selected by JHAL_MCU=stm32f4xx and JHAL_LIB=ll. The env works on the
+   registers through the CMSIS device header only. The application sets up the
+   clocks (SystemCoreClock is kept by SystemCoreClockUpdate) and the alternate
+   functions of the pins, jhal_tick_init starts the DWT counter the timeouts of
+   the blocking calls are counted on */
+
+#include "stm32f4xx.h"
+
+#define ENV_STM32F4XX_LL_IRQ_PRIORITY                   5U
+#define ENV_STM32F4XX_LL_TIMEOUT_MAX                    0xFFFFFFFFU
+
+#define ENV_STM32F4XX_LL_BUS_APB1                       1U
+#define ENV_STM32F4XX_LL_BUS_APB2                       2U
+
+/* Millisecond timeout of a blocking call, ENV_STM32F4XX_LL_TIMEOUT_MAX waits
+   forever */
+typedef struct {
+  uint32_t                      cycles_last;
+  uint32_t                      cycles;
+  uint32_t                      timeout;
+} env_stm32f4xx_ll_timeout;
+
+uint32_t env_stm32f4xx_ll_pclk_hz(uint8_t bus);
+void env_stm32f4xx_ll_irq_enable(IRQn_Type irq);
+void env_stm32f4xx_ll_timeout_start(env_stm32f4xx_ll_timeout* ptimeout, uint32_t timeout);
+uint8_t env_stm32f4xx_ll_timeout_expired(env_stm32f4xx_ll_timeout* ptimeout);
+
+#endif
@@ -0,0 +1,96 @@
+#include <string.h>
+#include "jhal_crc.h"
+#include "env_stm32f4xx_ll_crc.h"
+#include "env_stm32f4xx_ll_tick.h"
+
+#define CRC_UNIT_POLYNOMIAL     0x04C11DB7U
+#define CRC_UNIT_RESET_VALUE    0xFFFFFFFFU
+
+/* The unit is shared by all instances, a block that finds it busy is
+   calculated in software by jhal_crc */
+static volatile uint8_t UnitBusy = 0;
+
+/* The data register can not be written directly, so the word which turns the
+   reset value into the wanted register is found by running the 32 steps of
+   the unit backwards */
+static uint32_t prv_crc_preload_word(uint32_t state)
+{
+  for(uint8_t i = 0; i < 32; i++)
+  {
+    uint32_t top = state & 1U;
+    
+    if(top)
+      state ^= CRC_UNIT_POLYNOMIAL;
+    state = (state >> 1) | (top << 31);
+  }
+  
+  return state ^ CRC_UNIT_RESET_VALUE;
+}
+
+uint32_t env_stm32f4xx_ll_crc_size_drv(void)
+{
+  return env_stm32f4xx_ll_crc_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_ll_crc_init(void* pinstance, jhal_crc_params* pparams)
+{
+  env_stm32f4xx_ll_crc* pcrc = (env_stm32f4xx_ll_crc*)pinstance;
+  
+  if(pparams->width != 32 || pparams->polynomial != CRC_UNIT_POLYNOMIAL)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  pcrc->reflect = pparams->reflect_in;
+  RCC->AHB1ENR |= RCC_AHB1ENR_CRCEN;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_crc_deinit(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_crc_accumulate(void* pinstance, const uint8_t* pdata, uint32_t size, uint32_t* pstate)
+{
+  env_stm32f4xx_ll_crc* pcrc = (env_stm32f4xx_ll_crc*)pinstance;
+  
+  uint32_t primask = env_stm32f4xx_ll_critical_enter();
+  if(UnitBusy)
+  {
+    env_stm32f4xx_ll_critical_exit(primask);
+    return JHAL_RES_ERROR;
+  }
+  UnitBusy = 1;
+  env_stm32f4xx_ll_critical_exit(primask);
+  
+  /* The unit holds the register in normal form, reflected models keep it reversed */
+  uint32_t state = pcrc->reflect ? __RBIT(*pstate) : *pstate;
+  
+  CRC->CR = CRC_CR_RESET;
+  CRC->DR = prv_crc_preload_word(state);
+  
+  for(; size >= sizeof(uint32_t); size -= sizeof(uint32_t), pdata += sizeof(uint32_t))
+  {
+    uint32_t word;
+    memcpy(&word, pdata, sizeof(uint32_t));
+    CRC->DR = pcrc->reflect ? __RBIT(word) : __REV(word);
+  }
+  
+  state = CRC->DR;
+  UnitBusy = 0;
+  
+  while(size--)
+  {
+    uint32_t byte = *pdata++;
+    
+    state ^= pcrc->reflect ? __RBIT(byte) : byte << 24;
+    for(uint8_t i = 0; i < 8; i++)
+      state = (state << 1) ^ (CRC_UNIT_POLYNOMIAL & (0U - (state >> 31)));
+  }
+  
+  *pstate = pcrc->reflect ? __RBIT(state) : state;
+  
+  return JHAL_RES_NO_ERRORS;
+}
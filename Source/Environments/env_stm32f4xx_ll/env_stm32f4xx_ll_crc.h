@@ -0,0 +1,20 @@
+#ifndef __ENV_STM32F4XX_LL_CRC__
+#define __ENV_STM32F4XX_LL_CRC__
+
+#include "env_stm32f4xx_ll.h"
+
+/* The unit runs CRC-32 with the polynomial 0x04C11DB7 over 32-bit words, MSB
+   first. Reflected models feed bit reversed words, the tail of a block shorter
+   than a word is finished in place */
+typedef struct {
+  uint8_t                       reflect;
+} env_stm32f4xx_ll_crc;
+
+#define env_stm32f4xx_ll_crc_size_drv_static           sizeof(env_stm32f4xx_ll_crc)
+
+uint32_t env_stm32f4xx_ll_crc_size_drv(void);
+uint8_t env_stm32f4xx_ll_crc_init(void* pinstance, jhal_crc_params* pparams);
+uint8_t env_stm32f4xx_ll_crc_deinit(void* pinstance);
+uint8_t env_stm32f4xx_ll_crc_accumulate(void* pinstance, const uint8_t* pdata, uint32_t size, uint32_t* pstate);
+
+#endif
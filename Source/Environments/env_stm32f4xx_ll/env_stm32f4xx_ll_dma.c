@@ -0,0 +1,345 @@
+#include <string.h>
+#include "jhal_dma.h"
+#include "env_stm32f4xx_ll_dma.h"
+
+#define DMA_AMOUNT_STREAMS              16U
+#define DMA_STREAMS_PER_MODULE          8U
+#define DMA_SIZE_MAX                    0xFFFFU
+
+#define DMA_FLAG_FE                     (1U << 0)
+#define DMA_FLAG_DME                    (1U << 2)
+#define DMA_FLAG_TE                     (1U << 3)
+#define DMA_FLAG_HT                     (1U << 4)
+#define DMA_FLAG_TC                     (1U << 5)
+#define DMA_FLAGS_ALL                   (DMA_FLAG_FE | DMA_FLAG_DME | DMA_FLAG_TE | DMA_FLAG_HT | DMA_FLAG_TC)
+
+/* Fields of the control register an instance keeps for the peripheral transfers */
+#define DMA_CR_INSTANCE                 (DMA_SxCR_CHSEL | DMA_SxCR_PL)
+
+static env_stm32f4xx_ll_dma* DMAInstances[DMA_AMOUNT_STREAMS] = {NULL};
+
+static DMA_Stream_TypeDef* const DMAStreams[DMA_AMOUNT_STREAMS] = {
+  DMA1_Stream0, DMA1_Stream1, DMA1_Stream2, DMA1_Stream3, DMA1_Stream4, DMA1_Stream5, DMA1_Stream6, DMA1_Stream7,
+  DMA2_Stream0, DMA2_Stream1, DMA2_Stream2, DMA2_Stream3, DMA2_Stream4, DMA2_Stream5, DMA2_Stream6, DMA2_Stream7};
+
+static const IRQn_Type DMAIRQs[DMA_AMOUNT_STREAMS] = {
+  DMA1_Stream0_IRQn, DMA1_Stream1_IRQn, DMA1_Stream2_IRQn, DMA1_Stream3_IRQn, 
+  DMA1_Stream4_IRQn, DMA1_Stream5_IRQn, DMA1_Stream6_IRQn, DMA1_Stream7_IRQn,
+  DMA2_Stream0_IRQn, DMA2_Stream1_IRQn, DMA2_Stream2_IRQn, DMA2_Stream3_IRQn, 
+  DMA2_Stream4_IRQn, DMA2_Stream5_IRQn, DMA2_Stream6_IRQn, DMA2_Stream7_IRQn};
+
+static const uint8_t DMAFlagShifts[4] = {0, 6, 16, 22};
+
+/* PL of the jhal priorities, the lowest two share the low level */
+static const uint8_t DMAPriorities[] = {0, 0, 1, 2, 3};
+
+static uint32_t prv_dma_size_bits(jhal_dma_data_size data_size)
+{
+  switch(data_size)
+  {
+    case JHAL_DMA_DATA_SIZE_16BIT:      return 1U;
+    case JHAL_DMA_DATA_SIZE_32BIT:      return 2U;
+    default:                            return 0U;
+  }
+}
+
+static void prv_dma_disable(env_stm32f4xx_ll_dma* pdma)
+{
+  pdma->pstream->CR &= ~(DMA_SxCR_EN | DMA_SxCR_TCIE | DMA_SxCR_TEIE);
+  while(pdma->pstream->CR & DMA_SxCR_EN);
+  
+  *pdma->pifcr = DMA_FLAGS_ALL << pdma->shift;
+}
+
+static uint8_t prv_dma_program(env_stm32f4xx_ll_dma* pdma, uint32_t cr, uint32_t fcr, uint32_t periph, uint32_t memory, uint32_t size)
+{
+  if(pdma->pstream->CR & DMA_SxCR_EN)
+    return JHAL_RES_ERROR;
+  
+  if(!size || size > DMA_SIZE_MAX)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  *pdma->pifcr = DMA_FLAGS_ALL << pdma->shift;
+  pdma->pstream->PAR = periph;
+  pdma->pstream->M0AR = memory;
+  pdma->pstream->NDTR = size;
+  pdma->pstream->FCR = fcr;
+  pdma->pstream->CR = cr;
+  pdma->pstream->CR = cr | DMA_SxCR_EN;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_dma_start(env_stm32f4xx_ll_dma* pdma, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size, uint32_t cr_it)
+{
+  /* The peripheral port reads the source of the memory to memory transfers */
+  if(pdma->periph_to_memory)
+    return prv_dma_program(pdma, pdma->cr | cr_it, pdma->fcr, (uint32_t)srcaddress, (uint32_t)dstaddress, size);
+  
+  return prv_dma_program(pdma, pdma->cr | cr_it, pdma->fcr, (uint32_t)dstaddress, (uint32_t)srcaddress, size);
+}
+
+uint32_t env_stm32f4xx_ll_dma_size_drv(void)
+{
+  return env_stm32f4xx_ll_dma_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_ll_dma_init(void* pinstance, jhal_dma_params* pparams)
+{
+  env_stm32f4xx_ll_dma* pdma = (env_stm32f4xx_ll_dma*)pinstance;
+  uint32_t size_src = prv_dma_size_bits(pparams->source_data_size);
+  uint32_t size_dst = prv_dma_size_bits(pparams->destination_data_size);
+  uint32_t inc_src = (pparams->source_increment_type == JHAL_DMA_INCREMENT_TYPE_ENABLE) ? 1U : 0U;
+  uint32_t inc_dst = (pparams->destination_increment_type == JHAL_DMA_INCREMENT_TYPE_ENABLE) ? 1U : 0U;
+  uint8_t request = 0;
+  
+  memset(pdma, 0, sizeof(env_stm32f4xx_ll_dma));
+  
+  if(pparams->num_module < 1 || pparams->num_module > 2 || pparams->num_channel >= DMA_STREAMS_PER_MODULE)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint8_t index = (uint8_t)((pparams->num_module - 1U) * DMA_STREAMS_PER_MODULE + pparams->num_channel);
+  
+  if(DMAInstances[index] != NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(pparams->plib_data != NULL)
+    request = ((env_stm32f4xx_ll_dma_config*)pparams->plib_data)->request;
+  
+  if(request >= 8U)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  pdma->cr = ((uint32_t)request << DMA_SxCR_CHSEL_Pos) | ((uint32_t)DMAPriorities[(pparams->priority > JHAL_DMA_PRIORITY_HIGHEST) ? JHAL_DMA_PRIORITY_HIGHEST : pparams->priority] << DMA_SxCR_PL_Pos);
+  
+  switch(pparams->direction)
+  {
+    case JHAL_DMA_DIRECTION_PERIPH_TO_MEM:
+      pdma->periph_to_memory = 1;
+      pdma->cr |= (size_src << DMA_SxCR_PSIZE_Pos) | (size_dst << DMA_SxCR_MSIZE_Pos) | (inc_src << DMA_SxCR_PINC_Pos) | (inc_dst << DMA_SxCR_MINC_Pos);
+    break;
+    case JHAL_DMA_DIRECTION_MEM_TO_PERIPH:
+      pdma->cr |= DMA_SxCR_DIR_0 | (size_dst << DMA_SxCR_PSIZE_Pos) | (size_src << DMA_SxCR_MSIZE_Pos) | (inc_dst << DMA_SxCR_PINC_Pos) | (inc_src << DMA_SxCR_MINC_Pos);
+    break;
+    case JHAL_DMA_DIRECTION_MEM_TO_MEM:
+      if(pparams->num_module != 2)
+        return JHAL_RES_NOT_SUPPORTED;
+      pdma->periph_to_memory = 1;
+      pdma->cr |= DMA_SxCR_DIR_1 | (size_src << DMA_SxCR_PSIZE_Pos) | (size_dst << DMA_SxCR_MSIZE_Pos) | (inc_src << DMA_SxCR_PINC_Pos) | (inc_dst << DMA_SxCR_MINC_Pos);
+    break;
+    default:
+      return JHAL_RES_NOT_SUPPORTED;
+  }
+  
+  /* Packing of different sizes and the memory to memory mode need the FIFO */
+  if(size_src != size_dst || pparams->direction == JHAL_DMA_DIRECTION_MEM_TO_MEM)
+    pdma->fcr = DMA_SxFCR_DMDIS | DMA_SxFCR_FTH;
+  
+  RCC->AHB1ENR |= (pparams->num_module == 1) ? RCC_AHB1ENR_DMA1EN : RCC_AHB1ENR_DMA2EN;
+  (void)RCC->AHB1ENR;
+  
+  uint8_t stream = pparams->num_channel;
+  DMA_TypeDef* pcontroller = (pparams->num_module == 1) ? DMA1 : DMA2;
+  
+  pdma->pstream = DMAStreams[index];
+  pdma->pisr = (stream < 4U) ? &pcontroller->LISR : &pcontroller->HISR;
+  pdma->pifcr = (stream < 4U) ? &pcontroller->LIFCR : &pcontroller->HIFCR;
+  pdma->shift = DMAFlagShifts[stream & 3U];
+  pdma->index = index;
+  
+  prv_dma_disable(pdma);
+  DMAInstances[index] = pdma;
+  env_stm32f4xx_ll_irq_enable(DMAIRQs[index]);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_dma_deinit(void* pinstance)
+{
+  env_stm32f4xx_ll_dma* pdma = (env_stm32f4xx_ll_dma*)pinstance;
+  
+  if(pdma->pstream == NULL)
+    return JHAL_RES_NO_ERRORS;
+  
+  prv_dma_disable(pdma);
+  NVIC_DisableIRQ(DMAIRQs[pdma->index]);
+  DMAInstances[pdma->index] = NULL;
+  pdma->pfunc_complete = NULL;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_dma_start(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size)
+{
+  env_stm32f4xx_ll_dma* pdma = (env_stm32f4xx_ll_dma*)pinstance;
+  
+  uint8_t res = prv_dma_start(pdma, srcaddress, dstaddress, size, 0);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  uint32_t flags;
+  do {
+    flags = (*pdma->pisr >> pdma->shift) & (DMA_FLAG_TC | DMA_FLAG_TE);
+  } while(!flags);
+  
+  *pdma->pifcr = DMA_FLAGS_ALL << pdma->shift;
+  
+  return (flags & DMA_FLAG_TE) ? JHAL_RES_ERROR : JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_dma_stop(void* pinstance)
+{
+  prv_dma_disable((env_stm32f4xx_ll_dma*)pinstance);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_dma_start_it(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size)
+{
+  env_stm32f4xx_ll_dma* pdma = (env_stm32f4xx_ll_dma*)pinstance;
+  
+  if(pdma->pstream->CR & DMA_SxCR_EN)
+    return JHAL_RES_ERROR;
+  
+  pdma->pfunc_complete = NULL;
+  
+  return prv_dma_start(pdma, srcaddress, dstaddress, size, DMA_SxCR_TCIE | DMA_SxCR_TEIE);
+}
+
+uint8_t env_stm32f4xx_ll_dma_stop_it(void* pinstance)
+{
+  prv_dma_disable((env_stm32f4xx_ll_dma*)pinstance);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_dma_start_periph(void* pinstance, uint32_t cr, volatile void* pperiph, const void* pmemory, uint16_t size,
+                                           env_stm32f4xx_ll_dma_complete pfunc_complete, void* pcontext)
+{
+  env_stm32f4xx_ll_dma* pdma = (env_stm32f4xx_ll_dma*)pinstance;
+  
+  if(pdma->pstream->CR & DMA_SxCR_EN)
+    return JHAL_RES_ERROR;
+  
+  cr |= pdma->cr & DMA_CR_INSTANCE;
+  if(pfunc_complete != NULL)
+    cr |= DMA_SxCR_TCIE | DMA_SxCR_TEIE;
+  
+  pdma->pfunc_complete = pfunc_complete;
+  pdma->pcontext = pcontext;
+  
+  return prv_dma_program(pdma, cr, 0, (uint32_t)(uintptr_t)pperiph, (uint32_t)(uintptr_t)pmemory, size);
+}
+
+void env_stm32f4xx_ll_dma_stop_periph(void* pinstance)
+{
+  env_stm32f4xx_ll_dma* pdma = (env_stm32f4xx_ll_dma*)pinstance;
+  
+  prv_dma_disable(pdma);
+  pdma->pfunc_complete = NULL;
+}
+
+/* A transfer error disables the stream, jhal_dma has no error callback so it
+   ends the transfer the same way as the completion */
+static void prv_dma_irq(uint8_t index)
+{
+  env_stm32f4xx_ll_dma* pdma = DMAInstances[index];
+  
+  if(pdma == NULL)
+    return;
+  
+  uint32_t flags = (*pdma->pisr >> pdma->shift) & DMA_FLAGS_ALL;
+  *pdma->pifcr = flags << pdma->shift;
+  
+  if(!(flags & (DMA_FLAG_TC | DMA_FLAG_TE)))
+    return;
+  
+  pdma->pstream->CR &= ~(DMA_SxCR_TCIE | DMA_SxCR_TEIE);
+  
+  env_stm32f4xx_ll_dma_complete pfunc_complete = pdma->pfunc_complete;
+  pdma->pfunc_complete = NULL;
+  
+  if(pfunc_complete != NULL)
+    pfunc_complete(pdma->pcontext, (flags & DMA_FLAG_TE) ? 1U : 0U);
+  else
+    jhal_dma_transfer_complete_callback(pdma);
+}
+
+void DMA1_Stream0_IRQHandler(void)
+{
+  prv_dma_irq(0);
+}
+
+void DMA1_Stream1_IRQHandler(void)
+{
+  prv_dma_irq(1);
+}
+
+void DMA1_Stream2_IRQHandler(void)
+{
+  prv_dma_irq(2);
+}
+
+void DMA1_Stream3_IRQHandler(void)
+{
+  prv_dma_irq(3);
+}
+
+void DMA1_Stream4_IRQHandler(void)
+{
+  prv_dma_irq(4);
+}
+
+void DMA1_Stream5_IRQHandler(void)
+{
+  prv_dma_irq(5);
+}
+
+void DMA1_Stream6_IRQHandler(void)
+{
+  prv_dma_irq(6);
+}
+
+void DMA1_Stream7_IRQHandler(void)
+{
+  prv_dma_irq(7);
+}
+
+void DMA2_Stream0_IRQHandler(void)
+{
+  prv_dma_irq(8);
+}
+
+void DMA2_Stream1_IRQHandler(void)
+{
+  prv_dma_irq(9);
+}
+
+void DMA2_Stream2_IRQHandler(void)
+{
+  prv_dma_irq(10);
+}
+
+void DMA2_Stream3_IRQHandler(void)
+{
+  prv_dma_irq(11);
+}
+
+void DMA2_Stream4_IRQHandler(void)
+{
+  prv_dma_irq(12);
+}
+
+void DMA2_Stream5_IRQHandler(void)
+{
+  prv_dma_irq(13);
+}
+
+void DMA2_Stream6_IRQHandler(void)
+{
+  prv_dma_irq(14);
+}
+
+void DMA2_Stream7_IRQHandler(void)
+{
+  prv_dma_irq(15);
+}
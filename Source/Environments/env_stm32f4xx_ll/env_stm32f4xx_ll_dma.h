@@ -0,0 +1,49 @@
+#ifndef __ENV_STM32F4XX_LL_DMA__
+#define __ENV_STM32F4XX_LL_DMA__
+
+#include "env_stm32f4xx_ll.h"
+
+/* Called from the stream interrupt when a peripheral transfer of the env ends,
+   error is set if the stream stopped on a transfer error */
+typedef void (*env_stm32f4xx_ll_dma_complete)(void* pcontext, uint8_t error);
+
+/* num_module 1..2 selects DMA1..DMA2 and num_channel 0..7 the stream, one
+   instance per stream. plib_data of jhal_dma_params may point to
+   env_stm32f4xx_ll_dma_config to select the request channel of the stream,
+   channel 0 by default. The env owns the stream interrupts */
+typedef struct {
+  uint8_t                       request;
+} env_stm32f4xx_ll_dma_config;
+
+typedef struct {
+  DMA_Stream_TypeDef*           pstream;
+  volatile uint32_t*            pisr;
+  volatile uint32_t*            pifcr;
+  uint32_t                      shift;
+  uint32_t                      cr;
+  uint32_t                      fcr;
+  uint8_t                       index;
+  uint8_t                       periph_to_memory;
+  env_stm32f4xx_ll_dma_complete pfunc_complete;
+  void*                         pcontext;
+} env_stm32f4xx_ll_dma;
+
+#define env_stm32f4xx_ll_dma_size_drv_static            sizeof(env_stm32f4xx_ll_dma)
+
+uint32_t env_stm32f4xx_ll_dma_size_drv(void);
+uint8_t env_stm32f4xx_ll_dma_init(void* pinstance, jhal_dma_params* pparams);
+uint8_t env_stm32f4xx_ll_dma_deinit(void* pinstance);
+uint8_t env_stm32f4xx_ll_dma_start(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size);
+uint8_t env_stm32f4xx_ll_dma_stop(void* pinstance);
+uint8_t env_stm32f4xx_ll_dma_start_it(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size);
+uint8_t env_stm32f4xx_ll_dma_stop_it(void* pinstance);
+
+/* Used by the peripherals of the env: runs the stream between the data
+   register pperiph and pmemory with the request channel and the priority of
+   the instance, cr gives the direction, the increments and the data sizes.
+   pfunc_complete = NULL runs the stream without interrupts */
+uint8_t env_stm32f4xx_ll_dma_start_periph(void* pinstance, uint32_t cr, volatile void* pperiph, const void* pmemory, uint16_t size,
+                                           env_stm32f4xx_ll_dma_complete pfunc_complete, void* pcontext);
+void env_stm32f4xx_ll_dma_stop_periph(void* pinstance);
+
+#endif
@@ -0,0 +1,266 @@
+#include "jhal_gpio.h"
+#include "env_stm32f4xx_ll_gpio.h"
+
+#define GPIO_AMOUNT_LINES               16U
+#define GPIO_PINS_ALL                   0xFFFFU
+
+static env_stm32f4xx_ll_gpio* GPIOLines[GPIO_AMOUNT_LINES] = {NULL};
+
+static GPIO_TypeDef* prv_gpio_port(uint8_t num_module)
+{
+  switch(num_module)
+  {
+#ifdef GPIOA
+    case JHAL_GPIO_BANK_A:      return GPIOA;
+#endif
+#ifdef GPIOB
+    case JHAL_GPIO_BANK_B:      return GPIOB;
+#endif
+#ifdef GPIOC
+    case JHAL_GPIO_BANK_C:      return GPIOC;
+#endif
+#ifdef GPIOD
+    case JHAL_GPIO_BANK_D:      return GPIOD;
+#endif
+#ifdef GPIOE
+    case JHAL_GPIO_BANK_E:      return GPIOE;
+#endif
+#ifdef GPIOF
+    case JHAL_GPIO_BANK_F:      return GPIOF;
+#endif
+#ifdef GPIOG
+    case JHAL_GPIO_BANK_G:      return GPIOG;
+#endif
+#ifdef GPIOH
+    case JHAL_GPIO_BANK_H:      return GPIOH;
+#endif
+#ifdef GPIOI
+    case JHAL_GPIO_BANK_I:      return GPIOI;
+#endif
+#ifdef GPIOJ
+    case JHAL_GPIO_BANK_J:      return GPIOJ;
+#endif
+#ifdef GPIOK
+    case JHAL_GPIO_BANK_K:      return GPIOK;
+#endif
+    default:                    return NULL;
+  }
+}
+
+static IRQn_Type prv_gpio_irq(uint8_t line)
+{
+  switch(line)
+  {
+    case 0:     return EXTI0_IRQn;
+    case 1:     return EXTI1_IRQn;
+    case 2:     return EXTI2_IRQn;
+    case 3:     return EXTI3_IRQn;
+    case 4:     return EXTI4_IRQn;
+    default:    return (line < 10U) ? EXTI9_5_IRQn : EXTI15_10_IRQn;
+  }
+}
+
+static void prv_gpio_release_lines(env_stm32f4xx_ll_gpio* pgpio)
+{
+  for(uint8_t line = 0; line < GPIO_AMOUNT_LINES; line++)
+  {
+    if(GPIOLines[line] != pgpio)
+      continue;
+    
+    EXTI->IMR &= ~(1U << line);
+    EXTI->RTSR &= ~(1U << line);
+    EXTI->FTSR &= ~(1U << line);
+    EXTI->PR = 1U << line;
+    GPIOLines[line] = NULL;
+  }
+  
+  pgpio->pins_it = 0;
+}
+
+uint32_t env_stm32f4xx_ll_gpio_size_drv(void)
+{
+  return env_stm32f4xx_ll_gpio_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_ll_gpio_init(void* pinstance, jhal_gpio_params* pparams)
+{
+  env_stm32f4xx_ll_gpio* pgpio = (env_stm32f4xx_ll_gpio*)pinstance;
+  uint32_t mode, pull, rising = 0, falling = 0;
+  
+  pgpio->pport = prv_gpio_port(pparams->num_module);
+  pgpio->pins_it = 0;
+  
+  if(pgpio->pport == NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(!pparams->pins || pparams->pins > GPIO_PINS_ALL)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  switch(pparams->pull_type)
+  {
+    case JHAL_GPIO_PULL_TYPE_PULLUP:    pull = 1U; break;
+    case JHAL_GPIO_PULL_TYPE_PULLDOWN:  pull = 2U; break;
+    default:                            pull = 0U; break;
+  }
+  
+  if(pparams->mode == JHAL_GPIO_MODE_INPUT)
+  {
+    mode = 0U;
+    
+    switch(pparams->int_type)
+    {
+      case JHAL_GPIO_INT_TYPE_NOT_SET:
+      break;
+      case JHAL_GPIO_INT_TYPE_RISING_EDGE:
+        rising = 1;
+      break;
+      case JHAL_GPIO_INT_TYPE_FALLING_EDGE:
+        falling = 1;
+      break;
+      case JHAL_GPIO_INT_TYPE_BOTH_EDGES:
+        rising = 1;
+        falling = 1;
+      break;
+      default:
+        return JHAL_RES_NOT_SUPPORTED;
+    }
+  }
+  else if(pparams->mode == JHAL_GPIO_MODE_OUTPUT || pparams->mode == JHAL_GPIO_MODE_OUTPUT_OPENDRAIN)
+    mode = 1U;
+  else
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(rising || falling)
+  {
+    for(uint8_t line = 0; line < GPIO_AMOUNT_LINES; line++)
+    {
+      if(((pparams->pins >> line) & 1U) && GPIOLines[line] != NULL)
+        return JHAL_RES_ERROR;
+    }
+  }
+  
+  RCC->AHB1ENR |= RCC_AHB1ENR_GPIOAEN << (pparams->num_module - 1U);
+  (void)RCC->AHB1ENR;
+  
+  GPIO_TypeDef* pport = pgpio->pport;
+  
+  for(uint8_t pin = 0; pin < GPIO_AMOUNT_LINES; pin++)
+  {
+    if(!((pparams->pins >> pin) & 1U))
+      continue;
+    
+    uint32_t shift = 2U * pin;
+    
+    pport->PUPDR = (pport->PUPDR & ~(3U << shift)) | (pull << shift);
+    pport->OSPEEDR &= ~(3U << shift);
+    if(pparams->mode == JHAL_GPIO_MODE_OUTPUT_OPENDRAIN)
+      pport->OTYPER |= 1U << pin;
+    else
+      pport->OTYPER &= ~(1U << pin);
+    pport->MODER = (pport->MODER & ~(3U << shift)) | (mode << shift);
+    
+    if(!rising && !falling)
+      continue;
+    
+    RCC->APB2ENR |= RCC_APB2ENR_SYSCFGEN;
+    shift = 4U * (pin & 3U);
+    SYSCFG->EXTICR[pin >> 2] = (SYSCFG->EXTICR[pin >> 2] & ~(0xFU << shift)) | ((uint32_t)(pparams->num_module - 1U) << shift);
+    
+    if(rising)
+      EXTI->RTSR |= 1U << pin;
+    else
+      EXTI->RTSR &= ~(1U << pin);
+    if(falling)
+      EXTI->FTSR |= 1U << pin;
+    else
+      EXTI->FTSR &= ~(1U << pin);
+    
+    GPIOLines[pin] = pgpio;
+    pgpio->pins_it |= (uint16_t)(1U << pin);
+    EXTI->PR = 1U << pin;
+    EXTI->IMR |= 1U << pin;
+    env_stm32f4xx_ll_irq_enable(prv_gpio_irq(pin));
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* The pins keep their mode, only the EXTI lines are given back */
+uint8_t env_stm32f4xx_ll_gpio_deinit(void* pinstance)
+{
+  prv_gpio_release_lines((env_stm32f4xx_ll_gpio*)pinstance);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+#if (USE_JHAL_INLINE == 0)
+uint8_t env_stm32f4xx_ll_gpio_set(void* pinstance, uint64_t pins, uint8_t value)
+{
+  if(pins > GPIO_PINS_ALL)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  ((env_stm32f4xx_ll_gpio*)pinstance)->pport->BSRR = value ? (uint32_t)pins : (uint32_t)pins << 16U;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_gpio_get(void* pinstance, uint64_t pins, uint8_t* pvalue)
+{
+  if(pins > GPIO_PINS_ALL)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  *pvalue = (((env_stm32f4xx_ll_gpio*)pinstance)->pport->IDR & (uint32_t)pins) ? 1 : 0;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+#endif
+
+static void prv_gpio_irq_lines(uint32_t lines)
+{
+  uint32_t pending = EXTI->PR & lines;
+  
+  EXTI->PR = pending;
+  
+  for(uint8_t line = 0; pending; line++, pending >>= 1)
+  {
+    env_stm32f4xx_ll_gpio* pgpio = GPIOLines[line];
+    
+    if((pending & 1U) && pgpio != NULL)
+      jhal_gpio_input_callback(pgpio, line, (pgpio->pport->IDR >> line) & 1U);
+  }
+}
+
+void EXTI0_IRQHandler(void)
+{
+  prv_gpio_irq_lines(1U << 0);
+}
+
+void EXTI1_IRQHandler(void)
+{
+  prv_gpio_irq_lines(1U << 1);
+}
+
+void EXTI2_IRQHandler(void)
+{
+  prv_gpio_irq_lines(1U << 2);
+}
+
+void EXTI3_IRQHandler(void)
+{
+  prv_gpio_irq_lines(1U << 3);
+}
+
+void EXTI4_IRQHandler(void)
+{
+  prv_gpio_irq_lines(1U << 4);
+}
+
+void EXTI9_5_IRQHandler(void)
+{
+  prv_gpio_irq_lines(0x03E0U);
+}
+
+void EXTI15_10_IRQHandler(void)
+{
+  prv_gpio_irq_lines(0xFC00U);
+}
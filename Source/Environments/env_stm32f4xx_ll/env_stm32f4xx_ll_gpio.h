@@ -0,0 +1,38 @@
+#ifndef __ENV_STM32F4XX_LL_GPIO__
+#define __ENV_STM32F4XX_LL_GPIO__
+
+#include "env_stm32f4xx_ll.h"
+
+/* Inputs with an edge interrupt take the EXTI lines of their pins, a line is
+   owned by one instance at a time. The env owns the EXTI interrupts */
+typedef struct {
+  GPIO_TypeDef*                 pport;
+  uint16_t                      pins_it;
+} env_stm32f4xx_ll_gpio;
+
+#define env_stm32f4xx_ll_gpio_size_drv_static           sizeof(env_stm32f4xx_ll_gpio)
+
+uint32_t env_stm32f4xx_ll_gpio_size_drv(void);
+uint8_t env_stm32f4xx_ll_gpio_init(void* pinstance, jhal_gpio_params* pparams);
+uint8_t env_stm32f4xx_ll_gpio_deinit(void* pinstance);
+#if (USE_JHAL_INLINE == 0)
+uint8_t env_stm32f4xx_ll_gpio_set(void* pinstance, uint64_t pins, uint8_t value);
+uint8_t env_stm32f4xx_ll_gpio_get(void* pinstance, uint64_t pins, uint8_t* pvalue);
+#else
+/* Pins are validated by env_stm32f4xx_ll_gpio_init, so the hot path is a single port access */
+static inline uint8_t env_stm32f4xx_ll_gpio_set(void* pinstance, uint64_t pins, uint8_t value)
+{
+  ((env_stm32f4xx_ll_gpio*)pinstance)->pport->BSRR = value ? (uint32_t)pins : (uint32_t)pins << 16U;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static inline uint8_t env_stm32f4xx_ll_gpio_get(void* pinstance, uint64_t pins, uint8_t* pvalue)
+{
+  *pvalue = (((env_stm32f4xx_ll_gpio*)pinstance)->pport->IDR & (uint32_t)pins) ? 1 : 0;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+#endif
+
+#endif
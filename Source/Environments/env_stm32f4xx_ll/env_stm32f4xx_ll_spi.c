@@ -0,0 +1,516 @@
+#include <string.h>
+#include "jhal_spi.h"
+#include "env_stm32f4xx_ll_spi.h"
+#include "jhal_dma.h"
+
+#define SPI_OPERATION_TX                1U
+#define SPI_OPERATION_RX                2U
+#define SPI_OPERATION_TXRX              3U
+
+#define SPI_AMOUNT_MODULES              6U
+#define SPI_FRAME_IDLE                  0xFFFFU
+
+static env_stm32f4xx_ll_spi* SPIInstances[SPI_AMOUNT_MODULES] = {NULL};
+
+/* Source of the idle frames the transmit stream sends during a receive */
+static const uint16_t SPIFrameIdle = SPI_FRAME_IDLE;
+
+static inline uint16_t prv_spi_frame_get(env_stm32f4xx_ll_spi* pspi, const uint8_t* pdata, uint16_t index)
+{
+  if(pdata == NULL)
+    return SPI_FRAME_IDLE;
+  
+  if(pspi->frame_size == 1)
+    return pdata[index];
+  
+  return (uint16_t)(pdata[2U * index] | (pdata[2U * index + 1U] << 8));
+}
+
+static inline void prv_spi_frame_put(env_stm32f4xx_ll_spi* pspi, uint8_t* pdata, uint16_t index, uint16_t frame)
+{
+  if(pdata == NULL)
+    return;
+  
+  if(pspi->frame_size == 1)
+  {
+    pdata[index] = (uint8_t)frame;
+    return;
+  }
+  
+  pdata[2U * index] = (uint8_t)frame;
+  pdata[2U * index + 1U] = (uint8_t)(frame >> 8);
+}
+
+/* Drops a frame left by a transmit by DMA and clears the overrun it caused */
+static inline void prv_spi_flush(SPI_TypeDef* pregs)
+{
+  if(pregs->SR & (SPI_SR_RXNE | SPI_SR_OVR))
+  {
+    (void)pregs->DR;
+    (void)pregs->SR;
+  }
+}
+
+static void prv_spi_complete(env_stm32f4xx_ll_spi* pspi)
+{
+  uint8_t operation = pspi->operation;
+  
+  pspi->operation = 0;
+  pspi->pinstance_dma_rx = NULL;
+  pspi->pinstance_dma_tx = NULL;
+  
+  switch(operation)
+  {
+    case SPI_OPERATION_TX:
+      jhal_spi_tx_complete_callback(pspi);
+    break;
+    case SPI_OPERATION_RX:
+      jhal_spi_rx_complete_callback(pspi, pspi->prxdata, pspi->size);
+    break;
+    case SPI_OPERATION_TXRX:
+      jhal_spi_txrx_complete_callback(pspi, pspi->prxdata, pspi->size);
+    break;
+  }
+}
+
+static uint8_t prv_spi_start(env_stm32f4xx_ll_spi* pspi, uint8_t operation, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  if(pspi->operation)
+    return JHAL_RES_ERROR;
+  
+  prv_spi_flush(pspi->pspi);
+  
+  pspi->operation = operation;
+  pspi->ptxdata = ptxdata;
+  pspi->prxdata = prxdata;
+  pspi->size = size;
+  pspi->count = 0;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* One frame in flight, the next frame is written once the previous one is
+   read back, so an interrupt between the frames never overruns the receiver */
+static uint8_t prv_spi_exchange(env_stm32f4xx_ll_spi* pspi, const uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  SPI_TypeDef* pregs = pspi->pspi;
+  env_stm32f4xx_ll_timeout deadline;
+  
+  if(pspi->operation)
+    return JHAL_RES_ERROR;
+  
+  prv_spi_flush(pregs);
+  env_stm32f4xx_ll_timeout_start(&deadline, timeout);
+  
+  for(uint16_t i = 0; i < size; i++)
+  {
+    pregs->DR = prv_spi_frame_get(pspi, ptxdata, i);
+    
+    while(!(pregs->SR & SPI_SR_RXNE))
+    {
+      if(env_stm32f4xx_ll_timeout_expired(&deadline))
+        return JHAL_RES_TIMEOUT;
+    }
+    
+    prv_spi_frame_put(pspi, prxdata, i, (uint16_t)pregs->DR);
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_spi_start_it(env_stm32f4xx_ll_spi* pspi, uint8_t operation, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  uint8_t res = prv_spi_start(pspi, operation, ptxdata, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  pspi->pspi->CR2 |= SPI_CR2_RXNEIE;
+  pspi->pspi->DR = prv_spi_frame_get(pspi, ptxdata, 0);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint32_t prv_spi_dma_sizes(env_stm32f4xx_ll_spi* pspi)
+{
+  return (pspi->frame_size == 2) ? (DMA_SxCR_PSIZE_0 | DMA_SxCR_MSIZE_0) : 0U;
+}
+
+/* A stream stopped by a transfer error ends the whole transfer */
+static uint8_t prv_spi_dma_failed(env_stm32f4xx_ll_spi* pspi, uint8_t error)
+{
+  if(!error)
+    return 0;
+  
+  env_stm32f4xx_ll_spi_abort(pspi);
+  jhal_spi_error_callback(pspi, JHAL_SPI_ERROR_DMA);
+  
+  return 1;
+}
+
+/* The stream is done once the last frame is in the data register, the
+   completion waits for it to leave the shifter */
+static void prv_spi_dma_tx_complete(void* pcontext, uint8_t error)
+{
+  env_stm32f4xx_ll_spi* pspi = (env_stm32f4xx_ll_spi*)pcontext;
+  SPI_TypeDef* pregs = pspi->pspi;
+  
+  if(prv_spi_dma_failed(pspi, error))
+    return;
+  
+  pregs->CR2 &= ~SPI_CR2_TXDMAEN;
+  
+  while(!(pregs->SR & SPI_SR_TXE));
+  while(pregs->SR & SPI_SR_BSY);
+  
+  prv_spi_flush(pregs);
+  prv_spi_complete(pspi);
+}
+
+static void prv_spi_dma_rx_complete(void* pcontext, uint8_t error)
+{
+  env_stm32f4xx_ll_spi* pspi = (env_stm32f4xx_ll_spi*)pcontext;
+  
+  if(prv_spi_dma_failed(pspi, error))
+    return;
+  
+  pspi->pspi->CR2 &= ~(SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+  env_stm32f4xx_ll_dma_stop_periph(pspi->pinstance_dma_tx);
+  
+  prv_spi_complete(pspi);
+}
+
+/* The receive stream is started first, so it is ready for the first frame
+   the transmit stream clocks */
+static uint8_t prv_spi_start_dma_rx(env_stm32f4xx_ll_spi* pspi, uint8_t operation, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  SPI_TypeDef* pregs = pspi->pspi;
+  uint32_t sizes = prv_spi_dma_sizes(pspi);
+  
+  if(pspi->config.pinstance_dma_tx == NULL)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  uint8_t res = prv_spi_start(pspi, operation, ptxdata, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  pspi->pinstance_dma_rx = pinstance_dma;
+  pspi->pinstance_dma_tx = pspi->config.pinstance_dma_tx;
+  
+  res = env_stm32f4xx_ll_dma_start_periph(pinstance_dma, sizes | DMA_SxCR_MINC, &pregs->DR, prxdata, size, prv_spi_dma_rx_complete, pspi);
+  if(res == JHAL_RES_NO_ERRORS)
+  {
+    pregs->CR2 |= SPI_CR2_RXDMAEN;
+    res = env_stm32f4xx_ll_dma_start_periph(pspi->pinstance_dma_tx, DMA_SxCR_DIR_0 | sizes | (ptxdata ? DMA_SxCR_MINC : 0U), &pregs->DR, 
+                                            ptxdata ? (const void*)ptxdata : (const void*)&SPIFrameIdle, size, NULL, NULL);
+    if(res != JHAL_RES_NO_ERRORS)
+    {
+      pregs->CR2 &= ~SPI_CR2_RXDMAEN;
+      env_stm32f4xx_ll_dma_stop_periph(pinstance_dma);
+    }
+  }
+  
+  if(res != JHAL_RES_NO_ERRORS)
+  {
+    pspi->operation = 0;
+    pspi->pinstance_dma_rx = NULL;
+    pspi->pinstance_dma_tx = NULL;
+    return res;
+  }
+  
+  pregs->CR2 |= SPI_CR2_TXDMAEN;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint32_t env_stm32f4xx_ll_spi_size_drv(void)
+{
+  return env_stm32f4xx_ll_spi_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_ll_spi_init(void* pinstance, jhal_spi_params* pparams)
+{
+  env_stm32f4xx_ll_spi* pspi = (env_stm32f4xx_ll_spi*)pinstance;
+  uint8_t bus = ENV_STM32F4XX_LL_BUS_APB2;
+  uint32_t cr1 = 0;
+  IRQn_Type irq;
+  
+  memset(pspi, 0, sizeof(env_stm32f4xx_ll_spi));
+  
+  if(pparams->num_module < 1 || pparams->num_module > SPI_AMOUNT_MODULES || SPIInstances[pparams->num_module - 1] != NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(!pparams->baudrate)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  switch(pparams->mode)
+  {
+    case JHAL_SPI_MODE_MASTER:          cr1 |= SPI_CR1_MSTR | SPI_CR1_SSM | SPI_CR1_SSI; break;
+    case JHAL_SPI_MODE_SLAVE:           break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->data_size)
+  {
+    case JHAL_SPI_DATA_SIZE_8BIT:       pspi->frame_size = 1; break;
+    case JHAL_SPI_DATA_SIZE_16BIT:      pspi->frame_size = 2; cr1 |= SPI_CR1_DFF; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->cpol)
+  {
+    case JHAL_SPI_CPOL_LOW:             break;
+    case JHAL_SPI_CPOL_HIGH:            cr1 |= SPI_CR1_CPOL; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->cpha)
+  {
+    case JHAL_SPI_CPHA_LOW:             break;
+    case JHAL_SPI_CPHA_HIGH:            cr1 |= SPI_CR1_CPHA; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->first_bit)
+  {
+    case JHAL_SPI_FIRST_BIT_MSB:        break;
+    case JHAL_SPI_FIRST_BIT_LSB:        cr1 |= SPI_CR1_LSBFIRST; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->num_module)
+  {
+#ifdef SPI1
+    case 1:
+      RCC->APB2ENR |= RCC_APB2ENR_SPI1EN;
+      pspi->pspi = SPI1;
+      irq = SPI1_IRQn;
+    break;
+#endif
+#ifdef SPI2
+    case 2:
+      RCC->APB1ENR |= RCC_APB1ENR_SPI2EN;
+      pspi->pspi = SPI2;
+      irq = SPI2_IRQn;
+      bus = ENV_STM32F4XX_LL_BUS_APB1;
+    break;
+#endif
+#ifdef SPI3
+    case 3:
+      RCC->APB1ENR |= RCC_APB1ENR_SPI3EN;
+      pspi->pspi = SPI3;
+      irq = SPI3_IRQn;
+      bus = ENV_STM32F4XX_LL_BUS_APB1;
+    break;
+#endif
+#ifdef SPI4
+    case 4:
+      RCC->APB2ENR |= RCC_APB2ENR_SPI4EN;
+      pspi->pspi = SPI4;
+      irq = SPI4_IRQn;
+    break;
+#endif
+#ifdef SPI5
+    case 5:
+      RCC->APB2ENR |= RCC_APB2ENR_SPI5EN;
+      pspi->pspi = SPI5;
+      irq = SPI5_IRQn;
+    break;
+#endif
+#ifdef SPI6
+    case 6:
+      RCC->APB2ENR |= RCC_APB2ENR_SPI6EN;
+      pspi->pspi = SPI6;
+      irq = SPI6_IRQn;
+    break;
+#endif
+    default:
+      return JHAL_RES_NOT_SUPPORTED;
+  }
+  
+  /* The fastest clock of PCLK / 2^(BR + 1) that does not exceed baudrate */
+  uint32_t pclk = env_stm32f4xx_ll_pclk_hz(bus);
+  uint32_t br = 0;
+  while(br < 7U && (pclk >> (br + 1U)) > pparams->baudrate)
+    br++;
+  
+  if(pparams->plib_data != NULL)
+    pspi->config = *((env_stm32f4xx_ll_spi_config*)pparams->plib_data);
+  
+  pspi->index = pparams->num_module - 1U;
+  pspi->pspi->CR1 = 0;
+  pspi->pspi->CR2 = 0;
+  pspi->pspi->CR1 = cr1 | (br << SPI_CR1_BR_Pos);
+  pspi->pspi->CR1 |= SPI_CR1_SPE;
+  
+  SPIInstances[pspi->index] = pspi;
+  env_stm32f4xx_ll_irq_enable(irq);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_spi_deinit(void* pinstance)
+{
+  env_stm32f4xx_ll_spi* pspi = (env_stm32f4xx_ll_spi*)pinstance;
+  
+  if(pspi->pspi == NULL)
+    return JHAL_RES_NO_ERRORS;
+  
+  env_stm32f4xx_ll_spi_abort(pinstance);
+  
+  pspi->pspi->CR1 = 0;
+  SPIInstances[pspi->index] = NULL;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+  return prv_spi_exchange((env_stm32f4xx_ll_spi*)pinstance, ptxdata, NULL, size, timeout);
+}
+
+uint8_t env_stm32f4xx_ll_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  return prv_spi_exchange((env_stm32f4xx_ll_spi*)pinstance, NULL, prxdata, size, timeout);
+}
+
+uint8_t env_stm32f4xx_ll_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  return prv_spi_exchange((env_stm32f4xx_ll_spi*)pinstance, ptxdata, prxdata, size, timeout);
+}
+
+uint8_t env_stm32f4xx_ll_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size)
+{
+  return prv_spi_start_it((env_stm32f4xx_ll_spi*)pinstance, SPI_OPERATION_TX, ptxdata, NULL, size);
+}
+
+uint8_t env_stm32f4xx_ll_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+  return prv_spi_start_it((env_stm32f4xx_ll_spi*)pinstance, SPI_OPERATION_RX, NULL, prxdata, size);
+}
+
+uint8_t env_stm32f4xx_ll_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  return prv_spi_start_it((env_stm32f4xx_ll_spi*)pinstance, SPI_OPERATION_TXRX, ptxdata, prxdata, size);
+}
+
+uint8_t env_stm32f4xx_ll_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_ll_spi* pspi = (env_stm32f4xx_ll_spi*)pinstance;
+  
+  uint8_t res = prv_spi_start(pspi, SPI_OPERATION_TX, ptxdata, NULL, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  pspi->pinstance_dma_tx = pinstance_dma;
+  
+  res = env_stm32f4xx_ll_dma_start_periph(pinstance_dma, DMA_SxCR_DIR_0 | prv_spi_dma_sizes(pspi) | DMA_SxCR_MINC, &pspi->pspi->DR, ptxdata, size, 
+                                          prv_spi_dma_tx_complete, pspi);
+  if(res != JHAL_RES_NO_ERRORS)
+  {
+    pspi->operation = 0;
+    pspi->pinstance_dma_tx = NULL;
+    return res;
+  }
+  
+  pspi->pspi->CR2 |= SPI_CR2_TXDMAEN;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  return prv_spi_start_dma_rx((env_stm32f4xx_ll_spi*)pinstance, SPI_OPERATION_RX, NULL, prxdata, size, pinstance_dma);
+}
+
+uint8_t env_stm32f4xx_ll_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  return prv_spi_start_dma_rx((env_stm32f4xx_ll_spi*)pinstance, SPI_OPERATION_TXRX, ptxdata, prxdata, size, pinstance_dma);
+}
+
+uint8_t env_stm32f4xx_ll_spi_abort(void* pinstance)
+{
+  env_stm32f4xx_ll_spi* pspi = (env_stm32f4xx_ll_spi*)pinstance;
+  SPI_TypeDef* pregs = pspi->pspi;
+  
+  pregs->CR2 &= ~(SPI_CR2_RXNEIE | SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+  
+  if(pspi->pinstance_dma_rx != NULL)
+    env_stm32f4xx_ll_dma_stop_periph(pspi->pinstance_dma_rx);
+  if(pspi->pinstance_dma_tx != NULL)
+    env_stm32f4xx_ll_dma_stop_periph(pspi->pinstance_dma_tx);
+  
+  pspi->operation = 0;
+  pspi->pinstance_dma_rx = NULL;
+  pspi->pinstance_dma_tx = NULL;
+  
+  while(pregs->SR & SPI_SR_BSY);
+  prv_spi_flush(pregs);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static void prv_spi_irq(uint8_t index)
+{
+  env_stm32f4xx_ll_spi* pspi = SPIInstances[index];
+  
+  if(pspi == NULL)
+    return;
+  
+  SPI_TypeDef* pregs = pspi->pspi;
+  
+  if(!(pregs->CR2 & SPI_CR2_RXNEIE) || !(pregs->SR & SPI_SR_RXNE))
+    return;
+  
+  prv_spi_frame_put(pspi, pspi->prxdata, pspi->count, (uint16_t)pregs->DR);
+  
+  if(++pspi->count < pspi->size)
+  {
+    pregs->DR = prv_spi_frame_get(pspi, pspi->ptxdata, pspi->count);
+    return;
+  }
+  
+  pregs->CR2 &= ~SPI_CR2_RXNEIE;
+  prv_spi_complete(pspi);
+}
+
+#ifdef SPI1
+void SPI1_IRQHandler(void)
+{
+  prv_spi_irq(0);
+}
+#endif
+
+#ifdef SPI2
+void SPI2_IRQHandler(void)
+{
+  prv_spi_irq(1);
+}
+#endif
+
+#ifdef SPI3
+void SPI3_IRQHandler(void)
+{
+  prv_spi_irq(2);
+}
+#endif
+
+#ifdef SPI4
+void SPI4_IRQHandler(void)
+{
+  prv_spi_irq(3);
+}
+#endif
+
+#ifdef SPI5
+void SPI5_IRQHandler(void)
+{
+  prv_spi_irq(4);
+}
+#endif
+
+#ifdef SPI6
+void SPI6_IRQHandler(void)
+{
+  prv_spi_irq(5);
+}
+#endif
@@ -0,0 +1,47 @@
+#ifndef __ENV_STM32F4XX_LL_SPI__
+#define __ENV_STM32F4XX_LL_SPI__
+
+#include "env_stm32f4xx_ll.h"
+
+/* A receive by DMA needs a second stream that clocks the frames out, so
+   plib_data of jhal_spi_params may point to env_stm32f4xx_ll_spi_config with
+   the DMA instance of the transmit side. pinstance_dma of transmit_dma is the
+   transmit stream, of receive_dma and transmitreceive_dma the receive stream */
+typedef struct {
+  void*                         pinstance_dma_tx;
+} env_stm32f4xx_ll_spi_config;
+
+/* num_module 1..6 selects SPI1..SPI6, the master drives NSS by software. With
+   16-bit frames size counts the frames, the buffers hold them little endian.
+   The env owns the SPI interrupts */
+typedef struct {
+  SPI_TypeDef*                  pspi;
+  env_stm32f4xx_ll_spi_config   config;
+  uint8_t                       index;
+  uint8_t                       operation;
+  uint8_t                       frame_size;
+  uint8_t*                      ptxdata;
+  uint8_t*                      prxdata;
+  uint16_t                      size;
+  uint16_t                      count;
+  void*                         pinstance_dma_rx;
+  void*                         pinstance_dma_tx;
+} env_stm32f4xx_ll_spi;
+
+#define env_stm32f4xx_ll_spi_size_drv_static            sizeof(env_stm32f4xx_ll_spi)
+
+uint32_t env_stm32f4xx_ll_spi_size_drv(void);
+uint8_t env_stm32f4xx_ll_spi_init(void* pinstance, jhal_spi_params* pparams);
+uint8_t env_stm32f4xx_ll_spi_deinit(void* pinstance);
+uint8_t env_stm32f4xx_ll_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_ll_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_ll_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_ll_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size);
+uint8_t env_stm32f4xx_ll_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size);
+uint8_t env_stm32f4xx_ll_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
+uint8_t env_stm32f4xx_ll_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_ll_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_ll_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_ll_spi_abort(void* pinstance);
+
+#endif
@@ -0,0 +1,46 @@
+#include "jhal_tick.h"
+#include "env_stm32f4xx_ll_tick.h"
+
+uint32_t env_stm32f4xx_ll_tick_init(void)
+{
+  if(!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk))
+  {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* The core clock is read on every call, so a change of SystemCoreClock by
+   SystemCoreClockUpdate is taken into account */
+uint32_t env_stm32f4xx_ll_tick(uint32_t delay)
+{
+  int32_t tp = (int32_t)(DWT->CYCCNT + delay * (SystemCoreClock / 1000000U));
+  while(((int32_t)DWT->CYCCNT - tp) < 0);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint32_t env_stm32f4xx_ll_tick_cycles(void)
+{
+  return DWT->CYCCNT;
+}
+
+uint32_t env_stm32f4xx_ll_tick_cycles_hz(void)
+{
+  return SystemCoreClock;
+}
+
+uint32_t env_stm32f4xx_ll_critical_enter(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  
+  return primask;
+}
+
+void env_stm32f4xx_ll_critical_exit(uint32_t state)
+{
+  __set_PRIMASK(state);
+}
@@ -0,0 +1,13 @@
+#ifndef __ENV_STM32F4XX_LL_TICK__
+#define __ENV_STM32F4XX_LL_TICK__
+
+#include "env_stm32f4xx_ll.h"
+
+uint32_t env_stm32f4xx_ll_tick_init(void);
+uint32_t env_stm32f4xx_ll_tick(uint32_t delay);
+uint32_t env_stm32f4xx_ll_tick_cycles(void);
+uint32_t env_stm32f4xx_ll_tick_cycles_hz(void);
+uint32_t env_stm32f4xx_ll_critical_enter(void);
+void env_stm32f4xx_ll_critical_exit(uint32_t state);
+
+#endif
@@ -0,0 +1,322 @@
+#include <string.h>
+#include "jhal_tim_base.h"
+#include "env_stm32f4xx_ll_tim_base.h"
+#include "jhal_dma.h"
+
+#define TIM_AMOUNT_MODULES              14U
+
+static env_stm32f4xx_ll_tim_base* TIMInstances[TIM_AMOUNT_MODULES] = {NULL};
+
+/* The timers with the direction bit, the others only count up */
+static uint8_t prv_tim_base_has_dir(uint8_t num_module)
+{
+  return (num_module >= 1U && num_module <= 5U) || num_module == 8U;
+}
+
+/* The stream has written the last value to ARR, reported the same way as the
+   update event, like the period elapsed of the DMA mode of the HAL */
+static void prv_tim_base_dma_complete(void* pcontext, uint8_t error)
+{
+  env_stm32f4xx_ll_tim_base* ptim = (env_stm32f4xx_ll_tim_base*)pcontext;
+  (void)error;
+  
+  ptim->ptim->DIER &= ~TIM_DIER_UDE;
+  ptim->pinstance_dma = NULL;
+  
+  jhal_tim_base_period_ellapsed_callback(ptim);
+}
+
+uint32_t env_stm32f4xx_ll_tim_base_size_drv(void)
+{
+  return env_stm32f4xx_ll_tim_base_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_ll_tim_base_init(void* pinstance, jhal_tim_base_params* pparams)
+{
+  env_stm32f4xx_ll_tim_base* ptim = (env_stm32f4xx_ll_tim_base*)pinstance;
+  uint32_t cr1 = 0;
+  IRQn_Type irq;
+  
+  memset(ptim, 0, sizeof(env_stm32f4xx_ll_tim_base));
+  
+  if(pparams->num_module < 1 || pparams->num_module > TIM_AMOUNT_MODULES || TIMInstances[pparams->num_module - 1] != NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(pparams->clock_source != 0 && pparams->clock_source != JHAL_TIM_CLOCK_SOURCE_INTERNAL)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  if(pparams->prescaler > 0xFFFFU)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  switch(pparams->clock_prescaler)
+  {
+    case 0:
+    case 1:                             break;
+    case 2:                             cr1 |= TIM_CR1_CKD_0; break;
+    case 4:                             cr1 |= TIM_CR1_CKD_1; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->type_counter)
+  {
+    case JHAL_TIM_BASE_TYPE_COUNTER_UP:
+    break;
+    case JHAL_TIM_BASE_TYPE_COUNTER_DOWN:
+      if(!prv_tim_base_has_dir(pparams->num_module))
+        return JHAL_RES_NOT_SUPPORTED;
+      cr1 |= TIM_CR1_DIR;
+    break;
+    default:
+      return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  if(pparams->preload_value)
+    cr1 |= TIM_CR1_ARPE;
+  
+  switch(pparams->num_module)
+  {
+#ifdef TIM1
+    case 1:   RCC->APB2ENR |= RCC_APB2ENR_TIM1EN;  ptim->ptim = TIM1;  irq = TIM1_UP_TIM10_IRQn;       break;
+#endif
+#ifdef TIM2
+    case 2:   RCC->APB1ENR |= RCC_APB1ENR_TIM2EN;  ptim->ptim = TIM2;  irq = TIM2_IRQn;                break;
+#endif
+#ifdef TIM3
+    case 3:   RCC->APB1ENR |= RCC_APB1ENR_TIM3EN;  ptim->ptim = TIM3;  irq = TIM3_IRQn;                break;
+#endif
+#ifdef TIM4
+    case 4:   RCC->APB1ENR |= RCC_APB1ENR_TIM4EN;  ptim->ptim = TIM4;  irq = TIM4_IRQn;                break;
+#endif
+#ifdef TIM5
+    case 5:   RCC->APB1ENR |= RCC_APB1ENR_TIM5EN;  ptim->ptim = TIM5;  irq = TIM5_IRQn;                break;
+#endif
+#ifdef TIM6
+    case 6:   RCC->APB1ENR |= RCC_APB1ENR_TIM6EN;  ptim->ptim = TIM6;  irq = TIM6_DAC_IRQn;            break;
+#endif
+#ifdef TIM7
+    case 7:   RCC->APB1ENR |= RCC_APB1ENR_TIM7EN;  ptim->ptim = TIM7;  irq = TIM7_IRQn;                break;
+#endif
+#ifdef TIM8
+    case 8:   RCC->APB2ENR |= RCC_APB2ENR_TIM8EN;  ptim->ptim = TIM8;  irq = TIM8_UP_TIM13_IRQn;       break;
+#endif
+#ifdef TIM9
+    case 9:   RCC->APB2ENR |= RCC_APB2ENR_TIM9EN;  ptim->ptim = TIM9;  irq = TIM1_BRK_TIM9_IRQn;       break;
+#endif
+#ifdef TIM10
+    case 10:  RCC->APB2ENR |= RCC_APB2ENR_TIM10EN; ptim->ptim = TIM10; irq = TIM1_UP_TIM10_IRQn;       break;
+#endif
+#ifdef TIM11
+    case 11:  RCC->APB2ENR |= RCC_APB2ENR_TIM11EN; ptim->ptim = TIM11; irq = TIM1_TRG_COM_TIM11_IRQn;  break;
+#endif
+#ifdef TIM12
+    case 12:  RCC->APB1ENR |= RCC_APB1ENR_TIM12EN; ptim->ptim = TIM12; irq = TIM8_BRK_TIM12_IRQn;      break;
+#endif
+#ifdef TIM13
+    case 13:  RCC->APB1ENR |= RCC_APB1ENR_TIM13EN; ptim->ptim = TIM13; irq = TIM8_UP_TIM13_IRQn;       break;
+#endif
+#ifdef TIM14
+    case 14:  RCC->APB1ENR |= RCC_APB1ENR_TIM14EN; ptim->ptim = TIM14; irq = TIM8_TRG_COM_TIM14_IRQn;  break;
+#endif
+    default:
+      return JHAL_RES_NOT_SUPPORTED;
+  }
+  
+  /* TIM2 and TIM5 are the 32-bit ones */
+  if(pparams->num_module != 2U && pparams->num_module != 5U && (pparams->period > 0xFFFFU || pparams->counter > 0xFFFFU))
+  {
+    ptim->ptim = NULL;
+    return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  ptim->index = pparams->num_module - 1U;
+  ptim->ptim->CR1 = cr1;
+  ptim->ptim->DIER = 0;
+  ptim->ptim->PSC = pparams->prescaler;
+  ptim->ptim->ARR = pparams->period;
+  
+  /* Loads PSC, which is always buffered, without a period elapsed */
+  ptim->ptim->EGR = TIM_EGR_UG;
+  ptim->ptim->SR = ~TIM_SR_UIF;
+  ptim->ptim->CNT = pparams->counter;
+  
+  TIMInstances[ptim->index] = ptim;
+  env_stm32f4xx_ll_irq_enable(irq);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_tim_base_deinit(void* pinstance)
+{
+  env_stm32f4xx_ll_tim_base* ptim = (env_stm32f4xx_ll_tim_base*)pinstance;
+  
+  if(ptim->ptim == NULL)
+    return JHAL_RES_NO_ERRORS;
+  
+  env_stm32f4xx_ll_tim_base_stop_it(pinstance);
+  if(ptim->pinstance_dma != NULL)
+    env_stm32f4xx_ll_tim_base_stop_dma(pinstance, ptim->pinstance_dma);
+  
+  TIMInstances[ptim->index] = NULL;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_tim_base_start(void* pinstance)
+{
+  env_stm32f4xx_ll_tim_base* ptim = (env_stm32f4xx_ll_tim_base*)pinstance;
+  
+  ptim->ptim->CR1 |= TIM_CR1_CEN;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_tim_base_stop(void* pinstance)
+{
+  env_stm32f4xx_ll_tim_base* ptim = (env_stm32f4xx_ll_tim_base*)pinstance;
+  
+  ptim->ptim->CR1 &= ~TIM_CR1_CEN;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_tim_base_start_it(void* pinstance)
+{
+  env_stm32f4xx_ll_tim_base* ptim = (env_stm32f4xx_ll_tim_base*)pinstance;
+  
+  ptim->ptim->SR = ~TIM_SR_UIF;
+  ptim->ptim->DIER |= TIM_DIER_UIE;
+  ptim->ptim->CR1 |= TIM_CR1_CEN;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_tim_base_stop_it(void* pinstance)
+{
+  env_stm32f4xx_ll_tim_base* ptim = (env_stm32f4xx_ll_tim_base*)pinstance;
+  
+  ptim->ptim->DIER &= ~TIM_DIER_UIE;
+  ptim->ptim->CR1 &= ~TIM_CR1_CEN;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* pdata holds size words that the update events load into ARR one by one,
+   pinstance_dma is the stream of the update request of the timer */
+uint8_t env_stm32f4xx_ll_tim_base_start_dma(void* pinstance, uint8_t* pdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_ll_tim_base* ptim = (env_stm32f4xx_ll_tim_base*)pinstance;
+  
+  if(pdata == NULL || !size || pinstance_dma == NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(ptim->pinstance_dma != NULL)
+    return JHAL_RES_ERROR;
+  
+  uint8_t res = env_stm32f4xx_ll_dma_start_periph(pinstance_dma, DMA_SxCR_DIR_0 | DMA_SxCR_MINC | DMA_SxCR_PSIZE_1 | DMA_SxCR_MSIZE_1, 
+                                                  &ptim->ptim->ARR, pdata, size, prv_tim_base_dma_complete, ptim);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  ptim->pinstance_dma = pinstance_dma;
+  ptim->ptim->DIER |= TIM_DIER_UDE;
+  ptim->ptim->CR1 |= TIM_CR1_CEN;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_tim_base_stop_dma(void* pinstance, void* pinstance_dma)
+{
+  env_stm32f4xx_ll_tim_base* ptim = (env_stm32f4xx_ll_tim_base*)pinstance;
+  
+  ptim->ptim->DIER &= ~TIM_DIER_UDE;
+  ptim->ptim->CR1 &= ~TIM_CR1_CEN;
+  
+  env_stm32f4xx_ll_dma_stop_periph(pinstance_dma);
+  ptim->pinstance_dma = NULL;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static void prv_tim_base_irq(uint8_t index)
+{
+  env_stm32f4xx_ll_tim_base* ptim = TIMInstances[index];
+  
+  if(ptim == NULL)
+    return;
+  
+  if(!(ptim->ptim->DIER & TIM_DIER_UIE) || !(ptim->ptim->SR & TIM_SR_UIF))
+    return;
+  
+  ptim->ptim->SR = ~TIM_SR_UIF;
+  jhal_tim_base_period_ellapsed_callback(ptim);
+}
+
+void TIM1_UP_TIM10_IRQHandler(void)
+{
+  prv_tim_base_irq(0);
+  prv_tim_base_irq(9);
+}
+
+void TIM2_IRQHandler(void)
+{
+  prv_tim_base_irq(1);
+}
+
+void TIM3_IRQHandler(void)
+{
+  prv_tim_base_irq(2);
+}
+
+void TIM4_IRQHandler(void)
+{
+  prv_tim_base_irq(3);
+}
+
+#ifdef TIM5
+void TIM5_IRQHandler(void)
+{
+  prv_tim_base_irq(4);
+}
+#endif
+
+#ifdef TIM6
+void TIM6_DAC_IRQHandler(void)
+{
+  prv_tim_base_irq(5);
+}
+#endif
+
+#ifdef TIM7
+void TIM7_IRQHandler(void)
+{
+  prv_tim_base_irq(6);
+}
+#endif
+
+void TIM1_BRK_TIM9_IRQHandler(void)
+{
+  prv_tim_base_irq(8);
+}
+
+void TIM1_TRG_COM_TIM11_IRQHandler(void)
+{
+  prv_tim_base_irq(10);
+}
+
+#ifdef TIM8
+void TIM8_UP_TIM13_IRQHandler(void)
+{
+  prv_tim_base_irq(7);
+  prv_tim_base_irq(12);
+}
+
+void TIM8_BRK_TIM12_IRQHandler(void)
+{
+  prv_tim_base_irq(11);
+}
+
+void TIM8_TRG_COM_TIM14_IRQHandler(void)
+{
+  prv_tim_base_irq(13);
+}
+#endif
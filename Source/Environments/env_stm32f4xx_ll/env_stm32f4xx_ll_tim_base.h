@@ -0,0 +1,29 @@
+#ifndef __ENV_STM32F4XX_LL_TIM_BASE__
+#define __ENV_STM32F4XX_LL_TIM_BASE__
+
+#include "env_stm32f4xx_ll.h"
+
+/* num_module 1..14 selects TIM1..TIM14 on the internal clock, prescaler and
+   period go to PSC and ARR as they are. clock_prescaler 1, 2 or 4 is the
+   dead-time and filter clock division, a nonzero preload_value buffers ARR.
+   The env owns the update interrupts, including the ones TIM1 and TIM8 share
+   with TIM9..TIM14 */
+typedef struct {
+  TIM_TypeDef*                  ptim;
+  uint8_t                       index;
+  void*                         pinstance_dma;
+} env_stm32f4xx_ll_tim_base;
+
+#define env_stm32f4xx_ll_tim_base_size_drv_static       sizeof(env_stm32f4xx_ll_tim_base)
+
+uint32_t env_stm32f4xx_ll_tim_base_size_drv(void);
+uint8_t env_stm32f4xx_ll_tim_base_init(void* pinstance, jhal_tim_base_params* pparams);
+uint8_t env_stm32f4xx_ll_tim_base_deinit(void* pinstance);
+uint8_t env_stm32f4xx_ll_tim_base_start(void* pinstance);
+uint8_t env_stm32f4xx_ll_tim_base_stop(void* pinstance);
+uint8_t env_stm32f4xx_ll_tim_base_start_it(void* pinstance);
+uint8_t env_stm32f4xx_ll_tim_base_stop_it(void* pinstance);
+uint8_t env_stm32f4xx_ll_tim_base_start_dma(void* pinstance, uint8_t* pdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_ll_tim_base_stop_dma(void* pinstance, void* pinstance_dma);
+
+#endif
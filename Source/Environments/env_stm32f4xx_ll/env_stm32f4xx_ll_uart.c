@@ -0,0 +1,657 @@
+#include <string.h>
+#include "jhal_uart.h"
+#include "env_stm32f4xx_ll_uart.h"
+#include "jhal_dma.h"
+
+#define UART_OPERATION_TX               1U
+#define UART_OPERATION_RX               2U
+#define UART_OPERATION_TXRX             3U
+
+#define UART_AMOUNT_MODULES             8U
+
+static env_stm32f4xx_ll_uart* UARTInstances[UART_AMOUNT_MODULES] = {NULL};
+
+static uint32_t prv_uart_baudrate(jhal_uart_baudrate baudrate)
+{
+  switch(baudrate)
+  {
+    case JHAL_UART_BAUDRATE_300:        return 300U;
+    case JHAL_UART_BAUDRATE_600:        return 600U;
+    case JHAL_UART_BAUDRATE_1200:       return 1200U;
+    case JHAL_UART_BAUDRATE_2400:       return 2400U;
+    case JHAL_UART_BAUDRATE_4800:       return 4800U;
+    case JHAL_UART_BAUDRATE_9600:       return 9600U;
+    case JHAL_UART_BAUDRATE_19200:      return 19200U;
+    case JHAL_UART_BAUDRATE_38400:      return 38400U;
+    case JHAL_UART_BAUDRATE_57600:      return 57600U;
+    case JHAL_UART_BAUDRATE_115200:     return 115200U;
+    case JHAL_UART_BAUDRATE_230400:     return 230400U;
+    case JHAL_UART_BAUDRATE_460800:     return 460800U;
+    case JHAL_UART_BAUDRATE_921600:     return 921600U;
+  }
+  
+  return 0;
+}
+
+/* Oversampling by 16, BRR holds the divider with 4 fractional bits */
+static inline uint32_t prv_uart_brr(env_stm32f4xx_ll_uart* puart, uint32_t baudrate)
+{
+  return (env_stm32f4xx_ll_pclk_hz(puart->bus) + baudrate / 2U) / baudrate;
+}
+
+/* Drops a byte received while no receive was running and clears the overrun */
+static inline void prv_uart_flush(USART_TypeDef* pregs)
+{
+  if(pregs->SR & (USART_SR_RXNE | USART_SR_ORE))
+    (void)pregs->DR;
+}
+
+static void prv_uart_tx_complete(env_stm32f4xx_ll_uart* puart)
+{
+  uint8_t operation = puart->operation_tx;
+  
+  puart->operation_tx = 0;
+  puart->pinstance_dma_tx = NULL;
+  
+  if(operation == UART_OPERATION_TX)
+    jhal_uart_tx_complete_callback(puart);
+}
+
+static void prv_uart_rx_complete(env_stm32f4xx_ll_uart* puart)
+{
+  uint8_t operation = puart->operation_rx;
+  
+  puart->operation_rx = 0;
+  puart->pinstance_dma_rx = NULL;
+  
+  if(operation == UART_OPERATION_TXRX)
+    jhal_uart_txrx_complete_callback(puart, puart->prxdata, puart->size_rx);
+  else
+    jhal_uart_rx_complete_callback(puart, puart->prxdata, puart->size_rx);
+}
+
+static uint8_t prv_uart_start(env_stm32f4xx_ll_uart* puart, uint8_t operation, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  if((ptxdata != NULL && puart->operation_tx) || (prxdata != NULL && puart->operation_rx))
+    return JHAL_RES_ERROR;
+  
+  if(ptxdata != NULL)
+  {
+    puart->operation_tx = operation;
+    puart->ptxdata = ptxdata;
+    puart->size_tx = size;
+    puart->count_tx = 0;
+  }
+  
+  if(prxdata != NULL)
+  {
+    prv_uart_flush(puart->puart);
+    puart->operation_rx = operation;
+    puart->prxdata = prxdata;
+    puart->size_rx = size;
+    puart->count_rx = 0;
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* The transmitter runs ahead of the receiver by the frames the data register
+   and the shifter hold, so ptxdata and prxdata may be the same buffer */
+static uint8_t prv_uart_exchange(env_stm32f4xx_ll_uart* puart, const uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  USART_TypeDef* pregs = puart->puart;
+  env_stm32f4xx_ll_timeout deadline;
+  uint16_t count_tx = ptxdata ? 0 : size;
+  uint16_t count_rx = prxdata ? 0 : size;
+  
+  if((ptxdata != NULL && puart->operation_tx) || (prxdata != NULL && puart->operation_rx))
+    return JHAL_RES_ERROR;
+  
+  if(prxdata != NULL)
+    prv_uart_flush(pregs);
+  
+  env_stm32f4xx_ll_timeout_start(&deadline, timeout);
+  
+  while(count_tx < size || count_rx < size)
+  {
+    uint32_t sr = pregs->SR;
+    
+    if(count_rx < size && (sr & USART_SR_RXNE))
+    {
+      prxdata[count_rx++] = (uint8_t)pregs->DR & puart->mask;
+      continue;
+    }
+    
+    if(count_tx < size && (sr & USART_SR_TXE))
+    {
+      pregs->DR = ptxdata[count_tx++];
+      continue;
+    }
+    
+    if(env_stm32f4xx_ll_timeout_expired(&deadline))
+      return JHAL_RES_TIMEOUT;
+  }
+  
+  if(ptxdata != NULL)
+  {
+    while(!(pregs->SR & USART_SR_TC))
+    {
+      if(env_stm32f4xx_ll_timeout_expired(&deadline))
+        return JHAL_RES_TIMEOUT;
+    }
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_uart_start_it(env_stm32f4xx_ll_uart* puart, uint8_t operation, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  uint8_t res = prv_uart_start(puart, operation, ptxdata, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  puart->puart->CR1 |= (prxdata ? USART_CR1_RXNEIE : 0U) | (ptxdata ? USART_CR1_TXEIE : 0U);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* Stops both sides and ends the transfer with the error */
+static void prv_uart_failed(env_stm32f4xx_ll_uart* puart, uint8_t error)
+{
+  env_stm32f4xx_ll_uart_abort(puart);
+  jhal_uart_error_callback(puart, error);
+}
+
+/* The stream is done once the last byte is in the data register, the
+   completion is reported on the transmission complete flag */
+static void prv_uart_dma_tx_complete(void* pcontext, uint8_t error)
+{
+  env_stm32f4xx_ll_uart* puart = (env_stm32f4xx_ll_uart*)pcontext;
+  
+  if(error)
+  {
+    prv_uart_failed(puart, JHAL_UART_ERROR_DMA);
+    return;
+  }
+  
+  puart->puart->CR3 &= ~USART_CR3_DMAT;
+  puart->puart->CR1 |= USART_CR1_TCIE;
+}
+
+static void prv_uart_dma_rx_complete(void* pcontext, uint8_t error)
+{
+  env_stm32f4xx_ll_uart* puart = (env_stm32f4xx_ll_uart*)pcontext;
+  
+  if(error)
+  {
+    prv_uart_failed(puart, JHAL_UART_ERROR_DMA);
+    return;
+  }
+  
+  puart->puart->CR3 &= ~(USART_CR3_DMAR | USART_CR3_DMAT);
+  
+  if(puart->operation_rx == UART_OPERATION_TXRX)
+  {
+    env_stm32f4xx_ll_dma_stop_periph(puart->pinstance_dma_tx);
+    puart->operation_tx = 0;
+    puart->pinstance_dma_tx = NULL;
+  }
+  
+  prv_uart_rx_complete(puart);
+}
+
+static uint8_t prv_uart_start_dma_tx(env_stm32f4xx_ll_uart* puart, uint8_t* ptxdata, uint16_t size, void* pinstance_dma, env_stm32f4xx_ll_dma_complete pfunc_complete)
+{
+  USART_TypeDef* pregs = puart->puart;
+  
+  puart->pinstance_dma_tx = pinstance_dma;
+  pregs->SR &= ~USART_SR_TC;
+  
+  uint8_t res = env_stm32f4xx_ll_dma_start_periph(pinstance_dma, DMA_SxCR_DIR_0 | DMA_SxCR_MINC, &pregs->DR, ptxdata, size, pfunc_complete, puart);
+  if(res != JHAL_RES_NO_ERRORS)
+  {
+    puart->pinstance_dma_tx = NULL;
+    return res;
+  }
+  
+  pregs->CR3 |= USART_CR3_DMAT;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_uart_start_dma_rx(env_stm32f4xx_ll_uart* puart, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  puart->pinstance_dma_rx = pinstance_dma;
+  
+  uint8_t res = env_stm32f4xx_ll_dma_start_periph(pinstance_dma, DMA_SxCR_MINC, &puart->puart->DR, prxdata, size, prv_uart_dma_rx_complete, puart);
+  if(res != JHAL_RES_NO_ERRORS)
+  {
+    puart->pinstance_dma_rx = NULL;
+    return res;
+  }
+  
+  puart->puart->CR3 |= USART_CR3_DMAR;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint32_t env_stm32f4xx_ll_uart_size_drv(void)
+{
+  return env_stm32f4xx_ll_uart_size_drv_static;
+}
+
+uint8_t env_stm32f4xx_ll_uart_init(void* pinstance, jhal_uart_params* pparams)
+{
+  env_stm32f4xx_ll_uart* puart = (env_stm32f4xx_ll_uart*)pinstance;
+  uint32_t baudrate = prv_uart_baudrate(pparams->baudrate);
+  uint32_t cr1 = USART_CR1_TE | USART_CR1_RE;
+  uint32_t cr2 = 0;
+  uint32_t cr3 = 0;
+  uint8_t flow_ctrl = 0;
+  IRQn_Type irq;
+  
+  memset(puart, 0, sizeof(env_stm32f4xx_ll_uart));
+  
+  if(pparams->num_module < 1 || pparams->num_module > UART_AMOUNT_MODULES || UARTInstances[pparams->num_module - 1] != NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(!baudrate)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  switch(pparams->parity)
+  {
+    case JHAL_UART_PARITY_NONE:         break;
+    case JHAL_UART_PARITY_EVEN:         cr1 |= USART_CR1_PCE; break;
+    case JHAL_UART_PARITY_ODD:          cr1 |= USART_CR1_PCE | USART_CR1_PS; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  /* The parity bit is a part of the frame, M selects 9 bits with it */
+  puart->mask = 0xFFU;
+  switch(pparams->data_size)
+  {
+    case JHAL_UART_DATA_SIZE_7BIT:
+      if(!(cr1 & USART_CR1_PCE))
+        return JHAL_RES_NOT_SUPPORTED;
+      puart->mask = 0x7FU;
+    break;
+    case JHAL_UART_DATA_SIZE_8BIT:
+      if(cr1 & USART_CR1_PCE)
+        cr1 |= USART_CR1_M;
+    break;
+    case JHAL_UART_DATA_SIZE_5BIT:
+    case JHAL_UART_DATA_SIZE_6BIT:
+    case JHAL_UART_DATA_SIZE_9BIT:
+      return JHAL_RES_NOT_SUPPORTED;
+    default:
+      return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->stop_bits)
+  {
+    case JHAL_UART_STOP_BITS_1BIT:      break;
+    case JHAL_UART_STOP_BITS_15BIT:     cr2 |= USART_CR2_STOP_0 | USART_CR2_STOP_1; break;
+    case JHAL_UART_STOP_BITS_2BIT:      cr2 |= USART_CR2_STOP_1; break;
+    default:                            return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->hwr_flow_ctrl)
+  {
+    case JHAL_UART_HWR_FLOW_CTRL_NOT_USE:       break;
+    case JHAL_UART_HWR_FLOW_CTRL_USE:           cr3 |= USART_CR3_RTSE | USART_CR3_CTSE; break;
+    default:                                    return JHAL_RES_INVALID_PARAMS;
+  }
+  
+  switch(pparams->num_module)
+  {
+#ifdef USART1
+    case 1:
+      RCC->APB2ENR |= RCC_APB2ENR_USART1EN;
+      puart->puart = USART1;
+      puart->bus = ENV_STM32F4XX_LL_BUS_APB2;
+      irq = USART1_IRQn;
+      flow_ctrl = 1;
+    break;
+#endif
+#ifdef USART2
+    case 2:
+      RCC->APB1ENR |= RCC_APB1ENR_USART2EN;
+      puart->puart = USART2;
+      puart->bus = ENV_STM32F4XX_LL_BUS_APB1;
+      irq = USART2_IRQn;
+      flow_ctrl = 1;
+    break;
+#endif
+#ifdef USART3
+    case 3:
+      RCC->APB1ENR |= RCC_APB1ENR_USART3EN;
+      puart->puart = USART3;
+      puart->bus = ENV_STM32F4XX_LL_BUS_APB1;
+      irq = USART3_IRQn;
+      flow_ctrl = 1;
+    break;
+#endif
+#ifdef UART4
+    case 4:
+      RCC->APB1ENR |= RCC_APB1ENR_UART4EN;
+      puart->puart = UART4;
+      puart->bus = ENV_STM32F4XX_LL_BUS_APB1;
+      irq = UART4_IRQn;
+    break;
+#endif
+#ifdef UART5
+    case 5:
+      RCC->APB1ENR |= RCC_APB1ENR_UART5EN;
+      puart->puart = UART5;
+      puart->bus = ENV_STM32F4XX_LL_BUS_APB1;
+      irq = UART5_IRQn;
+    break;
+#endif
+#ifdef USART6
+    case 6:
+      RCC->APB2ENR |= RCC_APB2ENR_USART6EN;
+      puart->puart = USART6;
+      puart->bus = ENV_STM32F4XX_LL_BUS_APB2;
+      irq = USART6_IRQn;
+      flow_ctrl = 1;
+    break;
+#endif
+#ifdef UART7
+    case 7:
+      RCC->APB1ENR |= RCC_APB1ENR_UART7EN;
+      puart->puart = UART7;
+      puart->bus = ENV_STM32F4XX_LL_BUS_APB1;
+      irq = UART7_IRQn;
+    break;
+#endif
+#ifdef UART8
+    case 8:
+      RCC->APB1ENR |= RCC_APB1ENR_UART8EN;
+      puart->puart = UART8;
+      puart->bus = ENV_STM32F4XX_LL_BUS_APB1;
+      irq = UART8_IRQn;
+    break;
+#endif
+    default:
+      return JHAL_RES_NOT_SUPPORTED;
+  }
+  
+  if(cr3 && !flow_ctrl)
+  {
+    puart->puart = NULL;
+    return JHAL_RES_NOT_SUPPORTED;
+  }
+  
+  if(pparams->plib_data != NULL)
+    puart->config = *((env_stm32f4xx_ll_uart_config*)pparams->plib_data);
+  
+  puart->index = pparams->num_module - 1U;
+  puart->puart->CR1 = 0;
+  puart->puart->CR2 = cr2;
+  puart->puart->CR3 = cr3;
+  puart->puart->BRR = prv_uart_brr(puart, baudrate);
+  puart->puart->CR1 = cr1 | USART_CR1_UE;
+  
+  UARTInstances[puart->index] = puart;
+  env_stm32f4xx_ll_irq_enable(irq);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_uart_deinit(void* pinstance)
+{
+  env_stm32f4xx_ll_uart* puart = (env_stm32f4xx_ll_uart*)pinstance;
+  
+  if(puart->puart == NULL)
+    return JHAL_RES_NO_ERRORS;
+  
+  env_stm32f4xx_ll_uart_abort(pinstance);
+  
+  puart->puart->CR1 = 0;
+  UARTInstances[puart->index] = NULL;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_uart_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+  return prv_uart_exchange((env_stm32f4xx_ll_uart*)pinstance, ptxdata, NULL, size, timeout);
+}
+
+uint8_t env_stm32f4xx_ll_uart_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  return prv_uart_exchange((env_stm32f4xx_ll_uart*)pinstance, NULL, prxdata, size, timeout);
+}
+
+uint8_t env_stm32f4xx_ll_uart_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  return prv_uart_exchange((env_stm32f4xx_ll_uart*)pinstance, ptxdata, prxdata, size, timeout);
+}
+
+uint8_t env_stm32f4xx_ll_uart_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size)
+{
+  return prv_uart_start_it((env_stm32f4xx_ll_uart*)pinstance, UART_OPERATION_TX, ptxdata, NULL, size);
+}
+
+uint8_t env_stm32f4xx_ll_uart_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+  return prv_uart_start_it((env_stm32f4xx_ll_uart*)pinstance, UART_OPERATION_RX, NULL, prxdata, size);
+}
+
+uint8_t env_stm32f4xx_ll_uart_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  return prv_uart_start_it((env_stm32f4xx_ll_uart*)pinstance, UART_OPERATION_TXRX, ptxdata, prxdata, size);
+}
+
+uint8_t env_stm32f4xx_ll_uart_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_ll_uart* puart = (env_stm32f4xx_ll_uart*)pinstance;
+  
+  uint8_t res = prv_uart_start(puart, UART_OPERATION_TX, ptxdata, NULL, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  res = prv_uart_start_dma_tx(puart, ptxdata, size, pinstance_dma, prv_uart_dma_tx_complete);
+  if(res != JHAL_RES_NO_ERRORS)
+    puart->operation_tx = 0;
+  
+  return res;
+}
+
+uint8_t env_stm32f4xx_ll_uart_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_ll_uart* puart = (env_stm32f4xx_ll_uart*)pinstance;
+  
+  uint8_t res = prv_uart_start(puart, UART_OPERATION_RX, NULL, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  res = prv_uart_start_dma_rx(puart, prxdata, size, pinstance_dma);
+  if(res != JHAL_RES_NO_ERRORS)
+    puart->operation_rx = 0;
+  
+  return res;
+}
+
+/* The transmit stream runs without interrupts, the receive stream reports the
+   end of the exchange */
+uint8_t env_stm32f4xx_ll_uart_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  env_stm32f4xx_ll_uart* puart = (env_stm32f4xx_ll_uart*)pinstance;
+  
+  if(puart->config.pinstance_dma_tx == NULL)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  uint8_t res = prv_uart_start(puart, UART_OPERATION_TXRX, ptxdata, prxdata, size);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  res = prv_uart_start_dma_rx(puart, prxdata, size, pinstance_dma);
+  if(res == JHAL_RES_NO_ERRORS)
+  {
+    res = prv_uart_start_dma_tx(puart, ptxdata, size, puart->config.pinstance_dma_tx, NULL);
+    if(res != JHAL_RES_NO_ERRORS)
+    {
+      puart->puart->CR3 &= ~USART_CR3_DMAR;
+      env_stm32f4xx_ll_dma_stop_periph(pinstance_dma);
+      puart->pinstance_dma_rx = NULL;
+    }
+  }
+  
+  if(res != JHAL_RES_NO_ERRORS)
+  {
+    puart->operation_tx = 0;
+    puart->operation_rx = 0;
+  }
+  
+  return res;
+}
+
+uint8_t env_stm32f4xx_ll_uart_abort(void* pinstance)
+{
+  env_stm32f4xx_ll_uart* puart = (env_stm32f4xx_ll_uart*)pinstance;
+  USART_TypeDef* pregs = puart->puart;
+  
+  pregs->CR1 &= ~(USART_CR1_TXEIE | USART_CR1_TCIE | USART_CR1_RXNEIE);
+  pregs->CR3 &= ~(USART_CR3_DMAT | USART_CR3_DMAR);
+  
+  if(puart->pinstance_dma_rx != NULL)
+    env_stm32f4xx_ll_dma_stop_periph(puart->pinstance_dma_rx);
+  if(puart->pinstance_dma_tx != NULL)
+    env_stm32f4xx_ll_dma_stop_periph(puart->pinstance_dma_tx);
+  
+  puart->operation_tx = 0;
+  puart->operation_rx = 0;
+  puart->pinstance_dma_rx = NULL;
+  puart->pinstance_dma_tx = NULL;
+  
+  prv_uart_flush(pregs);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t env_stm32f4xx_ll_uart_set_baudrate(void* pinstance, jhal_uart_baudrate baudrate)
+{
+  env_stm32f4xx_ll_uart* puart = (env_stm32f4xx_ll_uart*)pinstance;
+  uint32_t value = prv_uart_baudrate(baudrate);
+  
+  if(!value)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(puart->operation_tx || puart->operation_rx)
+    return JHAL_RES_ERROR;
+  
+  puart->puart->BRR = prv_uart_brr(puart, value);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static void prv_uart_irq(uint8_t index)
+{
+  env_stm32f4xx_ll_uart* puart = UARTInstances[index];
+  
+  if(puart == NULL)
+    return;
+  
+  USART_TypeDef* pregs = puart->puart;
+  uint32_t sr = pregs->SR;
+  uint32_t cr1 = pregs->CR1;
+  
+  /* The read of the data register after the status clears the error flags */
+  if((cr1 & USART_CR1_RXNEIE) && (sr & (USART_SR_ORE | USART_SR_FE | USART_SR_NE | USART_SR_PE)))
+  {
+    (void)pregs->DR;
+    prv_uart_failed(puart, (sr & USART_SR_ORE) ? JHAL_UART_ERROR_OVERRUN :
+                           (sr & USART_SR_FE) ? JHAL_UART_ERROR_FRAMING :
+                           (sr & USART_SR_NE) ? JHAL_UART_ERROR_NOISE : JHAL_UART_ERROR_PARITY);
+    return;
+  }
+  
+  if((cr1 & USART_CR1_RXNEIE) && (sr & (USART_SR_RXNE | USART_SR_ORE)))
+  {
+    puart->prxdata[puart->count_rx] = (uint8_t)pregs->DR & puart->mask;
+    if(++puart->count_rx == puart->size_rx)
+    {
+      pregs->CR1 &= ~USART_CR1_RXNEIE;
+      prv_uart_rx_complete(puart);
+    }
+  }
+  
+  if((cr1 & USART_CR1_TXEIE) && (sr & USART_SR_TXE))
+  {
+    pregs->DR = puart->ptxdata[puart->count_tx];
+    if(++puart->count_tx == puart->size_tx)
+    {
+      /* The exchange ends with its last received byte, the transmit side is
+         free as soon as the data register took the last byte */
+      if(puart->operation_tx == UART_OPERATION_TXRX)
+      {
+        pregs->CR1 &= ~USART_CR1_TXEIE;
+        puart->operation_tx = 0;
+      }
+      else
+        pregs->CR1 = (pregs->CR1 & ~USART_CR1_TXEIE) | USART_CR1_TCIE;
+    }
+  }
+  else if((cr1 & USART_CR1_TCIE) && (sr & USART_SR_TC))
+  {
+    pregs->CR1 &= ~USART_CR1_TCIE;
+    prv_uart_tx_complete(puart);
+  }
+}
+
+#ifdef USART1
+void USART1_IRQHandler(void)
+{
+  prv_uart_irq(0);
+}
+#endif
+
+#ifdef USART2
+void USART2_IRQHandler(void)
+{
+  prv_uart_irq(1);
+}
+#endif
+
+#ifdef USART3
+void USART3_IRQHandler(void)
+{
+  prv_uart_irq(2);
+}
+#endif
+
+#ifdef UART4
+void UART4_IRQHandler(void)
+{
+  prv_uart_irq(3);
+}
+#endif
+
+#ifdef UART5
+void UART5_IRQHandler(void)
+{
+  prv_uart_irq(4);
+}
+#endif
+
+#ifdef USART6
+void USART6_IRQHandler(void)
+{
+  prv_uart_irq(5);
+}
+#endif
+
+#ifdef UART7
+void UART7_IRQHandler(void)
+{
+  prv_uart_irq(6);
+}
+#endif
+
+#ifdef UART8
+void UART8_IRQHandler(void)
+{
+  prv_uart_irq(7);
+}
+#endif
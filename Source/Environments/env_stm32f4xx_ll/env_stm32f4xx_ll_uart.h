@@ -0,0 +1,51 @@
+#ifndef __ENV_STM32F4XX_LL_UART__
+#define __ENV_STM32F4XX_LL_UART__
+
+#include "env_stm32f4xx_ll.h"
+
+/* plib_data of jhal_uart_params may point to env_stm32f4xx_ll_uart_config
+   with the DMA instance of the transmit side for transmitreceive_dma, whose
+   pinstance_dma is the receive stream */
+typedef struct {
+  void*                         pinstance_dma_tx;
+} env_stm32f4xx_ll_uart_config;
+
+/* num_module 1..8 selects USART1..3, UART4..5, USART6, UART7..8, the flow
+   control is on USART1..3 and USART6 only. 9-bit data is not supported, the
+   frames are bytes. The env owns the UART interrupts */
+typedef struct {
+  USART_TypeDef*                puart;
+  env_stm32f4xx_ll_uart_config  config;
+  uint8_t                       index;
+  uint8_t                       bus;
+  uint8_t                       mask;
+  uint8_t                       operation_tx;
+  uint8_t                       operation_rx;
+  uint8_t*                      ptxdata;
+  uint8_t*                      prxdata;
+  uint16_t                      size_tx;
+  uint16_t                      size_rx;
+  uint16_t                      count_tx;
+  uint16_t                      count_rx;
+  void*                         pinstance_dma_rx;
+  void*                         pinstance_dma_tx;
+} env_stm32f4xx_ll_uart;
+
+#define env_stm32f4xx_ll_uart_size_drv_static           sizeof(env_stm32f4xx_ll_uart)
+
+uint32_t env_stm32f4xx_ll_uart_size_drv(void);
+uint8_t env_stm32f4xx_ll_uart_init(void* pinstance, jhal_uart_params* pparams);
+uint8_t env_stm32f4xx_ll_uart_deinit(void* pinstance);
+uint8_t env_stm32f4xx_ll_uart_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_ll_uart_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_ll_uart_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t env_stm32f4xx_ll_uart_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size);
+uint8_t env_stm32f4xx_ll_uart_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size);
+uint8_t env_stm32f4xx_ll_uart_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
+uint8_t env_stm32f4xx_ll_uart_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_ll_uart_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_ll_uart_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t env_stm32f4xx_ll_uart_abort(void* pinstance);
+uint8_t env_stm32f4xx_ll_uart_set_baudrate(void* pinstance, jhal_uart_baudrate baudrate);
+
+#endif
@@ -0,0 +1,467 @@
+/**
+  \file    JHALBench.c 
+  \brief   Исполняемый файл замера накладных расходов диспетчеризации jhal
+  \author  JavaLandau
+  \version 1.0
+  \date    17.10.2026 
+*/
+
+/**
+  \defgroup module_JHALBench Замер накладных расходов jhal
+   
+  \brief Модуль замера стоимости вызова точек входа jhal: обертки jhal_*, 
+         макроса JHAL_* и функции окружения с проверками параметров текущего
+         уровня защиты. Каждая точка входа замеряется через обертку и напрямую
+         через функцию окружения, результат выводится в формате CSV
+  @{
+*/
+
+#if defined(__linux__)
+  #define _POSIX_C_SOURCE 200809L
+  #include <time.h>
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include "TypesDefine.h"
+#include "JHALBench.h"
+#include JHAL_TICK_INCLUDE_NAME
+
+#define SIZE_LINE               128             ///<Размер строки вывода
+#define SIZE_MEM_DRV            1024            ///<Размер памяти под экземпляр окружения при прямом вызове
+#define SIZE_MEM_DMA            256             ///<Размер буферов передачи DMA
+#define SIZE_SELECTION          50              ///<Величина выборки для калибровки счетчика
+
+#define JHAL_BENCH_ENV          JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_MCU_ENV)    ///<Имя окружения, для которого собран замер
+
+#if defined(__linux__)
+  #define JHAL_BENCH_UNITS      "ns"            ///<Единицы измерения на хосте
+#else
+  #define JHAL_BENCH_UNITS      "cycles"        ///<Единицы измерения на цели
+
+  #define DWT_CYCCNT            *(volatile uint32_t *)0xE0001004
+  #define DWT_CONTROL           *(volatile uint32_t *)0xE0001000
+  #define SCB_DEMCR             *(volatile uint32_t *)0xE000EDFC
+#endif
+
+///Структура статистики замеров одной точки входа
+typedef struct {
+  uint32_t      Min;                            ///<Минимальное время вызова
+  uint32_t      Max;                            ///<Максимальное время вызова
+  uint64_t      Sum;                            ///<Суммарное время вызовов
+  uint32_t      Count;                          ///<Количество замеров
+  uint32_t      Failed;                         ///<Количество замеров, отброшенных из-за ошибки вызова
+} JHALBenchStats;
+
+static JHALBenchParams* pBenchParams;           ///<Параметры текущего замера
+static uint32_t SelfDelay = 0;                  ///<Задержка, вносимая самим чтением счетчика
+static volatile uint8_t Completed = 0;          ///<Флаг завершения IT/DMA операции
+static uint8_t SampleFailed = 0;                ///<Флаг ошибки в действиях до или после замера
+static uint64_t MemDrv[SIZE_MEM_DRV / sizeof(uint64_t)];        ///<Память экземпляра окружения при прямом вызове
+static uint8_t MemSrc[SIZE_MEM_DMA];            ///<Буфер-источник
+static uint8_t MemDst[SIZE_MEM_DMA];            ///<Буфер-приемник
+
+/**Замер одной точки входа
+  \param[in] NAME имя точки входа
+  \param[in] PATH путь вызова: "jhal" или "env"
+  \param[in] PRE действие перед замером, не входящее во время вызова
+  \param[in] CALL замеряемый вызов, возвращающий результат jhal (JHAL_RES_*)
+  \param[in] POST действие после замера, не входящее во время вызова
+  \details Замер, в котором вызов вернул ошибку или действие, проверенное через
+           JHAL_BENCH_CHECK, завершилось неудачно, не учитывается во времени и
+           считается в столбце ошибок
+*/
+#define JHAL_BENCH_MEASURE(NAME, PATH, PRE, CALL, POST)                         \
+  do {                                                                          \
+    JHALBenchStats Stats = {UINT32_MAX, 0, 0, 0, 0};                            \
+    for(uint32_t i = 0; i < pBenchParams->Iterations; i++)                      \
+    {                                                                           \
+      Completed = 0;                                                            \
+      SampleFailed = 0;                                                         \
+      PRE;                                                                      \
+      uint32_t Start = prvJHALBenchCycles();                                    \
+      uint8_t Res = (CALL);                                                     \
+      uint32_t Cycles = prvJHALBenchCycles() - Start;                           \
+      POST;                                                                     \
+      if(Res != JHAL_RES_NO_ERRORS || SampleFailed)                             \
+        Stats.Failed++;                                                         \
+      else                                                                      \
+        prvJHALBenchAdd(&Stats, Cycles);                                        \
+    }                                                                           \
+    prvJHALBenchPrint(NAME, PATH, &Stats);                                      \
+  } while(0)
+
+#define JHAL_BENCH_NONE                 do {} while(0)  ///<Пустое действие
+#define JHAL_BENCH_VOID(CALL)           ((CALL), JHAL_RES_NO_ERRORS)    ///<Замеряемый вызов без результата jhal
+#define JHAL_BENCH_CHECK(CALL)          do {if((CALL) != JHAL_RES_NO_ERRORS) SampleFailed = 1;} while(0)        ///<Действие, ошибка которого отбрасывает замер
+#define JHAL_BENCH_WAIT                 JHAL_BENCH_CHECK(prvJHALBenchWait())    ///<Ожидание завершения IT/DMA операции
+
+/*Текущее значение счетчика*/
+static inline uint32_t prvJHALBenchCycles(void)
+{
+#if defined(__linux__)
+  struct timespec Now;
+  clock_gettime(CLOCK_MONOTONIC, &Now);
+  return (uint32_t)((uint64_t)Now.tv_sec * 1000000000ULL + Now.tv_nsec);
+#else
+  return DWT_CYCCNT;
+#endif
+}
+
+/*Учет одного замера*/
+static void prvJHALBenchAdd(JHALBenchStats* pStats, uint32_t Cycles)
+{
+  Cycles = (Cycles > SelfDelay) ? Cycles - SelfDelay : 0;
+  
+  if(Cycles < pStats->Min)
+    pStats->Min = Cycles;
+  if(Cycles > pStats->Max)
+    pStats->Max = Cycles;
+  
+  pStats->Sum += Cycles;
+  pStats->Count++;
+}
+
+/*Вывод строки результата*/
+static void prvJHALBenchPrint(const char* pName, const char* pPath, JHALBenchStats* pStats)
+{
+  char Line[SIZE_LINE];
+  
+  if(!pStats->Count && !pStats->Failed)
+    return;
+  
+  /* Точка входа, все вызовы которой завершились ошибкой, выводится с нулевым временем */
+  if(!pStats->Count)
+    pStats->Min = 0;
+  
+  snprintf(Line, SIZE_LINE, "jhal_bench,%s,%u,%s,%u,%s,%s,%lu,%lu,%lu,%lu", JHAL_BENCH_ENV, (unsigned)JHAL_LEVEL_PROTECT, JHAL_BENCH_UNITS, 
+           (unsigned)pBenchParams->SizeTransfer, pName, pPath, (unsigned long)pStats->Min, 
+           (unsigned long)(pStats->Count ? pStats->Sum / pStats->Count : 0), (unsigned long)pStats->Max, (unsigned long)pStats->Failed);
+  
+  pBenchParams->pFuncOutput(Line);
+}
+
+/*Ожидание завершения IT/DMA операции*/
+static uint8_t prvJHALBenchWait(void)
+{
+  for(uint32_t i = 0; i < JHAL_BENCH_WAIT_IT && !Completed; i++);
+  
+  return Completed ? JHAL_RES_NO_ERRORS : JHAL_RES_TIMEOUT;
+}
+
+/*Обработчики завершения операций*/
+static void prvJHALBenchComplete(void* pUserData)
+{
+  (void)pUserData;
+  Completed = 1;
+}
+
+static void prvJHALBenchCompleteData(void* pUserData, uint8_t* pData, uint16_t Size)
+{
+  (void)pData;
+  (void)Size;
+  prvJHALBenchComplete(pUserData);
+}
+
+static void prvJHALBenchCompleteDMA(void* pInstance, void* pUserData)
+{
+  (void)pInstance;
+  prvJHALBenchComplete(pUserData);
+}
+
+static void prvJHALBenchCompleteGPIO(void* pUserData, uint16_t Pin, uint8_t Value)
+{
+  (void)Pin;
+  (void)Value;
+  prvJHALBenchComplete(pUserData);
+}
+
+/*Калибровка задержки, вносимой чтением счетчика*/
+static void prvJHALBenchCalibrate(void)
+{
+#if !defined(__linux__)
+  if(!(DWT_CONTROL & 1))
+  {
+    SCB_DEMCR |= 0x01000000;
+    DWT_CONTROL |= 1;
+  }
+#endif
+  
+  uint32_t SelfMin = UINT32_MAX;
+  SelfDelay = 0;
+  for(uint32_t i = 0; i < SIZE_SELECTION; i++)
+  {
+    uint32_t Start = prvJHALBenchCycles();
+    uint32_t Cycles = prvJHALBenchCycles() - Start;
+    if(Cycles < SelfMin)
+      SelfMin = Cycles;
+  }
+  
+  SelfDelay = SelfMin;
+}
+
+/*Замер точек входа GPIO*/
+static void prvJHALBenchGPIO(void)
+{
+  jhal_gpio_params Params = *pBenchParams->pGPIOParams;
+  Params.pfunc_input = prvJHALBenchCompleteGPIO;
+  void* pInstance = NULL;
+  uint8_t Value;
+  
+  if(JHAL_GPIO_SIZE_DRV > SIZE_MEM_DRV)
+    return;
+  
+  JHAL_BENCH_MEASURE("gpio_init", "jhal", JHAL_BENCH_NONE, jhal_gpio_init(&pInstance, &Params), jhal_gpio_deinit(pInstance); pInstance = NULL);
+  JHAL_BENCH_MEASURE("gpio_init", "env", JHAL_BENCH_NONE, JHAL_GPIO_INIT(MemDrv, &Params), JHAL_GPIO_DEINIT(MemDrv));
+  
+  if(jhal_gpio_init(&pInstance, &Params) != JHAL_RES_NO_ERRORS)
+    return;
+  
+  JHAL_BENCH_MEASURE("gpio_set", "jhal", JHAL_BENCH_NONE, jhal_gpio_set(pInstance, Params.pins, i & 1), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("gpio_set", "env", JHAL_BENCH_NONE, JHAL_GPIO_SET(pInstance, Params.pins, i & 1), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("gpio_get", "jhal", JHAL_BENCH_NONE, jhal_gpio_get(pInstance, Params.pins, &Value), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("gpio_get", "env", JHAL_BENCH_NONE, JHAL_GPIO_GET(pInstance, Params.pins, &Value), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("gpio_input_callback", "jhal", JHAL_BENCH_NONE, JHAL_BENCH_VOID(jhal_gpio_input_callback(pInstance, 0, 1)), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("gpio_input_callback", "env", JHAL_BENCH_NONE, JHAL_BENCH_VOID(Params.pfunc_input(Params.puser_data, 0, 1)), JHAL_BENCH_NONE);
+  
+  jhal_gpio_deinit(pInstance);
+}
+
+/*Замер точек входа SPI*/
+static void prvJHALBenchSPI(void)
+{
+  jhal_spi_params Params = *pBenchParams->pSPIParams;
+  Params.pfunc_tx_complete = prvJHALBenchComplete;
+  Params.pfunc_rx_complete = prvJHALBenchCompleteData;
+  Params.pfunc_txrx_complete = prvJHALBenchCompleteData;
+  void* pInstance = NULL;
+  void* pDMA = NULL;
+  uint16_t Size = pBenchParams->SizeTransfer;
+  
+  if(JHAL_SPI_SIZE_DRV > SIZE_MEM_DRV)
+    return;
+  
+  JHAL_BENCH_MEASURE("spi_init", "jhal", JHAL_BENCH_NONE, jhal_spi_init(&pInstance, &Params), jhal_spi_deinit(pInstance); pInstance = NULL);
+  JHAL_BENCH_MEASURE("spi_init", "env", JHAL_BENCH_NONE, JHAL_SPI_INIT(MemDrv, &Params), JHAL_SPI_DEINIT(MemDrv));
+  
+  if(jhal_spi_init(&pInstance, &Params) != JHAL_RES_NO_ERRORS)
+    return;
+  
+  JHAL_BENCH_MEASURE("spi_transmit", "jhal", JHAL_BENCH_NONE, jhal_spi_transmit(pInstance, MemSrc, Size, 1), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("spi_transmit", "env", JHAL_BENCH_NONE, JHAL_SPI_TRANSMIT(pInstance, MemSrc, Size, 1), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("spi_receive", "jhal", JHAL_BENCH_NONE, jhal_spi_receive(pInstance, MemDst, Size, 1), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("spi_receive", "env", JHAL_BENCH_NONE, JHAL_SPI_RECEIVE(pInstance, MemDst, Size, 1), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("spi_transmitreceive", "jhal", JHAL_BENCH_NONE, jhal_spi_transmitreceive(pInstance, MemSrc, MemDst, Size, 1), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("spi_transmitreceive", "env", JHAL_BENCH_NONE, JHAL_SPI_TRANSMITRECEIVE(pInstance, MemSrc, MemDst, Size, 1), JHAL_BENCH_NONE);
+  
+  JHAL_BENCH_MEASURE("spi_transmit_it", "jhal", JHAL_BENCH_NONE, jhal_spi_transmit_it(pInstance, MemSrc, Size), JHAL_BENCH_WAIT);
+  JHAL_BENCH_MEASURE("spi_transmit_it", "env", JHAL_BENCH_NONE, JHAL_SPI_TRANSMIT_IT(pInstance, MemSrc, Size), JHAL_BENCH_WAIT);
+  JHAL_BENCH_MEASURE("spi_receive_it", "jhal", JHAL_BENCH_NONE, jhal_spi_receive_it(pInstance, MemDst, Size), JHAL_BENCH_WAIT);
+  JHAL_BENCH_MEASURE("spi_receive_it", "env", JHAL_BENCH_NONE, JHAL_SPI_RECEIVE_IT(pInstance, MemDst, Size), JHAL_BENCH_WAIT);
+  JHAL_BENCH_MEASURE("spi_transmitreceive_it", "jhal", JHAL_BENCH_NONE, jhal_spi_transmitreceive_it(pInstance, MemSrc, MemDst, Size), JHAL_BENCH_WAIT);
+  JHAL_BENCH_MEASURE("spi_transmitreceive_it", "env", JHAL_BENCH_NONE, JHAL_SPI_TRANSMITRECEIVE_IT(pInstance, MemSrc, MemDst, Size), JHAL_BENCH_WAIT);
+  
+  if(pBenchParams->pDMAParams != NULL && jhal_dma_init(&pDMA, pBenchParams->pDMAParams) == JHAL_RES_NO_ERRORS)
+  {
+    JHAL_BENCH_MEASURE("spi_transmit_dma", "jhal", JHAL_BENCH_NONE, jhal_spi_transmit_dma(pInstance, MemSrc, Size, pDMA), JHAL_BENCH_WAIT);
+    JHAL_BENCH_MEASURE("spi_transmit_dma", "env", JHAL_BENCH_NONE, JHAL_SPI_TRANSMIT_DMA(pInstance, MemSrc, Size, pDMA), JHAL_BENCH_WAIT);
+    JHAL_BENCH_MEASURE("spi_receive_dma", "jhal", JHAL_BENCH_NONE, jhal_spi_receive_dma(pInstance, MemDst, Size, pDMA), JHAL_BENCH_WAIT);
+    JHAL_BENCH_MEASURE("spi_receive_dma", "env", JHAL_BENCH_NONE, JHAL_SPI_RECEIVE_DMA(pInstance, MemDst, Size, pDMA), JHAL_BENCH_WAIT);
+    JHAL_BENCH_MEASURE("spi_transmitreceive_dma", "jhal", JHAL_BENCH_NONE, jhal_spi_transmitreceive_dma(pInstance, MemSrc, MemDst, Size, pDMA), JHAL_BENCH_WAIT);
+    JHAL_BENCH_MEASURE("spi_transmitreceive_dma", "env", JHAL_BENCH_NONE, JHAL_SPI_TRANSMITRECEIVE_DMA(pInstance, MemSrc, MemDst, Size, pDMA), JHAL_BENCH_WAIT);
+    jhal_dma_deinit(pDMA);
+  }
+  
+  JHAL_BENCH_MEASURE("spi_tx_complete_callback", "jhal", JHAL_BENCH_NONE, JHAL_BENCH_VOID(jhal_spi_tx_complete_callback(pInstance)), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("spi_tx_complete_callback", "env", JHAL_BENCH_NONE, JHAL_BENCH_VOID(Params.pfunc_tx_complete(Params.puser_data)), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("spi_rx_complete_callback", "jhal", JHAL_BENCH_NONE, JHAL_BENCH_VOID(jhal_spi_rx_complete_callback(pInstance, MemDst, Size)), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("spi_rx_complete_callback", "env", JHAL_BENCH_NONE, JHAL_BENCH_VOID(Params.pfunc_rx_complete(Params.puser_data, MemDst, Size)), JHAL_BENCH_NONE);
+  
+  jhal_spi_deinit(pInstance);
+}
+
+/*Замер точек входа UART. Прием замеряется после неучитываемой передачи,
+  поэтому TX и RX модуля должны быть замкнуты*/
+static void prvJHALBenchUART(void)
+{
+  jhal_uart_params Params = *pBenchParams->pUARTParams;
+  Params.pfunc_tx_complete = prvJHALBenchComplete;
+  Params.pfunc_rx_complete = prvJHALBenchCompleteData;
+  Params.pfunc_txrx_complete = prvJHALBenchCompleteData;
+  void* pInstance = NULL;
+  void* pDMA = NULL;
+  uint16_t Size = pBenchParams->SizeTransfer;
+  
+  if(JHAL_UART_SIZE_DRV > SIZE_MEM_DRV)
+    return;
+  
+  JHAL_BENCH_MEASURE("uart_init", "jhal", JHAL_BENCH_NONE, jhal_uart_init(&pInstance, &Params), jhal_uart_deinit(pInstance); pInstance = NULL);
+  JHAL_BENCH_MEASURE("uart_init", "env", JHAL_BENCH_NONE, JHAL_UART_INIT(MemDrv, &Params), JHAL_UART_DEINIT(MemDrv));
+  
+  if(jhal_uart_init(&pInstance, &Params) != JHAL_RES_NO_ERRORS)
+    return;
+  
+  JHAL_BENCH_MEASURE("uart_transmit", "jhal", JHAL_BENCH_NONE, jhal_uart_transmit(pInstance, MemSrc, Size, 10), JHAL_BENCH_CHECK(JHAL_UART_RECEIVE(pInstance, MemDst, Size, 10)));
+  JHAL_BENCH_MEASURE("uart_transmit", "env", JHAL_BENCH_NONE, JHAL_UART_TRANSMIT(pInstance, MemSrc, Size, 10), JHAL_BENCH_CHECK(JHAL_UART_RECEIVE(pInstance, MemDst, Size, 10)));
+  JHAL_BENCH_MEASURE("uart_receive", "jhal", JHAL_BENCH_CHECK(JHAL_UART_TRANSMIT(pInstance, MemSrc, Size, 10)), jhal_uart_receive(pInstance, MemDst, Size, 10), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("uart_receive", "env", JHAL_BENCH_CHECK(JHAL_UART_TRANSMIT(pInstance, MemSrc, Size, 10)), JHAL_UART_RECEIVE(pInstance, MemDst, Size, 10), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("uart_transmitreceive", "jhal", JHAL_BENCH_NONE, jhal_uart_transmitreceive(pInstance, MemSrc, MemDst, Size, 10), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("uart_transmitreceive", "env", JHAL_BENCH_NONE, JHAL_UART_TRANSMITRECEIVE(pInstance, MemSrc, MemDst, Size, 10), JHAL_BENCH_NONE);
+  
+  JHAL_BENCH_MEASURE("uart_transmitreceive_it", "jhal", JHAL_BENCH_NONE, jhal_uart_transmitreceive_it(pInstance, MemSrc, MemDst, Size), JHAL_BENCH_WAIT);
+  JHAL_BENCH_MEASURE("uart_transmitreceive_it", "env", JHAL_BENCH_NONE, JHAL_UART_TRANSMITRECEIVE_IT(pInstance, MemSrc, MemDst, Size), JHAL_BENCH_WAIT);
+  JHAL_BENCH_MEASURE("uart_receive_it", "jhal", JHAL_BENCH_CHECK(JHAL_UART_TRANSMIT(pInstance, MemSrc, Size, 10)), jhal_uart_receive_it(pInstance, MemDst, Size), JHAL_BENCH_WAIT);
+  JHAL_BENCH_MEASURE("uart_receive_it", "env", JHAL_BENCH_CHECK(JHAL_UART_TRANSMIT(pInstance, MemSrc, Size, 10)), JHAL_UART_RECEIVE_IT(pInstance, MemDst, Size), JHAL_BENCH_WAIT);
+  JHAL_BENCH_MEASURE("uart_transmit_it", "jhal", JHAL_BENCH_NONE, jhal_uart_transmit_it(pInstance, MemSrc, Size), JHAL_BENCH_WAIT; JHAL_BENCH_CHECK(JHAL_UART_RECEIVE(pInstance, MemDst, Size, 10)));
+  JHAL_BENCH_MEASURE("uart_transmit_it", "env", JHAL_BENCH_NONE, JHAL_UART_TRANSMIT_IT(pInstance, MemSrc, Size), JHAL_BENCH_WAIT; JHAL_BENCH_CHECK(JHAL_UART_RECEIVE(pInstance, MemDst, Size, 10)));
+  
+  if(pBenchParams->pDMAParams != NULL && jhal_dma_init(&pDMA, pBenchParams->pDMAParams) == JHAL_RES_NO_ERRORS)
+  {
+    JHAL_BENCH_MEASURE("uart_transmitreceive_dma", "jhal", JHAL_BENCH_NONE, jhal_uart_transmitreceive_dma(pInstance, MemSrc, MemDst, Size, pDMA), JHAL_BENCH_WAIT);
+    JHAL_BENCH_MEASURE("uart_transmitreceive_dma", "env", JHAL_BENCH_NONE, JHAL_UART_TRANSMITRECEIVE_DMA(pInstance, MemSrc, MemDst, Size, pDMA), JHAL_BENCH_WAIT);
+    JHAL_BENCH_MEASURE("uart_receive_dma", "jhal", JHAL_BENCH_CHECK(JHAL_UART_TRANSMIT(pInstance, MemSrc, Size, 10)), jhal_uart_receive_dma(pInstance, MemDst, Size, pDMA), JHAL_BENCH_WAIT);
+    JHAL_BENCH_MEASURE("uart_receive_dma", "env", JHAL_BENCH_CHECK(JHAL_UART_TRANSMIT(pInstance, MemSrc, Size, 10)), JHAL_UART_RECEIVE_DMA(pInstance, MemDst, Size, pDMA), JHAL_BENCH_WAIT);
+    JHAL_BENCH_MEASURE("uart_transmit_dma", "jhal", JHAL_BENCH_NONE, jhal_uart_transmit_dma(pInstance, MemSrc, Size, pDMA), JHAL_BENCH_WAIT; JHAL_BENCH_CHECK(JHAL_UART_RECEIVE(pInstance, MemDst, Size, 10)));
+    JHAL_BENCH_MEASURE("uart_transmit_dma", "env", JHAL_BENCH_NONE, JHAL_UART_TRANSMIT_DMA(pInstance, MemSrc, Size, pDMA), JHAL_BENCH_WAIT; JHAL_BENCH_CHECK(JHAL_UART_RECEIVE(pInstance, MemDst, Size, 10)));
+    jhal_dma_deinit(pDMA);
+  }
+  
+  JHAL_BENCH_MEASURE("uart_tx_complete_callback", "jhal", JHAL_BENCH_NONE, JHAL_BENCH_VOID(jhal_uart_tx_complete_callback(pInstance)), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("uart_tx_complete_callback", "env", JHAL_BENCH_NONE, JHAL_BENCH_VOID(Params.pfunc_tx_complete(Params.puser_data)), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("uart_rx_complete_callback", "jhal", JHAL_BENCH_NONE, JHAL_BENCH_VOID(jhal_uart_rx_complete_callback(pInstance, MemDst, Size)), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("uart_rx_complete_callback", "env", JHAL_BENCH_NONE, JHAL_BENCH_VOID(Params.pfunc_rx_complete(Params.puser_data, MemDst, Size)), JHAL_BENCH_NONE);
+  
+  jhal_uart_deinit(pInstance);
+}
+
+/*Замер точек входа DMA*/
+static void prvJHALBenchDMA(void)
+{
+  jhal_dma_params Params = *pBenchParams->pDMAParams;
+  Params.pfunc_transfer_complete = prvJHALBenchCompleteDMA;
+  void* pInstance = NULL;
+  uintptr_t Src = (uintptr_t)MemSrc;
+  uintptr_t Dst = (uintptr_t)MemDst;
+  uint32_t Size = pBenchParams->SizeTransfer;
+  
+  if(JHAL_DMA_SIZE_DRV > SIZE_MEM_DRV)
+    return;
+  
+  JHAL_BENCH_MEASURE("dma_init", "jhal", JHAL_BENCH_NONE, jhal_dma_init(&pInstance, &Params), jhal_dma_deinit(pInstance); pInstance = NULL);
+  JHAL_BENCH_MEASURE("dma_init", "env", JHAL_BENCH_NONE, JHAL_DMA_INIT(MemDrv, &Params), JHAL_DMA_DEINIT(MemDrv));
+  
+  if(jhal_dma_init(&pInstance, &Params) != JHAL_RES_NO_ERRORS)
+    return;
+  
+  JHAL_BENCH_MEASURE("dma_start", "jhal", JHAL_BENCH_NONE, jhal_dma_start(pInstance, Src, Dst, Size), jhal_dma_stop(pInstance));
+  JHAL_BENCH_MEASURE("dma_start", "env", JHAL_BENCH_NONE, JHAL_DMA_START(pInstance, Src, Dst, Size), JHAL_DMA_STOP(pInstance));
+  JHAL_BENCH_MEASURE("dma_start_it", "jhal", JHAL_BENCH_NONE, jhal_dma_start_it(pInstance, Src, Dst, Size), JHAL_BENCH_WAIT);
+  JHAL_BENCH_MEASURE("dma_start_it", "env", JHAL_BENCH_NONE, JHAL_DMA_START_IT(pInstance, Src, Dst, Size), JHAL_BENCH_WAIT);
+  JHAL_BENCH_MEASURE("dma_transfer_complete_callback", "jhal", JHAL_BENCH_NONE, JHAL_BENCH_VOID(jhal_dma_transfer_complete_callback(pInstance)), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("dma_transfer_complete_callback", "env", JHAL_BENCH_NONE, JHAL_BENCH_VOID(Params.pfunc_transfer_complete(pInstance, Params.puser_data)), JHAL_BENCH_NONE);
+  
+  jhal_dma_deinit(pInstance);
+}
+
+/*Замер точек входа базового таймера*/
+static void prvJHALBenchTIMBase(void)
+{
+  jhal_tim_base_params Params = *pBenchParams->pTIMBaseParams;
+  Params.pfunc_period_ellapsed = prvJHALBenchComplete;
+  void* pInstance = NULL;
+  
+  if(JHAL_TIM_BASE_SIZE_DRV > SIZE_MEM_DRV)
+    return;
+  
+  JHAL_BENCH_MEASURE("tim_base_init", "jhal", JHAL_BENCH_NONE, jhal_tim_base_init(&pInstance, &Params), jhal_tim_base_deinit(pInstance); pInstance = NULL);
+  JHAL_BENCH_MEASURE("tim_base_init", "env", JHAL_BENCH_NONE, JHAL_TIM_BASE_INIT(MemDrv, &Params), JHAL_TIM_BASE_DEINIT(MemDrv));
+  
+  if(jhal_tim_base_init(&pInstance, &Params) != JHAL_RES_NO_ERRORS)
+    return;
+  
+  JHAL_BENCH_MEASURE("tim_base_start", "jhal", JHAL_BENCH_NONE, jhal_tim_base_start(pInstance), jhal_tim_base_stop(pInstance));
+  JHAL_BENCH_MEASURE("tim_base_start", "env", JHAL_BENCH_NONE, JHAL_TIM_BASE_START(pInstance), JHAL_TIM_BASE_STOP(pInstance));
+  JHAL_BENCH_MEASURE("tim_base_start_it", "jhal", JHAL_BENCH_NONE, jhal_tim_base_start_it(pInstance), jhal_tim_base_stop_it(pInstance));
+  JHAL_BENCH_MEASURE("tim_base_start_it", "env", JHAL_BENCH_NONE, JHAL_TIM_BASE_START_IT(pInstance), JHAL_TIM_BASE_STOP_IT(pInstance));
+  JHAL_BENCH_MEASURE("tim_base_period_ellapsed_callback", "jhal", JHAL_BENCH_NONE, JHAL_BENCH_VOID(jhal_tim_base_period_ellapsed_callback(pInstance)), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("tim_base_period_ellapsed_callback", "env", JHAL_BENCH_NONE, JHAL_BENCH_VOID(Params.pfunc_period_ellapsed(Params.puser_data)), JHAL_BENCH_NONE);
+  
+  jhal_tim_base_deinit(pInstance);
+}
+
+/*Замер расчета CRC разными реализациями*/
+static void prvJHALBenchCRC(void)
+{
+  static uint32_t Table[JHAL_CRC_TABLE_SIZE];
+  jhal_crc_params Params = *pBenchParams->pCRCParams;
+  void* pInstance = NULL;
+  uint32_t Result;
+  
+  Params.ptable = NULL;
+  Params.software_only = TRUE;
+  if(jhal_crc_init(&pInstance, &Params) != JHAL_RES_NO_ERRORS)
+    return;
+  
+  JHAL_BENCH_MEASURE("crc_calculate", "bitwise", JHAL_BENCH_NONE, jhal_crc_calculate(pInstance, MemSrc, pBenchParams->SizeTransfer, &Result), JHAL_BENCH_NONE);
+  jhal_crc_deinit(pInstance);
+  pInstance = NULL;
+  
+  Params.ptable = Table;
+  if(jhal_crc_init(&pInstance, &Params) != JHAL_RES_NO_ERRORS)
+    return;
+  
+  JHAL_BENCH_MEASURE("crc_calculate", "sliced", JHAL_BENCH_NONE, jhal_crc_calculate(pInstance, MemSrc, pBenchParams->SizeTransfer, &Result), JHAL_BENCH_NONE);
+  jhal_crc_deinit(pInstance);
+  pInstance = NULL;
+  
+  Params.software_only = FALSE;
+  if(jhal_crc_init(&pInstance, &Params) != JHAL_RES_NO_ERRORS)
+    return;
+  
+  if(jhal_crc_uses_unit(pInstance))
+    JHAL_BENCH_MEASURE("crc_calculate", "unit", JHAL_BENCH_NONE, jhal_crc_calculate(pInstance, MemSrc, pBenchParams->SizeTransfer, &Result), JHAL_BENCH_NONE);
+  
+  jhal_crc_deinit(pInstance);
+}
+
+/*Замер стоимости вызова публичных точек входа jhal*/
+uint8_t JHALBenchRun(JHALBenchParams* pParams)
+{
+  if(!pParams || !pParams->pFuncOutput || !pParams->SizeTransfer || pParams->SizeTransfer > SIZE_MEM_DMA)
+    return FUNC_INVALID_PARAM;
+  
+  pBenchParams = pParams;
+  if(!pBenchParams->Iterations)
+    pBenchParams->Iterations = JHAL_BENCH_ITERATIONS_DEFAULT;
+  
+  for(uint16_t i = 0; i < SIZE_MEM_DMA; i++)
+    MemSrc[i] = (uint8_t)i;
+  
+  prvJHALBenchCalibrate();
+  
+  JHAL_BENCH_MEASURE("tick", "jhal", JHAL_BENCH_NONE, JHAL_BENCH_VOID(jhal_tick(0)), JHAL_BENCH_NONE);
+  JHAL_BENCH_MEASURE("tick", "env", JHAL_BENCH_NONE, JHAL_BENCH_VOID(JHAL_TICK(0)), JHAL_BENCH_NONE);
+  
+  if(pParams->pGPIOParams != NULL)
+    prvJHALBenchGPIO();
+  
+  if(pParams->pSPIParams != NULL)
+    prvJHALBenchSPI();
+  
+  if(pParams->pUARTParams != NULL)
+    prvJHALBenchUART();
+  
+  if(pParams->pDMAParams != NULL)
+    prvJHALBenchDMA();
+  
+  if(pParams->pTIMBaseParams != NULL)
+    prvJHALBenchTIMBase();
+  
+  if(pParams->pCRCParams != NULL)
+    prvJHALBenchCRC();
+  
+  return FUNC_OK;
+}
+/**  
+  @}
+*/
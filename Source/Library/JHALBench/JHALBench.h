@@ -0,0 +1,66 @@
+/**
+  \file    JHALBench.h 
+  \brief   Заголовочный файл замера накладных расходов диспетчеризации jhal
+  \author  JavaLandau
+  \version 1.0
+  \date    17.10.2026 
+*/
+
+#ifndef __JHAL_BENCH__
+#define __JHAL_BENCH__
+
+#include "jhal_gpio.h"
+#include "jhal_spi.h"
+#include "jhal_uart.h"
+#include "jhal_dma.h"
+#include "jhal_tim_base.h"
+#include "jhal_crc.h"
+#include "jhal_tick.h"
+
+/**
+  \addtogroup module_JHALBench
+@{
+*/
+
+#define JHAL_BENCH_ITERATIONS_DEFAULT   64              ///<Количество замеров по умолчанию
+#define JHAL_BENCH_WAIT_IT              1000000         ///<Предельное количество опросов флага завершения IT/DMA операции
+
+///Функция вывода одной строки результатов
+typedef void (*JHALBenchOutput)(const char* pLine);
+
+///Структура параметров замера
+typedef struct {
+  jhal_gpio_params*             pGPIOParams;    ///<Параметры GPIO (выход), NULL - не замерять
+  jhal_spi_params*              pSPIParams;     ///<Параметры SPI, NULL - не замерять
+  jhal_uart_params*             pUARTParams;    ///<Параметры UART, NULL - не замерять
+  jhal_dma_params*              pDMAParams;     ///<Параметры DMA (память-память), NULL - не замерять
+  jhal_tim_base_params*         pTIMBaseParams; ///<Параметры базового таймера, NULL - не замерять
+  jhal_crc_params*              pCRCParams;     ///<Параметры модели CRC, NULL - не замерять
+  uint16_t                      SizeTransfer;   ///<Размер передачи в байтах для SPI, UART и DMA
+  uint32_t                      Iterations;     ///<Количество замеров каждой точки входа, 0 - по умолчанию
+  JHALBenchOutput               pFuncOutput;    ///<Функция вывода результатов
+} JHALBenchParams;
+
+/**Замер стоимости вызова публичных точек входа jhal
+  \param[in] pParams указатель на структуру параметров замера
+  \return Результат выполнения функции
+  \details Для каждой точки входа выводится строка CSV 
+           "jhal_bench,<окружение>,<уровень защиты>,<единицы>,<размер>,<точка входа>,<путь>,<мин>,<среднее>,<макс>,<ошибки>",
+           где путь "jhal" - вызов через обертку jhal, "env" - прямой вызов функции окружения.
+           Ошибки - количество замеров, в которых вызов вернул ошибку или IT/DMA операция не
+           завершилась за JHAL_BENCH_WAIT_IT опросов, их время в мин/среднее/макс не входит.
+           Разница между путями и есть стоимость диспетчеризации. Расчет CRC по SizeTransfer
+           байтам сравнивает реализации, путь "bitwise" - побитный расчет, "sliced" - по таблицам
+           JHAL_CRC_SLICES байт за шаг, "unit" - аппаратный блок CRC, если окружение его поддерживает
+           для заданной модели. Уровень защиты и окружение задаются
+           при сборке, поэтому для сравнения уровней или окружений (например, stm32f4xx_hal
+           и stm32f4xx_ll) программа собирается несколько раз, а строки сводятся по столбцам
+           окружения и размера передачи (SizeTransfer).
+           На цели время считается в тактах счетчика DWT, на хосте - в наносекундах
+*/
+uint8_t JHALBenchRun(JHALBenchParams* pParams);
+
+#endif
+/**  
+  @}
+*/
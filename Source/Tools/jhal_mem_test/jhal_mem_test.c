@@ -0,0 +1,400 @@
+/* Host unit test and benchmark of the jhal size-class pools (jhal_malloc,
+   jhal_free) with the pool configuration of jhal_settings.h.
+
+   Build: cc -O2 -I../../jhal -DJHAL_MCU=host -DJHAL_LIB=posix -o jhal_mem_test jhal_mem_test.c ../../jhal/jhal_environment.c
+   Usage: jhal_mem_test [iterations]
+
+   The test walks every request size through every class, frees in several
+   orders, churns against a model of the pools and checks that a double
+   free, a foreign pointer or an address inside a block leave the pools
+   intact. The benchmark times an alloc/free pair with 0..N live blocks
+   against the list allocator that the pools replaced (a first-fit chain of
+   blocks walked from its head on every alloc and free) and prints CSV lines:
+   allocator,live,ns_per_pair */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "jhal_environment.h"
+
+#define POOL_ALIGN(SIZE)                (((SIZE) + sizeof(uint64_t) - 1) / sizeof(uint64_t) * sizeof(uint64_t))
+
+#define CHURN_ITERATIONS                1000000U
+#define BENCH_ITERATIONS                200000U
+
+#define LIST_SIZE_HEADER                sizeof(list_block)
+
+typedef struct {
+  uint32_t      size_block;
+  uint32_t      amount_blocks;
+} pool_class;
+
+typedef struct _list_block {
+  uint8_t                       invalid;
+  uint32_t                      size;
+  struct _list_block*           pnext;
+} list_block;
+
+static const pool_class Classes[] = {
+  {POOL_ALIGN(JHAL_MEM_POOL_SIZE_CLASS_0), JHAL_MEM_POOL_AMOUNT_CLASS_0},
+#if (JHAL_MEM_POOL_CLASSES > 1)
+  {POOL_ALIGN(JHAL_MEM_POOL_SIZE_CLASS_1), JHAL_MEM_POOL_AMOUNT_CLASS_1},
+#endif
+#if (JHAL_MEM_POOL_CLASSES > 2)
+  {POOL_ALIGN(JHAL_MEM_POOL_SIZE_CLASS_2), JHAL_MEM_POOL_AMOUNT_CLASS_2},
+#endif
+#if (JHAL_MEM_POOL_CLASSES > 3)
+  {POOL_ALIGN(JHAL_MEM_POOL_SIZE_CLASS_3), JHAL_MEM_POOL_AMOUNT_CLASS_3},
+#endif
+};
+
+#define AMOUNT_CLASSES                  (sizeof(Classes) / sizeof(Classes[0]))
+#define AMOUNT_MAX                      1024U
+
+static void* Live[AMOUNT_MAX];
+static uint32_t LiveSize[AMOUNT_MAX];
+static uint32_t LiveClass[AMOUNT_MAX];
+static uint32_t AmountLive = 0;
+static uint32_t Failures = 0;
+
+static uint64_t ListArena[(JHAL_MEM_POOL_SIZE_CLASS_0 * JHAL_MEM_POOL_AMOUNT_CLASS_0 + JHAL_MEM_POOL_SIZE_CLASS_1 * JHAL_MEM_POOL_AMOUNT_CLASS_1 +
+                           JHAL_MEM_POOL_SIZE_CLASS_2 * JHAL_MEM_POOL_AMOUNT_CLASS_2 + JHAL_MEM_POOL_SIZE_CLASS_3 * JHAL_MEM_POOL_AMOUNT_CLASS_3 +
+                           AMOUNT_MAX * LIST_SIZE_HEADER) / sizeof(uint64_t)];
+static uint32_t ListWatermark = 0;
+
+#define CHECK(CONDITION, ...)           do {if(!(CONDITION)){fprintf(stderr, "%s:%d: ", __FILE__, __LINE__); fprintf(stderr, __VA_ARGS__); fputc('\n', stderr); Failures++;}}while(0)
+
+static uint32_t prv_capacity(uint32_t size)
+{
+  uint32_t amount = 0;
+  
+  for(uint32_t i = 0; i < AMOUNT_CLASSES; i++)
+  {
+    if(size <= Classes[i].size_block)
+      amount += Classes[i].amount_blocks;
+  }
+  
+  return amount;
+}
+
+static uint32_t prv_random(void)
+{
+  static uint32_t state = 0x12345678U;
+  
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  
+  return state;
+}
+
+static uint8_t prv_is_live(void* pblock)
+{
+  for(uint32_t i = 0; i < AmountLive; i++)
+  {
+    if(Live[i] == pblock)
+      return 1;
+  }
+  
+  return 0;
+}
+
+/* Every live block is filled with its own pattern, an overlap of two blocks
+   or a free list link written into a live block breaks the pattern */
+static void* prv_alloc(uint32_t size)
+{
+  void* pblock = jhal_malloc(size);
+  
+  if(pblock == NULL)
+    return NULL;
+  
+  CHECK(!((uintptr_t)pblock % sizeof(uint64_t)), "block %p is not aligned", pblock);
+  CHECK(!prv_is_live(pblock), "block %p of size %u is already live", pblock, size);
+  
+  memset(pblock, (uint8_t)(AmountLive + 1), size);
+  Live[AmountLive] = pblock;
+  LiveSize[AmountLive++] = size;
+  
+  return pblock;
+}
+
+static void prv_release(uint32_t index)
+{
+  uint8_t* pblock = (uint8_t*)Live[index];
+  uint8_t pattern = pblock[0];
+  
+  for(uint32_t i = 0; i < LiveSize[index]; i++)
+  {
+    if(pblock[i] != pattern)
+    {
+      CHECK(0, "block %p of size %u is corrupted at %u", (void*)pblock, LiveSize[index], i);
+      break;
+    }
+  }
+  
+  jhal_free(pblock);
+  Live[index] = Live[--AmountLive];
+  LiveSize[index] = LiveSize[AmountLive];
+  LiveClass[index] = LiveClass[AmountLive];
+}
+
+static void prv_release_all(void)
+{
+  while(AmountLive)
+    prv_release(AmountLive - 1);
+}
+
+static uint32_t prv_fill(uint32_t size)
+{
+  uint32_t amount = 0;
+  
+  while(prv_alloc(size) != NULL)
+    amount++;
+  
+  return amount;
+}
+
+/* Every size from 0 to one past the largest class, the fill fails exactly
+   when all classes that fit the size are exhausted */
+static void prv_test_sizes(void)
+{
+  uint32_t size_max = Classes[AMOUNT_CLASSES - 1].size_block;
+  
+  for(uint32_t size = 0; size <= size_max + 1; size++)
+  {
+    uint32_t amount = prv_fill(size);
+  
+    CHECK(amount == prv_capacity(size), "size %u: %u blocks, expected %u", size, amount, prv_capacity(size));
+    prv_release_all();
+  }
+}
+
+/* Frees forward, backward and every second block first, each order has to
+   give the whole capacity back */
+static void prv_test_orders(void)
+{
+  for(uint8_t order = 0; order < 3; order++)
+  {
+    uint32_t amount = prv_fill(1);
+  
+    if(order == 0)
+    {
+      for(uint32_t i = 0; i < amount; i++)
+        jhal_free(Live[i]);
+    }
+    else if(order == 1)
+    {
+      for(uint32_t i = amount; i > 0; i--)
+        jhal_free(Live[i - 1]);
+    }
+    else
+    {
+      for(uint32_t i = 0; i < amount; i += 2)
+        jhal_free(Live[i]);
+      for(uint32_t i = 1; i < amount; i += 2)
+        jhal_free(Live[i]);
+    }
+  
+    AmountLive = 0;
+    CHECK(prv_fill(1) == prv_capacity(1), "order %u: capacity is not restored", order);
+    prv_release_all();
+  }
+}
+
+/* Invalid frees must not touch the free lists: a corrupted list hands out a
+   live block twice or loses blocks */
+static void prv_test_invalid_free(void)
+{
+  uint64_t foreign[4];
+  
+  void* pfirst = prv_alloc(1);
+  void* psecond = prv_alloc(1);
+  
+  prv_release(0);
+  jhal_free(pfirst);
+  jhal_free(NULL);
+  jhal_free(foreign);
+  jhal_free((uint8_t*)psecond + 1);
+  jhal_free((uint8_t*)psecond + sizeof(uint64_t));
+  
+  CHECK(prv_is_live(psecond), "the second block is lost");
+  CHECK(prv_fill(1) == prv_capacity(1) - 1, "invalid frees changed the capacity");
+  prv_release_all();
+  CHECK(prv_fill(1) == prv_capacity(1), "capacity is not restored after invalid frees");
+  prv_release_all();
+}
+
+/* Random allocs and frees against a model of the pools: the first class
+   that fits the size and has a free block serves it */
+static void prv_test_churn(uint32_t iterations)
+{
+  uint32_t used[AMOUNT_CLASSES];
+  
+  memset(used, 0, sizeof(used));
+  
+  for(uint32_t n = 0; n < iterations; n++)
+  {
+    if(AmountLive && (prv_random() & 1U))
+    {
+      uint32_t index = prv_random() % AmountLive;
+  
+      used[LiveClass[index]]--;
+      prv_release(index);
+      continue;
+    }
+  
+    uint32_t size = prv_random() % (Classes[AMOUNT_CLASSES - 1].size_block + 1);
+    uint32_t expected = AMOUNT_CLASSES;
+  
+    for(uint32_t i = 0; i < AMOUNT_CLASSES; i++)
+    {
+      if(size <= Classes[i].size_block && used[i] < Classes[i].amount_blocks)
+      {
+        expected = i;
+        break;
+      }
+    }
+  
+    void* pblock = prv_alloc(size);
+  
+    CHECK((pblock != NULL) == (expected < AMOUNT_CLASSES), "iteration %u: size %u %s", n, size, pblock ? "allocated from full pools" : "failed with free blocks");
+  
+    if(pblock != NULL && expected < AMOUNT_CLASSES)
+    {
+      LiveClass[AmountLive - 1] = expected;
+      used[expected]++;
+    }
+  
+    if(Failures)
+      break;
+  }
+  
+  prv_release_all();
+  CHECK(prv_fill(1) == prv_capacity(1), "capacity is not restored after churn");
+  prv_release_all();
+}
+
+static void* prv_list_malloc(uint32_t size)
+{
+  list_block* plast = NULL;
+  
+  for(list_block* pblock = (list_block*)ListArena; ListWatermark && pblock != NULL; pblock = pblock->pnext)
+  {
+    if(pblock->invalid && pblock->size >= size)
+    {
+      pblock->invalid = 0;
+      return (uint8_t*)pblock + LIST_SIZE_HEADER;
+    }
+  
+    plast = pblock;
+  }
+  
+  size = (uint32_t)POOL_ALIGN(size);
+  if(ListWatermark + LIST_SIZE_HEADER + size > sizeof(ListArena))
+    return NULL;
+  
+  list_block* pblock = (list_block*)((uint8_t*)ListArena + ListWatermark);
+  
+  pblock->invalid = 0;
+  pblock->size = size;
+  pblock->pnext = NULL;
+  ListWatermark += LIST_SIZE_HEADER + size;
+  
+  if(plast != NULL)
+    plast->pnext = pblock;
+  
+  return (uint8_t*)pblock + LIST_SIZE_HEADER;
+}
+
+static void prv_list_free(void* pmem)
+{
+  for(list_block* pblock = (list_block*)ListArena; ListWatermark && pblock != NULL; pblock = pblock->pnext)
+  {
+    if((uint8_t*)pblock + LIST_SIZE_HEADER == pmem)
+    {
+      pblock->invalid = 1;
+      return;
+    }
+  }
+}
+
+static uint64_t prv_time_ns(void)
+{
+  struct timespec time;
+  
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t)time.tv_sec * 1000000000ULL + (uint64_t)time.tv_nsec;
+}
+
+/* live blocks are taken first, the measured pair then allocates behind them,
+   which is the worst case of the list and the usual case of a driver that is
+   created after the others */
+static void prv_bench(uint32_t iterations)
+{
+  uint32_t amount = prv_capacity(1);
+  volatile uintptr_t sink = 0;
+  
+  for(uint32_t live = 0; live < amount; live++)
+  {
+    for(uint32_t i = 0; i < live; i++)
+      Live[i] = jhal_malloc(1);
+  
+    uint64_t start = prv_time_ns();
+    for(uint32_t n = 0; n < iterations; n++)
+    {
+      void* pblock = jhal_malloc(1);
+      sink += (uintptr_t)pblock;
+      jhal_free(pblock);
+    }
+    printf("pool,%u,%.2f\n", live, (double)(prv_time_ns() - start) / iterations);
+  
+    for(uint32_t i = 0; i < live; i++)
+      jhal_free(Live[i]);
+  
+    ListWatermark = 0;
+    for(uint32_t i = 0; i < live; i++)
+      Live[i] = prv_list_malloc(1);
+  
+    start = prv_time_ns();
+    for(uint32_t n = 0; n < iterations; n++)
+    {
+      void* pblock = prv_list_malloc(1);
+      sink += (uintptr_t)pblock;
+      prv_list_free(pblock);
+    }
+    printf("list,%u,%.2f\n", live, (double)(prv_time_ns() - start) / iterations);
+  }
+  
+  (void)sink;
+}
+
+int main(int argc, char* argv[])
+{
+  uint32_t iterations = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : CHURN_ITERATIONS;
+  
+  if(prv_capacity(0) > AMOUNT_MAX)
+  {
+    fprintf(stderr, "more than %u blocks in the pools\n", AMOUNT_MAX);
+    return 1;
+  }
+  
+  prv_test_sizes();
+  prv_test_orders();
+  prv_test_invalid_free();
+  prv_test_churn(iterations);
+  
+  if(Failures)
+  {
+    fprintf(stderr, "%u failures\n", Failures);
+    return 1;
+  }
+  
+  fprintf(stderr, "all tests passed\n");
+  prv_bench(BENCH_ITERATIONS);
+  
+  return 0;
+}
@@ -0,0 +1,274 @@
+/* Host decoder of jhal_trace_dump output into Chrome trace JSON
+   (chrome://tracing, ui.perfetto.dev).
+   
+   Build: cc -O2 -o jhal_trace_decode jhal_trace_decode.c
+   Usage: jhal_trace_decode dump.bin [trace.json]
+   
+   Every driver instance gets a track with its blocking calls as slices and
+   interrupt events as instants. An IT/DMA start or a queued request opens a
+   span on the "async" track of the instance that the next completion of the
+   same instance closes, so the span shows the real bus time of the transfer */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TRACE_MAGIC                     0x4352544AU
+#define TRACE_VERSION                   1U
+#define TRACE_SIZE_HEADER               24U
+#define TRACE_SIZE_RECORD_MIN           16U
+
+#define TRACE_PHASE_BEGIN               0U
+#define TRACE_PHASE_END                 1U
+#define TRACE_PHASE_EVENT               2U
+
+#define TRACE_OP_REQUEST                15U
+#define TRACE_OP_USER                   255U
+
+#define TRACKS_MAX                      256U
+#define TRACK_PENDING                   32U
+
+typedef struct {
+  uint8_t       driver;
+  uint32_t      instance;
+  uint64_t      pending[TRACK_PENDING];
+  uint8_t       pending_op[TRACK_PENDING];
+  uint16_t      pending_size[TRACK_PENDING];
+  uint8_t       pending_head;
+  uint8_t       pending_amount;
+} track;
+
+static const char* const DriverNames[] = {"other", "gpio", "spi", "uart", "dma", "tim_base", "crc", "i2c", "adc", "onewire", "flash"};
+
+static const char* const OpNames[] = {
+  "none", "transmit", "receive", "transmitreceive", "transmit_it", "receive_it", "transmitreceive_it",
+  "transmit_dma", "receive_dma", "transmitreceive_dma", "start", "stop", "start_it", "stop_it",
+  "abort", "request", "tx_complete", "rx_complete", "txrx_complete", "transfer_complete",
+  "input", "period_ellapsed", "calculate", "error", "half_complete",
+  "reset", "reset_it", "erase", "erase_it"
+};
+
+static track Tracks[TRACKS_MAX];
+static uint32_t AmountTracks = 0;
+static uint32_t AmountEvents = 0;
+
+static uint32_t prv_read_u32(const uint8_t* p)
+{
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint16_t prv_read_u16(const uint8_t* p)
+{
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static const char* prv_driver_name(uint8_t driver)
+{
+  return driver < sizeof(DriverNames) / sizeof(DriverNames[0]) ? DriverNames[driver] : "unknown";
+}
+
+static const char* prv_op_name(uint8_t op)
+{
+  if(op == TRACE_OP_USER)
+    return "user";
+  
+  return op < sizeof(OpNames) / sizeof(OpNames[0]) ? OpNames[op] : "unknown";
+}
+
+/* IT and DMA starts complete later from an interrupt */
+static int prv_op_is_async(uint8_t op)
+{
+  return (op >= 4 && op <= 9) || op == 12 || op == 26 || op == 28;
+}
+
+static int prv_op_is_complete(uint8_t op)
+{
+  return op >= 16 && op <= 19;
+}
+
+static void prv_emit(FILE* pout, const char* pformat_event)
+{
+  fprintf(pout, "%s\n    %s", AmountEvents++ ? "," : "", pformat_event);
+}
+
+static uint32_t prv_track(FILE* pout, uint8_t driver, uint32_t instance)
+{
+  char buf[256];
+  
+  for(uint32_t i = 0; i < AmountTracks; i++)
+    if(Tracks[i].driver == driver && Tracks[i].instance == instance)
+      return i;
+  
+  if(AmountTracks == TRACKS_MAX)
+    return TRACKS_MAX - 1;
+  
+  uint32_t index = AmountTracks++;
+  memset(&Tracks[index], 0, sizeof(track));
+  Tracks[index].driver = driver;
+  Tracks[index].instance = instance;
+  
+  /* Thread ids 2n and 2n+1 hold the calls and the async spans of track n */
+  if(driver == 0)
+    snprintf(buf, sizeof(buf), "{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":\"user markers\"}}", index * 2);
+  else
+    snprintf(buf, sizeof(buf), "{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":\"%s 0x%08X\"}}", index * 2, prv_driver_name(driver), instance);
+  prv_emit(pout, buf);
+  
+  if(driver != 0)
+  {
+    snprintf(buf, sizeof(buf), "{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\",\"args\":{\"name\":\"%s 0x%08X async\"}}", index * 2 + 1, prv_driver_name(driver), instance);
+    prv_emit(pout, buf);
+  }
+  
+  return index;
+}
+
+static double prv_us(uint64_t cycles, uint32_t cycles_hz)
+{
+  return (double)cycles * 1000000.0 / (double)cycles_hz;
+}
+
+int main(int argc, char** argv)
+{
+  uint8_t header[TRACE_SIZE_HEADER];
+  char buf[512];
+  
+  if(argc < 2)
+  {
+    fprintf(stderr, "usage: %s dump.bin [trace.json]\n", argv[0]);
+    return 2;
+  }
+  
+  FILE* pin = fopen(argv[1], "rb");
+  if(!pin)
+  {
+    perror(argv[1]);
+    return 1;
+  }
+  
+  FILE* pout = argc > 2 ? fopen(argv[2], "w") : stdout;
+  if(!pout)
+  {
+    perror(argv[2]);
+    return 1;
+  }
+  
+  if(fread(header, 1, sizeof(header), pin) != sizeof(header) || prv_read_u32(&header[0]) != TRACE_MAGIC)
+  {
+    fprintf(stderr, "%s: not a jhal trace dump\n", argv[1]);
+    return 1;
+  }
+  
+  uint16_t version = prv_read_u16(&header[4]);
+  uint16_t size_record = prv_read_u16(&header[6]);
+  uint32_t cycles_hz = prv_read_u32(&header[8]);
+  uint32_t index = prv_read_u32(&header[12]);
+  uint32_t amount = prv_read_u32(&header[16]);
+  
+  if(version != TRACE_VERSION || size_record < TRACE_SIZE_RECORD_MIN || !cycles_hz)
+  {
+    fprintf(stderr, "%s: unsupported dump (version %u, record %u bytes, %u Hz)\n", argv[1], version, size_record, cycles_hz);
+    return 1;
+  }
+  
+  uint8_t* precord = malloc(size_record);
+  uint64_t time = 0;
+  uint32_t timestamp_last = 0;
+  uint32_t amount_read = 0;
+  
+  fprintf(pout, "{\n  \"displayTimeUnit\": \"ns\",\n  \"otherData\": {\"cycles_hz\": %u, \"records\": %u, \"lost\": %u},\n  \"traceEvents\": [", 
+          cycles_hz, amount, index - amount);
+  
+  for(; amount_read < amount && fread(precord, 1, size_record, pin) == size_record; amount_read++)
+  {
+    uint32_t timestamp = prv_read_u32(&precord[0]);
+    uint32_t instance = prv_read_u32(&precord[4]);
+    uint16_t size = prv_read_u16(&precord[8]);
+    uint8_t driver = precord[10];
+    uint8_t op = precord[11];
+    uint8_t phase = precord[12];
+    uint8_t result = precord[13];
+    
+    /* The counter wraps, records are in order so the forward distance is the elapsed time */
+    if(amount_read)
+      time += (uint32_t)(timestamp - timestamp_last);
+    timestamp_last = timestamp;
+    
+    if(op == TRACE_OP_USER)
+    {
+      uint32_t n = prv_track(pout, 0, 0);
+      snprintf(buf, sizeof(buf), "{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"name\":\"user %u\",\"args\":{\"value\":%u}}",
+               n * 2, prv_us(time, cycles_hz), instance, size);
+      prv_emit(pout, buf);
+      continue;
+    }
+    
+    uint32_t n = prv_track(pout, driver, instance);
+    track* ptrack = &Tracks[n];
+    
+    if(phase == TRACE_PHASE_BEGIN)
+    {
+      /* Opened at the call, a fast transfer may complete before the call returns */
+      if(prv_op_is_async(op) && ptrack->pending_amount < TRACK_PENDING)
+      {
+        uint8_t slot = (uint8_t)((ptrack->pending_head + ptrack->pending_amount++) % TRACK_PENDING);
+        ptrack->pending[slot] = time;
+        ptrack->pending_op[slot] = op;
+        ptrack->pending_size[slot] = size;
+      }
+      
+      snprintf(buf, sizeof(buf), "{\"ph\":\"B\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"name\":\"%s\",\"args\":{\"size\":%u}}",
+               n * 2, prv_us(time, cycles_hz), prv_op_name(op), size);
+      prv_emit(pout, buf);
+    }
+    else if(phase == TRACE_PHASE_END)
+    {
+      snprintf(buf, sizeof(buf), "{\"ph\":\"E\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"args\":{\"result\":%u}}",
+               n * 2, prv_us(time, cycles_hz), result);
+      prv_emit(pout, buf);
+      
+      /* A start that failed will not complete */
+      if(prv_op_is_async(op) && result != 0 && ptrack->pending_amount)
+        ptrack->pending_amount--;
+    }
+    else if(op == TRACE_OP_REQUEST && ptrack->pending_amount < TRACK_PENDING)
+    {
+      uint8_t slot = (uint8_t)((ptrack->pending_head + ptrack->pending_amount++) % TRACK_PENDING);
+      ptrack->pending[slot] = time;
+      ptrack->pending_op[slot] = op;
+      ptrack->pending_size[slot] = size;
+    }
+    else if(prv_op_is_complete(op) && ptrack->pending_amount)
+    {
+      uint8_t slot = ptrack->pending_head;
+      ptrack->pending_head = (uint8_t)((slot + 1) % TRACK_PENDING);
+      ptrack->pending_amount--;
+      
+      snprintf(buf, sizeof(buf), "{\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"name\":\"%s\",\"args\":{\"size\":%u}}",
+               n * 2 + 1, prv_us(ptrack->pending[slot], cycles_hz), prv_us(time - ptrack->pending[slot], cycles_hz), 
+               prv_op_name(ptrack->pending_op[slot]), ptrack->pending_size[slot]);
+      prv_emit(pout, buf);
+    }
+    else
+    {
+      snprintf(buf, sizeof(buf), "{\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"name\":\"%s\",\"args\":{\"size\":%u}}",
+               n * 2, prv_us(time, cycles_hz), prv_op_name(op), size);
+      prv_emit(pout, buf);
+    }
+  }
+  
+  fprintf(pout, "\n  ]\n}\n");
+  free(precord);
+  fclose(pin);
+  if(pout != stdout)
+    fclose(pout);
+  
+  if(amount_read != amount)
+  {
+    fprintf(stderr, "%s: truncated, %u of %u records\n", argv[1], amount_read, amount);
+    return 1;
+  }
+  
+  return 0;
+}
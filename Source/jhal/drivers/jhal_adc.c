@@ -0,0 +1,456 @@
+#include "jhal_adc.h"
+#include JHAL_ADC_INCLUDE_NAME
+#include JHAL_TICK_INCLUDE_NAME
+
+#if (USE_JHAL_MEM_LINKED == 1)
+JHAL_MEM_SLOTS_DEFINE(ADC);
+#endif
+
+__WEAK uint8_t JHAL_ADC_INIT(void* pinstance, jhal_adc_params* pparams)
+{
+  (void)pinstance;
+  (void)pparams;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_ADC_DEINIT(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+#if (USE_JHAL_INLINE == 0)
+__WEAK uint8_t JHAL_ADC_CONVERT(void* pinstance, uint16_t* pvalues, uint32_t timeout)
+{
+  (void)pinstance;
+  (void)pvalues;
+  (void)timeout;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_ADC_CONVERT_IT(void* pinstance, uint16_t* pvalues)
+{
+  (void)pinstance;
+  (void)pvalues;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_ADC_START_DMA(void* pinstance, uint16_t* pbuffer, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)pbuffer;
+  (void)size;
+  (void)pinstance_dma;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_ADC_STOP(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+#endif
+
+#if (USE_JHAL_OPS == 1)
+JHAL_ADC_OPS_DECLARE(jhal_adc_ops_default, JHAL_MCU_ENV);
+#endif
+
+#if (USE_JHAL_DEFER == 1)
+#define ADC_EVENT_CONVERSION            1U
+#define ADC_EVENT_HALF                  2U
+#define ADC_EVENT_FULL                  3U
+#define ADC_EVENT_DECIMATED             4U
+#define ADC_EVENT_ERROR                 5U
+#endif
+
+static uint8_t prv_adc_check_params(jhal_adc_params* pparams)
+{
+  if(!pparams->pchannels || !pparams->amount_channels)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  if(pparams->pdecimation && (pparams->decimation_log2 > JHAL_ADC_DECIMATION_LOG2_MAX || pparams->oversampling_bits > pparams->decimation_log2))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_adc_init(jhal_driver_instance* pnew_instance, void** ppinstance, jhal_adc_params* pparams)
+{
+   adc_callback_instance* pcallbacks = (adc_callback_instance*)pnew_instance->pfuncs_callbacks;
+   pcallbacks->pfunc_conversion_complete = pparams->pfunc_conversion_complete;
+   pcallbacks->pfunc_half_complete = pparams->pfunc_half_complete;
+   pcallbacks->pfunc_full_complete = pparams->pfunc_full_complete;
+   pcallbacks->pfunc_decimated = pparams->pfunc_decimated;
+   pcallbacks->pfunc_error = pparams->pfunc_error;
+   pcallbacks->pdecimation = pparams->pdecimation;
+   pcallbacks->amount_channels = pparams->amount_channels;
+   pcallbacks->decimation_log2 = pparams->pdecimation ? pparams->decimation_log2 : 0;
+   pcallbacks->decimation_shift = pparams->pdecimation ? (uint8_t)(pparams->decimation_log2 - pparams->oversampling_bits) : 0;
+   pcallbacks->output_next = 0;
+   pcallbacks->outputs_pending = 0;
+   pcallbacks->outputs_dropping = 0;
+   pnew_instance->puser_data = pparams->puser_data;
+#if (USE_JHAL_OPS == 1)
+   pnew_instance->pops = JHAL_OPS_BY_PARAMS(pparams, _adc);
+#endif
+  
+   uint8_t res = JHAL_DISPATCH(pnew_instance->pinstance, _adc, _init)(pnew_instance->pinstance, pparams);
+  
+   if(res == JHAL_RES_NO_ERRORS)
+   {
+     *ppinstance = pnew_instance->pinstance;
+     jhal_adc_decimation_reset(pnew_instance->pinstance);
+   }
+   else
+   {
+     *ppinstance = NULL;
+     jhal_driver_free(pnew_instance->pinstance);
+   }
+  
+   return res;
+}
+
+uint8_t (jhal_adc_init)(void** ppinstance, jhal_adc_params* pparams)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!ppinstance || *ppinstance || !pparams)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   if(prv_adc_check_params(pparams) != JHAL_RES_NO_ERRORS)
+     return JHAL_RES_INVALID_PARAMS;
+  
+   jhal_driver_instance* pnew_instance = JHAL_DRIVER_MALLOC(JHAL_SIZE_DRV_BY_PARAMS(pparams, _adc), sizeof(adc_callback_instance), ADC);
+  
+   if(pnew_instance == NULL)
+     return JHAL_RES_ALLOC_ERROR;
+  
+   return prv_adc_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_adc_init_static(void** ppinstance, jhal_adc_params* pparams, void* pmem, uint32_t size_mem)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!ppinstance || *ppinstance || !pparams || !pmem)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   if(prv_adc_check_params(pparams) != JHAL_RES_NO_ERRORS)
+     return JHAL_RES_INVALID_PARAMS;
+  
+   jhal_driver_instance* pnew_instance = jhal_driver_place(pmem, size_mem, JHAL_SIZE_DRV_BY_PARAMS(pparams, _adc), sizeof(adc_callback_instance));
+  
+   if(pnew_instance == NULL)
+     return JHAL_RES_ALLOC_ERROR;
+  
+   return prv_adc_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_adc_deinit(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint8_t res = JHAL_DISPATCH(pinstance, _adc, _deinit)(pinstance);
+  
+  jhal_driver_free(pinstance);
+  
+  return res;
+}
+
+/* Drops the partial sums, the next output is the average of the scans that
+   follow. start_dma calls it, so a restarted stream is not mixed with the old one */
+uint8_t jhal_adc_decimation_reset(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  adc_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, adc_callback_instance);
+  
+  if(pcallbacks->pdecimation)
+  {
+    for(uint8_t i = 0; i < pcallbacks->amount_channels; i++)
+      pcallbacks->pdecimation[i] = 0;
+  }
+  
+  pcallbacks->frames_left = 1UL << pcallbacks->decimation_log2;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_adc_convert(void* pinstance, uint16_t* pvalues, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pvalues || !timeout)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RECEIVE, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RECEIVE, 0, JHAL_DISPATCH(pinstance, _adc, _convert)(pinstance, pvalues, timeout));
+}
+
+uint8_t jhal_adc_convert_it(void* pinstance, uint16_t* pvalues)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pvalues)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RECEIVE_IT, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RECEIVE_IT, 0, JHAL_DISPATCH(pinstance, _adc, _convert_it)(pinstance, pvalues));
+}
+
+uint8_t jhal_adc_start_dma(void* pinstance, uint16_t* pbuffer, uint16_t size, void* pinstance_dma)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pbuffer || !size)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance) || size % (2U * JHAL_GET_CALLBACKS(pinstance, adc_callback_instance)->amount_channels))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  jhal_adc_decimation_reset(pinstance);
+  
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size, JHAL_DISPATCH(pinstance, _adc, _start_dma)(pinstance, pbuffer, size, pinstance_dma));
+}
+
+uint8_t jhal_adc_stop(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_STOP, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_STOP, 0, JHAL_DISPATCH(pinstance, _adc, _stop)(pinstance));
+}
+#endif
+
+#if (USE_JHAL_DEFER == 1)
+static void prv_adc_defer_dispatch(const jhal_defer_event* pevent)
+{
+  adc_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pevent->pinstance, adc_callback_instance);
+  void* puser_data = JHAL_GET_USERDATA(pevent->pinstance);
+  
+  switch(pevent->type)
+  {
+    case ADC_EVENT_CONVERSION:
+      pcallbacks->pfunc_conversion_complete(puser_data, (uint16_t*)(void*)pevent->pdata, (uint8_t)pevent->size);
+      break;
+    case ADC_EVENT_HALF:
+      pcallbacks->pfunc_half_complete(puser_data, (uint16_t*)(void*)pevent->pdata, pevent->size);
+      break;
+    case ADC_EVENT_FULL:
+      pcallbacks->pfunc_full_complete(puser_data, (uint16_t*)(void*)pevent->pdata, pevent->size);
+      break;
+    case ADC_EVENT_DECIMATED:
+    {
+      pcallbacks->pfunc_decimated(puser_data, (uint32_t*)(void*)pevent->pdata, (uint8_t)pevent->size);
+      
+      /* The frame goes back to the ring only after the consumer is done with it */
+      uint32_t state = JHAL_CRITICAL_ENTER();
+      pcallbacks->outputs_pending--;
+      JHAL_CRITICAL_EXIT(state);
+      break;
+    }
+    case ADC_EVENT_ERROR:
+      pcallbacks->pfunc_error(puser_data, pevent->value);
+      break;
+  }
+}
+#endif
+
+#if (USE_JHAL_DEFER == 1)
+/* Takes the next frame of the ring for a deferred output, NULL when all of
+   them still wait for the dispatch. The error is reported once per run of
+   dropped outputs, so it does not flood the defer queue */
+static uint32_t* prv_adc_output_take(void* pinstance, adc_callback_instance* pcallbacks)
+{
+  if(pcallbacks->outputs_pending == JHAL_ADC_DECIMATION_OUTPUTS)
+  {
+    if(!pcallbacks->outputs_dropping && pcallbacks->pfunc_error && !JHAL_DEFER_POST(pinstance, prv_adc_defer_dispatch, ADC_EVENT_ERROR, JHAL_ADC_ERROR_DECIMATION, NULL, 0))
+      pcallbacks->pfunc_error(JHAL_GET_USERDATA(pinstance), JHAL_ADC_ERROR_DECIMATION);
+    pcallbacks->outputs_dropping = 1;
+    return NULL;
+  }
+  
+  pcallbacks->outputs_dropping = 0;
+
+  uint32_t* poutputs = pcallbacks->pdecimation + (1U + pcallbacks->output_next) * pcallbacks->amount_channels;
+  pcallbacks->output_next = (uint8_t)((pcallbacks->output_next + 1U) % JHAL_ADC_DECIMATION_OUTPUTS);
+  
+  return poutputs;
+}
+#endif
+
+/* The sums of a channel run over the scans left to the next output with the
+   stride of the scan, so every sample costs one load and one add. A deferred
+   output is written to its own frame of the ring, so the next ones do not
+   overwrite it before the consumer has it */
+static void prv_adc_decimate(void* pinstance, adc_callback_instance* pcallbacks, const uint16_t* psamples, uint16_t size)
+{
+  uint8_t amount = pcallbacks->amount_channels;
+  uint32_t* psums = pcallbacks->pdecimation;
+  uint32_t* poutputs = psums + amount;
+  uint32_t frames = size / amount;
+  
+  while(frames)
+  {
+    uint32_t frames_step = (pcallbacks->frames_left < frames) ? pcallbacks->frames_left : frames;
+  
+    for(uint8_t channel = 0; channel < amount; channel++)
+    {
+      const uint16_t* psample = psamples + channel;
+      uint32_t sum = psums[channel];
+  
+      for(uint32_t i = 0; i < frames_step; i++, psample += amount)
+        sum += *psample;
+  
+      psums[channel] = sum;
+    }
+  
+    psamples += frames_step * amount;
+    frames -= frames_step;
+    pcallbacks->frames_left -= frames_step;
+  
+    if(pcallbacks->frames_left)
+      continue;
+  
+    pcallbacks->frames_left = 1UL << pcallbacks->decimation_log2;
+  
+#if (USE_JHAL_DEFER == 1)
+    uint8_t deferred = JHAL_DRIVER_BY_INSTANCE(pinstance)->defer_level != JHAL_DEFER_LEVEL_NONE;
+    
+    poutputs = deferred ? prv_adc_output_take(pinstance, pcallbacks) : psums + amount;
+    if(poutputs == NULL)
+    {
+      for(uint8_t channel = 0; channel < amount; channel++)
+        psums[channel] = 0;
+      continue;
+    }
+#endif
+  
+    for(uint8_t channel = 0; channel < amount; channel++)
+    {
+      poutputs[channel] = psums[channel] >> pcallbacks->decimation_shift;
+      psums[channel] = 0;
+    }
+  
+#if (USE_JHAL_DEFER == 1)
+    if(deferred)
+    {
+      /* Counted before the post, the dispatch may run before the post returns */
+      pcallbacks->outputs_pending++;
+      if(jhal_defer_post(pinstance, prv_adc_defer_dispatch, ADC_EVENT_DECIMATED, 0, (uint8_t*)poutputs, amount) == JHAL_RES_NO_ERRORS)
+        continue;
+      pcallbacks->outputs_pending--;
+    }
+#endif
+    pcallbacks->pfunc_decimated(JHAL_GET_USERDATA(pinstance), poutputs, amount);
+  }
+}
+
+void jhal_adc_conversion_complete_callback(void* pinstance, uint16_t* pvalues, uint8_t amount)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && pvalues && amount);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RX_COMPLETE, amount);
+  adc_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, adc_callback_instance);
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_conversion_complete && JHAL_DEFER_POST(pinstance, prv_adc_defer_dispatch, ADC_EVENT_CONVERSION, 0, (uint8_t*)pvalues, amount))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_conversion_complete)
+    pcallbacks->pfunc_conversion_complete(JHAL_GET_USERDATA(pinstance), pvalues, amount);
+}
+
+/* The decimation runs in the interrupt in any case, the half is rewritten by
+   the DMA after the other one is filled */
+void jhal_adc_half_complete_callback(void* pinstance, uint16_t* psamples, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && psamples && size);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_HALF_COMPLETE, size);
+  adc_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, adc_callback_instance);
+  
+  if(pcallbacks->pdecimation && pcallbacks->pfunc_decimated)
+    prv_adc_decimate(pinstance, pcallbacks, psamples, size);
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_half_complete && JHAL_DEFER_POST(pinstance, prv_adc_defer_dispatch, ADC_EVENT_HALF, 0, (uint8_t*)psamples, size))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_half_complete)
+    pcallbacks->pfunc_half_complete(JHAL_GET_USERDATA(pinstance), psamples, size);
+}
+
+void jhal_adc_full_complete_callback(void* pinstance, uint16_t* psamples, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && psamples && size);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_TRANSFER_COMPLETE, size);
+  adc_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, adc_callback_instance);
+  
+  if(pcallbacks->pdecimation && pcallbacks->pfunc_decimated)
+    prv_adc_decimate(pinstance, pcallbacks, psamples, size);
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_full_complete && JHAL_DEFER_POST(pinstance, prv_adc_defer_dispatch, ADC_EVENT_FULL, 0, (uint8_t*)psamples, size))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_full_complete)
+    pcallbacks->pfunc_full_complete(JHAL_GET_USERDATA(pinstance), psamples, size);
+}
+
+/* The env has stopped the conversions before the call */
+void jhal_adc_error_callback(void* pinstance, uint8_t error)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && error);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_ERROR, error);
+  adc_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, adc_callback_instance);
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_error && JHAL_DEFER_POST(pinstance, prv_adc_defer_dispatch, ADC_EVENT_ERROR, error, NULL, 0))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_error)
+    pcallbacks->pfunc_error(JHAL_GET_USERDATA(pinstance), error);
+}
+
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_adc_get_stats(void* pinstance, jhal_stats* pstats)
+{
+  return jhal_stats_get(pinstance, pstats);
+}
+
+uint8_t jhal_adc_reset_stats(void* pinstance)
+{
+  return jhal_stats_reset(pinstance);
+}
+#endif
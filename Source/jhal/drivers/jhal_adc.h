@@ -0,0 +1,194 @@
+#ifndef __JHAL_ADC__
+#define __JHAL_ADC__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  
+#include "jhal_environment.h"
+#include "jhal_defer.h"
+#include "jhal_probe.h"
+  
+#define JHAL_ADC_ERROR_OVERRUN                  1U
+#define JHAL_ADC_ERROR_DMA                      2U
+#define JHAL_ADC_ERROR_DECIMATION               3U
+  
+/* Words of the decimation storage of an instance with AMOUNT channels: the
+   running sums and a ring of JHAL_ADC_DECIMATION_OUTPUTS outputs. A deferred
+   output keeps its frame of the ring until it is dispatched, an output that
+   finds the ring full is dropped with JHAL_ADC_ERROR_DECIMATION */
+#define JHAL_ADC_DECIMATION_SIZE(AMOUNT)        ((1U + JHAL_ADC_DECIMATION_OUTPUTS) * (AMOUNT))
+#define JHAL_ADC_DECIMATION_DECLARE(NAME, AMOUNT)  static uint32_t NAME[JHAL_ADC_DECIMATION_SIZE(AMOUNT)]
+#define JHAL_ADC_DECIMATION_LOG2_MAX            16U
+  
+typedef void (*jhal_type_adc_conversion_complete)(void*, uint16_t* pvalues, uint8_t amount);
+typedef void (*jhal_type_adc_buffer_complete)(void*, uint16_t* psamples, uint16_t size);
+typedef void (*jhal_type_adc_decimated)(void*, uint32_t* pvalues, uint8_t amount);
+typedef void (*jhal_type_adc_error)(void*, uint8_t error);
+  
+typedef enum {
+  JHAL_ADC_RESOLUTION_12BIT             = 140U,
+  JHAL_ADC_RESOLUTION_10BIT             = 27U,
+  JHAL_ADC_RESOLUTION_8BIT              = 203U,
+  JHAL_ADC_RESOLUTION_6BIT              = 66U
+} jhal_adc_resolution;
+  
+typedef enum {
+  JHAL_ADC_TRIGGER_SOFTWARE             = 95U,
+  JHAL_ADC_TRIGGER_TIMER                = 178U
+} jhal_adc_trigger;
+  
+/* sample_time is in ADC clocks, the env takes the nearest time it has that is
+   not shorter */
+typedef struct {
+  uint8_t                               channel;
+  uint32_t                              sample_time;
+} jhal_adc_channel;
+  
+#if (USE_JHAL_OPS == 1)
+typedef struct jhal_adc_ops_struct jhal_adc_ops;
+#endif
+  
+/* pchannels is the scan group, one conversion runs all of it in order and
+   gives one sample per channel. JHAL_ADC_TRIGGER_TIMER starts every scan by
+   the update event of timer trigger_module, which the application runs, the
+   software trigger repeats the scans back to back in the DMA mode.
+   pdecimation is the storage of JHAL_ADC_DECIMATION_SIZE words that turns on
+   the decimation of the DMA stream: the samples of 2^decimation_log2 scans are
+   summed per channel and given to pfunc_decimated shifted right by
+   decimation_log2 - oversampling_bits, so the output keeps oversampling_bits
+   fractional bits of the average */
+typedef struct {
+  uint8_t                               num_module;
+  jhal_adc_resolution                   resolution;
+  const jhal_adc_channel*               pchannels;
+  uint8_t                               amount_channels;
+  jhal_adc_trigger                      trigger;
+  uint8_t                               trigger_module;
+  uint32_t*                             pdecimation;
+  uint8_t                               decimation_log2;
+  uint8_t                               oversampling_bits;
+  
+  jhal_type_adc_conversion_complete     pfunc_conversion_complete;
+  jhal_type_adc_buffer_complete         pfunc_half_complete;
+  jhal_type_adc_buffer_complete         pfunc_full_complete;
+  jhal_type_adc_decimated               pfunc_decimated;
+  jhal_type_adc_error                   pfunc_error;
+  void*                                 plib_data;
+  void*                                 puser_data;
+#if (USE_JHAL_OPS == 1)
+  const jhal_adc_ops*                   pops;
+#endif
+} jhal_adc_params;
+  
+typedef struct {
+  jhal_type_adc_conversion_complete     pfunc_conversion_complete;
+  jhal_type_adc_buffer_complete         pfunc_half_complete;
+  jhal_type_adc_buffer_complete         pfunc_full_complete;
+  jhal_type_adc_decimated               pfunc_decimated;
+  jhal_type_adc_error                   pfunc_error;
+  uint32_t*                             pdecimation;
+  uint32_t                              frames_left;
+  uint8_t                               amount_channels;
+  uint8_t                               decimation_log2;
+  uint8_t                               decimation_shift;
+  uint8_t                               output_next;
+  volatile uint8_t                      outputs_pending;
+  uint8_t                               outputs_dropping;
+} adc_callback_instance;
+  
+#define JHAL_ADC_SIZE_STATIC                    JHAL_DRIVER_SIZE_STATIC(JHAL_ADC_SIZE_DRV_STATIC, sizeof(adc_callback_instance))
+#define JHAL_ADC_DECLARE_STATIC(NAME)           JHAL_DECLARE_STATIC_MEM(NAME, JHAL_ADC_SIZE_STATIC)
+#if (USE_JHAL_MEM_LINKED == 1)
+#define JHAL_ADC_DECLARE_INSTANCE(NAME)         JHAL_DECLARE_INSTANCE(NAME, JHAL_ADC_SIZE_STATIC, ADC)
+JHAL_MEM_SLOTS_DECLARE(ADC);
+#endif
+  
+#if (USE_JHAL_OPS == 1)
+struct jhal_adc_ops_struct {
+  uint32_t (*pfunc_size_drv)(void);
+  uint8_t (*pfunc_init)(void* pinstance, jhal_adc_params* pparams);
+  uint8_t (*pfunc_deinit)(void* pinstance);
+  uint8_t (*pfunc_convert)(void* pinstance, uint16_t* pvalues, uint32_t timeout);
+  uint8_t (*pfunc_convert_it)(void* pinstance, uint16_t* pvalues);
+  uint8_t (*pfunc_start_dma)(void* pinstance, uint16_t* pbuffer, uint16_t size, void* pinstance_dma);
+  uint8_t (*pfunc_stop)(void* pinstance);
+};
+  
+extern const jhal_adc_ops jhal_adc_ops_default;
+  
+#define JHAL_ADC_OPS_DECLARE(NAME, ENV)   const jhal_adc_ops NAME = {\
+        JHAL_FUNCTION_NAME(ENV,_adc,_size_drv),\
+        JHAL_FUNCTION_NAME(ENV,_adc,_init),\
+        JHAL_FUNCTION_NAME(ENV,_adc,_deinit),\
+        JHAL_FUNCTION_NAME(ENV,_adc,_convert),\
+        JHAL_FUNCTION_NAME(ENV,_adc,_convert_it),\
+        JHAL_FUNCTION_NAME(ENV,_adc,_start_dma),\
+        JHAL_FUNCTION_NAME(ENV,_adc,_stop)}
+#define JHAL_ADC_SIZE_STATIC_BY_ENV(ENV)  JHAL_DRIVER_SIZE_STATIC(JHAL_FUNCTION_NAME(ENV,_adc,_size_drv_static), sizeof(adc_callback_instance))
+#endif
+  
+uint8_t jhal_adc_init(void** ppinstance, jhal_adc_params* pparams);
+uint8_t jhal_adc_init_static(void** ppinstance, jhal_adc_params* pparams, void* pmem, uint32_t size_mem);
+uint8_t jhal_adc_deinit(void* pinstance);
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_adc_get_stats(void* pinstance, jhal_stats* pstats);
+uint8_t jhal_adc_reset_stats(void* pinstance);
+#endif
+uint8_t jhal_adc_decimation_reset(void* pinstance);
+/* convert runs one scan into pvalues, one value per channel of the group.
+   start_dma fills pbuffer in a circle until stop, size is a multiple of twice
+   the scan and the halves are handed to the callbacks while the other one is
+   written. pinstance_dma may be NULL for envs that run the stream themselves */
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_adc_convert(void* pinstance, uint16_t* pvalues, uint32_t timeout);
+uint8_t jhal_adc_convert_it(void* pinstance, uint16_t* pvalues);
+uint8_t jhal_adc_start_dma(void* pinstance, uint16_t* pbuffer, uint16_t size, void* pinstance_dma);
+uint8_t jhal_adc_stop(void* pinstance);
+#endif
+  
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+  #define jhal_adc_init(PPINSTANCE, PPARAMS)    JHAL_MEM_CALL_SITE((jhal_adc_init)(PPINSTANCE, PPARAMS))
+#endif
+  
+/* Called by the env: the scan of convert_it is done, a half of the DMA buffer
+   is filled or the conversions have stopped with a JHAL_ADC_ERROR_* */
+void jhal_adc_conversion_complete_callback(void* pinstance, uint16_t* pvalues, uint8_t amount);
+void jhal_adc_half_complete_callback(void* pinstance, uint16_t* psamples, uint16_t size);
+void jhal_adc_full_complete_callback(void* pinstance, uint16_t* psamples, uint16_t size);
+void jhal_adc_error_callback(void* pinstance, uint8_t error);
+  
+#ifdef __cplusplus
+}
+#endif
+
+#include JHAL_ADC_INCLUDE_NAME
+
+#if (USE_JHAL_INLINE == 1)
+static inline uint8_t jhal_adc_convert(void* pinstance, uint16_t* pvalues, uint32_t timeout)
+{
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RECEIVE, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RECEIVE, 0, JHAL_DISPATCH(pinstance, _adc, _convert)(pinstance, pvalues, timeout));
+}
+
+static inline uint8_t jhal_adc_convert_it(void* pinstance, uint16_t* pvalues)
+{
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RECEIVE_IT, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RECEIVE_IT, 0, JHAL_DISPATCH(pinstance, _adc, _convert_it)(pinstance, pvalues));
+}
+
+static inline uint8_t jhal_adc_start_dma(void* pinstance, uint16_t* pbuffer, uint16_t size, void* pinstance_dma)
+{
+  jhal_adc_decimation_reset(pinstance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size, JHAL_DISPATCH(pinstance, _adc, _start_dma)(pinstance, pbuffer, size, pinstance_dma));
+}
+
+static inline uint8_t jhal_adc_stop(void* pinstance)
+{
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_STOP, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ADC, pinstance, JHAL_TRACE_OP_STOP, 0, JHAL_DISPATCH(pinstance, _adc, _stop)(pinstance));
+}
+#endif
+
+#endif
@@ -0,0 +1,369 @@
+#include "jhal_crc.h"
+#include JHAL_CRC_INCLUDE_NAME
+
+#if (USE_JHAL_MEM_LINKED == 1)
+JHAL_MEM_SLOTS_DEFINE(CRC);
+#endif
+
+#if (JHAL_CRC_SLICES != 1) && (JHAL_CRC_SLICES != 4) && (JHAL_CRC_SLICES != 8)
+  #error "JHAL_CRC_SLICES must be 1, 4 or 8!"
+#endif
+
+#define CRC_TABLE(PTABLE, SLICE)        (&(PTABLE)[256U * (SLICE)])
+
+typedef struct {
+  uint8_t                       width;
+  uint32_t                      polynomial;
+  uint32_t                      init;
+  uint32_t                      xor_out;
+  uint8_t                       reflect_in;
+  uint8_t                       reflect_out;
+} crc_model;
+
+static const crc_model CRCPresets[] = {
+  {8,  0x31,       0x00,       0x00,       1, 1},
+  {16, 0x1021,     0xFFFF,     0x0000,     0, 0},
+  {16, 0x8005,     0xFFFF,     0x0000,     1, 1},
+  {32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, 1, 1},
+  {32, 0x04C11DB7, 0xFFFFFFFF, 0x00000000, 0, 0}
+};
+
+__WEAK uint8_t JHAL_CRC_INIT(void* pinstance, jhal_crc_params* pparams)
+{
+  (void)pinstance;
+  (void)pparams;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_CRC_DEINIT(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_CRC_ACCUMULATE(void* pinstance, const uint8_t* pdata, uint32_t size, uint32_t* pstate)
+{
+  (void)pinstance;
+  (void)pdata;
+  (void)size;
+  (void)pstate;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+#if (USE_JHAL_OPS == 1)
+JHAL_CRC_OPS_DECLARE(jhal_crc_ops_default, JHAL_MCU_ENV);
+#endif
+
+static uint32_t prv_crc_mask(uint8_t width)
+{
+  return width < 32 ? ((uint32_t)1 << width) - 1 : 0xFFFFFFFF;
+}
+
+static uint32_t prv_crc_reflect(uint32_t value, uint8_t width)
+{
+  uint32_t res = 0;
+  
+  for(uint8_t i = 0; i < width; i++, value >>= 1)
+    res = (res << 1) | (value & 1);
+  
+  return res;
+}
+
+static uint32_t prv_crc_bitwise(crc_callback_instance* pcallbacks, const uint8_t* pdata, uint32_t size, uint32_t state)
+{
+  uint32_t polynomial = pcallbacks->polynomial;
+  
+  if(pcallbacks->reflect_in)
+  {
+    while(size--)
+    {
+      state ^= *pdata++;
+      for(uint8_t i = 0; i < 8; i++)
+        state = (state >> 1) ^ (polynomial & (0U - (state & 1)));
+    }
+  }
+  else
+  {
+    while(size--)
+    {
+      state ^= (uint32_t)*pdata++ << 24;
+      for(uint8_t i = 0; i < 8; i++)
+        state = (state << 1) ^ (polynomial & (0U - (state >> 31)));
+    }
+  }
+  
+  return state;
+}
+
+/* Slice-by-N: the register is folded with N input bytes at once, each byte
+   position having its own table of the register advanced by the bytes after it */
+static uint32_t prv_crc_sliced(crc_callback_instance* pcallbacks, const uint8_t* pdata, uint32_t size, uint32_t state)
+{
+  const uint32_t* ptable = pcallbacks->ptable;
+  
+  if(pcallbacks->reflect_in)
+  {
+#if (JHAL_CRC_SLICES >= 4)
+    for(; size >= JHAL_CRC_SLICES; size -= JHAL_CRC_SLICES, pdata += JHAL_CRC_SLICES)
+    {
+      uint32_t one = state ^ ((uint32_t)pdata[0] | ((uint32_t)pdata[1] << 8) | ((uint32_t)pdata[2] << 16) | ((uint32_t)pdata[3] << 24));
+#if (JHAL_CRC_SLICES == 8)
+      uint32_t two = (uint32_t)pdata[4] | ((uint32_t)pdata[5] << 8) | ((uint32_t)pdata[6] << 16) | ((uint32_t)pdata[7] << 24);
+      state = CRC_TABLE(ptable, 7)[one & 0xFF] ^ CRC_TABLE(ptable, 6)[(one >> 8) & 0xFF] ^
+              CRC_TABLE(ptable, 5)[(one >> 16) & 0xFF] ^ CRC_TABLE(ptable, 4)[one >> 24] ^
+              CRC_TABLE(ptable, 3)[two & 0xFF] ^ CRC_TABLE(ptable, 2)[(two >> 8) & 0xFF] ^
+              CRC_TABLE(ptable, 1)[(two >> 16) & 0xFF] ^ CRC_TABLE(ptable, 0)[two >> 24];
+#else
+      state = CRC_TABLE(ptable, 3)[one & 0xFF] ^ CRC_TABLE(ptable, 2)[(one >> 8) & 0xFF] ^
+              CRC_TABLE(ptable, 1)[(one >> 16) & 0xFF] ^ CRC_TABLE(ptable, 0)[one >> 24];
+#endif
+    }
+#endif
+    while(size--)
+      state = (state >> 8) ^ ptable[(state ^ *pdata++) & 0xFF];
+  }
+  else
+  {
+#if (JHAL_CRC_SLICES >= 4)
+    for(; size >= JHAL_CRC_SLICES; size -= JHAL_CRC_SLICES, pdata += JHAL_CRC_SLICES)
+    {
+      uint32_t one = state ^ (((uint32_t)pdata[0] << 24) | ((uint32_t)pdata[1] << 16) | ((uint32_t)pdata[2] << 8) | (uint32_t)pdata[3]);
+#if (JHAL_CRC_SLICES == 8)
+      uint32_t two = ((uint32_t)pdata[4] << 24) | ((uint32_t)pdata[5] << 16) | ((uint32_t)pdata[6] << 8) | (uint32_t)pdata[7];
+      state = CRC_TABLE(ptable, 7)[one >> 24] ^ CRC_TABLE(ptable, 6)[(one >> 16) & 0xFF] ^
+              CRC_TABLE(ptable, 5)[(one >> 8) & 0xFF] ^ CRC_TABLE(ptable, 4)[one & 0xFF] ^
+              CRC_TABLE(ptable, 3)[two >> 24] ^ CRC_TABLE(ptable, 2)[(two >> 16) & 0xFF] ^
+              CRC_TABLE(ptable, 1)[(two >> 8) & 0xFF] ^ CRC_TABLE(ptable, 0)[two & 0xFF];
+#else
+      state = CRC_TABLE(ptable, 3)[one >> 24] ^ CRC_TABLE(ptable, 2)[(one >> 16) & 0xFF] ^
+              CRC_TABLE(ptable, 1)[(one >> 8) & 0xFF] ^ CRC_TABLE(ptable, 0)[one & 0xFF];
+#endif
+    }
+#endif
+    while(size--)
+      state = (state << 8) ^ ptable[(state >> 24) ^ *pdata++];
+  }
+  
+  return state;
+}
+
+static void prv_crc_build_table(crc_callback_instance* pcallbacks, uint32_t* ptable)
+{
+  const uint8_t zero = 0;
+  
+  /* An entry is the register holding the byte advanced by one zero byte */
+  for(uint32_t i = 0; i < 256; i++)
+    ptable[i] = prv_crc_bitwise(pcallbacks, &zero, 1, pcallbacks->reflect_in ? i : i << 24);
+  
+  for(uint32_t slice = 1; slice < JHAL_CRC_SLICES; slice++)
+  {
+    for(uint32_t i = 0; i < 256; i++)
+    {
+      uint32_t prev = CRC_TABLE(ptable, slice - 1)[i];
+  
+      CRC_TABLE(ptable, slice)[i] = pcallbacks->reflect_in ? (prev >> 8) ^ ptable[prev & 0xFF]
+                                                           : (prev << 8) ^ ptable[prev >> 24];
+    }
+  }
+}
+
+static uint32_t prv_crc_final(crc_callback_instance* pcallbacks)
+{
+  uint32_t res = pcallbacks->reflect_in ? pcallbacks->state : pcallbacks->state >> (32 - pcallbacks->width);
+  
+  if(pcallbacks->reflect_in != pcallbacks->reflect_out)
+    res = prv_crc_reflect(res, pcallbacks->width);
+  
+  return (res ^ pcallbacks->xor_out) & prv_crc_mask(pcallbacks->width);
+}
+
+static uint8_t prv_crc_init(jhal_driver_instance* pnew_instance, void** ppinstance, jhal_crc_params* pparams)
+{
+   crc_callback_instance* pcallbacks = (crc_callback_instance*)pnew_instance->pfuncs_callbacks;
+   jhal_crc_params params = *pparams;
+  
+   if(params.preset != JHAL_CRC_PRESET_CUSTOM)
+   {
+     const crc_model* pmodel;
+  
+     switch(params.preset)
+     {
+       case JHAL_CRC_PRESET_CRC8_MAXIM:         pmodel = &CRCPresets[0]; break;
+       case JHAL_CRC_PRESET_CRC16_CCITT_FALSE:  pmodel = &CRCPresets[1]; break;
+       case JHAL_CRC_PRESET_CRC16_MODBUS:       pmodel = &CRCPresets[2]; break;
+       case JHAL_CRC_PRESET_CRC32:              pmodel = &CRCPresets[3]; break;
+       case JHAL_CRC_PRESET_CRC32_MPEG2:        pmodel = &CRCPresets[4]; break;
+       default:
+         jhal_driver_free(pnew_instance->pinstance);
+         *ppinstance = NULL;
+         return JHAL_RES_INVALID_PARAMS;
+     }
+  
+     params.width = pmodel->width;
+     params.polynomial = pmodel->polynomial;
+     params.init = pmodel->init;
+     params.xor_out = pmodel->xor_out;
+     params.reflect_in = pmodel->reflect_in;
+     params.reflect_out = pmodel->reflect_out;
+   }
+  
+   if(!params.width || params.width > 32)
+   {
+     jhal_driver_free(pnew_instance->pinstance);
+     *ppinstance = NULL;
+     return JHAL_RES_INVALID_PARAMS;
+   }
+  
+   uint32_t mask = prv_crc_mask(params.width);
+   params.polynomial &= mask;
+   params.init &= mask;
+   params.xor_out &= mask;
+   params.reflect_in = params.reflect_in ? 1 : 0;
+   params.reflect_out = params.reflect_out ? 1 : 0;
+  
+   pcallbacks->width = params.width;
+   pcallbacks->reflect_in = params.reflect_in;
+   pcallbacks->reflect_out = params.reflect_out;
+   pcallbacks->xor_out = params.xor_out;
+   if(params.reflect_in)
+   {
+     pcallbacks->polynomial = prv_crc_reflect(params.polynomial, params.width);
+     pcallbacks->init = prv_crc_reflect(params.init, params.width);
+   }
+   else
+   {
+     pcallbacks->polynomial = params.polynomial << (32 - params.width);
+     pcallbacks->init = params.init << (32 - params.width);
+   }
+   pcallbacks->state = pcallbacks->init;
+   pcallbacks->ptable = params.ptable;
+  
+   if(params.ptable)
+     prv_crc_build_table(pcallbacks, params.ptable);
+  
+   pnew_instance->puser_data = params.puser_data;
+#if (USE_JHAL_OPS == 1)
+   pnew_instance->pops = JHAL_OPS_BY_PARAMS(pparams, _crc);
+#endif
+  
+   /* Models the unit can not run stay in software, that is not an error */
+   uint8_t res = params.software_only ? JHAL_RES_NOT_SUPPORTED : JHAL_DISPATCH(pnew_instance->pinstance, _crc, _init)(pnew_instance->pinstance, &params);
+   pcallbacks->unit = (res == JHAL_RES_NO_ERRORS);
+  
+   *ppinstance = pnew_instance->pinstance;
+  
+   return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t (jhal_crc_init)(void** ppinstance, jhal_crc_params* pparams)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!ppinstance || *ppinstance || !pparams)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = JHAL_DRIVER_MALLOC(JHAL_SIZE_DRV_BY_PARAMS(pparams, _crc), sizeof(crc_callback_instance), CRC);
+  
+   if(pnew_instance == NULL)
+     return JHAL_RES_ALLOC_ERROR;
+  
+   return prv_crc_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_crc_init_static(void** ppinstance, jhal_crc_params* pparams, void* pmem, uint32_t size_mem)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!ppinstance || *ppinstance || !pparams || !pmem)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = jhal_driver_place(pmem, size_mem, JHAL_SIZE_DRV_BY_PARAMS(pparams, _crc), sizeof(crc_callback_instance));
+  
+   if(pnew_instance == NULL)
+     return JHAL_RES_ALLOC_ERROR;
+  
+   return prv_crc_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_crc_deinit(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint8_t res = JHAL_RES_NO_ERRORS;
+  if(JHAL_GET_CALLBACKS(pinstance, crc_callback_instance)->unit)
+    res = JHAL_DISPATCH(pinstance, _crc, _deinit)(pinstance);
+  
+  jhal_driver_free(pinstance);
+  
+  return res;
+}
+
+static uint8_t prv_crc_accumulate(void* pinstance, const uint8_t* pdata, uint32_t size, uint32_t* presult)
+{
+  crc_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, crc_callback_instance);
+  
+  if(!pcallbacks->unit || JHAL_DISPATCH(pinstance, _crc, _accumulate)(pinstance, pdata, size, &pcallbacks->state) != JHAL_RES_NO_ERRORS)
+  {
+    if(pcallbacks->ptable)
+      pcallbacks->state = prv_crc_sliced(pcallbacks, pdata, size, pcallbacks->state);
+    else
+      pcallbacks->state = prv_crc_bitwise(pcallbacks, pdata, size, pcallbacks->state);
+  }
+  
+  *presult = prv_crc_final(pcallbacks);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_crc_calculate(void* pinstance, const uint8_t* pdata, uint32_t size, uint32_t* presult)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || (!pdata && size) || !presult)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  
+  crc_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, crc_callback_instance);
+  pcallbacks->state = pcallbacks->init;
+  
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_CRC, pinstance, JHAL_TRACE_OP_CALCULATE, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_CRC, pinstance, JHAL_TRACE_OP_CALCULATE, size, prv_crc_accumulate(pinstance, pdata, size, presult));
+}
+
+uint8_t jhal_crc_accumulate(void* pinstance, const uint8_t* pdata, uint32_t size, uint32_t* presult)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || (!pdata && size) || !presult)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_CRC, pinstance, JHAL_TRACE_OP_CALCULATE, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_CRC, pinstance, JHAL_TRACE_OP_CALCULATE, size, prv_crc_accumulate(pinstance, pdata, size, presult));
+}
+
+uint8_t jhal_crc_uses_unit(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return 0;
+#endif
+  
+  return JHAL_GET_CALLBACKS(pinstance, crc_callback_instance)->unit;
+}
+
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_crc_get_stats(void* pinstance, jhal_stats* pstats)
+{
+  return jhal_stats_get(pinstance, pstats);
+}
+
+uint8_t jhal_crc_reset_stats(void* pinstance)
+{
+  return jhal_stats_reset(pinstance);
+}
+#endif
@@ -0,0 +1,120 @@
+#ifndef __JHAL_CRC__
+#define __JHAL_CRC__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  
+#include <stdint.h>
+#include "jhal_environment.h"
+#include "jhal_probe.h"
+  
+/* Words of the lookup table of one instance, JHAL_CRC_SLICES tables of 256 entries */
+#define JHAL_CRC_TABLE_SIZE                 (256U * JHAL_CRC_SLICES)
+#define JHAL_CRC_DECLARE_TABLE(NAME)        static uint32_t NAME[JHAL_CRC_TABLE_SIZE]
+  
+typedef enum {
+  JHAL_CRC_PRESET_CUSTOM                = 41U,
+  JHAL_CRC_PRESET_CRC8_MAXIM            = 17U,
+  JHAL_CRC_PRESET_CRC16_CCITT_FALSE     = 83U,
+  JHAL_CRC_PRESET_CRC16_MODBUS          = 66U,
+  JHAL_CRC_PRESET_CRC32                 = 125U,
+  JHAL_CRC_PRESET_CRC32_MPEG2           = 92U
+} jhal_crc_preset;
+  
+#if (USE_JHAL_OPS == 1)
+typedef struct jhal_crc_ops_struct jhal_crc_ops;
+#endif
+  
+/* The model fields follow the usual catalogue of parametrised CRCs: polynomial
+   and init in normal form without the top bit, xor_out applied after the output
+   reflection. They are taken from the preset unless it is JHAL_CRC_PRESET_CUSTOM.
+   ptable is the storage of JHAL_CRC_TABLE_SIZE words filled by init and may be
+   shared by instances of the same model, NULL leaves the bitwise calculation.
+   software_only keeps the instance off the CRC unit, e.g. to reserve the unit */
+typedef struct {
+  jhal_crc_preset               preset;
+  uint8_t                       width;
+  uint32_t                      polynomial;
+  uint32_t                      init;
+  uint32_t                      xor_out;
+  uint8_t                       reflect_in;
+  uint8_t                       reflect_out;
+  uint32_t*                     ptable;
+  uint8_t                       software_only;
+  
+  void*                         plib_data;
+  void*                         puser_data;
+#if (USE_JHAL_OPS == 1)
+  const jhal_crc_ops*           pops;
+#endif
+} jhal_crc_params;
+  
+/* The register is kept in the form the calculation runs in: right aligned for
+   reflected input, left aligned in 32 bits otherwise */
+typedef struct {
+  uint32_t                      polynomial;
+  uint32_t                      init;
+  uint32_t                      xor_out;
+  uint32_t                      state;
+  const uint32_t*               ptable;
+  uint8_t                       width;
+  uint8_t                       reflect_in;
+  uint8_t                       reflect_out;
+  uint8_t                       unit;
+} crc_callback_instance;
+  
+#define JHAL_CRC_SIZE_STATIC                    JHAL_DRIVER_SIZE_STATIC(JHAL_CRC_SIZE_DRV_STATIC, sizeof(crc_callback_instance))
+#define JHAL_CRC_DECLARE_STATIC(NAME)           JHAL_DECLARE_STATIC_MEM(NAME, JHAL_CRC_SIZE_STATIC)
+#if (USE_JHAL_MEM_LINKED == 1)
+#define JHAL_CRC_DECLARE_INSTANCE(NAME)         JHAL_DECLARE_INSTANCE(NAME, JHAL_CRC_SIZE_STATIC, CRC)
+JHAL_MEM_SLOTS_DECLARE(CRC);
+#endif
+  
+/* An environment with a CRC unit accepts the models it can run in init, any
+   other result of init leaves the instance to the software calculation. The
+   unit advances the register passed in the form above, a result other than
+   JHAL_RES_NO_ERRORS (e.g. the unit is busy) repeats the block in software */
+#if (USE_JHAL_OPS == 1)
+struct jhal_crc_ops_struct {
+  uint32_t (*pfunc_size_drv)(void);
+  uint8_t (*pfunc_init)(void* pinstance, jhal_crc_params* pparams);
+  uint8_t (*pfunc_deinit)(void* pinstance);
+  uint8_t (*pfunc_accumulate)(void* pinstance, const uint8_t* pdata, uint32_t size, uint32_t* pstate);
+};
+  
+extern const jhal_crc_ops jhal_crc_ops_default;
+  
+#define JHAL_CRC_OPS_DECLARE(NAME, ENV)   const jhal_crc_ops NAME = {\
+        JHAL_FUNCTION_NAME(ENV,_crc,_size_drv),\
+        JHAL_FUNCTION_NAME(ENV,_crc,_init),\
+        JHAL_FUNCTION_NAME(ENV,_crc,_deinit),\
+        JHAL_FUNCTION_NAME(ENV,_crc,_accumulate)}
+#define JHAL_CRC_SIZE_STATIC_BY_ENV(ENV)  JHAL_DRIVER_SIZE_STATIC(JHAL_FUNCTION_NAME(ENV,_crc,_size_drv_static), sizeof(crc_callback_instance))
+#endif
+  
+uint8_t jhal_crc_init(void** ppinstance, jhal_crc_params* pparams);
+uint8_t jhal_crc_init_static(void** ppinstance, jhal_crc_params* pparams, void* pmem, uint32_t size_mem);
+uint8_t jhal_crc_deinit(void* pinstance);
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_crc_get_stats(void* pinstance, jhal_stats* pstats);
+uint8_t jhal_crc_reset_stats(void* pinstance);
+#endif
+  
+/* calculate starts from the init value of the model, accumulate goes on from
+   the end of the previous call, both return the final CRC of all data so far */
+uint8_t jhal_crc_calculate(void* pinstance, const uint8_t* pdata, uint32_t size, uint32_t* presult);
+uint8_t jhal_crc_accumulate(void* pinstance, const uint8_t* pdata, uint32_t size, uint32_t* presult);
+uint8_t jhal_crc_uses_unit(void* pinstance);
+  
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+  #define jhal_crc_init(PPINSTANCE, PPARAMS)    JHAL_MEM_CALL_SITE((jhal_crc_init)(PPINSTANCE, PPARAMS))
+#endif
+  
+#ifdef __cplusplus
+}
+#endif
+
+#include JHAL_CRC_INCLUDE_NAME
+
+#endif
@@ -1,148 +1,273 @@
-#include "jhal_dma.h"
-#include JHAL_DMA_INCLUDE_NAME
-
-typedef struct {
-  jhal_type_dma_transfer_complete     pfunc_transfer_complete;
-} dma_callback_instance;
-
-__WEAK uint8_t JHAL_DMA_INIT(void* pinstance, jhal_dma_params* pparams)
-{
-  (void)pinstance;
-  (void)pparams;  
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_DMA_DEINIT(void* pinstance)
-{
-  (void)pinstance;
-  
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_DMA_START(void* pinstance, uint32_t srcaddress, uint32_t dstaddress, uint32_t size)
-{
-  (void)pinstance;
-  (void)srcaddress;
-  (void)dstaddress;
-  (void)size;
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_DMA_STOP(void* pinstance)
-{
-  (void)pinstance;
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_DMA_START_IT(void* pinstance, uint32_t srcaddress, uint32_t dstaddress, uint32_t size)
-{
-  (void)pinstance;
-  (void)srcaddress;
-  (void)dstaddress;
-  (void)size;
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_DMA_STOP_IT(void* pinstance)
-{
-  (void)pinstance;
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-uint8_t jhal_dma_init(void** ppinstance, jhal_dma_params* pparams)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)       
-   if(!ppinstance || *ppinstance || !pparams) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   jhal_driver_instance* pnew_instance = jhal_driver_malloc(JHAL_DMA_SIZE_DRV, sizeof(dma_callback_instance));
-     
-   if(pnew_instance == NULL)  
-     return JHAL_RES_ALLOC_ERROR;
-   
-   ((dma_callback_instance*)pnew_instance->pfuncs_callbacks)->pfunc_transfer_complete = pparams->pfunc_transfer_complete;
-   pnew_instance->puser_data = pparams->puser_data;
-   
-   uint8_t res = JHAL_DMA_INIT(pnew_instance->pinstance, pparams); 
-   
-   if(res == JHAL_RES_NO_ERRORS)       
-     *ppinstance = pnew_instance->pinstance;
-   else 
-   {
-     *ppinstance = NULL;
-     jhal_driver_free(pnew_instance->pinstance);
-   }  
-   
-   return res;
-}
-
-uint8_t jhal_dma_deinit(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif        
-  jhal_driver_free(pinstance); 
-
-  return JHAL_DMA_DEINIT(pinstance);
-}
-
-uint8_t jhal_dma_start(void* pinstance, uint32_t srcaddress, uint32_t dstaddress, uint32_t size)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !srcaddress || !dstaddress || !size) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   
-   return JHAL_DMA_START(pinstance, srcaddress, dstaddress, size);
-}
-
-uint8_t jhal_dma_stop(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   
-   return JHAL_DMA_STOP(pinstance);
-}
-
-uint8_t jhal_dma_start_it(void* pinstance, uint32_t srcaddress, uint32_t dstaddress, uint32_t size)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !srcaddress || !dstaddress || !size) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   
-   return JHAL_DMA_START_IT(pinstance, srcaddress, dstaddress, size);
-}
-
-uint8_t jhal_dma_stop_it(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   
-   return JHAL_DMA_STOP_IT(pinstance);
-}
-
-void jhal_dma_transfer_complete_callback(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-  JHAL_ASSERT(pInstance);  
-#endif
-  
-  if(JHAL_CHECK_INSTANCE(pinstance))
-      JHAL_CARCASS_FUNC(pinstance, dma_callback_instance, jhal_type_dma_transfer_complete, pfunc_transfer_complete));
-  else {
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-    JHAL_ASSERT(pInstance);  
-#endif
-  }  
-}
\ No newline at end of file
+#include "jhal_dma.h"
+#include JHAL_DMA_INCLUDE_NAME
+
+#if (USE_JHAL_MEM_LINKED == 1)
+JHAL_MEM_SLOTS_DEFINE(DMA);
+#endif
+
+__WEAK uint8_t JHAL_DMA_INIT(void* pinstance, jhal_dma_params* pparams)
+{
+  (void)pinstance;
+  (void)pparams;  
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_DMA_DEINIT(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+#if (USE_JHAL_INLINE == 0)
+__WEAK uint8_t JHAL_DMA_START(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size)
+{
+  (void)pinstance;
+  (void)srcaddress;
+  (void)dstaddress;
+  (void)size;
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_DMA_STOP(void* pinstance)
+{
+  (void)pinstance;
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_DMA_START_IT(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size)
+{
+  (void)pinstance;
+  (void)srcaddress;
+  (void)dstaddress;
+  (void)size;
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_DMA_STOP_IT(void* pinstance)
+{
+  (void)pinstance;
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+#endif
+
+#if (USE_JHAL_OPS == 1)
+JHAL_DMA_OPS_DECLARE(jhal_dma_ops_default, JHAL_MCU_ENV);
+#endif
+
+static uint8_t prv_dma_init(jhal_driver_instance* pnew_instance, void** ppinstance, jhal_dma_params* pparams)
+{
+   ((dma_callback_instance*)pnew_instance->pfuncs_callbacks)->pfunc_transfer_complete = pparams->pfunc_transfer_complete;
+#if (USE_JHAL_QUEUE == 1)
+   ((dma_callback_instance*)pnew_instance->pfuncs_callbacks)->pqueue = NULL;
+#endif
+   pnew_instance->puser_data = pparams->puser_data;
+#if (USE_JHAL_OPS == 1)
+   pnew_instance->pops = JHAL_OPS_BY_PARAMS(pparams, _dma);
+#endif
+   
+   uint8_t res = JHAL_DISPATCH(pnew_instance->pinstance, _dma, _init)(pnew_instance->pinstance, pparams); 
+   
+   if(res == JHAL_RES_NO_ERRORS)       
+     *ppinstance = pnew_instance->pinstance;
+   else 
+   {
+     *ppinstance = NULL;
+     jhal_driver_free(pnew_instance->pinstance);
+   }  
+   
+   return res;
+}
+
+uint8_t (jhal_dma_init)(void** ppinstance, jhal_dma_params* pparams)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)       
+   if(!ppinstance || *ppinstance || !pparams) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = JHAL_DRIVER_MALLOC(JHAL_SIZE_DRV_BY_PARAMS(pparams, _dma), sizeof(dma_callback_instance), DMA);
+     
+   if(pnew_instance == NULL)  
+     return JHAL_RES_ALLOC_ERROR;
+   
+   return prv_dma_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_dma_init_static(void** ppinstance, jhal_dma_params* pparams, void* pmem, uint32_t size_mem)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)       
+   if(!ppinstance || *ppinstance || !pparams || !pmem) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = jhal_driver_place(pmem, size_mem, JHAL_SIZE_DRV_BY_PARAMS(pparams, _dma), sizeof(dma_callback_instance));
+     
+   if(pnew_instance == NULL)  
+     return JHAL_RES_ALLOC_ERROR;
+   
+   return prv_dma_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_dma_deinit(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif        
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint8_t res = JHAL_DISPATCH(pinstance, _dma, _deinit)(pinstance);
+  
+  jhal_driver_free(pinstance);
+  
+  return res;
+}
+
+#if (USE_JHAL_QUEUE == 1)
+static uint8_t prv_dma_request_start(void* pinstance, jhal_request* prequest)
+{
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_REQUEST, prequest->size);
+  
+  if(prequest->operation != JHAL_REQUEST_OPERATION_TXRX)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  return JHAL_DISPATCH(pinstance, _dma, _start_it)(pinstance, (uintptr_t)prequest->ptxdata, (uintptr_t)prequest->prxdata, prequest->size);
+}
+
+/* Binds a request queue to the instance, NULL detaches it. The queue attached
+   before is released first, JHAL_RES_BUSY while it still holds requests.
+   Completions of an attached instance go to the queue instead of the callbacks */
+uint8_t jhal_dma_queue_attach(void* pinstance, jhal_request_queue* pqueue)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  dma_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, dma_callback_instance);
+  
+  jhal_request_queue* pqueue_old = pcallbacks->pqueue;
+  
+  if(pqueue_old != NULL && pqueue_old != pqueue && jhal_request_pending(pqueue_old))
+    return JHAL_RES_BUSY;
+  
+  if(pqueue != NULL)
+  {
+    uint8_t res = jhal_request_queue_bind(pqueue, pinstance, prv_dma_request_start);
+    if(res != JHAL_RES_NO_ERRORS)
+      return res;
+  }
+  
+  if(pqueue_old != NULL && pqueue_old != pqueue)
+    jhal_request_queue_bind(pqueue_old, NULL, NULL);
+  
+  pcallbacks->pqueue = pqueue;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+#endif
+
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_dma_start(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !srcaddress || !dstaddress || !size) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, dma_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_START, size);
+   return JHAL_PROBE_END(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_START, size, JHAL_DISPATCH(pinstance, _dma, _start)(pinstance, srcaddress, dstaddress, size));
+}
+
+uint8_t jhal_dma_stop(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_STOP, 0);
+   return JHAL_PROBE_END(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_STOP, 0, JHAL_DISPATCH(pinstance, _dma, _stop)(pinstance));
+}
+
+uint8_t jhal_dma_start_it(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !srcaddress || !dstaddress || !size) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, dma_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_START_IT, size);
+   return JHAL_PROBE_END(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_START_IT, size, JHAL_DISPATCH(pinstance, _dma, _start_it)(pinstance, srcaddress, dstaddress, size));
+}
+
+uint8_t jhal_dma_stop_it(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_STOP_IT, 0);
+   return JHAL_PROBE_END(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_STOP_IT, 0, JHAL_DISPATCH(pinstance, _dma, _stop_it)(pinstance));
+}
+#endif
+
+#if (USE_JHAL_DEFER == 1)
+static void prv_dma_defer_dispatch(const jhal_defer_event* pevent)
+{
+  JHAL_CARCASS_FUNC(pevent->pinstance, dma_callback_instance, jhal_type_dma_transfer_complete, pfunc_transfer_complete));
+}
+#endif
+
+void jhal_dma_transfer_complete_callback(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance);  
+#endif
+  if(JHAL_CHECK_INSTANCE(pinstance))
+    JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_TRANSFER_COMPLETE, 0);
+  
+#if (USE_JHAL_QUEUE == 1)
+  if(JHAL_CHECK_INSTANCE(pinstance) && JHAL_GET_CALLBACKS(pinstance, dma_callback_instance)->pqueue)
+  {
+    jhal_request_queue_complete(JHAL_GET_CALLBACKS(pinstance, dma_callback_instance)->pqueue, JHAL_RES_NO_ERRORS);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_DEFER == 1)
+  if(JHAL_CHECK_INSTANCE(pinstance) && JHAL_GET_CALLBACKS(pinstance, dma_callback_instance)->pfunc_transfer_complete
+     && JHAL_DEFER_POST(pinstance, prv_dma_defer_dispatch, 0, 0, NULL, 0))
+    return;
+#endif
+  
+  if(JHAL_CHECK_INSTANCE(pinstance))
+      JHAL_CARCASS_FUNC(pinstance, dma_callback_instance, jhal_type_dma_transfer_complete, pfunc_transfer_complete));
+  else {
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+    JHAL_ASSERT(pinstance);  
+#endif
+  }  
+}
+
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_dma_get_stats(void* pinstance, jhal_stats* pstats)
+{
+  return jhal_stats_get(pinstance, pstats);
+}
+
+uint8_t jhal_dma_reset_stats(void* pinstance)
+{
+  return jhal_stats_reset(pinstance);
+}
+#endif
\ No newline at end of file
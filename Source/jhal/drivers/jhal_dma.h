@@ -1,64 +1,156 @@
-#ifndef __JHAL_DMA__
-#define __JHAL_DMA__
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include "jhal_environment.h"
-
-#define  JHAL_DMA_PRIORITY_LOWEST       0U
-#define  JHAL_DMA_PRIORITY_LOW          1U
-#define  JHAL_DMA_PRIORITY_MIDDLE       2U
-#define  JHAL_DMA_PRIORITY_HIGH         3U
-#define  JHAL_DMA_PRIORITY_HIGHEST      4U  
-  
-typedef void (*jhal_type_dma_transfer_complete)(void*, void*);
-
-typedef enum {
-  JHAL_DMA_DIRECTION_PERIPH_TO_MEM      = 96U,
-  JHAL_DMA_DIRECTION_MEM_TO_PERIPH      = 199U,
-  JHAL_DMA_DIRECTION_PERIPH_TO_PERIPH   = 11U,
-  JHAL_DMA_DIRECTION_MEM_TO_MEM         = 129U
-} jhal_dma_direction;  
-  
-typedef enum {
-  JHAL_DMA_DATA_SIZE_8BIT               = 7U,
-  JHAL_DMA_DATA_SIZE_16BIT              = 34U,
-  JHAL_DMA_DATA_SIZE_32BIT              = 88U
-} jhal_dma_data_size;
-
-typedef enum {
-  JHAL_DMA_INCREMENT_TYPE_DISABLE       = 111U,
-  JHAL_DMA_INCREMENT_TYPE_ENABLE        = 206U
-} jhal_dma_increment_type;
-
-typedef struct {
-  uint8_t                               num_module;
-  uint8_t                               num_channel;
-  uint32_t                              priority;
-  jhal_dma_direction                    direction;  
-  jhal_dma_data_size                    source_data_size;  
-  jhal_dma_data_size                    destination_data_size;
-  jhal_dma_increment_type               source_increment_type;
-  jhal_dma_increment_type               destination_increment_type;
-  
-  jhal_type_dma_transfer_complete       pfunc_transfer_complete;
-  void*                                 plib_data;
-  void*                                 puser_data;
-} jhal_dma_params;
-
-uint8_t jhal_dma_init(void** ppinstance, jhal_dma_params* pparams);
-uint8_t jhal_dma_deinit(void* pinstance);
-uint8_t jhal_dma_start(void* pinstance, uint32_t srcaddress, uint32_t dstaddress, uint32_t size);
-uint8_t jhal_dma_stop(void* pinstance);
-uint8_t jhal_dma_start_it(void* pinstance, uint32_t srcaddress, uint32_t dstaddress, uint32_t size);
-uint8_t jhal_dma_stop_it(void* pinstance);
-
-void jhal_dma_transfer_complete_callback(void* pInstance);
-
-#ifdef __cplusplus
-}
-#endif
-
+#ifndef __JHAL_DMA__
+#define __JHAL_DMA__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+#include "jhal_request.h"
+#include "jhal_defer.h"
+#include "jhal_probe.h"
+
+#define  JHAL_DMA_PRIORITY_LOWEST       0U
+#define  JHAL_DMA_PRIORITY_LOW          1U
+#define  JHAL_DMA_PRIORITY_MIDDLE       2U
+#define  JHAL_DMA_PRIORITY_HIGH         3U
+#define  JHAL_DMA_PRIORITY_HIGHEST      4U  
+  
+typedef void (*jhal_type_dma_transfer_complete)(void*, void*);
+
+typedef enum {
+  JHAL_DMA_DIRECTION_PERIPH_TO_MEM      = 96U,
+  JHAL_DMA_DIRECTION_MEM_TO_PERIPH      = 199U,
+  JHAL_DMA_DIRECTION_PERIPH_TO_PERIPH   = 11U,
+  JHAL_DMA_DIRECTION_MEM_TO_MEM         = 129U
+} jhal_dma_direction;  
+  
+typedef enum {
+  JHAL_DMA_DATA_SIZE_8BIT               = 7U,
+  JHAL_DMA_DATA_SIZE_16BIT              = 34U,
+  JHAL_DMA_DATA_SIZE_32BIT              = 88U
+} jhal_dma_data_size;
+
+typedef enum {
+  JHAL_DMA_INCREMENT_TYPE_DISABLE       = 111U,
+  JHAL_DMA_INCREMENT_TYPE_ENABLE        = 206U
+} jhal_dma_increment_type;
+
+#if (USE_JHAL_OPS == 1)
+typedef struct jhal_dma_ops_struct jhal_dma_ops;
+#endif
+
+typedef struct {
+  uint8_t                               num_module;
+  uint8_t                               num_channel;
+  uint32_t                              priority;
+  jhal_dma_direction                    direction;  
+  jhal_dma_data_size                    source_data_size;  
+  jhal_dma_data_size                    destination_data_size;
+  jhal_dma_increment_type               source_increment_type;
+  jhal_dma_increment_type               destination_increment_type;
+  
+  jhal_type_dma_transfer_complete       pfunc_transfer_complete;
+  void*                                 plib_data;
+  void*                                 puser_data;
+#if (USE_JHAL_OPS == 1)
+  const jhal_dma_ops*                   pops;
+#endif
+} jhal_dma_params;
+
+typedef struct {
+  jhal_type_dma_transfer_complete     pfunc_transfer_complete;
+#if (USE_JHAL_QUEUE == 1)
+  jhal_request_queue*           pqueue;
+#endif
+} dma_callback_instance;
+
+#define JHAL_DMA_SIZE_STATIC                     JHAL_DRIVER_SIZE_STATIC(JHAL_DMA_SIZE_DRV_STATIC, sizeof(dma_callback_instance))
+#define JHAL_DMA_DECLARE_STATIC(NAME)            JHAL_DECLARE_STATIC_MEM(NAME, JHAL_DMA_SIZE_STATIC)
+#if (USE_JHAL_MEM_LINKED == 1)
+#define JHAL_DMA_DECLARE_INSTANCE(NAME)          JHAL_DECLARE_INSTANCE(NAME, JHAL_DMA_SIZE_STATIC, DMA)
+JHAL_MEM_SLOTS_DECLARE(DMA);
+#endif
+
+#if (USE_JHAL_OPS == 1)
+struct jhal_dma_ops_struct {
+  uint32_t (*pfunc_size_drv)(void);
+  uint8_t (*pfunc_init)(void* pinstance, jhal_dma_params* pparams);
+  uint8_t (*pfunc_deinit)(void* pinstance);
+  uint8_t (*pfunc_start)(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size);
+  uint8_t (*pfunc_stop)(void* pinstance);
+  uint8_t (*pfunc_start_it)(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size);
+  uint8_t (*pfunc_stop_it)(void* pinstance);
+};
+
+extern const jhal_dma_ops jhal_dma_ops_default;
+
+#define JHAL_DMA_OPS_DECLARE(NAME, ENV)   const jhal_dma_ops NAME = {\
+        JHAL_FUNCTION_NAME(ENV,_dma,_size_drv),\
+        JHAL_FUNCTION_NAME(ENV,_dma,_init),\
+        JHAL_FUNCTION_NAME(ENV,_dma,_deinit),\
+        JHAL_FUNCTION_NAME(ENV,_dma,_start),\
+        JHAL_FUNCTION_NAME(ENV,_dma,_stop),\
+        JHAL_FUNCTION_NAME(ENV,_dma,_start_it),\
+        JHAL_FUNCTION_NAME(ENV,_dma,_stop_it)}
+#define JHAL_DMA_SIZE_STATIC_BY_ENV(ENV)  JHAL_DRIVER_SIZE_STATIC(JHAL_FUNCTION_NAME(ENV,_dma,_size_drv_static), sizeof(dma_callback_instance))
+#endif
+
+uint8_t jhal_dma_init(void** ppinstance, jhal_dma_params* pparams);
+uint8_t jhal_dma_init_static(void** ppinstance, jhal_dma_params* pparams, void* pmem, uint32_t size_mem);
+uint8_t jhal_dma_deinit(void* pinstance);
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_dma_get_stats(void* pinstance, jhal_stats* pstats);
+uint8_t jhal_dma_reset_stats(void* pinstance);
+#endif
+#if (USE_JHAL_QUEUE == 1)
+uint8_t jhal_dma_queue_attach(void* pinstance, jhal_request_queue* pqueue);
+#endif
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_dma_start(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size);
+uint8_t jhal_dma_stop(void* pinstance);
+uint8_t jhal_dma_start_it(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size);
+uint8_t jhal_dma_stop_it(void* pinstance);
+#endif
+
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+  #define jhal_dma_init(PPINSTANCE, PPARAMS)    JHAL_MEM_CALL_SITE((jhal_dma_init)(PPINSTANCE, PPARAMS))
+#endif
+
+void jhal_dma_transfer_complete_callback(void* pInstance);
+
+#ifdef __cplusplus
+}
+#endif
+
+#include JHAL_DMA_INCLUDE_NAME
+
+#if (USE_JHAL_INLINE == 1)
+static inline uint8_t jhal_dma_start(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, dma_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_START, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_START, size, JHAL_DISPATCH(pinstance, _dma, _start)(pinstance, srcaddress, dstaddress, size));
+}
+
+static inline uint8_t jhal_dma_stop(void* pinstance)
+{
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_STOP, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_STOP, 0, JHAL_DISPATCH(pinstance, _dma, _stop)(pinstance));
+}
+
+static inline uint8_t jhal_dma_start_it(void* pinstance, uintptr_t srcaddress, uintptr_t dstaddress, uint32_t size)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, dma_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_START_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_START_IT, size, JHAL_DISPATCH(pinstance, _dma, _start_it)(pinstance, srcaddress, dstaddress, size));
+}
+
+static inline uint8_t jhal_dma_stop_it(void* pinstance)
+{
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_STOP_IT, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_DMA, pinstance, JHAL_TRACE_OP_STOP_IT, 0, JHAL_DISPATCH(pinstance, _dma, _stop_it)(pinstance));
+}
+#endif
+
 #endif
\ No newline at end of file
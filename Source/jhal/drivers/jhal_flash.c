@@ -0,0 +1,597 @@
+#include <string.h>
+#include "jhal_flash.h"
+#include JHAL_FLASH_INCLUDE_NAME
+#include JHAL_TICK_INCLUDE_NAME
+
+#if (USE_JHAL_MEM_LINKED == 1)
+JHAL_MEM_SLOTS_DEFINE(FLASH);
+#endif
+
+__WEAK uint8_t JHAL_FLASH_INIT(void* pinstance, jhal_flash_params* pparams)
+{
+  (void)pinstance;
+  (void)pparams;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_FLASH_DEINIT(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_FLASH_GET_INFO(void* pinstance, jhal_flash_info* pinfo)
+{
+  (void)pinstance;
+  (void)pinfo;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_FLASH_GET_SECTOR(void* pinstance, uint32_t address, uint32_t* pstart, uint32_t* psize)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pstart;
+  (void)psize;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_FLASH_READ(void* pinstance, uint32_t address, uint8_t* pdata, uint16_t size)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pdata;
+  (void)size;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+#if (USE_JHAL_INLINE == 0)
+__WEAK uint8_t JHAL_FLASH_ERASE(void* pinstance, uint32_t address, uint32_t timeout)
+{
+  (void)pinstance;
+  (void)address;
+  (void)timeout;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_FLASH_ERASE_IT(void* pinstance, uint32_t address)
+{
+  (void)pinstance;
+  (void)address;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_FLASH_PROGRAM(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size, uint32_t timeout)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pdata;
+  (void)size;
+  (void)timeout;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_FLASH_PROGRAM_IT(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pdata;
+  (void)size;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+#endif
+
+#if (USE_JHAL_OPS == 1)
+JHAL_FLASH_OPS_DECLARE(jhal_flash_ops_default, JHAL_MCU_ENV);
+#endif
+
+#if (USE_JHAL_DEFER == 1)
+#define FLASH_EVENT_ERASE               1U
+#define FLASH_EVENT_PROGRAM             2U
+#define FLASH_EVENT_ERROR               3U
+#endif
+
+static uint8_t prv_flash_init(jhal_driver_instance* pnew_instance, void** ppinstance, jhal_flash_params* pparams)
+{
+   flash_callback_instance* pcallbacks = (flash_callback_instance*)pnew_instance->pfuncs_callbacks;
+   pcallbacks->pfunc_erase_complete = pparams->pfunc_erase_complete;
+   pcallbacks->pfunc_program_complete = pparams->pfunc_program_complete;
+   pcallbacks->pfunc_error = pparams->pfunc_error;
+   pcallbacks->index_fill = 0;
+   pcallbacks->index_program = 0;
+   pcallbacks->amount_queued = 0;
+   pcallbacks->programming = 0;
+   for(uint8_t i = 0; i < JHAL_FLASH_BUFFERS; i++)
+     pcallbacks->buffers[i].fill = 0;
+   pnew_instance->puser_data = pparams->puser_data;
+#if (USE_JHAL_OPS == 1)
+   pnew_instance->pops = JHAL_OPS_BY_PARAMS(pparams, _flash);
+#endif
+  
+   uint8_t res = JHAL_DISPATCH(pnew_instance->pinstance, _flash, _init)(pnew_instance->pinstance, pparams);
+  
+   /* The buffers are programmed as a whole, so they hold whole program units */
+   if(res == JHAL_RES_NO_ERRORS)
+   {
+     jhal_flash_info info;
+  
+     res = JHAL_DISPATCH(pnew_instance->pinstance, _flash, _get_info)(pnew_instance->pinstance, &info);
+  
+     if(res == JHAL_RES_NO_ERRORS && (!info.program_width || JHAL_FLASH_BUFFER_SIZE % info.program_width))
+       res = JHAL_RES_NOT_SUPPORTED;
+  
+     if(res == JHAL_RES_NO_ERRORS)
+     {
+       pcallbacks->program_width = info.program_width;
+       pcallbacks->erased_value = info.erased_value;
+     }
+     else
+       JHAL_DISPATCH(pnew_instance->pinstance, _flash, _deinit)(pnew_instance->pinstance);
+   }
+  
+   if(res == JHAL_RES_NO_ERRORS)
+     *ppinstance = pnew_instance->pinstance;
+   else
+   {
+     *ppinstance = NULL;
+     jhal_driver_free(pnew_instance->pinstance);
+   }
+  
+   return res;
+}
+
+uint8_t (jhal_flash_init)(void** ppinstance, jhal_flash_params* pparams)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!ppinstance || *ppinstance || !pparams)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = JHAL_DRIVER_MALLOC(JHAL_SIZE_DRV_BY_PARAMS(pparams, _flash), sizeof(flash_callback_instance), FLASH);
+  
+   if(pnew_instance == NULL)
+     return JHAL_RES_ALLOC_ERROR;
+  
+   return prv_flash_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_flash_init_static(void** ppinstance, jhal_flash_params* pparams, void* pmem, uint32_t size_mem)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!ppinstance || *ppinstance || !pparams || !pmem)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = jhal_driver_place(pmem, size_mem, JHAL_SIZE_DRV_BY_PARAMS(pparams, _flash), sizeof(flash_callback_instance));
+  
+   if(pnew_instance == NULL)
+     return JHAL_RES_ALLOC_ERROR;
+  
+   return prv_flash_init(pnew_instance, ppinstance, pparams);
+}
+
+/* The data still held by the write buffers is dropped, flush and wait for
+   pending to reach 0 before to keep it */
+uint8_t jhal_flash_deinit(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint8_t res = JHAL_DISPATCH(pinstance, _flash, _deinit)(pinstance);
+  
+  jhal_driver_free(pinstance);
+  
+  return res;
+}
+
+uint8_t jhal_flash_get_info(void* pinstance, jhal_flash_info* pinfo)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pinfo)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  return JHAL_DISPATCH(pinstance, _flash, _get_info)(pinstance, pinfo);
+}
+
+uint8_t jhal_flash_get_sector(void* pinstance, uint32_t address, uint32_t* pstart, uint32_t* psize)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pstart || !psize)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  return JHAL_DISPATCH(pinstance, _flash, _get_sector)(pinstance, address, pstart, psize);
+}
+
+#if (USE_JHAL_DEFER == 1)
+static void prv_flash_defer_dispatch(const jhal_defer_event* pevent)
+{
+  flash_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pevent->pinstance, flash_callback_instance);
+  void* puser_data = JHAL_GET_USERDATA(pevent->pinstance);
+  uint32_t address = (uint32_t)(uintptr_t)pevent->pdata;
+  
+  switch(pevent->type)
+  {
+    case FLASH_EVENT_ERASE:
+      pcallbacks->pfunc_erase_complete(puser_data, address);
+      break;
+    case FLASH_EVENT_PROGRAM:
+      pcallbacks->pfunc_program_complete(puser_data, address, pevent->size);
+      break;
+    case FLASH_EVENT_ERROR:
+      pcallbacks->pfunc_error(puser_data, address, pevent->value);
+      break;
+  }
+}
+#endif
+
+static void prv_flash_error(void* pinstance, flash_callback_instance* pcallbacks, uint32_t address, uint8_t error)
+{
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_error && JHAL_DEFER_POST(pinstance, prv_flash_defer_dispatch, FLASH_EVENT_ERROR, error, (uint8_t*)(uintptr_t)address, 0))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_error)
+    pcallbacks->pfunc_error(JHAL_GET_USERDATA(pinstance), address, error);
+}
+
+/* The oldest queued buffer is programmed, its place in the ring is free for
+   the writes. When all of them were queued it is the fill buffer */
+static void prv_flash_release(flash_callback_instance* pcallbacks)
+{
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  pcallbacks->buffers[pcallbacks->index_program].fill = 0;
+  pcallbacks->index_program = (uint8_t)((pcallbacks->index_program + 1U) % JHAL_FLASH_BUFFERS);
+  pcallbacks->amount_queued--;
+  pcallbacks->programming = 0;
+  JHAL_CRITICAL_EXIT(state);
+}
+
+/* Starts the oldest queued buffer when none is programmed, from the writes and
+   from the completions. JHAL_RES_BUSY of the env means that an operation of the
+   application runs, its completion starts the buffer. A buffer that the env
+   refuses for any other reason is dropped and reported to the error callback.
+   The starts are not probed, they run in the interrupts as well */
+static void prv_flash_submit(void* pinstance, flash_callback_instance* pcallbacks)
+{
+  for(;;)
+  {
+    uint32_t state = JHAL_CRITICAL_ENTER();
+  
+    if(pcallbacks->programming || !pcallbacks->amount_queued)
+    {
+      JHAL_CRITICAL_EXIT(state);
+      return;
+    }
+  
+    pcallbacks->programming = 1;
+    JHAL_CRITICAL_EXIT(state);
+  
+    flash_buffer* pbuffer = &pcallbacks->buffers[pcallbacks->index_program];
+    uint32_t address = pbuffer->address;
+    uint8_t res = JHAL_DISPATCH(pinstance, _flash, _program_it)(pinstance, address, pbuffer->data, pbuffer->fill);
+  
+    if(res == JHAL_RES_NO_ERRORS)
+      return;
+  
+    if(res == JHAL_RES_BUSY)
+    {
+      pcallbacks->programming = 0;
+      return;
+    }
+  
+    prv_flash_release(pcallbacks);
+    prv_flash_error(pinstance, pcallbacks, address, JHAL_FLASH_ERROR_OPERATION);
+  }
+}
+
+/* Pads the fill buffer to whole program units and queues it, the next buffer of
+   the ring becomes the fill one */
+static void prv_flash_queue(void* pinstance, flash_callback_instance* pcallbacks)
+{
+  flash_buffer* pbuffer = &pcallbacks->buffers[pcallbacks->index_fill];
+  uint16_t rest = pbuffer->fill % pcallbacks->program_width;
+  
+  if(rest)
+  {
+    memset(&pbuffer->data[pbuffer->fill], pcallbacks->erased_value, pcallbacks->program_width - rest);
+    pbuffer->fill += pcallbacks->program_width - rest;
+  }
+  
+  pcallbacks->index_fill = (uint8_t)((pcallbacks->index_fill + 1U) % JHAL_FLASH_BUFFERS);
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  pcallbacks->amount_queued++;
+  JHAL_CRITICAL_EXIT(state);
+  
+  prv_flash_submit(pinstance, pcallbacks);
+}
+
+/* The completions only take buffers away, so the room seen here can only grow
+   until the data is copied. The data is split across the buffers of the ring,
+   a write longer than all of them together never finds the room */
+uint8_t jhal_flash_write(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pdata || !size)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  flash_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, flash_callback_instance);
+  
+  if((uint32_t)size + address % pcallbacks->program_width > (uint32_t)JHAL_FLASH_BUFFERS * JHAL_FLASH_BUFFER_SIZE)
+    return JHAL_RES_INVALID_PARAMS;
+  uint8_t amount_free = (uint8_t)(JHAL_FLASH_BUFFERS - pcallbacks->amount_queued);
+  
+  if(!amount_free)
+    return JHAL_RES_BUSY;
+  
+  flash_buffer* pbuffer = &pcallbacks->buffers[pcallbacks->index_fill];
+  uint8_t append = pbuffer->fill && address == pbuffer->address + pbuffer->end;
+  uint32_t room = (uint32_t)amount_free * JHAL_FLASH_BUFFER_SIZE - pbuffer->fill;
+  uint32_t needed = size;
+  
+  if(!append)
+  {
+    needed += address % pcallbacks->program_width;
+    room = (uint32_t)(amount_free - (pbuffer->fill ? 1U : 0U)) * JHAL_FLASH_BUFFER_SIZE;
+  }
+  
+  if(needed > room)
+    return JHAL_RES_BUSY;
+  
+  if(!append && pbuffer->fill)
+    prv_flash_queue(pinstance, pcallbacks);
+  
+  while(size)
+  {
+    pbuffer = &pcallbacks->buffers[pcallbacks->index_fill];
+  
+    if(!pbuffer->fill)
+    {
+      pbuffer->address = address - address % pcallbacks->program_width;
+      pbuffer->start = (uint16_t)(address - pbuffer->address);
+      pbuffer->fill = pbuffer->start;
+      memset(pbuffer->data, pcallbacks->erased_value, pbuffer->start);
+    }
+  
+    uint16_t chunk = (uint16_t)(JHAL_FLASH_BUFFER_SIZE - pbuffer->fill);
+  
+    if(chunk > size)
+      chunk = size;
+  
+    memcpy(&pbuffer->data[pbuffer->fill], pdata, chunk);
+    pbuffer->fill += chunk;
+    pbuffer->end = pbuffer->fill;
+    pdata += chunk;
+    address += chunk;
+    size -= chunk;
+  
+    if(pbuffer->fill == JHAL_FLASH_BUFFER_SIZE)
+      prv_flash_queue(pinstance, pcallbacks);
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_flash_flush(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  flash_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, flash_callback_instance);
+  
+  if(pcallbacks->amount_queued < JHAL_FLASH_BUFFERS && pcallbacks->buffers[pcallbacks->index_fill].fill)
+    prv_flash_queue(pinstance, pcallbacks);
+  else
+    prv_flash_submit(pinstance, pcallbacks);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint32_t jhal_flash_pending(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return 0;
+#endif
+  flash_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, flash_callback_instance);
+  uint32_t amount = 0;
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  for(uint8_t i = 0; i < JHAL_FLASH_BUFFERS; i++)
+  {
+    if(pcallbacks->buffers[i].fill)
+      amount += (uint32_t)(pcallbacks->buffers[i].end - pcallbacks->buffers[i].start);
+  }
+  JHAL_CRITICAL_EXIT(state);
+  
+  return amount;
+}
+
+/* Copies the buffered data over what was read from the oldest buffer to the
+   fill one, so the newest data wins. A buffer released by a completion meanwhile
+   is already in the flash */
+static void prv_flash_overlay(flash_callback_instance* pcallbacks, uint32_t address, uint8_t* pdata, uint16_t size)
+{
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  uint8_t index = pcallbacks->index_program;
+  uint8_t amount = pcallbacks->amount_queued;
+  JHAL_CRITICAL_EXIT(state);
+  
+  if(amount < JHAL_FLASH_BUFFERS)
+    amount++;
+  
+  for(; amount; amount--, index = (uint8_t)((index + 1U) % JHAL_FLASH_BUFFERS))
+  {
+    flash_buffer* pbuffer = &pcallbacks->buffers[index];
+  
+    if(!pbuffer->fill)
+      continue;
+  
+    uint32_t from = pbuffer->address + pbuffer->start;
+    uint32_t to = pbuffer->address + pbuffer->end;
+  
+    if(from < address)
+      from = address;
+    if(to > address + size)
+      to = address + size;
+  
+    if(from < to)
+      memcpy(pdata + (from - address), &pbuffer->data[from - pbuffer->address], to - from);
+  }
+}
+
+uint8_t jhal_flash_read(void* pinstance, uint32_t address, uint8_t* pdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pdata || !size)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_RECEIVE, size);
+  uint8_t res = JHAL_DISPATCH(pinstance, _flash, _read)(pinstance, address, pdata, size);
+  
+  if(res == JHAL_RES_NO_ERRORS)
+    prv_flash_overlay(JHAL_GET_CALLBACKS(pinstance, flash_callback_instance), address, pdata, size);
+  
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_RECEIVE, size, res);
+}
+
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_flash_erase(void* pinstance, uint32_t address, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !timeout)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_ERASE, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_ERASE, 0, JHAL_DISPATCH(pinstance, _flash, _erase)(pinstance, address, timeout));
+}
+
+uint8_t jhal_flash_erase_it(void* pinstance, uint32_t address)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_ERASE_IT, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_ERASE_IT, 0, JHAL_DISPATCH(pinstance, _flash, _erase_it)(pinstance, address));
+}
+
+uint8_t jhal_flash_program(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pdata || !size || !timeout)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_TRANSMIT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_TRANSMIT, size, JHAL_DISPATCH(pinstance, _flash, _program)(pinstance, address, pdata, size, timeout));
+}
+
+uint8_t jhal_flash_program_it(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pdata || !size)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size, JHAL_DISPATCH(pinstance, _flash, _program_it)(pinstance, address, pdata, size));
+}
+#endif
+
+/* Every completion frees the controller, so the next queued buffer is started
+   before the user callback runs */
+void jhal_flash_erase_complete_callback(void* pinstance, uint32_t address)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_TRANSFER_COMPLETE, 0);
+  flash_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, flash_callback_instance);
+  
+  prv_flash_submit(pinstance, pcallbacks);
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_erase_complete && JHAL_DEFER_POST(pinstance, prv_flash_defer_dispatch, FLASH_EVENT_ERASE, 0, (uint8_t*)(uintptr_t)address, 0))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_erase_complete)
+    pcallbacks->pfunc_erase_complete(JHAL_GET_USERDATA(pinstance), address);
+}
+
+void jhal_flash_program_complete_callback(void* pinstance, uint32_t address, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && size);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_TX_COMPLETE, size);
+  flash_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, flash_callback_instance);
+  
+  if(pcallbacks->programming && pcallbacks->buffers[pcallbacks->index_program].address == address)
+    prv_flash_release(pcallbacks);
+  
+  prv_flash_submit(pinstance, pcallbacks);
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_program_complete && JHAL_DEFER_POST(pinstance, prv_flash_defer_dispatch, FLASH_EVENT_PROGRAM, 0, (uint8_t*)(uintptr_t)address, size))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_program_complete)
+    pcallbacks->pfunc_program_complete(JHAL_GET_USERDATA(pinstance), address, size);
+}
+
+/* A failed buffer is dropped, its data is lost */
+void jhal_flash_error_callback(void* pinstance, uint32_t address, uint8_t error)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && error);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_ERROR, error);
+  flash_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, flash_callback_instance);
+  
+  if(pcallbacks->programming && pcallbacks->buffers[pcallbacks->index_program].address == address)
+    prv_flash_release(pcallbacks);
+  
+  prv_flash_submit(pinstance, pcallbacks);
+  prv_flash_error(pinstance, pcallbacks, address, error);
+}
+
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_flash_get_stats(void* pinstance, jhal_stats* pstats)
+{
+  return jhal_stats_get(pinstance, pstats);
+}
+
+uint8_t jhal_flash_reset_stats(void* pinstance)
+{
+  return jhal_stats_reset(pinstance);
+}
+#endif
@@ -0,0 +1,201 @@
+#ifndef __JHAL_FLASH__
+#define __JHAL_FLASH__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  
+#include "jhal_environment.h"
+#include "jhal_defer.h"
+#include "jhal_probe.h"
+  
+#define JHAL_FLASH_ERROR_PROTECT                1U
+#define JHAL_FLASH_ERROR_PROGRAM                2U
+#define JHAL_FLASH_ERROR_OPERATION              3U
+  
+#if (JHAL_FLASH_BUFFERS < 2)
+  #error "JHAL_FLASH_BUFFERS must be at least 2!"
+#endif
+  
+typedef void (*jhal_type_flash_erase_complete)(void*, uint32_t address);
+typedef void (*jhal_type_flash_program_complete)(void*, uint32_t address, uint16_t size);
+typedef void (*jhal_type_flash_error)(void*, uint32_t address, uint8_t error);
+  
+/* Filled by the env. Program operations take an address and a size that are
+   multiples of program_width. read_while_busy is set when the part has more
+   than one bank and a read of the bank that is not programmed or erased runs
+   while the operation does */
+typedef struct {
+  uint32_t                              address;
+  uint32_t                              size;
+  uint16_t                              program_width;
+  uint8_t                               erased_value;
+  uint8_t                               read_while_busy;
+} jhal_flash_info;
+  
+#if (USE_JHAL_OPS == 1)
+typedef struct jhal_flash_ops_struct jhal_flash_ops;
+#endif
+  
+/* num_module selects the flash controller, 1 on the parts with one. The
+   callbacks report the operations started by erase_it and program_it and the
+   programming of the write buffers */
+typedef struct {
+  uint8_t                               num_module;
+  
+  jhal_type_flash_erase_complete        pfunc_erase_complete;
+  jhal_type_flash_program_complete      pfunc_program_complete;
+  jhal_type_flash_error                 pfunc_error;
+  void*                                 plib_data;
+  void*                                 puser_data;
+#if (USE_JHAL_OPS == 1)
+  const jhal_flash_ops*                 pops;
+#endif
+} jhal_flash_params;
+  
+/* One write buffer: fill bytes from address go to the flash as one program
+   operation, the data written by the application is between start and end,
+   the rest is padded with the erased value */
+typedef struct {
+  uint32_t                              address;
+  uint16_t                              start;
+  uint16_t                              end;
+  uint16_t                              fill;
+  uint8_t                               data[JHAL_FLASH_BUFFER_SIZE];
+} flash_buffer;
+  
+typedef struct {
+  jhal_type_flash_erase_complete        pfunc_erase_complete;
+  jhal_type_flash_program_complete      pfunc_program_complete;
+  jhal_type_flash_error                 pfunc_error;
+  uint16_t                              program_width;
+  uint8_t                               erased_value;
+  uint8_t                               index_fill;
+  uint8_t                               index_program;
+  uint8_t                               amount_queued;
+  uint8_t                               programming;
+  flash_buffer                          buffers[JHAL_FLASH_BUFFERS];
+} flash_callback_instance;
+  
+#define JHAL_FLASH_SIZE_STATIC                  JHAL_DRIVER_SIZE_STATIC(JHAL_FLASH_SIZE_DRV_STATIC, sizeof(flash_callback_instance))
+#define JHAL_FLASH_DECLARE_STATIC(NAME)         JHAL_DECLARE_STATIC_MEM(NAME, JHAL_FLASH_SIZE_STATIC)
+#if (USE_JHAL_MEM_LINKED == 1)
+#define JHAL_FLASH_DECLARE_INSTANCE(NAME)       JHAL_DECLARE_INSTANCE(NAME, JHAL_FLASH_SIZE_STATIC, FLASH)
+JHAL_MEM_SLOTS_DECLARE(FLASH);
+#endif
+  
+#if (USE_JHAL_OPS == 1)
+struct jhal_flash_ops_struct {
+  uint32_t (*pfunc_size_drv)(void);
+  uint8_t (*pfunc_init)(void* pinstance, jhal_flash_params* pparams);
+  uint8_t (*pfunc_deinit)(void* pinstance);
+  uint8_t (*pfunc_get_info)(void* pinstance, jhal_flash_info* pinfo);
+  uint8_t (*pfunc_get_sector)(void* pinstance, uint32_t address, uint32_t* pstart, uint32_t* psize);
+  uint8_t (*pfunc_read)(void* pinstance, uint32_t address, uint8_t* pdata, uint16_t size);
+  uint8_t (*pfunc_erase)(void* pinstance, uint32_t address, uint32_t timeout);
+  uint8_t (*pfunc_erase_it)(void* pinstance, uint32_t address);
+  uint8_t (*pfunc_program)(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size, uint32_t timeout);
+  uint8_t (*pfunc_program_it)(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size);
+};
+  
+extern const jhal_flash_ops jhal_flash_ops_default;
+  
+#define JHAL_FLASH_OPS_DECLARE(NAME, ENV) const jhal_flash_ops NAME = {\
+        JHAL_FUNCTION_NAME(ENV,_flash,_size_drv),\
+        JHAL_FUNCTION_NAME(ENV,_flash,_init),\
+        JHAL_FUNCTION_NAME(ENV,_flash,_deinit),\
+        JHAL_FUNCTION_NAME(ENV,_flash,_get_info),\
+        JHAL_FUNCTION_NAME(ENV,_flash,_get_sector),\
+        JHAL_FUNCTION_NAME(ENV,_flash,_read),\
+        JHAL_FUNCTION_NAME(ENV,_flash,_erase),\
+        JHAL_FUNCTION_NAME(ENV,_flash,_erase_it),\
+        JHAL_FUNCTION_NAME(ENV,_flash,_program),\
+        JHAL_FUNCTION_NAME(ENV,_flash,_program_it)}
+#define JHAL_FLASH_SIZE_STATIC_BY_ENV(ENV) JHAL_DRIVER_SIZE_STATIC(JHAL_FUNCTION_NAME(ENV,_flash,_size_drv_static), sizeof(flash_callback_instance))
+#endif
+  
+uint8_t jhal_flash_init(void** ppinstance, jhal_flash_params* pparams);
+uint8_t jhal_flash_init_static(void** ppinstance, jhal_flash_params* pparams, void* pmem, uint32_t size_mem);
+uint8_t jhal_flash_deinit(void* pinstance);
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_flash_get_stats(void* pinstance, jhal_stats* pstats);
+uint8_t jhal_flash_reset_stats(void* pinstance);
+#endif
+uint8_t jhal_flash_get_info(void* pinstance, jhal_flash_info* pinfo);
+uint8_t jhal_flash_get_sector(void* pinstance, uint32_t address, uint32_t* pstart, uint32_t* psize);
+/* read returns JHAL_RES_BUSY instead of stalling the bus while an operation
+   runs on the bank of the data. The data that is still in the write buffers
+   is taken from them, so a read sees every write that went before it */
+uint8_t jhal_flash_read(void* pinstance, uint32_t address, uint8_t* pdata, uint16_t size);
+/* write copies the data to the write buffers and returns, a buffer is
+   programmed in the background as a whole as soon as it is full, so small
+   appends turn into program operations of JHAL_FLASH_BUFFER_SIZE bytes. A
+   write that does not continue the previous one closes the buffer and starts
+   a new one at its program unit. The data of one write is split across the
+   buffers, so it takes up to JHAL_FLASH_BUFFERS * JHAL_FLASH_BUFFER_SIZE
+   bytes together with the offset of the address in its program unit, a longer
+   write is JHAL_RES_INVALID_PARAMS and is split by the caller. JHAL_RES_BUSY -
+   the buffers have no room for all of the data, nothing is taken. flush pads the last program unit
+   of the buffered data with the erased value and starts its programming, so
+   the next write goes to the next unit. pending is the amount of bytes that
+   are not programmed yet. The sectors are erased by the application before
+   they are written, not while the buffers still hold data for them. A buffer
+   that waits for an operation of the application starts when that one
+   completes */
+uint8_t jhal_flash_write(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size);
+uint8_t jhal_flash_flush(void* pinstance);
+uint32_t jhal_flash_pending(void* pinstance);
+/* erase takes the start address of a sector. program and program_it write
+   whole program units to the erased flash, pdata of program_it is used until
+   the completion. The env returns JHAL_RES_BUSY while another operation runs */
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_flash_erase(void* pinstance, uint32_t address, uint32_t timeout);
+uint8_t jhal_flash_erase_it(void* pinstance, uint32_t address);
+uint8_t jhal_flash_program(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size, uint32_t timeout);
+uint8_t jhal_flash_program_it(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size);
+#endif
+  
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+  #define jhal_flash_init(PPINSTANCE, PPARAMS)  JHAL_MEM_CALL_SITE((jhal_flash_init)(PPINSTANCE, PPARAMS))
+#endif
+  
+/* Called by the env when an operation started by erase_it or program_it is
+   done or has failed with a JHAL_FLASH_ERROR_*, address is the one the
+   operation was started with */
+void jhal_flash_erase_complete_callback(void* pinstance, uint32_t address);
+void jhal_flash_program_complete_callback(void* pinstance, uint32_t address, uint16_t size);
+void jhal_flash_error_callback(void* pinstance, uint32_t address, uint8_t error);
+  
+#ifdef __cplusplus
+}
+#endif
+
+#include JHAL_FLASH_INCLUDE_NAME
+
+#if (USE_JHAL_INLINE == 1)
+static inline uint8_t jhal_flash_erase(void* pinstance, uint32_t address, uint32_t timeout)
+{
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_ERASE, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_ERASE, 0, JHAL_DISPATCH(pinstance, _flash, _erase)(pinstance, address, timeout));
+}
+
+static inline uint8_t jhal_flash_erase_it(void* pinstance, uint32_t address)
+{
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_ERASE_IT, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_ERASE_IT, 0, JHAL_DISPATCH(pinstance, _flash, _erase_it)(pinstance, address));
+}
+
+static inline uint8_t jhal_flash_program(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size, uint32_t timeout)
+{
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_TRANSMIT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_TRANSMIT, size, JHAL_DISPATCH(pinstance, _flash, _program)(pinstance, address, pdata, size, timeout));
+}
+
+static inline uint8_t jhal_flash_program_it(void* pinstance, uint32_t address, const uint8_t* pdata, uint16_t size)
+{
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_FLASH, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size, JHAL_DISPATCH(pinstance, _flash, _program_it)(pinstance, address, pdata, size));
+}
+#endif
+
+#endif
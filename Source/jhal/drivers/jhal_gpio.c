@@ -1,141 +1,172 @@
-#include "jhal_gpio.h"
-#include JHAL_GPIO_INCLUDE_NAME
-
-struct _instance_list{  
-  void*                         puser_data;
-  jhal_type_gpio_input          pfunc_input;
-  struct _instance_list*        pnext;
-  struct _instance_list*        pprev;
-  void*                         pinstance;
-};
-
-typedef struct _instance_list instance_list;
-
-static instance_list* plist_top = NULL;
-
-__WEAK uint8_t JHAL_GPIO_INIT(void* pinstance, jhal_gpio_params* pparams)
-{
-  (void)pinstance;
-  (void)pparams;  
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_GPIO_DEINIT(void* pinstance)
-{
-  (void)pinstance;
-  
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_GPIO_SET(void* pinstance, uint64_t pins, uint8_t value)
-{
-  (void)pinstance;
-  (void)pins;
-  (void)value;
-  
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_GPIO_GET(void* pinstance, uint64_t pins, uint8_t* pvalue)
-{
-  (void)pinstance;
-  (void)pins;
-  (void)pvalue;
-  
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-uint8_t jhal_gpio_init(void** ppinstance, jhal_gpio_params* pparams)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)       
-   if(!ppinstance || *ppinstance || !pparams) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif      
-   instance_list* plist_new = (instance_list*)jhal_malloc(JHAL_GPIO_SIZE_DRV + sizeof(instance_list));
-   
-   if(plist_new == NULL)  
-     return JHAL_RES_ALLOC_ERROR;
-          
-   plist_new->pfunc_input = pparams->pfunc_input;
-   plist_new->puser_data = pparams->puser_data;
-   
-   uint8_t res = JHAL_GPIO_INIT(plist_new->pinstance, pparams); 
-   
-   if(res == JHAL_RES_NO_ERRORS)
-   {
-     JHAL_DRV_ITEM_ADD(plist_new);
-       
-     *ppinstance = plist_new->pinstance;
-   } else 
-   {
-     *ppinstance = NULL;
-     jhal_free(plist_new);
-   }
-        
-  return res;  
-}
-
-uint8_t jhal_gpio_deinit(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-  instance_list* plist = plist_top;
-  while(plist != NULL)
-  {
-    if(plist->pinstance == pinstance)
-      break;
-
-    plist = plist->pnext;
-  }
-  
-  if(plist == NULL)
-    return JHAL_RES_INVALID_PARAMS;
-  
-  JHAL_DRV_ITEM_DELETE(plist);
-      
-  jhal_free(pinstance); 
-  
-  return JHAL_GPIO_DEINIT(pinstance);
-}
-
-uint8_t jhal_gpio_set(void* pinstance, uint64_t pins, uint8_t value)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance && !pins && value > 1) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   
-  return JHAL_GPIO_SET(pinstance, pins, value);
-}
-
-uint8_t jhal_gpio_get(void* pinstance, uint64_t pins, uint8_t* pvalue)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance && !pins && !pvalue) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   
-  return JHAL_GPIO_GET(pinstance, pins, pvalue);
-}
-
-void jhal_gpio_input_callback(void* pinstance, uint16_t pin, uint8_t value)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-  JHAL_ASSERT(pinstance && value <= 1);  
-#endif
-  instance_list* plist = plist_top;
-  while(plist != NULL)
-  {
-    if(plist->pinstance == pinstance)
-    {
-      if(plist->pfunc_input)
-        plist->pfunc_input(plist->puser_data, pin, value);
-      
-      break;
-    }
-    plist = plist->pnext;
-  }    
-}
\ No newline at end of file
+#include "jhal_gpio.h"
+#include JHAL_GPIO_INCLUDE_NAME
+
+#if (USE_JHAL_MEM_LINKED == 1)
+JHAL_MEM_SLOTS_DEFINE(GPIO);
+#endif
+
+__WEAK uint8_t JHAL_GPIO_INIT(void* pinstance, jhal_gpio_params* pparams)
+{
+  (void)pinstance;
+  (void)pparams;  
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_GPIO_DEINIT(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+#if (USE_JHAL_INLINE == 0)
+__WEAK uint8_t JHAL_GPIO_SET(void* pinstance, uint64_t pins, uint8_t value)
+{
+  (void)pinstance;
+  (void)pins;
+  (void)value;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_GPIO_GET(void* pinstance, uint64_t pins, uint8_t* pvalue)
+{
+  (void)pinstance;
+  (void)pins;
+  (void)pvalue;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+#endif
+
+#if (USE_JHAL_OPS == 1)
+JHAL_GPIO_OPS_DECLARE(jhal_gpio_ops_default, JHAL_MCU_ENV);
+#endif
+
+static uint8_t prv_gpio_init(jhal_driver_instance* pnew_instance, void** ppinstance, jhal_gpio_params* pparams)
+{
+   gpio_callback_instance* pcallbacks = (gpio_callback_instance*)pnew_instance->pfuncs_callbacks;
+   pcallbacks->pfunc_input = pparams->pfunc_input;
+   pnew_instance->puser_data = pparams->puser_data;
+#if (USE_JHAL_OPS == 1)
+   pnew_instance->pops = JHAL_OPS_BY_PARAMS(pparams, _gpio);
+#endif
+   
+   uint8_t res = JHAL_DISPATCH(pnew_instance->pinstance, _gpio, _init)(pnew_instance->pinstance, pparams); 
+   
+   if(res == JHAL_RES_NO_ERRORS)       
+     *ppinstance = pnew_instance->pinstance;
+   else 
+   {
+     *ppinstance = NULL;
+     jhal_driver_free(pnew_instance->pinstance);
+   }  
+   
+   return res;
+}
+
+uint8_t (jhal_gpio_init)(void** ppinstance, jhal_gpio_params* pparams)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)       
+   if(!ppinstance || *ppinstance || !pparams) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif      
+   jhal_driver_instance* pnew_instance = JHAL_DRIVER_MALLOC(JHAL_SIZE_DRV_BY_PARAMS(pparams, _gpio), sizeof(gpio_callback_instance), GPIO);
+     
+   if(pnew_instance == NULL)  
+     return JHAL_RES_ALLOC_ERROR;
+   
+   return prv_gpio_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_gpio_init_static(void** ppinstance, jhal_gpio_params* pparams, void* pmem, uint32_t size_mem)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)       
+   if(!ppinstance || *ppinstance || !pparams || !pmem) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif      
+   jhal_driver_instance* pnew_instance = jhal_driver_place(pmem, size_mem, JHAL_SIZE_DRV_BY_PARAMS(pparams, _gpio), sizeof(gpio_callback_instance));
+     
+   if(pnew_instance == NULL)  
+     return JHAL_RES_ALLOC_ERROR;
+   
+   return prv_gpio_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_gpio_deinit(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint8_t res = JHAL_DISPATCH(pinstance, _gpio, _deinit)(pinstance);
+  
+  jhal_driver_free(pinstance);
+  
+  return res;
+}
+
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_gpio_set(void* pinstance, uint64_t pins, uint8_t value)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance && !pins && value > 1) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   
+  return JHAL_DISPATCH(pinstance, _gpio, _set)(pinstance, pins, value);
+}
+
+uint8_t jhal_gpio_get(void* pinstance, uint64_t pins, uint8_t* pvalue)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance && !pins && !pvalue) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   
+  return JHAL_DISPATCH(pinstance, _gpio, _get)(pinstance, pins, pvalue);
+}
+#endif
+
+#if (USE_JHAL_DEFER == 1)
+static void prv_gpio_defer_dispatch(const jhal_defer_event* pevent)
+{
+  JHAL_GET_CALLBACKS(pevent->pinstance, gpio_callback_instance)->pfunc_input(JHAL_GET_USERDATA(pevent->pinstance), pevent->size, pevent->value);
+}
+#endif
+
+void jhal_gpio_input_callback(void* pinstance, uint16_t pin, uint8_t value)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && value <= 1);  
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_GPIO, pinstance, JHAL_TRACE_OP_INPUT, pin);
+  gpio_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, gpio_callback_instance);
+  
+#if (USE_JHAL_DEFER == 1)
+  /* The pin travels in the size field of the event */
+  if(pcallbacks->pfunc_input && JHAL_DEFER_POST(pinstance, prv_gpio_defer_dispatch, 0, value, NULL, pin))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_input)
+    pcallbacks->pfunc_input(JHAL_GET_USERDATA(pinstance), pin, value);
+}
+
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_gpio_get_stats(void* pinstance, jhal_stats* pstats)
+{
+  return jhal_stats_get(pinstance, pstats);
+}
+
+uint8_t jhal_gpio_reset_stats(void* pinstance)
+{
+  return jhal_stats_reset(pinstance);
+}
+#endif
\ No newline at end of file
@@ -1,75 +1,140 @@
-#ifndef __JHAL_GPIO__
-#define __JHAL_GPIO__
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include <stdint.h>
-#include "jhal_environment.h"  
-  
-#define JHAL_GPIO_BANK_A                    1
-#define JHAL_GPIO_BANK_B                    2  
-#define JHAL_GPIO_BANK_C                    3
-#define JHAL_GPIO_BANK_D                    4
-#define JHAL_GPIO_BANK_E                    5  
-#define JHAL_GPIO_BANK_F                    6
-#define JHAL_GPIO_BANK_G                    7
-#define JHAL_GPIO_BANK_H                    8  
-#define JHAL_GPIO_BANK_I                    9  
-#define JHAL_GPIO_BANK_J                    10  
-#define JHAL_GPIO_BANK_K                    11
-  
-#define JHAL_PIN_NUM(NUM)                   (((uint64_t)1)<<(NUM))
-#define JHAL_PIN_RANGE(FROM,TO)             ((JHAL_PIN_NUM(TO) - JHAL_PIN_NUM(FROM - 1)) << 1)
-
-#define JHAL_GPIO_VALUE(NUM)                JHAL_PIN_NUM(NUM)
-#define JHAL_GPIO_VALUES_RANGE(FROM,TO)     JHAL_PIN_RANGE(FROM,TO)
-  
-typedef void (*jhal_type_gpio_input)(void*, uint16_t pin, uint8_t value);
-  
-typedef enum {  
-  JHAL_GPIO_MODE_INPUT                  = 99U,
-  JHAL_GPIO_MODE_OUTPUT                 = 13U,
-  JHAL_GPIO_MODE_OUTPUT_OPENDRAIN       = 14U
-} jhal_gpio_mode;
-
-typedef enum {
-  JHAL_GPIO_PULL_TYPE_NOT_PULL          = 114U,
-  JHAL_GPIO_PULL_TYPE_PULLDOWN          = 56U,
-  JHAL_GPIO_PULL_TYPE_PULLUP            = 10U
-} jhal_gpio_pull_type;
-
-typedef enum {
-  JHAL_GPIO_INT_TYPE_NOT_SET            = 74U,
-  JHAL_GPIO_INT_TYPE_LOW_LEVEL          = 98U,
-  JHAL_GPIO_INT_TYPE_HIGH_LEVEL         = 135U,
-  JHAL_GPIO_INT_TYPE_RISING_EDGE        = 129U,
-  JHAL_GPIO_INT_TYPE_FALLING_EDGE       = 108U,
-  JHAL_GPIO_INT_TYPE_BOTH_EDGES         = 244U
-} jhal_gpio_int_type;
-
-typedef struct {
-  uint8_t                       num_module;
-  jhal_gpio_mode                mode;
-  jhal_gpio_int_type            int_type;
-  jhal_gpio_pull_type           pull_type;
-  uint64_t                      pins;
-  
-  jhal_type_gpio_input          pfunc_input;
-  void*                         plib_data;
-  void*                         puser_data;
-} jhal_gpio_params;
-
-uint8_t jhal_gpio_init(void** ppinstance, jhal_gpio_params* pparams);
-uint8_t jhal_gpio_deinit(void* pinstance);
-uint8_t jhal_gpio_set(void* pinstance, uint64_t pins, uint8_t value);
-uint8_t jhal_gpio_get(void* pinstance, uint64_t pins, uint8_t* pValue);
-
-void jhal_gpio_input_callback(void* pinstance, uint16_t pin, uint8_t value);
-
-#ifdef __cplusplus
-}
-#endif
-
+#ifndef __JHAL_GPIO__
+#define __JHAL_GPIO__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "jhal_environment.h"  
+#include "jhal_defer.h"
+#include "jhal_probe.h"
+  
+#define JHAL_GPIO_BANK_A                    1
+#define JHAL_GPIO_BANK_B                    2  
+#define JHAL_GPIO_BANK_C                    3
+#define JHAL_GPIO_BANK_D                    4
+#define JHAL_GPIO_BANK_E                    5  
+#define JHAL_GPIO_BANK_F                    6
+#define JHAL_GPIO_BANK_G                    7
+#define JHAL_GPIO_BANK_H                    8  
+#define JHAL_GPIO_BANK_I                    9  
+#define JHAL_GPIO_BANK_J                    10  
+#define JHAL_GPIO_BANK_K                    11
+  
+#define JHAL_PIN_NUM(NUM)                   (((uint64_t)1)<<(NUM))
+#define JHAL_PIN_RANGE(FROM,TO)             ((JHAL_PIN_NUM(TO) - JHAL_PIN_NUM(FROM - 1)) << 1)
+
+#define JHAL_GPIO_VALUE(NUM)                JHAL_PIN_NUM(NUM)
+#define JHAL_GPIO_VALUES_RANGE(FROM,TO)     JHAL_PIN_RANGE(FROM,TO)
+  
+typedef void (*jhal_type_gpio_input)(void*, uint16_t pin, uint8_t value);
+  
+typedef enum {  
+  JHAL_GPIO_MODE_INPUT                  = 99U,
+  JHAL_GPIO_MODE_OUTPUT                 = 13U,
+  JHAL_GPIO_MODE_OUTPUT_OPENDRAIN       = 14U
+} jhal_gpio_mode;
+
+typedef enum {
+  JHAL_GPIO_PULL_TYPE_NOT_PULL          = 114U,
+  JHAL_GPIO_PULL_TYPE_PULLDOWN          = 56U,
+  JHAL_GPIO_PULL_TYPE_PULLUP            = 10U
+} jhal_gpio_pull_type;
+
+typedef enum {
+  JHAL_GPIO_INT_TYPE_NOT_SET            = 74U,
+  JHAL_GPIO_INT_TYPE_LOW_LEVEL          = 98U,
+  JHAL_GPIO_INT_TYPE_HIGH_LEVEL         = 135U,
+  JHAL_GPIO_INT_TYPE_RISING_EDGE        = 129U,
+  JHAL_GPIO_INT_TYPE_FALLING_EDGE       = 108U,
+  JHAL_GPIO_INT_TYPE_BOTH_EDGES         = 244U
+} jhal_gpio_int_type;
+
+#if (USE_JHAL_OPS == 1)
+typedef struct jhal_gpio_ops_struct jhal_gpio_ops;
+#endif
+
+typedef struct {
+  uint8_t                       num_module;
+  jhal_gpio_mode                mode;
+  jhal_gpio_int_type            int_type;
+  jhal_gpio_pull_type           pull_type;
+  uint64_t                      pins;
+  
+  jhal_type_gpio_input          pfunc_input;
+  void*                         plib_data;
+  void*                         puser_data;
+#if (USE_JHAL_OPS == 1)
+  const jhal_gpio_ops*          pops;
+#endif
+} jhal_gpio_params;
+
+typedef struct {
+  jhal_type_gpio_input          pfunc_input;
+} gpio_callback_instance;
+
+#define JHAL_GPIO_SIZE_STATIC                    JHAL_DRIVER_SIZE_STATIC(JHAL_GPIO_SIZE_DRV_STATIC, sizeof(gpio_callback_instance))
+#define JHAL_GPIO_DECLARE_STATIC(NAME)           JHAL_DECLARE_STATIC_MEM(NAME, JHAL_GPIO_SIZE_STATIC)
+#if (USE_JHAL_MEM_LINKED == 1)
+#define JHAL_GPIO_DECLARE_INSTANCE(NAME)         JHAL_DECLARE_INSTANCE(NAME, JHAL_GPIO_SIZE_STATIC, GPIO)
+JHAL_MEM_SLOTS_DECLARE(GPIO);
+#endif
+
+#if (USE_JHAL_OPS == 1)
+struct jhal_gpio_ops_struct {
+  uint32_t (*pfunc_size_drv)(void);
+  uint8_t (*pfunc_init)(void* pinstance, jhal_gpio_params* pparams);
+  uint8_t (*pfunc_deinit)(void* pinstance);
+  uint8_t (*pfunc_set)(void* pinstance, uint64_t pins, uint8_t value);
+  uint8_t (*pfunc_get)(void* pinstance, uint64_t pins, uint8_t* pvalue);
+};
+
+extern const jhal_gpio_ops jhal_gpio_ops_default;
+
+#define JHAL_GPIO_OPS_DECLARE(NAME, ENV)   const jhal_gpio_ops NAME = {\
+        JHAL_FUNCTION_NAME(ENV,_gpio,_size_drv),\
+        JHAL_FUNCTION_NAME(ENV,_gpio,_init),\
+        JHAL_FUNCTION_NAME(ENV,_gpio,_deinit),\
+        JHAL_FUNCTION_NAME(ENV,_gpio,_set),\
+        JHAL_FUNCTION_NAME(ENV,_gpio,_get)}
+#define JHAL_GPIO_SIZE_STATIC_BY_ENV(ENV)  JHAL_DRIVER_SIZE_STATIC(JHAL_FUNCTION_NAME(ENV,_gpio,_size_drv_static), sizeof(gpio_callback_instance))
+#endif
+
+uint8_t jhal_gpio_init(void** ppinstance, jhal_gpio_params* pparams);
+uint8_t jhal_gpio_init_static(void** ppinstance, jhal_gpio_params* pparams, void* pmem, uint32_t size_mem);
+uint8_t jhal_gpio_deinit(void* pinstance);
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_gpio_get_stats(void* pinstance, jhal_stats* pstats);
+uint8_t jhal_gpio_reset_stats(void* pinstance);
+#endif
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_gpio_set(void* pinstance, uint64_t pins, uint8_t value);
+uint8_t jhal_gpio_get(void* pinstance, uint64_t pins, uint8_t* pValue);
+#endif
+
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+  #define jhal_gpio_init(PPINSTANCE, PPARAMS)    JHAL_MEM_CALL_SITE((jhal_gpio_init)(PPINSTANCE, PPARAMS))
+#endif
+
+void jhal_gpio_input_callback(void* pinstance, uint16_t pin, uint8_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#include JHAL_GPIO_INCLUDE_NAME
+
+#if (USE_JHAL_INLINE == 1)
+static inline uint8_t jhal_gpio_set(void* pinstance, uint64_t pins, uint8_t value)
+{
+  return JHAL_DISPATCH(pinstance, _gpio, _set)(pinstance, pins, value);
+}
+
+static inline uint8_t jhal_gpio_get(void* pinstance, uint64_t pins, uint8_t* pvalue)
+{
+  return JHAL_DISPATCH(pinstance, _gpio, _get)(pinstance, pins, pvalue);
+}
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,655 @@
+#include "jhal_i2c.h"
+#include JHAL_I2C_INCLUDE_NAME
+
+#if (USE_JHAL_MEM_LINKED == 1)
+JHAL_MEM_SLOTS_DEFINE(I2C);
+#endif
+
+__WEAK uint8_t JHAL_I2C_INIT(void* pinstance, jhal_i2c_params* pparams)
+{
+  (void)pinstance;
+  (void)pparams;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_I2C_DEINIT(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_I2C_ABORT(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+#if (USE_JHAL_INLINE == 0)
+__WEAK uint8_t JHAL_I2C_TRANSMIT(void* pinstance, uint16_t address, uint8_t* pTxData, uint16_t size, uint32_t timeout)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pTxData;
+  (void)size;
+  (void)timeout;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_I2C_RECEIVE(void* pinstance, uint16_t address, uint8_t* pRxData, uint16_t size, uint32_t timeout)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pRxData;
+  (void)size;
+  (void)timeout;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_I2C_WRITE_READ(void* pinstance, uint16_t address, uint8_t* pTxData, uint16_t size_tx, uint8_t* pRxData, uint16_t size_rx, uint32_t timeout)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pTxData;
+  (void)size_tx;
+  (void)pRxData;
+  (void)size_rx;
+  (void)timeout;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_I2C_TRANSMIT_IT(void* pinstance, uint16_t address, uint8_t* pTxData, uint16_t size)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pTxData;
+  (void)size;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_I2C_RECEIVE_IT(void* pinstance, uint16_t address, uint8_t* pRxData, uint16_t size)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pRxData;
+  (void)size;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_I2C_WRITE_READ_IT(void* pinstance, uint16_t address, uint8_t* pTxData, uint16_t size_tx, uint8_t* pRxData, uint16_t size_rx)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pTxData;
+  (void)size_tx;
+  (void)pRxData;
+  (void)size_rx;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_I2C_TRANSMIT_DMA(void* pinstance, uint16_t address, uint8_t* pTxData, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pTxData;
+  (void)size;
+  (void)pinstance_dma;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_I2C_RECEIVE_DMA(void* pinstance, uint16_t address, uint8_t* pRxData, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pRxData;
+  (void)size;
+  (void)pinstance_dma;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_I2C_WRITE_READ_DMA(void* pinstance, uint16_t address, uint8_t* pTxData, uint16_t size_tx, uint8_t* pRxData, uint16_t size_rx, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)address;
+  (void)pTxData;
+  (void)size_tx;
+  (void)pRxData;
+  (void)size_rx;
+  (void)pinstance_dma;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+#endif
+
+#if (USE_JHAL_OPS == 1)
+JHAL_I2C_OPS_DECLARE(jhal_i2c_ops_default, JHAL_MCU_ENV);
+#endif
+
+static uint8_t prv_i2c_init(jhal_driver_instance* pnew_instance, void** ppinstance, jhal_i2c_params* pparams)
+{
+   i2c_callback_instance* pcallbacks = (i2c_callback_instance*)pnew_instance->pfuncs_callbacks;
+   pcallbacks->pfunc_tx_complete = pparams->pfunc_tx_complete;
+   pcallbacks->pfunc_rx_complete = pparams->pfunc_rx_complete;
+   pcallbacks->pfunc_write_read_complete = pparams->pfunc_write_read_complete;
+   pcallbacks->pfunc_error = pparams->pfunc_error;
+#if (USE_JHAL_QUEUE == 1)
+   pcallbacks->pqueue = NULL;
+#endif
+   pnew_instance->puser_data = pparams->puser_data;
+#if (USE_JHAL_OPS == 1)
+   pnew_instance->pops = JHAL_OPS_BY_PARAMS(pparams, _i2c);
+#endif
+  
+#if (USE_JHAL_OS == 1)
+   pcallbacks->error = 0;
+   uint8_t res = jhal_os_blocking_init(&pcallbacks->blocking);
+  
+   if(res == JHAL_RES_NO_ERRORS)
+   {
+     res = JHAL_DISPATCH(pnew_instance->pinstance, _i2c, _init)(pnew_instance->pinstance, pparams);
+     if(res != JHAL_RES_NO_ERRORS)
+       jhal_os_blocking_deinit(&pcallbacks->blocking);
+   }
+#else
+   uint8_t res = JHAL_DISPATCH(pnew_instance->pinstance, _i2c, _init)(pnew_instance->pinstance, pparams);
+#endif
+  
+   if(res == JHAL_RES_NO_ERRORS)
+     *ppinstance = pnew_instance->pinstance;
+   else
+   {
+     *ppinstance = NULL;
+     jhal_driver_free(pnew_instance->pinstance);
+   }
+  
+   return res;
+}
+
+uint8_t (jhal_i2c_init)(void** ppinstance, jhal_i2c_params* pparams)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!ppinstance || *ppinstance || !pparams)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = JHAL_DRIVER_MALLOC(JHAL_SIZE_DRV_BY_PARAMS(pparams, _i2c), sizeof(i2c_callback_instance), I2C);
+  
+   if(pnew_instance == NULL)
+     return JHAL_RES_ALLOC_ERROR;
+  
+   return prv_i2c_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_i2c_init_static(void** ppinstance, jhal_i2c_params* pparams, void* pmem, uint32_t size_mem)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!ppinstance || *ppinstance || !pparams || !pmem)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = jhal_driver_place(pmem, size_mem, JHAL_SIZE_DRV_BY_PARAMS(pparams, _i2c), sizeof(i2c_callback_instance));
+  
+   if(pnew_instance == NULL)
+     return JHAL_RES_ALLOC_ERROR;
+  
+   return prv_i2c_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_i2c_deinit(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint8_t res = JHAL_DISPATCH(pinstance, _i2c, _deinit)(pinstance);
+#if (USE_JHAL_OS == 1)
+  jhal_os_blocking_deinit(&JHAL_GET_CALLBACKS(pinstance, i2c_callback_instance)->blocking);
+#endif
+  
+  jhal_driver_free(pinstance);
+  
+  return res;
+}
+
+uint8_t jhal_i2c_abort(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_ABORT, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_ABORT, 0, JHAL_DISPATCH(pinstance, _i2c, _abort)(pinstance));
+}
+
+#if (USE_JHAL_QUEUE == 1)
+static uint8_t prv_i2c_request_start(void* pinstance, jhal_request* prequest)
+{
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_REQUEST, prequest->size);
+  
+  if(prequest->size > 0xFFFFU)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint16_t size = (uint16_t)prequest->size;
+  
+  switch(prequest->operation)
+  {
+    case JHAL_REQUEST_OPERATION_TX:
+      if(prequest->pinstance_dma)
+        return JHAL_DISPATCH(pinstance, _i2c, _transmit_dma)(pinstance, prequest->address, prequest->ptxdata, size, prequest->pinstance_dma);
+      return JHAL_DISPATCH(pinstance, _i2c, _transmit_it)(pinstance, prequest->address, prequest->ptxdata, size);
+    case JHAL_REQUEST_OPERATION_RX:
+      if(prequest->pinstance_dma)
+        return JHAL_DISPATCH(pinstance, _i2c, _receive_dma)(pinstance, prequest->address, prequest->prxdata, size, prequest->pinstance_dma);
+      return JHAL_DISPATCH(pinstance, _i2c, _receive_it)(pinstance, prequest->address, prequest->prxdata, size);
+    case JHAL_REQUEST_OPERATION_WRITE_READ:
+      if(prequest->pinstance_dma)
+        return JHAL_DISPATCH(pinstance, _i2c, _write_read_dma)(pinstance, prequest->address, prequest->ptxdata, prequest->size_tx, prequest->prxdata, size, prequest->pinstance_dma);
+      return JHAL_DISPATCH(pinstance, _i2c, _write_read_it)(pinstance, prequest->address, prequest->ptxdata, prequest->size_tx, prequest->prxdata, size);
+  }
+  
+  return JHAL_RES_INVALID_PARAMS;
+}
+
+/* Binds a request queue to the instance, NULL detaches it. The queue attached
+   before is released first, JHAL_RES_BUSY while it still holds requests.
+   Completions of an attached instance go to the queue instead of the callbacks,
+   a transfer ended by a bus error completes its request with JHAL_RES_ERROR and
+   the queue goes on with the next one, so one silent device does not stall the bus */
+uint8_t jhal_i2c_queue_attach(void* pinstance, jhal_request_queue* pqueue)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  i2c_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, i2c_callback_instance);
+  
+  jhal_request_queue* pqueue_old = pcallbacks->pqueue;
+  
+  if(pqueue_old != NULL && pqueue_old != pqueue && jhal_request_pending(pqueue_old))
+    return JHAL_RES_BUSY;
+  
+  if(pqueue != NULL)
+  {
+    uint8_t res = jhal_request_queue_bind(pqueue, pinstance, prv_i2c_request_start);
+    if(res != JHAL_RES_NO_ERRORS)
+      return res;
+  }
+  
+  if(pqueue_old != NULL && pqueue_old != pqueue)
+    jhal_request_queue_bind(pqueue_old, NULL, NULL);
+  
+  pcallbacks->pqueue = pqueue;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+#endif
+
+#if (USE_JHAL_OS == 1) || (USE_JHAL_DEFER == 1)
+#define I2C_OPERATION_TX                1U
+#define I2C_OPERATION_RX                2U
+#define I2C_OPERATION_WRITE_READ        3U
+#define I2C_OPERATION_ERROR             4U
+#endif
+
+#if (USE_JHAL_INLINE == 0) || (USE_JHAL_OS == 1)
+#if (USE_JHAL_OS == 1)
+
+/* Runs the IT variant and sleeps on the completion instead of polling, envs
+   without IT support fall back to the polling variant under the same lock.
+   A bus error wakes the task as well and is returned as JHAL_RES_ERROR */
+static uint8_t prv_i2c_blocking(void* pinstance, uint8_t operation, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, uint32_t timeout)
+{
+  i2c_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, i2c_callback_instance);
+  jhal_os_blocking* pblocking = &pcallbacks->blocking;
+  
+  uint8_t res = jhal_os_blocking_begin(pblocking, timeout);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  pcallbacks->error = 0;
+  
+  switch(operation)
+  {
+    case I2C_OPERATION_TX:
+      res = JHAL_DISPATCH(pinstance, _i2c, _transmit_it)(pinstance, address, ptxdata, size_tx);
+    break;
+    case I2C_OPERATION_RX:
+      res = JHAL_DISPATCH(pinstance, _i2c, _receive_it)(pinstance, address, prxdata, size_rx);
+    break;
+    default:
+      res = JHAL_DISPATCH(pinstance, _i2c, _write_read_it)(pinstance, address, ptxdata, size_tx, prxdata, size_rx);
+    break;
+  }
+  
+  if(res == JHAL_RES_NO_ERRORS)
+  {
+    res = jhal_os_blocking_wait(pblocking, timeout);
+  
+    if(res == JHAL_RES_TIMEOUT)
+      JHAL_DISPATCH(pinstance, _i2c, _abort)(pinstance);
+    else if(res == JHAL_RES_NO_ERRORS && pcallbacks->error)
+      res = JHAL_RES_ERROR;
+  }
+  else if(res == JHAL_RES_NOT_SUPPORTED)
+  {
+    pblocking->waiting = 0;
+    timeout = jhal_os_blocking_remaining(pblocking, timeout);
+  
+    switch(operation)
+    {
+      case I2C_OPERATION_TX:
+        res = JHAL_DISPATCH(pinstance, _i2c, _transmit)(pinstance, address, ptxdata, size_tx, timeout);
+      break;
+      case I2C_OPERATION_RX:
+        res = JHAL_DISPATCH(pinstance, _i2c, _receive)(pinstance, address, prxdata, size_rx, timeout);
+      break;
+      default:
+        res = JHAL_DISPATCH(pinstance, _i2c, _write_read)(pinstance, address, ptxdata, size_tx, prxdata, size_rx, timeout);
+      break;
+    }
+  }
+  
+  jhal_os_blocking_end(pblocking);
+  
+  return res;
+}
+#endif
+
+uint8_t jhal_i2c_transmit(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ptxdata  || !size || !timeout)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT, size);
+#if (USE_JHAL_OS == 1)
+  if(jhal_os_can_block())
+    return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT, size, prv_i2c_blocking(pinstance, I2C_OPERATION_TX, address, ptxdata, size, NULL, 0, timeout));
+#endif
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT, size, JHAL_DISPATCH(pinstance, _i2c, _transmit)(pinstance, address, ptxdata, size, timeout));
+}
+
+uint8_t jhal_i2c_receive(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !prxdata || !size || !timeout)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE, size);
+#if (USE_JHAL_OS == 1)
+  if(jhal_os_can_block())
+    return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE, size, prv_i2c_blocking(pinstance, I2C_OPERATION_RX, address, NULL, 0, prxdata, size, timeout));
+#endif
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE, size, JHAL_DISPATCH(pinstance, _i2c, _receive)(pinstance, address, prxdata, size, timeout));
+}
+
+uint8_t jhal_i2c_write_read(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ptxdata || !size_tx || !prxdata || !size_rx || !timeout)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size_tx + size_rx);
+#if (USE_JHAL_OS == 1)
+  if(jhal_os_can_block())
+    return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size_tx + size_rx, prv_i2c_blocking(pinstance, I2C_OPERATION_WRITE_READ, address, ptxdata, size_tx, prxdata, size_rx, timeout));
+#endif
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size_tx + size_rx, JHAL_DISPATCH(pinstance, _i2c, _write_read)(pinstance, address, ptxdata, size_tx, prxdata, size_rx, timeout));
+}
+
+#endif
+
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_i2c_transmit_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ptxdata  || !size)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size, JHAL_DISPATCH(pinstance, _i2c, _transmit_it)(pinstance, address, ptxdata, size));
+}
+
+uint8_t jhal_i2c_receive_it(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !prxdata || !size)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE_IT, size, JHAL_DISPATCH(pinstance, _i2c, _receive_it)(pinstance, address, prxdata, size));
+}
+
+uint8_t jhal_i2c_write_read_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ptxdata || !size_tx || !prxdata || !size_rx)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_IT, size_tx + size_rx);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_IT, size_tx + size_rx, JHAL_DISPATCH(pinstance, _i2c, _write_read_it)(pinstance, address, ptxdata, size_tx, prxdata, size_rx));
+}
+
+uint8_t jhal_i2c_transmit_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ptxdata  || !size || !pinstance_dma)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT_DMA, size, JHAL_DISPATCH(pinstance, _i2c, _transmit_dma)(pinstance, address, ptxdata, size, pinstance_dma));
+}
+
+uint8_t jhal_i2c_receive_dma(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !prxdata || !size || !pinstance_dma)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size, JHAL_DISPATCH(pinstance, _i2c, _receive_dma)(pinstance, address, prxdata, size, pinstance_dma));
+}
+
+uint8_t jhal_i2c_write_read_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, void* pinstance_dma)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ptxdata || !size_tx || !prxdata || !size_rx || !pinstance_dma)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_DMA, size_tx + size_rx);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_DMA, size_tx + size_rx, JHAL_DISPATCH(pinstance, _i2c, _write_read_dma)(pinstance, address, ptxdata, size_tx, prxdata, size_rx, pinstance_dma));
+}
+#endif
+
+#if (USE_JHAL_DEFER == 1)
+static void prv_i2c_defer_dispatch(const jhal_defer_event* pevent)
+{
+  i2c_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pevent->pinstance, i2c_callback_instance);
+  void* puser_data = JHAL_GET_USERDATA(pevent->pinstance);
+  
+  switch(pevent->type)
+  {
+    case I2C_OPERATION_TX:
+      pcallbacks->pfunc_tx_complete(puser_data);
+      break;
+    case I2C_OPERATION_RX:
+      pcallbacks->pfunc_rx_complete(puser_data, pevent->pdata, pevent->size);
+      break;
+    case I2C_OPERATION_WRITE_READ:
+      pcallbacks->pfunc_write_read_complete(puser_data, pevent->pdata, pevent->size);
+      break;
+    case I2C_OPERATION_ERROR:
+      pcallbacks->pfunc_error(puser_data, pevent->value);
+      break;
+  }
+}
+#endif
+
+void jhal_i2c_tx_complete_callback(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  i2c_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, i2c_callback_instance);
+  
+#if (USE_JHAL_OS == 1)
+  if(jhal_os_blocking_complete(&pcallbacks->blocking))
+    return;
+#endif
+  
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TX_COMPLETE, 0);
+  
+#if (USE_JHAL_QUEUE == 1)
+  if(pcallbacks->pqueue)
+  {
+    jhal_request_queue_complete(pcallbacks->pqueue, JHAL_RES_NO_ERRORS);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_tx_complete && JHAL_DEFER_POST(pinstance, prv_i2c_defer_dispatch, I2C_OPERATION_TX, 0, NULL, 0))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_tx_complete)
+    pcallbacks->pfunc_tx_complete(JHAL_GET_USERDATA(pinstance));
+}
+
+void jhal_i2c_rx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && prxdata && size);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  i2c_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, i2c_callback_instance);
+  
+#if (USE_JHAL_OS == 1)
+  if(jhal_os_blocking_complete(&pcallbacks->blocking))
+    return;
+#endif
+  
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RX_COMPLETE, size);
+  
+#if (USE_JHAL_QUEUE == 1)
+  if(pcallbacks->pqueue)
+  {
+    jhal_request_queue_complete(pcallbacks->pqueue, JHAL_RES_NO_ERRORS);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_rx_complete && JHAL_DEFER_POST(pinstance, prv_i2c_defer_dispatch, I2C_OPERATION_RX, 0, prxdata, size))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_rx_complete)
+    pcallbacks->pfunc_rx_complete(JHAL_GET_USERDATA(pinstance), prxdata, size);
+}
+
+void jhal_i2c_write_read_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && prxdata && size);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  i2c_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, i2c_callback_instance);
+  
+#if (USE_JHAL_OS == 1)
+  if(jhal_os_blocking_complete(&pcallbacks->blocking))
+    return;
+#endif
+  
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TXRX_COMPLETE, size);
+  
+#if (USE_JHAL_QUEUE == 1)
+  if(pcallbacks->pqueue)
+  {
+    jhal_request_queue_complete(pcallbacks->pqueue, JHAL_RES_NO_ERRORS);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_write_read_complete && JHAL_DEFER_POST(pinstance, prv_i2c_defer_dispatch, I2C_OPERATION_WRITE_READ, 0, prxdata, size))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_write_read_complete)
+    pcallbacks->pfunc_write_read_complete(JHAL_GET_USERDATA(pinstance), prxdata, size);
+}
+
+/* Ends the transfer in progress, the env has released the bus before the call */
+void jhal_i2c_error_callback(void* pinstance, uint8_t error)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && error);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  i2c_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, i2c_callback_instance);
+  
+#if (USE_JHAL_OS == 1)
+  pcallbacks->error = error;
+  if(jhal_os_blocking_complete(&pcallbacks->blocking))
+    return;
+#endif
+  
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_ERROR, error);
+  
+#if (USE_JHAL_QUEUE == 1)
+  if(pcallbacks->pqueue)
+  {
+    jhal_request_queue_complete(pcallbacks->pqueue, JHAL_RES_ERROR);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_error && JHAL_DEFER_POST(pinstance, prv_i2c_defer_dispatch, I2C_OPERATION_ERROR, error, NULL, 0))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_error)
+    pcallbacks->pfunc_error(JHAL_GET_USERDATA(pinstance), error);
+}
+
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_i2c_get_stats(void* pinstance, jhal_stats* pstats)
+{
+  return jhal_stats_get(pinstance, pstats);
+}
+
+uint8_t jhal_i2c_reset_stats(void* pinstance)
+{
+  return jhal_stats_reset(pinstance);
+}
+#endif
@@ -0,0 +1,221 @@
+#ifndef __JHAL_I2C__
+#define __JHAL_I2C__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+#include "jhal_os.h"
+#include "jhal_request.h"
+#include "jhal_defer.h"
+#include "jhal_probe.h"
+
+#define JHAL_I2C_ERROR_NACK                     1U
+#define JHAL_I2C_ERROR_BUS                      2U
+#define JHAL_I2C_ERROR_ARBITRATION              3U
+#define JHAL_I2C_ERROR_OVERRUN                  4U
+
+typedef void (*jhal_type_i2c_tx_complete)(void*);
+typedef void (*jhal_type_i2c_rx_complete)(void*, uint8_t* prxdata, uint16_t size);
+typedef void (*jhal_type_i2c_write_read_complete)(void*, uint8_t* prxdata, uint16_t size);
+typedef void (*jhal_type_i2c_error)(void*, uint8_t error);
+
+typedef enum {
+  JHAL_I2C_ADDRESSING_7BIT  = 183U,
+  JHAL_I2C_ADDRESSING_10BIT = 58U
+} jhal_i2c_addressing;
+
+#if (USE_JHAL_OPS == 1)
+typedef struct jhal_i2c_ops_struct jhal_i2c_ops;
+#endif
+
+/* The instance is the bus master, addresses of the calls are the bus
+   addresses of the devices without the R/W bit */
+typedef struct {
+  uint8_t                       num_module;
+  jhal_i2c_addressing           addressing;
+  uint32_t                      clock_speed;
+  
+  jhal_type_i2c_tx_complete     pfunc_tx_complete;
+  jhal_type_i2c_rx_complete     pfunc_rx_complete;
+  jhal_type_i2c_write_read_complete pfunc_write_read_complete;
+  jhal_type_i2c_error           pfunc_error;
+  void*                         plib_data;
+  void*                         puser_data;
+#if (USE_JHAL_OPS == 1)
+  const jhal_i2c_ops*           pops;
+#endif
+} jhal_i2c_params;
+
+
+typedef struct {
+  jhal_type_i2c_tx_complete     pfunc_tx_complete;
+  jhal_type_i2c_rx_complete     pfunc_rx_complete;
+  jhal_type_i2c_write_read_complete pfunc_write_read_complete;
+  jhal_type_i2c_error           pfunc_error;
+#if (USE_JHAL_OS == 1)
+  jhal_os_blocking              blocking;
+  volatile uint8_t              error;
+#endif
+#if (USE_JHAL_QUEUE == 1)
+  jhal_request_queue*           pqueue;
+#endif
+} i2c_callback_instance;
+
+#define JHAL_I2C_SIZE_STATIC                     JHAL_DRIVER_SIZE_STATIC(JHAL_I2C_SIZE_DRV_STATIC, sizeof(i2c_callback_instance))
+#define JHAL_I2C_DECLARE_STATIC(NAME)            JHAL_DECLARE_STATIC_MEM(NAME, JHAL_I2C_SIZE_STATIC)
+#if (USE_JHAL_MEM_LINKED == 1)
+#define JHAL_I2C_DECLARE_INSTANCE(NAME)          JHAL_DECLARE_INSTANCE(NAME, JHAL_I2C_SIZE_STATIC, I2C)
+JHAL_MEM_SLOTS_DECLARE(I2C);
+#endif
+
+#if (USE_JHAL_OPS == 1)
+struct jhal_i2c_ops_struct {
+  uint32_t (*pfunc_size_drv)(void);
+  uint8_t (*pfunc_init)(void* pinstance, jhal_i2c_params* pparams);
+  uint8_t (*pfunc_deinit)(void* pinstance);
+  uint8_t (*pfunc_transmit)(void* pinstance, uint16_t address, uint8_t* pTxData, uint16_t size, uint32_t timeout);
+  uint8_t (*pfunc_receive)(void* pinstance, uint16_t address, uint8_t* pRxData, uint16_t size, uint32_t timeout);
+  uint8_t (*pfunc_write_read)(void* pinstance, uint16_t address, uint8_t* pTxData, uint16_t size_tx, uint8_t* pRxData, uint16_t size_rx, uint32_t timeout);
+  uint8_t (*pfunc_transmit_it)(void* pinstance, uint16_t address, uint8_t* pTxData, uint16_t size);
+  uint8_t (*pfunc_receive_it)(void* pinstance, uint16_t address, uint8_t* pRxData, uint16_t size);
+  uint8_t (*pfunc_write_read_it)(void* pinstance, uint16_t address, uint8_t* pTxData, uint16_t size_tx, uint8_t* pRxData, uint16_t size_rx);
+  uint8_t (*pfunc_transmit_dma)(void* pinstance, uint16_t address, uint8_t* pTxData, uint16_t size, void* pinstance_dma);
+  uint8_t (*pfunc_receive_dma)(void* pinstance, uint16_t address, uint8_t* pRxData, uint16_t size, void* pinstance_dma);
+  uint8_t (*pfunc_write_read_dma)(void* pinstance, uint16_t address, uint8_t* pTxData, uint16_t size_tx, uint8_t* pRxData, uint16_t size_rx, void* pinstance_dma);
+  uint8_t (*pfunc_abort)(void* pinstance);
+};
+
+extern const jhal_i2c_ops jhal_i2c_ops_default;
+
+#define JHAL_I2C_OPS_DECLARE(NAME, ENV)   const jhal_i2c_ops NAME = {\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_size_drv),\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_init),\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_deinit),\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_transmit),\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_receive),\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_write_read),\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_transmit_it),\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_receive_it),\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_write_read_it),\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_transmit_dma),\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_receive_dma),\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_write_read_dma),\
+        JHAL_FUNCTION_NAME(ENV,_i2c,_abort)}
+#define JHAL_I2C_SIZE_STATIC_BY_ENV(ENV)  JHAL_DRIVER_SIZE_STATIC(JHAL_FUNCTION_NAME(ENV,_i2c,_size_drv_static), sizeof(i2c_callback_instance))
+#endif
+
+uint8_t jhal_i2c_init(void** ppinstance, jhal_i2c_params* pparams_i2c);
+uint8_t jhal_i2c_init_static(void** ppinstance, jhal_i2c_params* pparams_i2c, void* pmem, uint32_t size_mem);
+uint8_t jhal_i2c_deinit(void* pinstance);
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_i2c_get_stats(void* pinstance, jhal_stats* pstats);
+uint8_t jhal_i2c_reset_stats(void* pinstance);
+#endif
+uint8_t jhal_i2c_abort(void* pinstance);
+#if (USE_JHAL_QUEUE == 1)
+uint8_t jhal_i2c_queue_attach(void* pinstance, jhal_request_queue* pqueue);
+#endif
+/* write_read sends ptxdata (e.g. a register address) and reads prxdata after
+   a repeated start, the bus is not released between the two parts */
+#if (USE_JHAL_INLINE == 0) || (USE_JHAL_OS == 1)
+uint8_t jhal_i2c_transmit(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+uint8_t jhal_i2c_receive(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t jhal_i2c_write_read(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, uint32_t timeout);
+#endif
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_i2c_transmit_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size);
+uint8_t jhal_i2c_receive_it(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size);
+uint8_t jhal_i2c_write_read_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx);
+uint8_t jhal_i2c_transmit_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+uint8_t jhal_i2c_receive_dma(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t jhal_i2c_write_read_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, void* pinstance_dma);
+#endif
+
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+  #define jhal_i2c_init(PPINSTANCE, PPARAMS)    JHAL_MEM_CALL_SITE((jhal_i2c_init)(PPINSTANCE, PPARAMS))
+#endif
+
+/* An IT or DMA transfer ends with one of the completions or with the error
+   callback, e.g. JHAL_I2C_ERROR_NACK when the device does not answer */
+void jhal_i2c_tx_complete_callback(void* pinstance);
+void jhal_i2c_rx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size);
+void jhal_i2c_write_read_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size);
+void jhal_i2c_error_callback(void* pinstance, uint8_t error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#include JHAL_I2C_INCLUDE_NAME
+
+#if (USE_JHAL_INLINE == 1)
+#if (USE_JHAL_OS == 0)
+static inline uint8_t jhal_i2c_transmit(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT, size, JHAL_DISPATCH(pinstance, _i2c, _transmit)(pinstance, address, ptxdata, size, timeout));
+}
+
+static inline uint8_t jhal_i2c_receive(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE, size, JHAL_DISPATCH(pinstance, _i2c, _receive)(pinstance, address, prxdata, size, timeout));
+}
+
+static inline uint8_t jhal_i2c_write_read(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, uint32_t timeout)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size_tx + size_rx);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size_tx + size_rx, JHAL_DISPATCH(pinstance, _i2c, _write_read)(pinstance, address, ptxdata, size_tx, prxdata, size_rx, timeout));
+}
+
+#endif
+
+static inline uint8_t jhal_i2c_transmit_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size, JHAL_DISPATCH(pinstance, _i2c, _transmit_it)(pinstance, address, ptxdata, size));
+}
+
+static inline uint8_t jhal_i2c_receive_it(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE_IT, size, JHAL_DISPATCH(pinstance, _i2c, _receive_it)(pinstance, address, prxdata, size));
+}
+
+static inline uint8_t jhal_i2c_write_read_it(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_IT, size_tx + size_rx);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_IT, size_tx + size_rx, JHAL_DISPATCH(pinstance, _i2c, _write_read_it)(pinstance, address, ptxdata, size_tx, prxdata, size_rx));
+}
+
+static inline uint8_t jhal_i2c_transmit_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMIT_DMA, size, JHAL_DISPATCH(pinstance, _i2c, _transmit_dma)(pinstance, address, ptxdata, size, pinstance_dma));
+}
+
+static inline uint8_t jhal_i2c_receive_dma(void* pinstance, uint16_t address, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size, JHAL_DISPATCH(pinstance, _i2c, _receive_dma)(pinstance, address, prxdata, size, pinstance_dma));
+}
+
+static inline uint8_t jhal_i2c_write_read_dma(void* pinstance, uint16_t address, uint8_t* ptxdata, uint16_t size_tx, uint8_t* prxdata, uint16_t size_rx, void* pinstance_dma)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, i2c_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_DMA, size_tx + size_rx);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_I2C, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_DMA, size_tx + size_rx, JHAL_DISPATCH(pinstance, _i2c, _write_read_dma)(pinstance, address, ptxdata, size_tx, prxdata, size_rx, pinstance_dma));
+}
+#endif
+
+#endif
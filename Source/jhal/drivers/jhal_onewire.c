@@ -0,0 +1,639 @@
+#include "jhal_onewire.h"
+#include "jhal_tick.h"
+#include JHAL_TICK_INCLUDE_NAME
+
+#if (USE_JHAL_MEM_LINKED == 1)
+JHAL_MEM_SLOTS_DEFINE(ONEWIRE);
+#endif
+
+#define ONEWIRE_OPERATION_RESET         1U
+#define ONEWIRE_OPERATION_TRANSFER      2U
+#define ONEWIRE_OPERATION_ERROR         3U
+
+/* Standard speed slots of the GPIO backend in us */
+#define ONEWIRE_GPIO_RESET_LOW          480U
+#define ONEWIRE_GPIO_PRESENCE_SAMPLE    70U
+#define ONEWIRE_GPIO_RESET_RECOVERY     410U
+#define ONEWIRE_GPIO_SLOT_LOW           6U
+#define ONEWIRE_GPIO_SLOT_SAMPLE        9U
+#define ONEWIRE_GPIO_SLOT_RECOVERY      55U
+#define ONEWIRE_GPIO_WRITE_0_LOW        60U
+#define ONEWIRE_GPIO_WRITE_0_RECOVERY   10U
+
+static void prv_onewire_uart_complete(void* pinstance, uint8_t* prxdata, uint16_t size);
+static void prv_onewire_uart_error(void* pinstance, uint8_t error);
+
+static uint8_t prv_onewire_gpio_init(void** ppgpio, uint64_t* pmem, uint8_t num_module, uint64_t pin, jhal_gpio_mode mode)
+{
+  jhal_gpio_params gpio_params = {0};
+  
+  gpio_params.num_module = num_module;
+  gpio_params.mode = mode;
+  gpio_params.int_type = JHAL_GPIO_INT_TYPE_NOT_SET;
+  gpio_params.pull_type = JHAL_GPIO_PULL_TYPE_NOT_PULL;
+  gpio_params.pins = pin;
+  
+  *ppgpio = NULL;
+  uint8_t res = jhal_gpio_init_static(ppgpio, &gpio_params, pmem, JHAL_GPIO_SIZE_STATIC);
+  
+  /* The bus idles high, the line is only released */
+  if(res == JHAL_RES_NO_ERRORS && mode != JHAL_GPIO_MODE_INPUT)
+    res = jhal_gpio_set(*ppgpio, pin, 1);
+  
+  return res;
+}
+
+static void prv_onewire_backend_deinit(onewire_bus* pbus)
+{
+  if(pbus->backend == JHAL_ONEWIRE_BACKEND_UART)
+  {
+    if(pbus->pline)
+      jhal_uart_deinit(pbus->pline);
+  }
+  else
+  {
+    if(pbus->pline)
+      jhal_gpio_deinit(pbus->pline);
+  
+    if(pbus->pline_rx)
+      jhal_gpio_deinit(pbus->pline_rx);
+  }
+  
+  pbus->pline = NULL;
+  pbus->pline_rx = NULL;
+}
+
+static uint8_t prv_onewire_backend_init(void* pinstance, jhal_onewire_params* pparams)
+{
+  onewire_bus* pbus = (onewire_bus*)pinstance;
+  
+  pbus->backend = pparams->backend;
+  pbus->operation = 0;
+  pbus->speed_slots = 0;
+  pbus->pline = NULL;
+  pbus->pline_rx = NULL;
+  pbus->pin = pparams->pin;
+  pbus->pin_rx = pparams->pin_rx;
+  
+  if(pparams->backend == JHAL_ONEWIRE_BACKEND_UART)
+  {
+    jhal_uart_params uart_params = {0};
+  
+    uart_params.num_module = pparams->num_module;
+    uart_params.baudrate = JHAL_UART_BAUDRATE_9600;
+    uart_params.data_size = JHAL_UART_DATA_SIZE_8BIT;
+    uart_params.stop_bits = JHAL_UART_STOP_BITS_1BIT;
+    uart_params.parity = JHAL_UART_PARITY_NONE;
+    uart_params.hwr_flow_ctrl = JHAL_UART_HWR_FLOW_CTRL_NOT_USE;
+    uart_params.pfunc_txrx_complete = prv_onewire_uart_complete;
+    uart_params.pfunc_error = prv_onewire_uart_error;
+    uart_params.plib_data = pparams->plib_data;
+    uart_params.puser_data = pinstance;
+  
+    return jhal_uart_init_static(&pbus->pline, &uart_params, pbus->mem.uart, sizeof(pbus->mem.uart));
+  }
+  
+  if(pparams->backend != JHAL_ONEWIRE_BACKEND_GPIO || !pparams->pin)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint8_t res = prv_onewire_gpio_init(&pbus->pline, pbus->mem.gpio[0], pparams->num_module, pparams->pin, JHAL_GPIO_MODE_OUTPUT_OPENDRAIN);
+  
+  if(res == JHAL_RES_NO_ERRORS && pparams->pin_rx)
+    res = prv_onewire_gpio_init(&pbus->pline_rx, pbus->mem.gpio[1], pparams->num_module_rx, pparams->pin_rx, JHAL_GPIO_MODE_INPUT);
+  
+  if(res != JHAL_RES_NO_ERRORS)
+    prv_onewire_backend_deinit(pbus);
+  
+  return res;
+}
+
+static uint8_t prv_onewire_init(jhal_driver_instance* pnew_instance, void** ppinstance, jhal_onewire_params* pparams)
+{
+   onewire_callback_instance* pcallbacks = (onewire_callback_instance*)pnew_instance->pfuncs_callbacks;
+   pcallbacks->pfunc_reset_complete = pparams->pfunc_reset_complete;
+   pcallbacks->pfunc_transfer_complete = pparams->pfunc_transfer_complete;
+   pcallbacks->pfunc_error = pparams->pfunc_error;
+   pnew_instance->puser_data = pparams->puser_data;
+#if (USE_JHAL_OPS == 1)
+   pnew_instance->pops = NULL;
+#endif
+  
+   uint8_t res = prv_onewire_backend_init(pnew_instance->pinstance, pparams);
+  
+   if(res == JHAL_RES_NO_ERRORS)
+     *ppinstance = pnew_instance->pinstance;
+   else
+   {
+     *ppinstance = NULL;
+     jhal_driver_free(pnew_instance->pinstance);
+   }
+  
+   return res;
+}
+
+uint8_t (jhal_onewire_init)(void** ppinstance, jhal_onewire_params* pparams)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!ppinstance || *ppinstance || !pparams)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = JHAL_DRIVER_MALLOC(sizeof(onewire_bus), sizeof(onewire_callback_instance), ONEWIRE);
+  
+   if(pnew_instance == NULL)
+     return JHAL_RES_ALLOC_ERROR;
+  
+   return prv_onewire_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_onewire_init_static(void** ppinstance, jhal_onewire_params* pparams, void* pmem, uint32_t size_mem)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!ppinstance || *ppinstance || !pparams || !pmem)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = jhal_driver_place(pmem, size_mem, sizeof(onewire_bus), sizeof(onewire_callback_instance));
+  
+   if(pnew_instance == NULL)
+     return JHAL_RES_ALLOC_ERROR;
+  
+   return prv_onewire_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_onewire_deinit(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  prv_onewire_backend_deinit((onewire_bus*)pinstance);
+  jhal_driver_free(pinstance);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+#if (USE_JHAL_DEFER == 1)
+static void prv_onewire_defer_dispatch(const jhal_defer_event* pevent)
+{
+  onewire_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pevent->pinstance, onewire_callback_instance);
+  void* puser_data = JHAL_GET_USERDATA(pevent->pinstance);
+  
+  switch(pevent->type)
+  {
+    case ONEWIRE_OPERATION_RESET:
+      pcallbacks->pfunc_reset_complete(puser_data, pevent->value);
+      break;
+    case ONEWIRE_OPERATION_TRANSFER:
+      pcallbacks->pfunc_transfer_complete(puser_data, pevent->pdata, pevent->size);
+      break;
+    case ONEWIRE_OPERATION_ERROR:
+      pcallbacks->pfunc_error(puser_data, pevent->value);
+      break;
+  }
+}
+#endif
+
+static void prv_onewire_reset_complete(void* pinstance, uint8_t presence)
+{
+  onewire_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, onewire_callback_instance);
+  
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_TXRX_COMPLETE, 0);
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_reset_complete && JHAL_DEFER_POST(pinstance, prv_onewire_defer_dispatch, ONEWIRE_OPERATION_RESET, presence, NULL, 0))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_reset_complete)
+    pcallbacks->pfunc_reset_complete(JHAL_GET_USERDATA(pinstance), presence);
+}
+
+static void prv_onewire_transfer_complete(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+  onewire_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, onewire_callback_instance);
+  
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_TXRX_COMPLETE, size);
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_transfer_complete && JHAL_DEFER_POST(pinstance, prv_onewire_defer_dispatch, ONEWIRE_OPERATION_TRANSFER, 0, prxdata, size))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_transfer_complete)
+    pcallbacks->pfunc_transfer_complete(JHAL_GET_USERDATA(pinstance), prxdata, size);
+}
+
+static void prv_onewire_error(void* pinstance, uint8_t error)
+{
+  onewire_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, onewire_callback_instance);
+  
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_ERROR, error);
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_error && JHAL_DEFER_POST(pinstance, prv_onewire_defer_dispatch, ONEWIRE_OPERATION_ERROR, error, NULL, 0))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_error)
+    pcallbacks->pfunc_error(JHAL_GET_USERDATA(pinstance), error);
+}
+
+/* UART backend. The baudrate is only switched between the reset and the
+   slots, so a run of transfers after one reset costs no reconfiguration */
+static uint8_t prv_onewire_uart_speed(onewire_bus* pbus, uint8_t speed_slots)
+{
+  if(pbus->speed_slots == speed_slots)
+    return JHAL_RES_NO_ERRORS;
+  
+  uint8_t res = jhal_uart_set_baudrate(pbus->pline, speed_slots ? JHAL_UART_BAUDRATE_115200 : JHAL_UART_BAUDRATE_9600);
+  
+  if(res == JHAL_RES_NO_ERRORS)
+    pbus->speed_slots = speed_slots;
+  
+  return res;
+}
+
+/* Expands the next chunk into one slot frame per bit, returns the frames */
+static uint16_t prv_onewire_uart_encode(onewire_bus* pbus)
+{
+  uint16_t chunk = pbus->size - pbus->done;
+  uint8_t* pslot = pbus->slots;
+  
+  if(chunk > JHAL_ONEWIRE_CHUNK_SIZE)
+    chunk = JHAL_ONEWIRE_CHUNK_SIZE;
+  
+  for(uint16_t i = 0; i < chunk; i++)
+  {
+    uint8_t byte = pbus->ptxdata ? pbus->ptxdata[pbus->done + i] : 0xFF;
+  
+    for(uint8_t j = 0; j < 8; j++, byte >>= 1)
+      *pslot++ = (byte & 1) ? JHAL_ONEWIRE_UART_BIT_1 : JHAL_ONEWIRE_UART_BIT_0;
+  }
+  
+  pbus->chunk = chunk;
+  
+  return (uint16_t)(chunk * 8);
+}
+
+/* A slot reads 1 only if no device pulled the line during the frame */
+static void prv_onewire_uart_decode(onewire_bus* pbus)
+{
+  if(pbus->prxdata)
+  {
+    const uint8_t* pslot = pbus->slots;
+  
+    for(uint16_t i = 0; i < pbus->chunk; i++)
+    {
+      uint8_t byte = 0;
+  
+      for(uint8_t j = 0; j < 8; j++)
+        byte |= (uint8_t)((*pslot++ == JHAL_ONEWIRE_UART_BIT_1) << j);
+  
+      pbus->prxdata[pbus->done + i] = byte;
+    }
+  }
+  
+  pbus->done += pbus->chunk;
+}
+
+static uint8_t prv_onewire_uart_next(onewire_bus* pbus)
+{
+  uint16_t amount = prv_onewire_uart_encode(pbus);
+  
+  if(pbus->pinstance_dma)
+    return jhal_uart_transmitreceive_dma(pbus->pline, pbus->slots, pbus->slots, amount, pbus->pinstance_dma);
+  
+  return jhal_uart_transmitreceive_it(pbus->pline, pbus->slots, pbus->slots, amount);
+}
+
+static void prv_onewire_uart_complete(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+  onewire_bus* pbus = (onewire_bus*)pinstance;
+  (void)prxdata;
+  (void)size;
+  
+  if(pbus->operation == ONEWIRE_OPERATION_RESET)
+  {
+    pbus->operation = 0;
+    prv_onewire_reset_complete(pinstance, pbus->slots[0] != JHAL_ONEWIRE_UART_RESET);
+    return;
+  }
+  
+  if(pbus->operation != ONEWIRE_OPERATION_TRANSFER)
+    return;
+  
+  prv_onewire_uart_decode(pbus);
+  
+  if(pbus->done < pbus->size && prv_onewire_uart_next(pbus) == JHAL_RES_NO_ERRORS)
+    return;
+  
+  pbus->operation = 0;
+  prv_onewire_transfer_complete(pinstance, pbus->prxdata, pbus->done);
+}
+
+/* The slots of a chunk that ended with a line error are lost, the reset or
+   the transfer stops there */
+static void prv_onewire_uart_error(void* pinstance, uint8_t error)
+{
+  onewire_bus* pbus = (onewire_bus*)pinstance;
+  
+  if(!pbus->operation)
+    return;
+  
+  pbus->operation = 0;
+  prv_onewire_error(pinstance, error);
+}
+
+static uint8_t prv_onewire_uart_reset(onewire_bus* pbus, uint8_t* ppresence, uint32_t timeout)
+{
+  uint8_t res = prv_onewire_uart_speed(pbus, 0);
+  
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  pbus->slots[0] = JHAL_ONEWIRE_UART_RESET;
+  res = jhal_uart_transmitreceive(pbus->pline, pbus->slots, pbus->slots, 1, timeout);
+  
+  if(res == JHAL_RES_NO_ERRORS)
+    *ppresence = pbus->slots[0] != JHAL_ONEWIRE_UART_RESET;
+  
+  return res;
+}
+
+/* One deadline for the whole transfer, each chunk gets the time left of it.
+   The UART envs take 0xFFFFFFFF as no timeout, it is passed on as is */
+static uint8_t prv_onewire_uart_transfer(onewire_bus* pbus, uint32_t timeout)
+{
+  uint64_t deadline = jhal_tick_now_us() + (uint64_t)timeout * 1000U;
+  uint8_t res = prv_onewire_uart_speed(pbus, 1);
+  
+  while(res == JHAL_RES_NO_ERRORS && pbus->done < pbus->size)
+  {
+    uint16_t amount = prv_onewire_uart_encode(pbus);
+    uint32_t remaining = timeout;
+  
+    if(timeout != 0xFFFFFFFFU)
+    {
+      uint64_t now = jhal_tick_now_us();
+  
+      if(now >= deadline)
+        return JHAL_RES_TIMEOUT;
+  
+      remaining = (uint32_t)((deadline - now + 999U) / 1000U);
+    }
+  
+    res = jhal_uart_transmitreceive(pbus->pline, pbus->slots, pbus->slots, amount, remaining);
+    if(res == JHAL_RES_NO_ERRORS)
+      prv_onewire_uart_decode(pbus);
+  }
+  
+  return res;
+}
+
+/* GPIO backend. The parts of the slots the device times against the falling
+   edge run with the interrupts masked, the recoveries do not */
+static uint8_t prv_onewire_gpio_read(onewire_bus* pbus)
+{
+  uint8_t value = 0;
+  
+  if(pbus->pline_rx)
+    jhal_gpio_get(pbus->pline_rx, pbus->pin_rx, &value);
+  else
+    jhal_gpio_get(pbus->pline, pbus->pin, &value);
+  
+  return value;
+}
+
+static uint8_t prv_onewire_gpio_reset(onewire_bus* pbus)
+{
+  jhal_gpio_set(pbus->pline, pbus->pin, 0);
+  jhal_tick(ONEWIRE_GPIO_RESET_LOW);
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  jhal_gpio_set(pbus->pline, pbus->pin, 1);
+  jhal_tick(ONEWIRE_GPIO_PRESENCE_SAMPLE);
+  uint8_t presence = !prv_onewire_gpio_read(pbus);
+  JHAL_CRITICAL_EXIT(state);
+  
+  jhal_tick(ONEWIRE_GPIO_RESET_RECOVERY);
+  
+  return presence;
+}
+
+/* A 1 is written by a short low pulse, which is also the read slot */
+static uint8_t prv_onewire_gpio_slot(onewire_bus* pbus, uint8_t bit)
+{
+  uint8_t value = 0;
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  
+  jhal_gpio_set(pbus->pline, pbus->pin, 0);
+  
+  if(bit)
+  {
+    jhal_tick(ONEWIRE_GPIO_SLOT_LOW);
+    jhal_gpio_set(pbus->pline, pbus->pin, 1);
+    jhal_tick(ONEWIRE_GPIO_SLOT_SAMPLE);
+    value = prv_onewire_gpio_read(pbus);
+    JHAL_CRITICAL_EXIT(state);
+    jhal_tick(ONEWIRE_GPIO_SLOT_RECOVERY);
+  }
+  else
+  {
+    jhal_tick(ONEWIRE_GPIO_WRITE_0_LOW);
+    jhal_gpio_set(pbus->pline, pbus->pin, 1);
+    JHAL_CRITICAL_EXIT(state);
+    jhal_tick(ONEWIRE_GPIO_WRITE_0_RECOVERY);
+  }
+  
+  return value;
+}
+
+static void prv_onewire_gpio_transfer(onewire_bus* pbus)
+{
+  for(; pbus->done < pbus->size; pbus->done++)
+  {
+    uint8_t txbyte = pbus->ptxdata ? pbus->ptxdata[pbus->done] : 0xFF;
+    uint8_t rxbyte = 0;
+  
+    for(uint8_t j = 0; j < 8; j++)
+      rxbyte |= (uint8_t)(prv_onewire_gpio_slot(pbus, (txbyte >> j) & 1) << j);
+  
+    if(pbus->prxdata)
+      pbus->prxdata[pbus->done] = rxbyte;
+  }
+}
+
+static uint8_t prv_onewire_start(onewire_bus* pbus, uint8_t operation, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  if(pbus->operation)
+    return JHAL_RES_ERROR;
+  
+  pbus->operation = operation;
+  pbus->ptxdata = ptxdata;
+  pbus->prxdata = prxdata;
+  pbus->size = size;
+  pbus->done = 0;
+  pbus->pinstance_dma = pinstance_dma;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_onewire_reset(void* pinstance, uint8_t* ppresence, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ppresence || !timeout)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  onewire_bus* pbus = (onewire_bus*)pinstance;
+  
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_RESET, 0);
+  
+  uint8_t res = prv_onewire_start(pbus, ONEWIRE_OPERATION_RESET, NULL, NULL, 0, NULL);
+  
+  if(res == JHAL_RES_NO_ERRORS)
+  {
+    if(pbus->backend == JHAL_ONEWIRE_BACKEND_UART)
+      res = prv_onewire_uart_reset(pbus, ppresence, timeout);
+    else
+      *ppresence = prv_onewire_gpio_reset(pbus);
+  
+    pbus->operation = 0;
+  }
+  
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_RESET, 0, res);
+}
+
+uint8_t jhal_onewire_transfer(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !size || !timeout)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  onewire_bus* pbus = (onewire_bus*)pinstance;
+  
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size);
+  
+  uint8_t res = prv_onewire_start(pbus, ONEWIRE_OPERATION_TRANSFER, ptxdata, prxdata, size, NULL);
+  
+  if(res == JHAL_RES_NO_ERRORS)
+  {
+    if(pbus->backend == JHAL_ONEWIRE_BACKEND_UART)
+      res = prv_onewire_uart_transfer(pbus, timeout);
+    else
+      prv_onewire_gpio_transfer(pbus);
+  
+    pbus->operation = 0;
+  }
+  
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size, res);
+}
+
+static uint8_t prv_onewire_reset_async(void* pinstance)
+{
+  onewire_bus* pbus = (onewire_bus*)pinstance;
+  uint8_t res = prv_onewire_start(pbus, ONEWIRE_OPERATION_RESET, NULL, NULL, 0, NULL);
+  
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  /* There is no interrupt source for the GPIO backend, the slots are run in
+     place and the callback is called before return */
+  if(pbus->backend == JHAL_ONEWIRE_BACKEND_GPIO)
+  {
+    uint8_t presence = prv_onewire_gpio_reset(pbus);
+  
+    pbus->operation = 0;
+    prv_onewire_reset_complete(pinstance, presence);
+  
+    return JHAL_RES_NO_ERRORS;
+  }
+  
+  res = prv_onewire_uart_speed(pbus, 0);
+  
+  if(res == JHAL_RES_NO_ERRORS)
+  {
+    pbus->slots[0] = JHAL_ONEWIRE_UART_RESET;
+    res = jhal_uart_transmitreceive_it(pbus->pline, pbus->slots, pbus->slots, 1);
+  }
+  
+  if(res != JHAL_RES_NO_ERRORS)
+    pbus->operation = 0;
+  
+  return res;
+}
+
+static uint8_t prv_onewire_transfer_async(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  onewire_bus* pbus = (onewire_bus*)pinstance;
+  
+  if(pbus->backend == JHAL_ONEWIRE_BACKEND_GPIO && pinstance_dma)
+    return JHAL_RES_NOT_SUPPORTED;
+  
+  uint8_t res = prv_onewire_start(pbus, ONEWIRE_OPERATION_TRANSFER, ptxdata, prxdata, size, pinstance_dma);
+  
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  if(pbus->backend == JHAL_ONEWIRE_BACKEND_GPIO)
+  {
+    prv_onewire_gpio_transfer(pbus);
+    pbus->operation = 0;
+    prv_onewire_transfer_complete(pinstance, prxdata, size);
+  
+    return JHAL_RES_NO_ERRORS;
+  }
+  
+  res = prv_onewire_uart_speed(pbus, 1);
+  
+  if(res == JHAL_RES_NO_ERRORS)
+    res = prv_onewire_uart_next(pbus);
+  
+  if(res != JHAL_RES_NO_ERRORS)
+    pbus->operation = 0;
+  
+  return res;
+}
+
+uint8_t jhal_onewire_reset_it(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_RESET_IT, 0);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_RESET_IT, 0, prv_onewire_reset_async(pinstance));
+}
+
+uint8_t jhal_onewire_transfer_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !size)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_IT, size, prv_onewire_transfer_async(pinstance, ptxdata, prxdata, size, NULL));
+}
+
+uint8_t jhal_onewire_transfer_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !size || !pinstance_dma)
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_ONEWIRE, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_DMA, size, prv_onewire_transfer_async(pinstance, ptxdata, prxdata, size, pinstance_dma));
+}
+
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_onewire_get_stats(void* pinstance, jhal_stats* pstats)
+{
+  return jhal_stats_get(pinstance, pstats);
+}
+
+uint8_t jhal_onewire_reset_stats(void* pinstance)
+{
+  return jhal_stats_reset(pinstance);
+}
+#endif
@@ -0,0 +1,125 @@
+#ifndef __JHAL_ONEWIRE__
+#define __JHAL_ONEWIRE__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+  
+#include "jhal_environment.h"
+#include "jhal_defer.h"
+#include "jhal_probe.h"
+#include "jhal_uart.h"
+#include "jhal_gpio.h"
+  
+/* UART frames that make up the 1-Wire slots: the reset pulse and the presence
+   window fit in one 0xF0 frame at 9600 baud, a bit slot is one frame at 115200
+   baud, 0xFF drives a 1 (and reads the line), 0x00 drives a 0 */
+#define JHAL_ONEWIRE_UART_RESET                 0xF0U
+#define JHAL_ONEWIRE_UART_BIT_1                 0xFFU
+#define JHAL_ONEWIRE_UART_BIT_0                 0x00U
+#define JHAL_ONEWIRE_SLOTS_SIZE                 (8U * JHAL_ONEWIRE_CHUNK_SIZE)
+  
+typedef void (*jhal_type_onewire_reset_complete)(void*, uint8_t presence);
+typedef void (*jhal_type_onewire_transfer_complete)(void*, uint8_t* prxdata, uint16_t size);
+typedef void (*jhal_type_onewire_error)(void*, uint8_t error);
+  
+typedef enum {
+  JHAL_ONEWIRE_BACKEND_UART             = 71U,
+  JHAL_ONEWIRE_BACKEND_GPIO             = 198U
+} jhal_onewire_backend;
+  
+/* JHAL_ONEWIRE_BACKEND_UART: num_module is a UART with TX and RX tied to the
+   bus (half-duplex or open-drain TX, set up by plib_data of the UART env), the
+   slots are shifted by the UART and the CPU only runs once per transfer chunk.
+   JHAL_ONEWIRE_BACKEND_GPIO: the fallback for parts without a free UART, pin of
+   gpio module num_module is driven open-drain and the slots are timed by
+   jhal_tick with the interrupts masked during the timing-critical part of each
+   slot. pin_rx of num_module_rx is the input for buses with a separate receive
+   line, pin_rx = 0 reads the bus back through pin */
+typedef struct {
+  jhal_onewire_backend                  backend;
+  uint8_t                               num_module;
+  uint64_t                              pin;
+  uint8_t                               num_module_rx;
+  uint64_t                              pin_rx;
+  
+  jhal_type_onewire_reset_complete      pfunc_reset_complete;
+  jhal_type_onewire_transfer_complete   pfunc_transfer_complete;
+  jhal_type_onewire_error               pfunc_error;
+  void*                                 plib_data;
+  void*                                 puser_data;
+} jhal_onewire_params;
+  
+#define JHAL_ONEWIRE_SIZE_UART          ((JHAL_UART_SIZE_STATIC + sizeof(uint64_t) - 1) / sizeof(uint64_t))
+#define JHAL_ONEWIRE_SIZE_GPIO          ((JHAL_GPIO_SIZE_STATIC + sizeof(uint64_t) - 1) / sizeof(uint64_t))
+  
+typedef struct {
+  jhal_onewire_backend                  backend;
+  uint8_t                               operation;
+  uint8_t                               speed_slots;
+  void*                                 pline;
+  void*                                 pline_rx;
+  uint64_t                              pin;
+  uint64_t                              pin_rx;
+  uint8_t*                              ptxdata;
+  uint8_t*                              prxdata;
+  uint16_t                              size;
+  uint16_t                              done;
+  uint16_t                              chunk;
+  void*                                 pinstance_dma;
+  uint8_t                               slots[JHAL_ONEWIRE_SLOTS_SIZE];
+  union {
+    uint64_t                            uart[JHAL_ONEWIRE_SIZE_UART];
+    uint64_t                            gpio[2][JHAL_ONEWIRE_SIZE_GPIO];
+  } mem;
+} onewire_bus;
+  
+typedef struct {
+  jhal_type_onewire_reset_complete      pfunc_reset_complete;
+  jhal_type_onewire_transfer_complete   pfunc_transfer_complete;
+  jhal_type_onewire_error               pfunc_error;
+} onewire_callback_instance;
+  
+#define JHAL_ONEWIRE_SIZE_STATIC                JHAL_DRIVER_SIZE_STATIC(sizeof(onewire_bus), sizeof(onewire_callback_instance))
+#define JHAL_ONEWIRE_DECLARE_STATIC(NAME)       JHAL_DECLARE_STATIC_MEM(NAME, JHAL_ONEWIRE_SIZE_STATIC)
+#if (USE_JHAL_MEM_LINKED == 1)
+#define JHAL_ONEWIRE_DECLARE_INSTANCE(NAME)     JHAL_DECLARE_INSTANCE(NAME, JHAL_ONEWIRE_SIZE_STATIC, ONEWIRE)
+JHAL_MEM_SLOTS_DECLARE(ONEWIRE);
+#endif
+  
+uint8_t jhal_onewire_init(void** ppinstance, jhal_onewire_params* pparams);
+uint8_t jhal_onewire_init_static(void** ppinstance, jhal_onewire_params* pparams, void* pmem, uint32_t size_mem);
+uint8_t jhal_onewire_deinit(void* pinstance);
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_onewire_get_stats(void* pinstance, jhal_stats* pstats);
+uint8_t jhal_onewire_reset_stats(void* pinstance);
+#endif
+  
+/* reset sends the reset pulse and reports whether any device answered with a
+   presence pulse. transfer runs size bytes LSB first, ptxdata = NULL sends the
+   read slots (all ones), prxdata = NULL drops what is read. The IT and DMA
+   variants report through the callbacks, long transfers are split into chunks
+   of JHAL_ONEWIRE_CHUNK_SIZE bytes that are chained from the completion of
+   the previous one; a chunk that fails to start ends the transfer, which is
+   reported with the amount of bytes done. A line error of the UART ends the
+   reset or the transfer through the error callback with the JHAL_UART_ERROR_*
+   code instead, the blocking variants return JHAL_RES_ERROR then. timeout of
+   the blocking transfer in ms covers all of its chunks. The GPIO backend has no
+   interrupt source and no DMA variant: its IT variants block like the blocking
+   ones, about 1 ms for a reset and 0.6 ms per byte, the callback is called
+   before they return, so they are not for the interrupts */
+uint8_t jhal_onewire_reset(void* pinstance, uint8_t* ppresence, uint32_t timeout);
+uint8_t jhal_onewire_transfer(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t jhal_onewire_reset_it(void* pinstance);
+uint8_t jhal_onewire_transfer_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
+uint8_t jhal_onewire_transfer_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+  
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+  #define jhal_onewire_init(PPINSTANCE, PPARAMS)        JHAL_MEM_CALL_SITE((jhal_onewire_init)(PPINSTANCE, PPARAMS))
+#endif
+  
+#ifdef __cplusplus
+}
+#endif
+
+#endif
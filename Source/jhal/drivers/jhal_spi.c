@@ -1,317 +1,868 @@
-#include "jhal_spi.h"
-#include JHAL_SPI_INCLUDE_NAME
-
-struct _instance_list{
-  void*                         puser_data;
-  jhal_type_spi_tx_complete     pfunc_tx_complete;
-  jhal_type_spi_rx_complete     pfunc_rx_complete;
-  jhal_type_spi_txrx_complete   pfunc_txrx_complete;
-  struct _instance_list*        pnext;
-  struct _instance_list*        pprev;
-  void*                         pinstance;  
-};
-
-typedef struct _instance_list instance_list;
-
-static instance_list* plist_top = NULL;
-
-__WEAK uint8_t JHAL_SPI_INIT(void* pinstance, jhal_spi_params* pparams)
-{
-  (void)pinstance;
-  (void)pparams;  
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_SPI_DEINIT(void* pinstance)
-{
-  (void)pinstance;
-  
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_SPI_TRANSMIT(void* pinstance, uint8_t* pTxData, uint16_t size, uint32_t timeout)
-{
-  (void)pinstance;
-  (void)pTxData;
-  (void)size;
-  (void)timeout;
-  
-  return JHAL_RES_NOT_SUPPORTED;  
-}
-
-__WEAK uint8_t JHAL_SPI_RECEIVE(void* pinstance, uint8_t* pRxData, uint16_t size, uint32_t timeout)
-{
-  (void)pinstance;
-  (void)pRxData;
-  (void)size;
-  (void)timeout;
-  
-  return JHAL_RES_NOT_SUPPORTED;  
-}
-
-__WEAK uint8_t JHAL_SPI_TRANSMITRECEIVE(void* pinstance, uint8_t* pTxData, uint8_t* pRxData, uint16_t size, uint32_t timeout)
-{
-  (void)pinstance;
-  (void)pTxData;
-  (void)pRxData;
-  (void)size;
-  (void)timeout;
-  
-  return JHAL_RES_NOT_SUPPORTED;  
-}
-
-__WEAK uint8_t JHAL_SPI_TRANSMIT_IT(void* pinstance, uint8_t* pTxData, uint16_t size)
-{
-  (void)pinstance;
-  (void)pTxData;
-  (void)size;
-  
-  return JHAL_RES_NOT_SUPPORTED;  
-}
-
-__WEAK uint8_t JHAL_SPI_RECEIVE_IT(void* pinstance, uint8_t* pRxData, uint16_t size)
-{
-  (void)pinstance;
-  (void)pRxData;
-  (void)size;
-  
-  return JHAL_RES_NOT_SUPPORTED;  
-}
-
-__WEAK uint8_t JHAL_SPI_TRANSMITRECEIVE_IT(void* pinstance, uint8_t* pTxData, uint8_t* pRxData, uint16_t size)
-{
-  (void)pinstance;
-  (void)pTxData;
-  (void)pRxData;
-  (void)size;
-  
-  return JHAL_RES_NOT_SUPPORTED;  
-}
-
-__WEAK uint8_t JHAL_SPI_TRANSMIT_DMA(void* pinstance, uint8_t* pTxData, uint16_t size, void* pinstance_dma)
-{
-  (void)pinstance;
-  (void)pTxData;
-  (void)size;
-  (void)pinstance_dma;
-  
-  return JHAL_RES_NOT_SUPPORTED;  
-}
-
-__WEAK uint8_t JHAL_SPI_RECEIVE_DMA(void* pinstance, uint8_t* pRxData, uint16_t size, void* pinstance_dma)
-{
-  (void)pinstance;
-  (void)pRxData;
-  (void)size;
-  (void)pinstance_dma;
-  
-  return JHAL_RES_NOT_SUPPORTED;  
-}
-
-__WEAK uint8_t JHAL_SPI_TRANSMITRECEIVE_DMA(void* pinstance, uint8_t* pTxData, uint8_t* pRxData, uint16_t size, void* pinstance_dma)
-{
-  (void)pinstance;
-  (void)pTxData;
-  (void)pRxData;
-  (void)size;
-  (void)pinstance_dma;
-  
-  return JHAL_RES_NOT_SUPPORTED;  
-}
-
-
-uint8_t jhal_spi_init(void** ppinstance, jhal_spi_params* pparams)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)       
-   if(!ppinstance || *ppinstance || !pparams) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   instance_list* plist_new = (instance_list*)jhal_malloc(JHAL_SPI_SIZE_DRV + sizeof(instance_list));
-   
-   if(plist_new == NULL)  
-     return JHAL_RES_ALLOC_ERROR;
-   
-   plist_new->pfunc_tx_complete = pparams->pfunc_tx_complete;
-   plist_new->pfunc_rx_complete = pparams->pfunc_rx_complete;
-   plist_new->pfunc_txrx_complete = pparams->pfunc_txrx_complete;
-   plist_new->puser_data = pparams->puser_data;
-   
-   uint8_t res = JHAL_SPI_INIT(plist_new->pinstance, pparams); 
-   
-   if(res == JHAL_RES_NO_ERRORS)
-   {
-     JHAL_DRV_ITEM_ADD(plist_new);
-       
-     *ppinstance = plist_new->pinstance;
-   } else 
-   {
-     *ppinstance = NULL;
-     jhal_free(plist_new);
-   } 
-  
-  return res;     
-}
-
-uint8_t jhal_spi_deinit(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-  instance_list* plist = plist_top;
-  while(plist != NULL)
-  {
-    if(plist->pinstance == pinstance)
-      break;
-
-    plist = plist->pnext;
-  }
-  
-  if(plist == NULL)
-    return JHAL_RES_INVALID_PARAMS;
-  
-  JHAL_DRV_ITEM_DELETE(plist);
-      
-  jhal_free(pinstance); 
-  
-  return JHAL_SPI_DEINIT(pinstance);
-}
-
-uint8_t jhal_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !ptxdata  || !size || !timeout) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-  return JHAL_SPI_TRANSMIT(pinstance, ptxdata, size, timeout);
-}
-
-uint8_t jhal_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !prxdata || !size || !timeout) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif  
-  return JHAL_SPI_RECEIVE(pinstance, prxdata, size, timeout);
-}
-
-uint8_t jhal_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !ptxdata || !prxdata || !size || !timeout) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif    
-  return JHAL_SPI_TRANSMITRECEIVE(pinstance, ptxdata, prxdata, size, timeout);
-}
-
-uint8_t jhal_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !ptxdata  || !size) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-  return JHAL_SPI_TRANSMIT_IT(pinstance, ptxdata, size);
-}
-
-uint8_t jhal_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !prxdata || !size) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif  
-  return JHAL_SPI_RECEIVE_IT(pinstance, prxdata, size);
-}
-
-uint8_t jhal_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !ptxdata || !prxdata || !size) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif    
-  return JHAL_SPI_TRANSMITRECEIVE_IT(pinstance, ptxdata, prxdata, size);
-}
-
-uint8_t jhal_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !ptxdata  || !size || !pinstance_dma) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-  return JHAL_SPI_TRANSMIT_DMA(pinstance, ptxdata, size, pinstance_dma);
-}
-
-uint8_t jhal_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !prxdata || !size || !pinstance_dma)
-     return JHAL_RES_INVALID_PARAMS;
-#endif  
-  return JHAL_SPI_RECEIVE_DMA(pinstance, prxdata, size, pinstance_dma);
-}
-
-uint8_t jhal_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !ptxdata || !prxdata || !size || !pinstance_dma) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif    
-  return JHAL_SPI_TRANSMITRECEIVE_DMA(pinstance, ptxdata, prxdata, size, pinstance_dma);
-}
-
-void jhal_spi_tx_complete_callback(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-  JHAL_ASSERT(pinstance);  
-#endif
-  instance_list* plist = plist_top;
-  while(plist != NULL)
-  {
-    if(plist->pinstance == pinstance)
-    {
-      if(plist->pfunc_tx_complete)
-        plist->pfunc_tx_complete(plist->puser_data);
-      
-      break;
-    }
-    plist = plist->pnext;
-  }   
-}
-
-void jhal_spi_rx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-  JHAL_ASSERT(pinstance && prxdata && size);
-#endif  
-  instance_list* plist = plist_top;
-  while(plist != NULL)
-  {
-    if(plist->pinstance == pinstance)
-    {
-      if(plist->pfunc_rx_complete)
-        plist->pfunc_rx_complete(plist->puser_data, prxdata, size);
-      
-      break;
-    }
-    plist = plist->pnext;
-  }   
-}
-
-void jhal_spi_txrx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-  JHAL_ASSERT(pinstance && prxdata && size);
-#endif
-  instance_list* plist = plist_top;
-  while(plist != NULL)
-  {
-    if(plist->pinstance == pinstance)
-    {
-      if(plist->pfunc_txrx_complete)
-        plist->pfunc_txrx_complete(plist->puser_data, prxdata, size);
-      
-      break;
-    }
-    plist = plist->pnext;
-  }   
-}
\ No newline at end of file
+#include "jhal_spi.h"
+#include JHAL_SPI_INCLUDE_NAME
+
+#if (USE_JHAL_MEM_LINKED == 1)
+JHAL_MEM_SLOTS_DEFINE(SPI);
+#endif
+
+__WEAK uint8_t JHAL_SPI_INIT(void* pinstance, jhal_spi_params* pparams)
+{
+  (void)pinstance;
+  (void)pparams;  
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_SPI_DEINIT(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_SPI_ABORT(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+#if (USE_JHAL_INLINE == 0)
+__WEAK uint8_t JHAL_SPI_TRANSMIT(void* pinstance, uint8_t* pTxData, uint16_t size, uint32_t timeout)
+{
+  (void)pinstance;
+  (void)pTxData;
+  (void)size;
+  (void)timeout;
+  
+  return JHAL_RES_NOT_SUPPORTED;  
+}
+
+__WEAK uint8_t JHAL_SPI_RECEIVE(void* pinstance, uint8_t* pRxData, uint16_t size, uint32_t timeout)
+{
+  (void)pinstance;
+  (void)pRxData;
+  (void)size;
+  (void)timeout;
+  
+  return JHAL_RES_NOT_SUPPORTED;  
+}
+
+__WEAK uint8_t JHAL_SPI_TRANSMITRECEIVE(void* pinstance, uint8_t* pTxData, uint8_t* pRxData, uint16_t size, uint32_t timeout)
+{
+  (void)pinstance;
+  (void)pTxData;
+  (void)pRxData;
+  (void)size;
+  (void)timeout;
+  
+  return JHAL_RES_NOT_SUPPORTED;  
+}
+
+__WEAK uint8_t JHAL_SPI_TRANSMIT_IT(void* pinstance, uint8_t* pTxData, uint16_t size)
+{
+  (void)pinstance;
+  (void)pTxData;
+  (void)size;
+  
+  return JHAL_RES_NOT_SUPPORTED;  
+}
+
+__WEAK uint8_t JHAL_SPI_RECEIVE_IT(void* pinstance, uint8_t* pRxData, uint16_t size)
+{
+  (void)pinstance;
+  (void)pRxData;
+  (void)size;
+  
+  return JHAL_RES_NOT_SUPPORTED;  
+}
+
+__WEAK uint8_t JHAL_SPI_TRANSMITRECEIVE_IT(void* pinstance, uint8_t* pTxData, uint8_t* pRxData, uint16_t size)
+{
+  (void)pinstance;
+  (void)pTxData;
+  (void)pRxData;
+  (void)size;
+  
+  return JHAL_RES_NOT_SUPPORTED;  
+}
+
+__WEAK uint8_t JHAL_SPI_TRANSMIT_DMA(void* pinstance, uint8_t* pTxData, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)pTxData;
+  (void)size;
+  (void)pinstance_dma;
+  
+  return JHAL_RES_NOT_SUPPORTED;  
+}
+
+__WEAK uint8_t JHAL_SPI_RECEIVE_DMA(void* pinstance, uint8_t* pRxData, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)pRxData;
+  (void)size;
+  (void)pinstance_dma;
+  
+  return JHAL_RES_NOT_SUPPORTED;  
+}
+
+__WEAK uint8_t JHAL_SPI_TRANSMITRECEIVE_DMA(void* pinstance, uint8_t* pTxData, uint8_t* pRxData, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)pTxData;
+  (void)pRxData;
+  (void)size;
+  (void)pinstance_dma;
+  
+  return JHAL_RES_NOT_SUPPORTED;  
+}
+#endif
+
+#if (USE_JHAL_OPS == 1)
+JHAL_SPI_OPS_DECLARE(jhal_spi_ops_default, JHAL_MCU_ENV);
+#endif
+
+static uint8_t prv_spi_init(jhal_driver_instance* pnew_instance, void** ppinstance, jhal_spi_params* pparams)
+{
+   spi_callback_instance* pcallbacks = (spi_callback_instance*)pnew_instance->pfuncs_callbacks;
+   pcallbacks->pfunc_tx_complete = pparams->pfunc_tx_complete;
+   pcallbacks->pfunc_rx_complete = pparams->pfunc_rx_complete;
+   pcallbacks->pfunc_txrx_complete = pparams->pfunc_txrx_complete;
+   pcallbacks->pfunc_error = pparams->pfunc_error;
+#if (USE_JHAL_QUEUE == 1)
+   pcallbacks->pqueue = NULL;
+#endif
+#if (USE_JHAL_SCRIPT == 1)
+   pcallbacks->pscript = NULL;
+#endif
+#if (USE_JHAL_BUF == 1)
+   pcallbacks->buf_tx.pbuf = NULL;
+   pcallbacks->pbuf_rx = NULL;
+#endif
+   pnew_instance->puser_data = pparams->puser_data;
+#if (USE_JHAL_OPS == 1)
+   pnew_instance->pops = JHAL_OPS_BY_PARAMS(pparams, _spi);
+#endif
+   
+#if (USE_JHAL_OS == 1)
+   pcallbacks->error = 0;
+   uint8_t res = jhal_os_blocking_init(&pcallbacks->blocking);
+   
+   if(res == JHAL_RES_NO_ERRORS)
+   {
+     res = JHAL_DISPATCH(pnew_instance->pinstance, _spi, _init)(pnew_instance->pinstance, pparams);
+     if(res != JHAL_RES_NO_ERRORS)
+       jhal_os_blocking_deinit(&pcallbacks->blocking);
+   }
+#else
+   uint8_t res = JHAL_DISPATCH(pnew_instance->pinstance, _spi, _init)(pnew_instance->pinstance, pparams); 
+#endif
+   
+   if(res == JHAL_RES_NO_ERRORS)       
+     *ppinstance = pnew_instance->pinstance;
+   else 
+   {
+     *ppinstance = NULL;
+     jhal_driver_free(pnew_instance->pinstance);
+   }  
+   
+   return res;
+}
+
+uint8_t (jhal_spi_init)(void** ppinstance, jhal_spi_params* pparams)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)       
+   if(!ppinstance || *ppinstance || !pparams) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = JHAL_DRIVER_MALLOC(JHAL_SIZE_DRV_BY_PARAMS(pparams, _spi), sizeof(spi_callback_instance), SPI);
+     
+   if(pnew_instance == NULL)  
+     return JHAL_RES_ALLOC_ERROR;
+   
+   return prv_spi_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_spi_init_static(void** ppinstance, jhal_spi_params* pparams, void* pmem, uint32_t size_mem)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)       
+   if(!ppinstance || *ppinstance || !pparams || !pmem) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = jhal_driver_place(pmem, size_mem, JHAL_SIZE_DRV_BY_PARAMS(pparams, _spi), sizeof(spi_callback_instance));
+     
+   if(pnew_instance == NULL)  
+     return JHAL_RES_ALLOC_ERROR;
+   
+   return prv_spi_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_spi_deinit(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint8_t res = JHAL_DISPATCH(pinstance, _spi, _deinit)(pinstance);
+#if (USE_JHAL_OS == 1)
+  jhal_os_blocking_deinit(&JHAL_GET_CALLBACKS(pinstance, spi_callback_instance)->blocking);
+#endif
+#if (USE_JHAL_BUF == 1)
+  jhal_buf_release(&JHAL_GET_CALLBACKS(pinstance, spi_callback_instance)->buf_tx.pbuf);
+  jhal_buf_release(&JHAL_GET_CALLBACKS(pinstance, spi_callback_instance)->pbuf_rx);
+#endif
+  
+  jhal_driver_free(pinstance);
+  
+  return res;
+}
+
+uint8_t jhal_spi_abort(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_ABORT, 0);
+#if (USE_JHAL_BUF == 1)
+  uint8_t res = JHAL_DISPATCH(pinstance, _spi, _abort)(pinstance);
+  
+  if(res == JHAL_RES_NO_ERRORS && JHAL_CHECK_INSTANCE(pinstance))
+  {
+    jhal_buf_release(&JHAL_GET_CALLBACKS(pinstance, spi_callback_instance)->buf_tx.pbuf);
+    jhal_buf_release(&JHAL_GET_CALLBACKS(pinstance, spi_callback_instance)->pbuf_rx);
+  }
+  
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_ABORT, 0, res);
+#else
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_ABORT, 0, JHAL_DISPATCH(pinstance, _spi, _abort)(pinstance));
+#endif
+}
+
+#if (USE_JHAL_QUEUE == 1)
+static uint8_t prv_spi_request_start(void* pinstance, jhal_request* prequest)
+{
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_REQUEST, prequest->size);
+  
+  if(prequest->size > 0xFFFFU)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint16_t size = (uint16_t)prequest->size;
+  
+  switch(prequest->operation)
+  {
+    case JHAL_REQUEST_OPERATION_TX:
+      if(prequest->pinstance_dma)
+        return JHAL_DISPATCH(pinstance, _spi, _transmit_dma)(pinstance, prequest->ptxdata, size, prequest->pinstance_dma);
+      return JHAL_DISPATCH(pinstance, _spi, _transmit_it)(pinstance, prequest->ptxdata, size);
+    case JHAL_REQUEST_OPERATION_RX:
+      if(prequest->pinstance_dma)
+        return JHAL_DISPATCH(pinstance, _spi, _receive_dma)(pinstance, prequest->prxdata, size, prequest->pinstance_dma);
+      return JHAL_DISPATCH(pinstance, _spi, _receive_it)(pinstance, prequest->prxdata, size);
+    case JHAL_REQUEST_OPERATION_TXRX:
+      if(prequest->pinstance_dma)
+        return JHAL_DISPATCH(pinstance, _spi, _transmitreceive_dma)(pinstance, prequest->ptxdata, prequest->prxdata, size, prequest->pinstance_dma);
+      return JHAL_DISPATCH(pinstance, _spi, _transmitreceive_it)(pinstance, prequest->ptxdata, prequest->prxdata, size);
+  }
+  
+  return JHAL_RES_INVALID_PARAMS;
+}
+
+/* Binds a request queue to the instance, NULL detaches it. The queue attached
+   before is released first, JHAL_RES_BUSY while it still holds requests.
+   Completions of an attached instance go to the queue instead of the callbacks */
+uint8_t jhal_spi_queue_attach(void* pinstance, jhal_request_queue* pqueue)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  spi_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, spi_callback_instance);
+  
+  jhal_request_queue* pqueue_old = pcallbacks->pqueue;
+  
+  if(pqueue_old != NULL && pqueue_old != pqueue && jhal_request_pending(pqueue_old))
+    return JHAL_RES_BUSY;
+  
+  if(pqueue != NULL)
+  {
+    uint8_t res = jhal_request_queue_bind(pqueue, pinstance, prv_spi_request_start);
+    if(res != JHAL_RES_NO_ERRORS)
+      return res;
+  }
+  
+  if(pqueue_old != NULL && pqueue_old != pqueue)
+    jhal_request_queue_bind(pqueue_old, NULL, NULL);
+  
+  pcallbacks->pqueue = pqueue;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+#endif
+
+#if (USE_JHAL_SCRIPT == 1)
+/* Hands the completions of the instance to a running script, NULL gives them
+   back to the callbacks */
+uint8_t jhal_spi_script_attach(void* pinstance, jhal_script* pscript)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  spi_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, spi_callback_instance);
+  
+  if(pscript != NULL && pcallbacks->pscript != NULL && pcallbacks->pscript != pscript)
+    return JHAL_RES_ERROR;
+#if (USE_JHAL_QUEUE == 1)
+  if(pscript != NULL && pcallbacks->pqueue != NULL)
+    return JHAL_RES_ERROR;
+#endif
+  
+  pcallbacks->pscript = pscript;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+#endif
+
+#if (USE_JHAL_OS == 1) || (USE_JHAL_DEFER == 1)
+#define SPI_OPERATION_TX                1U
+#define SPI_OPERATION_RX                2U
+#define SPI_OPERATION_TXRX              3U
+#define SPI_OPERATION_ERROR             4U
+#endif
+
+#if (USE_JHAL_INLINE == 0) || (USE_JHAL_OS == 1)
+#if (USE_JHAL_OS == 1)
+
+/* Runs the IT variant and sleeps on the completion instead of polling, envs
+   without IT support fall back to the polling variant under the same lock.
+   An error of the transfer wakes the task as well and is returned as JHAL_RES_ERROR */
+static uint8_t prv_spi_blocking(void* pinstance, uint8_t operation, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  spi_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, spi_callback_instance);
+  jhal_os_blocking* pblocking = &pcallbacks->blocking;
+  
+  uint8_t res = jhal_os_blocking_begin(pblocking, timeout);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  pcallbacks->error = 0;
+  
+  switch(operation)
+  {
+    case SPI_OPERATION_TX:
+      res = JHAL_DISPATCH(pinstance, _spi, _transmit_it)(pinstance, ptxdata, size);
+    break;
+    case SPI_OPERATION_RX:
+      res = JHAL_DISPATCH(pinstance, _spi, _receive_it)(pinstance, prxdata, size);
+    break;
+    default:
+      res = JHAL_DISPATCH(pinstance, _spi, _transmitreceive_it)(pinstance, ptxdata, prxdata, size);
+    break;
+  }
+  
+  if(res == JHAL_RES_NO_ERRORS)
+  {
+    res = jhal_os_blocking_wait(pblocking, timeout);
+    
+    if(res == JHAL_RES_TIMEOUT)
+      JHAL_DISPATCH(pinstance, _spi, _abort)(pinstance);
+    else if(res == JHAL_RES_NO_ERRORS && pcallbacks->error)
+      res = JHAL_RES_ERROR;
+  }
+  else if(res == JHAL_RES_NOT_SUPPORTED)
+  {
+    pblocking->waiting = 0;
+    timeout = jhal_os_blocking_remaining(pblocking, timeout);
+    
+    switch(operation)
+    {
+      case SPI_OPERATION_TX:
+        res = JHAL_DISPATCH(pinstance, _spi, _transmit)(pinstance, ptxdata, size, timeout);
+      break;
+      case SPI_OPERATION_RX:
+        res = JHAL_DISPATCH(pinstance, _spi, _receive)(pinstance, prxdata, size, timeout);
+      break;
+      default:
+        res = JHAL_DISPATCH(pinstance, _spi, _transmitreceive)(pinstance, ptxdata, prxdata, size, timeout);
+      break;
+    }
+  }
+  
+  jhal_os_blocking_end(pblocking);
+  
+  return res;
+}
+#endif
+
+uint8_t jhal_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ptxdata  || !size || !timeout) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT, size);
+#if (USE_JHAL_OS == 1)
+  if(jhal_os_can_block())
+    return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT, size, prv_spi_blocking(pinstance, SPI_OPERATION_TX, ptxdata, NULL, size, timeout));
+#endif
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT, size, JHAL_DISPATCH(pinstance, _spi, _transmit)(pinstance, ptxdata, size, timeout));
+}
+
+uint8_t jhal_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !prxdata || !size || !timeout) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif  
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE, size);
+#if (USE_JHAL_OS == 1)
+  if(jhal_os_can_block())
+    return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE, size, prv_spi_blocking(pinstance, SPI_OPERATION_RX, NULL, prxdata, size, timeout));
+#endif
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE, size, JHAL_DISPATCH(pinstance, _spi, _receive)(pinstance, prxdata, size, timeout));
+}
+
+uint8_t jhal_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ptxdata || !prxdata || !size || !timeout) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif    
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size);
+#if (USE_JHAL_OS == 1)
+  if(jhal_os_can_block())
+    return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size, prv_spi_blocking(pinstance, SPI_OPERATION_TXRX, ptxdata, prxdata, size, timeout));
+#endif
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size, JHAL_DISPATCH(pinstance, _spi, _transmitreceive)(pinstance, ptxdata, prxdata, size, timeout));
+}
+
+#endif
+
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ptxdata  || !size) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size, JHAL_DISPATCH(pinstance, _spi, _transmit_it)(pinstance, ptxdata, size));
+}
+
+uint8_t jhal_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !prxdata || !size) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif  
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE_IT, size, JHAL_DISPATCH(pinstance, _spi, _receive_it)(pinstance, prxdata, size));
+}
+
+uint8_t jhal_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ptxdata || !prxdata || !size) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif    
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_IT, size, JHAL_DISPATCH(pinstance, _spi, _transmitreceive_it)(pinstance, ptxdata, prxdata, size));
+}
+
+uint8_t jhal_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ptxdata  || !size || !pinstance_dma) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT_DMA, size, JHAL_DISPATCH(pinstance, _spi, _transmit_dma)(pinstance, ptxdata, size, pinstance_dma));
+}
+
+uint8_t jhal_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !prxdata || !size || !pinstance_dma)
+     return JHAL_RES_INVALID_PARAMS;
+#endif  
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size, JHAL_DISPATCH(pinstance, _spi, _receive_dma)(pinstance, prxdata, size, pinstance_dma));
+}
+
+uint8_t jhal_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !ptxdata || !prxdata || !size || !pinstance_dma) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif    
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_DMA, size, JHAL_DISPATCH(pinstance, _spi, _transmitreceive_dma)(pinstance, ptxdata, prxdata, size, pinstance_dma));
+}
+#endif
+
+#if (USE_JHAL_BUF == 1)
+uint8_t jhal_spi_transmit_buf(void* pinstance, jhal_buf* pbuf, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pbuf || !timeout) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  for(pbuf = jhal_buf_segment(pbuf); pbuf != NULL; pbuf = jhal_buf_segment(pbuf->pnext))
+  {
+    uint8_t res = jhal_spi_transmit(pinstance, pbuf->pdata, pbuf->size, timeout);
+    if(res != JHAL_RES_NO_ERRORS)
+      return res;
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* Receives size bytes into the tailroom of pbuf and appends them to its data */
+uint8_t jhal_spi_receive_buf(void* pinstance, jhal_buf* pbuf, uint16_t size, uint32_t timeout)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pbuf || !size || !timeout) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(jhal_buf_tailroom(pbuf) < size)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint8_t res = jhal_spi_receive(pinstance, &pbuf->pdata[pbuf->size], size, timeout);
+  if(res == JHAL_RES_NO_ERRORS)
+    pbuf->size += size;
+  
+  return res;
+}
+
+static uint8_t prv_spi_buf_tx_start(void* pinstance, uint8_t* pdata, uint16_t size, void* pinstance_dma)
+{
+  if(pinstance_dma)
+    return jhal_spi_transmit_dma(pinstance, pdata, size, pinstance_dma);
+  return jhal_spi_transmit_it(pinstance, pdata, size);
+}
+
+static uint8_t prv_spi_buf_rx_start(void* pinstance, uint8_t* pdata, uint16_t size, void* pinstance_dma)
+{
+  if(pinstance_dma)
+    return jhal_spi_receive_dma(pinstance, pdata, size, pinstance_dma);
+  return jhal_spi_receive_it(pinstance, pdata, size);
+}
+
+/* The instance holds its own reference to the chain until the last segment is
+   sent, so the caller may free pbuf right after the start */
+static uint8_t prv_spi_transmit_buf_async(void* pinstance, jhal_buf* pbuf, void* pinstance_dma)
+{
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+#if (USE_JHAL_QUEUE == 1)
+  if(JHAL_GET_CALLBACKS(pinstance, spi_callback_instance)->pqueue)
+    return JHAL_RES_ERROR;
+#endif
+  
+  return jhal_buf_tx_start(&JHAL_GET_CALLBACKS(pinstance, spi_callback_instance)->buf_tx, pbuf, pinstance, pinstance_dma, prv_spi_buf_tx_start);
+}
+
+/* The received bytes are appended to pbuf on completion, the rx callback gets
+   a pointer into pbuf, so the caller keeps its reference to use the data there */
+static uint8_t prv_spi_receive_buf_async(void* pinstance, jhal_buf* pbuf, uint16_t size, void* pinstance_dma)
+{
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+#if (USE_JHAL_QUEUE == 1)
+  if(JHAL_GET_CALLBACKS(pinstance, spi_callback_instance)->pqueue)
+    return JHAL_RES_ERROR;
+#endif
+  
+  return jhal_buf_rx_start(&JHAL_GET_CALLBACKS(pinstance, spi_callback_instance)->pbuf_rx, pbuf, size, pinstance, pinstance_dma, prv_spi_buf_rx_start);
+}
+
+uint8_t jhal_spi_transmit_buf_it(void* pinstance, jhal_buf* pbuf)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pbuf) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  return prv_spi_transmit_buf_async(pinstance, pbuf, NULL);
+}
+
+uint8_t jhal_spi_receive_buf_it(void* pinstance, jhal_buf* pbuf, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pbuf || !size) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  return prv_spi_receive_buf_async(pinstance, pbuf, size, NULL);
+}
+
+uint8_t jhal_spi_transmit_buf_dma(void* pinstance, jhal_buf* pbuf, void* pinstance_dma)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pbuf || !pinstance_dma) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  return prv_spi_transmit_buf_async(pinstance, pbuf, pinstance_dma);
+}
+
+uint8_t jhal_spi_receive_buf_dma(void* pinstance, jhal_buf* pbuf, uint16_t size, void* pinstance_dma)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pbuf || !size || !pinstance_dma) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  return prv_spi_receive_buf_async(pinstance, pbuf, size, pinstance_dma);
+}
+#endif
+
+#if (USE_JHAL_DEFER == 1)
+static void prv_spi_defer_dispatch(const jhal_defer_event* pevent)
+{
+  spi_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pevent->pinstance, spi_callback_instance);
+  void* puser_data = JHAL_GET_USERDATA(pevent->pinstance);
+  
+  switch(pevent->type)
+  {
+    case SPI_OPERATION_TX:
+      pcallbacks->pfunc_tx_complete(puser_data);
+      break;
+    case SPI_OPERATION_RX:
+      pcallbacks->pfunc_rx_complete(puser_data, pevent->pdata, pevent->size);
+      break;
+    case SPI_OPERATION_TXRX:
+      pcallbacks->pfunc_txrx_complete(puser_data, pevent->pdata, pevent->size);
+      break;
+    case SPI_OPERATION_ERROR:
+      pcallbacks->pfunc_error(puser_data, pevent->value);
+      break;
+  }
+}
+#endif
+
+/* Delivers an error of the instance to the user callback */
+static void prv_spi_error_notify(void* pinstance, spi_callback_instance* pcallbacks, uint8_t error)
+{
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_error && JHAL_DEFER_POST(pinstance, prv_spi_defer_dispatch, SPI_OPERATION_ERROR, error, NULL, 0))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_error)
+    pcallbacks->pfunc_error(JHAL_GET_USERDATA(pinstance), error);
+}
+
+void jhal_spi_tx_complete_callback(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance);  
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  spi_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, spi_callback_instance);
+  
+#if (USE_JHAL_OS == 1)
+  if(jhal_os_blocking_complete(&pcallbacks->blocking))
+    return;
+#endif
+  
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TX_COMPLETE, 0);
+  
+#if (USE_JHAL_SCRIPT == 1)
+  if(pcallbacks->pscript)
+  {
+    jhal_script_step_complete(pcallbacks->pscript);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_BUF == 1)
+  if(pcallbacks->buf_tx.pbuf)
+  {
+    uint8_t res = jhal_buf_tx_next(&pcallbacks->buf_tx);
+    
+    if(res == JHAL_RES_BUSY)
+      return;
+    if(res != JHAL_RES_NO_ERRORS)
+    {
+      JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_ERROR, JHAL_SPI_ERROR_START);
+      prv_spi_error_notify(pinstance, pcallbacks, JHAL_SPI_ERROR_START);
+      return;
+    }
+  }
+#endif
+  
+#if (USE_JHAL_QUEUE == 1)
+  if(pcallbacks->pqueue)
+  {
+    jhal_request_queue_complete(pcallbacks->pqueue, JHAL_RES_NO_ERRORS);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_tx_complete && JHAL_DEFER_POST(pinstance, prv_spi_defer_dispatch, SPI_OPERATION_TX, 0, NULL, 0))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_tx_complete)
+    pcallbacks->pfunc_tx_complete(JHAL_GET_USERDATA(pinstance));
+}
+
+void jhal_spi_rx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && prxdata && size);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  spi_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, spi_callback_instance);
+  
+#if (USE_JHAL_OS == 1)
+  if(jhal_os_blocking_complete(&pcallbacks->blocking))
+    return;
+#endif
+  
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RX_COMPLETE, size);
+  
+#if (USE_JHAL_SCRIPT == 1)
+  if(pcallbacks->pscript)
+  {
+    jhal_script_step_complete(pcallbacks->pscript);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_BUF == 1)
+  if(pcallbacks->pbuf_rx)
+    jhal_buf_rx_complete(&pcallbacks->pbuf_rx, prxdata, size);
+#endif
+  
+#if (USE_JHAL_QUEUE == 1)
+  if(pcallbacks->pqueue)
+  {
+    jhal_request_queue_complete(pcallbacks->pqueue, JHAL_RES_NO_ERRORS);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_rx_complete && JHAL_DEFER_POST(pinstance, prv_spi_defer_dispatch, SPI_OPERATION_RX, 0, prxdata, size))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_rx_complete)
+    pcallbacks->pfunc_rx_complete(JHAL_GET_USERDATA(pinstance), prxdata, size);
+}
+
+void jhal_spi_txrx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && prxdata && size);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  spi_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, spi_callback_instance);
+  
+#if (USE_JHAL_OS == 1)
+  if(jhal_os_blocking_complete(&pcallbacks->blocking))
+    return;
+#endif
+  
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TXRX_COMPLETE, size);
+  
+#if (USE_JHAL_SCRIPT == 1)
+  if(pcallbacks->pscript)
+  {
+    jhal_script_step_complete(pcallbacks->pscript);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_QUEUE == 1)
+  if(pcallbacks->pqueue)
+  {
+    jhal_request_queue_complete(pcallbacks->pqueue, JHAL_RES_NO_ERRORS);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_txrx_complete && JHAL_DEFER_POST(pinstance, prv_spi_defer_dispatch, SPI_OPERATION_TXRX, 0, prxdata, size))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_txrx_complete)
+    pcallbacks->pfunc_txrx_complete(JHAL_GET_USERDATA(pinstance), prxdata, size);
+}
+
+/* Ends the transfer in progress, the env has stopped both directions before the call */
+void jhal_spi_error_callback(void* pinstance, uint8_t error)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance && error);
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  spi_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, spi_callback_instance);
+  
+#if (USE_JHAL_OS == 1)
+  pcallbacks->error = error;
+  if(jhal_os_blocking_complete(&pcallbacks->blocking))
+    return;
+#endif
+  
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_ERROR, error);
+  
+#if (USE_JHAL_SCRIPT == 1)
+  if(pcallbacks->pscript)
+  {
+    jhal_script_step_failed(pcallbacks->pscript, JHAL_RES_ERROR);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_BUF == 1)
+  jhal_buf_release(&pcallbacks->buf_tx.pbuf);
+  jhal_buf_release(&pcallbacks->pbuf_rx);
+#endif
+  
+#if (USE_JHAL_QUEUE == 1)
+  if(pcallbacks->pqueue)
+  {
+    jhal_request_queue_complete(pcallbacks->pqueue, JHAL_RES_ERROR);
+    return;
+  }
+#endif
+  
+  prv_spi_error_notify(pinstance, pcallbacks, error);
+}
+
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_spi_get_stats(void* pinstance, jhal_stats* pstats)
+{
+  return jhal_stats_get(pinstance, pstats);
+}
+
+uint8_t jhal_spi_reset_stats(void* pinstance)
+{
+  return jhal_stats_reset(pinstance);
+}
+#endif
\ No newline at end of file
@@ -1,76 +1,264 @@
-#ifndef __JHAL_SPI__
-#define __JHAL_SPI__
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include "jhal_environment.h"
-
-typedef void (*jhal_type_spi_tx_complete)(void*);
-typedef void (*jhal_type_spi_txrx_complete)(void*, uint8_t* prxdata, uint16_t size);
-typedef void (*jhal_type_spi_rx_complete)(void*, uint8_t* prxdata, uint16_t size);
-  
-typedef enum {
-  JHAL_SPI_MODE_MASTER = 37U,
-  JHAL_SPI_MODE_SLAVE = 22U
-} jhal_spi_mode;
-
-typedef enum {
-  JHAL_SPI_FIRST_BIT_LSB = 141U,
-  JHAL_SPI_FIRST_BIT_MSB = 67U
-} jhal_spi_first_bit;
-
-typedef enum {
-  JHAL_SPI_DATA_SIZE_8BIT  = 209U,
-  JHAL_SPI_DATA_SIZE_16BIT = 108U
-} jhal_spi_data_size;
-
-typedef enum {
-  JHAL_SPI_CPOL_LOW  = 249U,
-  JHAL_SPI_CPOL_HIGH = 117U
-} jhal_spi_cpol;
-
-typedef enum {
-  JHAL_SPI_CPHA_LOW  = 30U,
-  JHAL_SPI_CPHA_HIGH = 76U
-} jhal_spi_cpha;
-
-typedef struct {
-  uint8_t                       num_module;
-  jhal_spi_mode                 mode;
-  jhal_spi_data_size            data_size;
-  jhal_spi_cpol                 cpol;
-  jhal_spi_cpha                 cpha;
-  jhal_spi_first_bit            first_bit;
-  uint32_t                      baudrate;
-        
-  jhal_type_spi_tx_complete     pfunc_tx_complete;
-  jhal_type_spi_rx_complete     pfunc_rx_complete;
-  jhal_type_spi_txrx_complete   pfunc_txrx_complete;  
-  void*                         plib_data;
-  void*                         puser_data;
-} jhal_spi_params;
-
-
-uint8_t jhal_spi_init(void** ppinstance, jhal_spi_params* pparams_spi);
-uint8_t jhal_spi_deinit(void* pinstance);
-uint8_t jhal_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
-uint8_t jhal_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout);
-uint8_t jhal_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
-uint8_t jhal_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size);
-uint8_t jhal_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size);
-uint8_t jhal_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
-uint8_t jhal_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
-uint8_t jhal_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
-uint8_t jhal_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
-
-void jhal_spi_tx_complete_callback(void* pinstance);
-void jhal_spi_rx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size);
-void jhal_spi_txrx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size);
-
-#ifdef __cplusplus
-}
-#endif
-
+#ifndef __JHAL_SPI__
+#define __JHAL_SPI__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+#include "jhal_os.h"
+#include "jhal_request.h"
+#include "jhal_defer.h"
+#include "jhal_probe.h"
+#include "jhal_buf.h"
+#include "jhal_script.h"
+
+#define JHAL_SPI_ERROR_OVERRUN                  1U
+#define JHAL_SPI_ERROR_MODE                     2U
+#define JHAL_SPI_ERROR_CRC                      3U
+#define JHAL_SPI_ERROR_FRAME                    4U
+#define JHAL_SPI_ERROR_DMA                      5U
+/* A segment of a buf chain failed to start, the rest of the chain is dropped */
+#define JHAL_SPI_ERROR_START                    6U
+
+typedef void (*jhal_type_spi_tx_complete)(void*);
+typedef void (*jhal_type_spi_txrx_complete)(void*, uint8_t* prxdata, uint16_t size);
+typedef void (*jhal_type_spi_rx_complete)(void*, uint8_t* prxdata, uint16_t size);
+typedef void (*jhal_type_spi_error)(void*, uint8_t error);
+  
+typedef enum {
+  JHAL_SPI_MODE_MASTER = 37U,
+  JHAL_SPI_MODE_SLAVE = 22U
+} jhal_spi_mode;
+
+typedef enum {
+  JHAL_SPI_FIRST_BIT_LSB = 141U,
+  JHAL_SPI_FIRST_BIT_MSB = 67U
+} jhal_spi_first_bit;
+
+typedef enum {
+  JHAL_SPI_DATA_SIZE_8BIT  = 209U,
+  JHAL_SPI_DATA_SIZE_16BIT = 108U
+} jhal_spi_data_size;
+
+typedef enum {
+  JHAL_SPI_CPOL_LOW  = 249U,
+  JHAL_SPI_CPOL_HIGH = 117U
+} jhal_spi_cpol;
+
+typedef enum {
+  JHAL_SPI_CPHA_LOW  = 30U,
+  JHAL_SPI_CPHA_HIGH = 76U
+} jhal_spi_cpha;
+
+#if (USE_JHAL_OPS == 1)
+typedef struct jhal_spi_ops_struct jhal_spi_ops;
+#endif
+
+typedef struct {
+  uint8_t                       num_module;
+  jhal_spi_mode                 mode;
+  jhal_spi_data_size            data_size;
+  jhal_spi_cpol                 cpol;
+  jhal_spi_cpha                 cpha;
+  jhal_spi_first_bit            first_bit;
+  uint32_t                      baudrate;
+        
+  jhal_type_spi_tx_complete     pfunc_tx_complete;
+  jhal_type_spi_rx_complete     pfunc_rx_complete;
+  jhal_type_spi_txrx_complete   pfunc_txrx_complete;  
+  jhal_type_spi_error           pfunc_error;
+  void*                         plib_data;
+  void*                         puser_data;
+#if (USE_JHAL_OPS == 1)
+  const jhal_spi_ops*           pops;
+#endif
+} jhal_spi_params;
+
+
+typedef struct {
+  jhal_type_spi_tx_complete     pfunc_tx_complete;
+  jhal_type_spi_rx_complete     pfunc_rx_complete;
+  jhal_type_spi_txrx_complete   pfunc_txrx_complete;
+  jhal_type_spi_error           pfunc_error;
+#if (USE_JHAL_OS == 1)
+  jhal_os_blocking              blocking;
+  volatile uint8_t              error;
+#endif
+#if (USE_JHAL_QUEUE == 1)
+  jhal_request_queue*           pqueue;
+#endif
+#if (USE_JHAL_BUF == 1)
+  jhal_buf_tx                   buf_tx;
+  jhal_buf*                     pbuf_rx;
+#endif
+#if (USE_JHAL_SCRIPT == 1)
+  jhal_script*                  pscript;
+#endif
+} spi_callback_instance;
+
+#define JHAL_SPI_SIZE_STATIC                     JHAL_DRIVER_SIZE_STATIC(JHAL_SPI_SIZE_DRV_STATIC, sizeof(spi_callback_instance))
+#define JHAL_SPI_DECLARE_STATIC(NAME)            JHAL_DECLARE_STATIC_MEM(NAME, JHAL_SPI_SIZE_STATIC)
+#if (USE_JHAL_MEM_LINKED == 1)
+#define JHAL_SPI_DECLARE_INSTANCE(NAME)          JHAL_DECLARE_INSTANCE(NAME, JHAL_SPI_SIZE_STATIC, SPI)
+JHAL_MEM_SLOTS_DECLARE(SPI);
+#endif
+
+#if (USE_JHAL_OPS == 1)
+struct jhal_spi_ops_struct {
+  uint32_t (*pfunc_size_drv)(void);
+  uint8_t (*pfunc_init)(void* pinstance, jhal_spi_params* pparams);
+  uint8_t (*pfunc_deinit)(void* pinstance);
+  uint8_t (*pfunc_transmit)(void* pinstance, uint8_t* pTxData, uint16_t size, uint32_t timeout);
+  uint8_t (*pfunc_receive)(void* pinstance, uint8_t* pRxData, uint16_t size, uint32_t timeout);
+  uint8_t (*pfunc_transmitreceive)(void* pinstance, uint8_t* pTxData, uint8_t* pRxData, uint16_t size, uint32_t timeout);
+  uint8_t (*pfunc_transmit_it)(void* pinstance, uint8_t* pTxData, uint16_t size);
+  uint8_t (*pfunc_receive_it)(void* pinstance, uint8_t* pRxData, uint16_t size);
+  uint8_t (*pfunc_transmitreceive_it)(void* pinstance, uint8_t* pTxData, uint8_t* pRxData, uint16_t size);
+  uint8_t (*pfunc_transmit_dma)(void* pinstance, uint8_t* pTxData, uint16_t size, void* pinstance_dma);
+  uint8_t (*pfunc_receive_dma)(void* pinstance, uint8_t* pRxData, uint16_t size, void* pinstance_dma);
+  uint8_t (*pfunc_transmitreceive_dma)(void* pinstance, uint8_t* pTxData, uint8_t* pRxData, uint16_t size, void* pinstance_dma);
+  uint8_t (*pfunc_abort)(void* pinstance);
+};
+
+extern const jhal_spi_ops jhal_spi_ops_default;
+
+#define JHAL_SPI_OPS_DECLARE(NAME, ENV)   const jhal_spi_ops NAME = {\
+        JHAL_FUNCTION_NAME(ENV,_spi,_size_drv),\
+        JHAL_FUNCTION_NAME(ENV,_spi,_init),\
+        JHAL_FUNCTION_NAME(ENV,_spi,_deinit),\
+        JHAL_FUNCTION_NAME(ENV,_spi,_transmit),\
+        JHAL_FUNCTION_NAME(ENV,_spi,_receive),\
+        JHAL_FUNCTION_NAME(ENV,_spi,_transmitreceive),\
+        JHAL_FUNCTION_NAME(ENV,_spi,_transmit_it),\
+        JHAL_FUNCTION_NAME(ENV,_spi,_receive_it),\
+        JHAL_FUNCTION_NAME(ENV,_spi,_transmitreceive_it),\
+        JHAL_FUNCTION_NAME(ENV,_spi,_transmit_dma),\
+        JHAL_FUNCTION_NAME(ENV,_spi,_receive_dma),\
+        JHAL_FUNCTION_NAME(ENV,_spi,_transmitreceive_dma),\
+        JHAL_FUNCTION_NAME(ENV,_spi,_abort)}
+#define JHAL_SPI_SIZE_STATIC_BY_ENV(ENV)  JHAL_DRIVER_SIZE_STATIC(JHAL_FUNCTION_NAME(ENV,_spi,_size_drv_static), sizeof(spi_callback_instance))
+#endif
+
+uint8_t jhal_spi_init(void** ppinstance, jhal_spi_params* pparams_spi);
+uint8_t jhal_spi_init_static(void** ppinstance, jhal_spi_params* pparams_spi, void* pmem, uint32_t size_mem);
+uint8_t jhal_spi_deinit(void* pinstance);
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_spi_get_stats(void* pinstance, jhal_stats* pstats);
+uint8_t jhal_spi_reset_stats(void* pinstance);
+#endif
+uint8_t jhal_spi_abort(void* pinstance);
+#if (USE_JHAL_QUEUE == 1)
+uint8_t jhal_spi_queue_attach(void* pinstance, jhal_request_queue* pqueue);
+#endif
+#if (USE_JHAL_SCRIPT == 1)
+uint8_t jhal_spi_script_attach(void* pinstance, jhal_script* pscript);
+#endif
+#if (USE_JHAL_INLINE == 0) || (USE_JHAL_OS == 1)
+uint8_t jhal_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+uint8_t jhal_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t jhal_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+#endif
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size);
+uint8_t jhal_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size);
+uint8_t jhal_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
+uint8_t jhal_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+uint8_t jhal_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t jhal_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+#endif
+#if (USE_JHAL_BUF == 1)
+uint8_t jhal_spi_transmit_buf(void* pinstance, jhal_buf* pbuf, uint32_t timeout);
+uint8_t jhal_spi_receive_buf(void* pinstance, jhal_buf* pbuf, uint16_t size, uint32_t timeout);
+uint8_t jhal_spi_transmit_buf_it(void* pinstance, jhal_buf* pbuf);
+uint8_t jhal_spi_receive_buf_it(void* pinstance, jhal_buf* pbuf, uint16_t size);
+uint8_t jhal_spi_transmit_buf_dma(void* pinstance, jhal_buf* pbuf, void* pinstance_dma);
+uint8_t jhal_spi_receive_buf_dma(void* pinstance, jhal_buf* pbuf, uint16_t size, void* pinstance_dma);
+#endif
+
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+  #define jhal_spi_init(PPINSTANCE, PPARAMS)    JHAL_MEM_CALL_SITE((jhal_spi_init)(PPINSTANCE, PPARAMS))
+#endif
+
+/* An IT or DMA transfer ends with one of the completions or with the error
+   callback, an error ends both directions of the transfer in progress */
+void jhal_spi_tx_complete_callback(void* pinstance);
+void jhal_spi_rx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size);
+void jhal_spi_txrx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size);
+void jhal_spi_error_callback(void* pinstance, uint8_t error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#include JHAL_SPI_INCLUDE_NAME
+
+#if (USE_JHAL_INLINE == 1)
+#if (USE_JHAL_OS == 0)
+static inline uint8_t jhal_spi_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT, size, JHAL_DISPATCH(pinstance, _spi, _transmit)(pinstance, ptxdata, size, timeout));
+}
+
+static inline uint8_t jhal_spi_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE, size, JHAL_DISPATCH(pinstance, _spi, _receive)(pinstance, prxdata, size, timeout));
+}
+
+static inline uint8_t jhal_spi_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size, JHAL_DISPATCH(pinstance, _spi, _transmitreceive)(pinstance, ptxdata, prxdata, size, timeout));
+}
+
+#endif
+
+static inline uint8_t jhal_spi_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size, JHAL_DISPATCH(pinstance, _spi, _transmit_it)(pinstance, ptxdata, size));
+}
+
+static inline uint8_t jhal_spi_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE_IT, size, JHAL_DISPATCH(pinstance, _spi, _receive_it)(pinstance, prxdata, size));
+}
+
+static inline uint8_t jhal_spi_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_IT, size, JHAL_DISPATCH(pinstance, _spi, _transmitreceive_it)(pinstance, ptxdata, prxdata, size));
+}
+
+static inline uint8_t jhal_spi_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMIT_DMA, size, JHAL_DISPATCH(pinstance, _spi, _transmit_dma)(pinstance, ptxdata, size, pinstance_dma));
+}
+
+static inline uint8_t jhal_spi_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size, JHAL_DISPATCH(pinstance, _spi, _receive_dma)(pinstance, prxdata, size, pinstance_dma));
+}
+
+static inline uint8_t jhal_spi_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, spi_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_SPI, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_DMA, size, JHAL_DISPATCH(pinstance, _spi, _transmitreceive_dma)(pinstance, ptxdata, prxdata, size, pinstance_dma));
+}
+#endif
+
 #endif
\ No newline at end of file
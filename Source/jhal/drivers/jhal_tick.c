@@ -1,22 +1,208 @@
-#include "jhal_tick.h"
-#include JHAL_TICK_INCLUDE_NAME
-
-__WEAK uint32_t JHAL_TICK(uint32_t amount_us)
-{
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint32_t JHAL_TICK_INIT(void)
-{
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-uint32_t jhal_tick(uint32_t amount_us)
-{
-  return JHAL_TICK(amount_us);
-}
-
-uint32_t jhal_tick_init(void)
-{
-  return JHAL_TICK_INIT();
+#include "jhal_tick.h"
+#include JHAL_TICK_INCLUDE_NAME
+
+#define TICK_NS_IN_S                    1000000000U
+#define TICK_US_IN_S                    1000000U
+
+/* units per cycle in 32.32 fixed point, so a conversion is a few 32x32
+   multiplies instead of a 64-bit division */
+typedef struct {
+  uint32_t                      whole;
+  uint32_t                      frac;
+} tick_scale;
+
+static uint32_t TickCyclesLast = 0;
+static uint64_t TickCyclesHigh = 0;
+static uint32_t TickHz = 0;
+static tick_scale TickScaleNs = {0, 0};
+static tick_scale TickScaleUs = {0, 0};
+static uint64_t TickEpochCycles = 0;
+static uint64_t TickEpochNs = 0;
+static uint64_t TickEpochUs = 0;
+
+/* Weak, extends the 32-bit counter of the env, which loses a wrap unless it
+   is called at least once per wrap period, see jhal_tick_keepalive. An env
+   with a 64-bit source of its own replaces it. Called with the interrupts
+   masked */
+__WEAK uint64_t JHAL_TICK_CYCLES64(void)
+{
+  uint32_t cycles = JHAL_TICK_CYCLES();
+  
+  if(cycles < TickCyclesLast)
+    TickCyclesHigh += 0x100000000ULL;
+  TickCyclesLast = cycles;
+  
+  return TickCyclesHigh | cycles;
+}
+
+static inline uint64_t prv_tick_now(void)
+{
+  return JHAL_TICK_CYCLES64();
+}
+
+static void prv_tick_scale_set(tick_scale* pscale, uint32_t units_in_s, uint32_t cycles_hz)
+{
+  pscale->whole = units_in_s / cycles_hz;
+  pscale->frac = (uint32_t)(((uint64_t)(units_in_s % cycles_hz) << 32) / cycles_hz);
+}
+
+/* Truncates, monotonic in cycles */
+static uint64_t prv_tick_scale(uint64_t cycles, const tick_scale* pscale)
+{
+  uint32_t high = (uint32_t)(cycles >> 32);
+  uint32_t low = (uint32_t)cycles;
+  
+  return cycles * pscale->whole + (uint64_t)high * pscale->frac + (((uint64_t)low * pscale->frac) >> 32);
+}
+
+/* Starts a new epoch at cycles with the clock the env reports now */
+static void prv_tick_rescale(uint64_t cycles)
+{
+  uint32_t cycles_hz = JHAL_TICK_CYCLES_HZ();
+  
+  if(!cycles_hz)
+    return;
+  
+  if(TickHz)
+  {
+    TickEpochNs += prv_tick_scale(cycles - TickEpochCycles, &TickScaleNs);
+    TickEpochUs += prv_tick_scale(cycles - TickEpochCycles, &TickScaleUs);
+  }
+  
+  TickEpochCycles = cycles;
+  TickHz = cycles_hz;
+  prv_tick_scale_set(&TickScaleNs, TICK_NS_IN_S, cycles_hz);
+  prv_tick_scale_set(&TickScaleUs, TICK_US_IN_S, cycles_hz);
+}
+
+/* The time base works without jhal_tick_init, it reads the clock on the first use */
+static inline void prv_tick_check_scale(void)
+{
+  if(TickHz)
+    return;
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  prv_tick_rescale(prv_tick_now());
+  JHAL_CRITICAL_EXIT(state);
+}
+
+#if (USE_JHAL_INLINE == 0)
+__WEAK uint32_t JHAL_TICK(uint32_t amount_us)
+{
+  return JHAL_RES_NOT_SUPPORTED;
+}
+#endif
+
+__WEAK uint32_t JHAL_TICK_INIT(void)
+{
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+#if (USE_JHAL_INLINE == 0) || (USE_JHAL_OS == 1)
+uint32_t jhal_tick(uint32_t amount_us)
+{
+#if (USE_JHAL_OS == 1) && (USE_JHAL_DEADLINE == 1)
+  /* Sleeps through the bulk of the wait and spins the last OS tick, so the
+     delay neither stretches to the tick nor burns the CPU */
+  if(amount_us >= JHAL_OS_SLEEP_MIN_US && jhal_os_can_block())
+    return jhal_deadline_wait(jhal_deadline_in_us(amount_us), NULL, NULL);
+#elif (USE_JHAL_OS == 1)
+  /* Waits shorter than the OS tick stay busy, sleeping would stretch them */
+  if(amount_us >= JHAL_OS_SLEEP_MIN_US && jhal_os_can_block())
+    return jhal_os_sleep_us(amount_us);
+#endif
+  return JHAL_TICK(amount_us);
+}
+#endif
+
+uint32_t jhal_tick_init(void)
+{
+  uint32_t res = JHAL_TICK_INIT();
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  prv_tick_rescale(prv_tick_now());
+  JHAL_CRITICAL_EXIT(state);
+  
+  return res;
+}
+
+uint64_t jhal_tick_now(void)
+{
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  uint64_t cycles = prv_tick_now();
+  JHAL_CRITICAL_EXIT(state);
+  
+  return cycles;
+}
+
+void jhal_tick_keepalive(void)
+{
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  (void)prv_tick_now();
+  JHAL_CRITICAL_EXIT(state);
+}
+
+uint64_t jhal_tick_now_ns(void)
+{
+  prv_tick_check_scale();
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  uint64_t cycles = prv_tick_now();
+  uint64_t ns = TickEpochNs + prv_tick_scale(cycles - TickEpochCycles, &TickScaleNs);
+  JHAL_CRITICAL_EXIT(state);
+  
+  return ns;
+}
+
+uint64_t jhal_tick_now_us(void)
+{
+  prv_tick_check_scale();
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  uint64_t cycles = prv_tick_now();
+  uint64_t us = TickEpochUs + prv_tick_scale(cycles - TickEpochCycles, &TickScaleUs);
+  JHAL_CRITICAL_EXIT(state);
+  
+  return us;
+}
+
+uint64_t jhal_tick_cycles_to_ns(uint64_t cycles)
+{
+  prv_tick_check_scale();
+  
+  return prv_tick_scale(cycles, &TickScaleNs);
+}
+
+uint64_t jhal_tick_cycles_to_us(uint64_t cycles)
+{
+  prv_tick_check_scale();
+  
+  return prv_tick_scale(cycles, &TickScaleUs);
+}
+
+uint32_t jhal_tick_hz(void)
+{
+  prv_tick_check_scale();
+  
+  return TickHz;
+}
+
+__WEAK void jhal_tick_clock_hook(uint32_t cycles_hz)
+{
+  (void)cycles_hz;
+}
+
+/* The time up to the call is taken at the old clock, the env tick is
+   initialized again so it picks up the new one */
+void jhal_tick_clock_changed(void)
+{
+  prv_tick_check_scale();
+  JHAL_TICK_INIT();
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  prv_tick_rescale(prv_tick_now());
+  uint32_t cycles_hz = TickHz;
+  JHAL_CRITICAL_EXIT(state);
+  
+  jhal_tick_clock_hook(cycles_hz);
 }
\ No newline at end of file
@@ -1,17 +1,53 @@
-#ifndef __JHAL_TICK__
-#define __JHAL_TICK__
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include <stdint.h>  
-#include "jhal_environment.h"  
-  
-uint32_t jhal_tick(uint32_t amount_us);
-
-#ifdef __cplusplus
-}
-#endif
-
+#ifndef __JHAL_TICK__
+#define __JHAL_TICK__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>  
+#include "jhal_environment.h"  
+#include "jhal_os.h"
+  
+/* jhal_tick_now is the cycle counter of the environment extended to 64 bits.
+   A 32-bit counter needs a read at least once per wrap (about 23 s at
+   180 MHz), jhal_tick_keepalive does it from a periodic hook. The HAL env
+   calls it for a TIM timebase attached with env_stm32f4xx_hal_tim_base_attach,
+   otherwise the application calls it from its own tick hook: SysTick_Handler
+   next to HAL_IncTick, or the tick hook of the OS. The conversions use the core clock read by jhal_tick_init and by
+   jhal_tick_clock_changed, which the application calls right after it has
+   switched the clock; now_ns and now_us continue from the time reached at the
+   old clock, so they stay monotonic across the switch. cycles_to_ns and
+   cycles_to_us convert a difference of jhal_tick_now values at the current
+   clock */
+uint32_t jhal_tick_init(void);
+uint64_t jhal_tick_now(void);
+void jhal_tick_keepalive(void);
+uint64_t jhal_tick_now_ns(void);
+uint64_t jhal_tick_now_us(void);
+uint64_t jhal_tick_cycles_to_ns(uint64_t cycles);
+uint64_t jhal_tick_cycles_to_us(uint64_t cycles);
+uint32_t jhal_tick_hz(void);
+void jhal_tick_clock_changed(void);
+/* Weak, called by jhal_tick_clock_changed with the new core clock, so the
+   application can re-time what depends on it */
+void jhal_tick_clock_hook(uint32_t cycles_hz);
+  
+#if (USE_JHAL_INLINE == 0) || (USE_JHAL_OS == 1)
+uint32_t jhal_tick(uint32_t amount_us);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#if (USE_JHAL_INLINE == 1) && (USE_JHAL_OS == 0)
+#include JHAL_TICK_INCLUDE_NAME
+
+static inline uint32_t jhal_tick(uint32_t amount_us)
+{
+  return JHAL_TICK(amount_us);
+}
+#endif
+
 #endif
\ No newline at end of file
@@ -1,209 +1,273 @@
-#include "jhal_tim_base.h"
-#include JHAL_TIM_BASE_INCLUDE_NAME
-
-struct _instance_list{
-  void*                               puser_data;  
-  jhal_type_tim_base_period_ellapsed  pfunc_period_ellapsed;
-  struct _instance_list*              pnext;
-  struct _instance_list*              pprev;
-  void*                               pinstance;  
-};
-
-typedef struct _instance_list instance_list;
-
-static instance_list* plist_top = NULL;
-
-__WEAK uint8_t JHAL_TIM_BASE_INIT(void* pinstance, jhal_tim_base_params* pparams)
-{
-  (void)pinstance;
-  (void)pparams;  
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_TIM_BASE_DEINIT(void* pinstance)
-{
-  (void)pinstance;
-  
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_TIM_BASE_START(void* pinstance)
-{
-  (void)pinstance;
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_TIM_BASE_START_IT(void* pinstance)
-{
-  (void)pinstance;
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_TIM_BASE_START_DMA(void* pinstance, uint8_t* pdata, uint16_t size, void* pinstance_dma)
-{
-  (void)pinstance;
-  (void)pdata;
-  (void)size;
-  (void)pinstance_dma;
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_TIM_BASE_STOP(void* pinstance)
-{
-  (void)pinstance;
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_TIM_BASE_STOP_IT(void* pinstance)
-{
-  (void)pinstance;
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-__WEAK uint8_t JHAL_TIM_BASE_STOP_DMA(void* pinstance, void* pinstance_dma)
-{
-  (void)pinstance;
-  (void)pinstance_dma;
-
-  return JHAL_RES_NOT_SUPPORTED;
-}
-
-uint8_t jhal_tim_base_init(void** ppinstance, jhal_tim_base_params* pparams)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)       
-   if(!ppinstance || *ppinstance || !pparams) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   instance_list* plist_new = (instance_list*)jhal_malloc(JHAL_TIM_BASE_SIZE_DRV + sizeof(instance_list));
-   
-   if(plist_new == NULL)  
-     return JHAL_RES_ALLOC_ERROR;
-   
-   plist_new->pfunc_period_ellapsed = pparams->pfunc_period_ellapsed;
-   plist_new->puser_data = pparams->puser_data;
-   
-   uint8_t res = JHAL_TIM_BASE_INIT(plist_new->pinstance, pparams); 
-   
-   if(res == JHAL_RES_NO_ERRORS)
-   {
-     JHAL_DRV_ITEM_ADD(plist_new);
-       
-     *ppinstance = plist_new->pinstance;
-   } else 
-   {
-     *ppinstance = NULL;
-     jhal_free(plist_new);
-   } 
-   
-   return res;
-}
-
-uint8_t jhal_tim_base_deinit(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-  instance_list* plist = plist_top;
-  while(plist != NULL)
-  {
-    if(plist->pinstance == pinstance)
-      break;
-
-    plist = plist->pnext;
-  }
-  
-  if(plist == NULL)
-    return JHAL_RES_INVALID_PARAMS;
-  
-  JHAL_DRV_ITEM_DELETE(plist);
-      
-  jhal_free(pinstance);  
-  
-  return JHAL_TIM_BASE_DEINIT(pinstance);
-}
-
-uint8_t jhal_tim_base_start(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   
-   return JHAL_TIM_BASE_START(pinstance);
-}
-
-uint8_t jhal_tim_base_start_it(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   
-   return JHAL_TIM_BASE_START_IT(pinstance);
-}
-
-uint8_t jhal_tim_base_start_dma(void* pinstance, uint8_t* pData, uint16_t size, void* pinstance_dma)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !pData || !size || !pinstance_dma) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   
-   return JHAL_TIM_BASE_START_DMA(pinstance, pData, size, pinstance_dma);
-}
-
-uint8_t jhal_tim_base_stop(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   
-   return JHAL_TIM_BASE_STOP(pinstance);
-}
-
-uint8_t jhal_tim_base_stop_it(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   
-   return JHAL_TIM_BASE_STOP_IT(pinstance);
-}
-
-uint8_t jhal_tim_base_stop_dma(void* pinstance, void* pinstance_dma)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-   if(!pinstance || !pinstance_dma) 
-     return JHAL_RES_INVALID_PARAMS;
-#endif
-   
-   return JHAL_TIM_BASE_STOP_DMA(pinstance, pinstance_dma);
-}
-
-void jhal_tim_base_period_ellapsed_callback(void* pinstance)
-{
-#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
-  JHAL_ASSERT(pinstance);  
-#endif
-  instance_list* plist = plist_top;
-  while(plist != NULL)
-  {
-    if(plist->pinstance == pinstance)
-    {
-      if(plist->pfunc_period_ellapsed)
-        plist->pfunc_period_ellapsed(plist->puser_data);
-      
-      break;
-    }
-    plist = plist->pnext;
-  }    
-}
\ No newline at end of file
+#include "jhal_tim_base.h"
+#include JHAL_TIM_BASE_INCLUDE_NAME
+
+#if (USE_JHAL_MEM_LINKED == 1)
+JHAL_MEM_SLOTS_DEFINE(TIM_BASE);
+#endif
+
+__WEAK uint8_t JHAL_TIM_BASE_INIT(void* pinstance, jhal_tim_base_params* pparams)
+{
+  (void)pinstance;
+  (void)pparams;  
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_TIM_BASE_DEINIT(void* pinstance)
+{
+  (void)pinstance;
+  
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+#if (USE_JHAL_INLINE == 0)
+__WEAK uint8_t JHAL_TIM_BASE_START(void* pinstance)
+{
+  (void)pinstance;
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_TIM_BASE_START_IT(void* pinstance)
+{
+  (void)pinstance;
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_TIM_BASE_START_DMA(void* pinstance, uint8_t* pdata, uint16_t size, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)pdata;
+  (void)size;
+  (void)pinstance_dma;
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_TIM_BASE_STOP(void* pinstance)
+{
+  (void)pinstance;
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_TIM_BASE_STOP_IT(void* pinstance)
+{
+  (void)pinstance;
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+
+__WEAK uint8_t JHAL_TIM_BASE_STOP_DMA(void* pinstance, void* pinstance_dma)
+{
+  (void)pinstance;
+  (void)pinstance_dma;
+
+  return JHAL_RES_NOT_SUPPORTED;
+}
+#endif
+
+#if (USE_JHAL_OPS == 1)
+JHAL_TIM_BASE_OPS_DECLARE(jhal_tim_base_ops_default, JHAL_MCU_ENV);
+#endif
+
+static uint8_t prv_tim_base_init(jhal_driver_instance* pnew_instance, void** ppinstance, jhal_tim_base_params* pparams)
+{
+   tim_base_callback_instance* pcallbacks = (tim_base_callback_instance*)pnew_instance->pfuncs_callbacks;
+   pcallbacks->pfunc_period_ellapsed = pparams->pfunc_period_ellapsed;
+#if (USE_JHAL_SCRIPT == 1)
+   pcallbacks->pscript = NULL;
+#endif
+   pnew_instance->puser_data = pparams->puser_data;
+#if (USE_JHAL_OPS == 1)
+   pnew_instance->pops = JHAL_OPS_BY_PARAMS(pparams, _tim_base);
+#endif
+   
+   uint8_t res = JHAL_DISPATCH(pnew_instance->pinstance, _tim_base, _init)(pnew_instance->pinstance, pparams); 
+   
+   if(res == JHAL_RES_NO_ERRORS)       
+     *ppinstance = pnew_instance->pinstance;
+   else 
+   {
+     *ppinstance = NULL;
+     jhal_driver_free(pnew_instance->pinstance);
+   }  
+   
+   return res;
+}
+
+uint8_t (jhal_tim_base_init)(void** ppinstance, jhal_tim_base_params* pparams)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)       
+   if(!ppinstance || *ppinstance || !pparams) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = JHAL_DRIVER_MALLOC(JHAL_SIZE_DRV_BY_PARAMS(pparams, _tim_base), sizeof(tim_base_callback_instance), TIM_BASE);
+     
+   if(pnew_instance == NULL)  
+     return JHAL_RES_ALLOC_ERROR;
+   
+   return prv_tim_base_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_tim_base_init_static(void** ppinstance, jhal_tim_base_params* pparams, void* pmem, uint32_t size_mem)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)       
+   if(!ppinstance || *ppinstance || !pparams || !pmem) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   jhal_driver_instance* pnew_instance = jhal_driver_place(pmem, size_mem, JHAL_SIZE_DRV_BY_PARAMS(pparams, _tim_base), sizeof(tim_base_callback_instance));
+     
+   if(pnew_instance == NULL)  
+     return JHAL_RES_ALLOC_ERROR;
+   
+   return prv_tim_base_init(pnew_instance, ppinstance, pparams);
+}
+
+uint8_t jhal_tim_base_deinit(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint8_t res = JHAL_DISPATCH(pinstance, _tim_base, _deinit)(pinstance);
+  
+  jhal_driver_free(pinstance);
+  
+  return res;
+}
+
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_tim_base_start(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   
+   return JHAL_DISPATCH(pinstance, _tim_base, _start)(pinstance);
+}
+
+uint8_t jhal_tim_base_start_it(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   
+   return JHAL_DISPATCH(pinstance, _tim_base, _start_it)(pinstance);
+}
+
+uint8_t jhal_tim_base_start_dma(void* pinstance, uint8_t* pData, uint16_t size, void* pinstance_dma)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pData || !size || !pinstance_dma) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   
+   return JHAL_DISPATCH(pinstance, _tim_base, _start_dma)(pinstance, pData, size, pinstance_dma);
+}
+
+uint8_t jhal_tim_base_stop(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   
+   return JHAL_DISPATCH(pinstance, _tim_base, _stop)(pinstance);
+}
+
+uint8_t jhal_tim_base_stop_it(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   
+   return JHAL_DISPATCH(pinstance, _tim_base, _stop_it)(pinstance);
+}
+
+uint8_t jhal_tim_base_stop_dma(void* pinstance, void* pinstance_dma)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance || !pinstance_dma) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+   
+   return JHAL_DISPATCH(pinstance, _tim_base, _stop_dma)(pinstance, pinstance_dma);
+}
+#endif
+
+#if (USE_JHAL_SCRIPT == 1)
+/* Hands the completions of the instance to a running script, NULL gives them
+   back to the callbacks */
+uint8_t jhal_tim_base_script_attach(void* pinstance, jhal_script* pscript)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+   if(!pinstance) 
+     return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  tim_base_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, tim_base_callback_instance);
+  
+  if(pscript != NULL && pcallbacks->pscript != NULL && pcallbacks->pscript != pscript)
+    return JHAL_RES_ERROR;
+  
+  pcallbacks->pscript = pscript;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+#endif
+
+#if (USE_JHAL_DEFER == 1)
+static void prv_tim_base_defer_dispatch(const jhal_defer_event* pevent)
+{
+  JHAL_GET_CALLBACKS(pevent->pinstance, tim_base_callback_instance)->pfunc_period_ellapsed(JHAL_GET_USERDATA(pevent->pinstance));
+}
+#endif
+
+void jhal_tim_base_period_ellapsed_callback(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  JHAL_ASSERT(pinstance);  
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return;
+#endif
+  JHAL_PROBE_EVENT(JHAL_DRIVER_TYPE_TIM_BASE, pinstance, JHAL_TRACE_OP_PERIOD_ELLAPSED, 0);
+  tim_base_callback_instance* pcallbacks = JHAL_GET_CALLBACKS(pinstance, tim_base_callback_instance);
+  
+#if (USE_JHAL_SCRIPT == 1)
+  if(pcallbacks->pscript)
+  {
+    jhal_script_period_ellapsed(pcallbacks->pscript);
+    return;
+  }
+#endif
+  
+#if (USE_JHAL_DEFER == 1)
+  if(pcallbacks->pfunc_period_ellapsed && JHAL_DEFER_POST(pinstance, prv_tim_base_defer_dispatch, 0, 0, NULL, 0))
+    return;
+#endif
+  
+  if(pcallbacks->pfunc_period_ellapsed)
+    pcallbacks->pfunc_period_ellapsed(JHAL_GET_USERDATA(pinstance));
+}
+
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_tim_base_get_stats(void* pinstance, jhal_stats* pstats)
+{
+  return jhal_stats_get(pinstance, pstats);
+}
+
+uint8_t jhal_tim_base_reset_stats(void* pinstance)
+{
+  return jhal_stats_reset(pinstance);
+}
+#endif
\ No newline at end of file
@@ -1,61 +1,161 @@
-#ifndef __JHAL_TIM__
-#define __JHAL_TIM__
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include "jhal_environment.h"
-
-typedef void (*jhal_type_tim_base_period_ellapsed)(void*);
-  
-#define JHAL_TIM_CLOCK_SOURCE_INTERNAL          12U
-#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_1        144U  
-#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_2        32U
-#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_3        225U
-#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_4        113U
-#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_5        89U
-#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_6        94U
-#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_7        33U
-#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_8        117U
-#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_9        11U
-#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_10       100U
-  
-typedef enum {
-  JHAL_TIM_BASE_TYPE_COUNTER_DOWN  =  31U,
-  JHAL_TIM_BASE_TYPE_COUNTER_UP    =  74U
-} jhal_tim_base_type_counter;
-  
-typedef struct {
-  uint8_t                               num_module;
-  uint8_t                               clock_source;
-  uint32_t                              prescaler; 
-  uint32_t                              clock_prescaler;
-  uint32_t                              period;
-  uint32_t                              preload_value;
-  uint32_t                              counter;
-  jhal_tim_base_type_counter            type_counter;
-  
-  jhal_type_tim_base_period_ellapsed    pfunc_period_ellapsed;
-  void*                                 plib_data;
-  void*                                 puser_data;
-} jhal_tim_base_params;
-
-
-uint8_t jhal_tim_base_init(void** ppinstance, jhal_tim_base_params* pparams);
-uint8_t jhal_tim_base_deinit(void* pinstance);
-uint8_t jhal_tim_base_start(void* pinstance);
-uint8_t jhal_tim_base_start_it(void* pinstance);
-uint8_t jhal_tim_base_start_dma(void* pinstance, uint8_t* pData, uint16_t size, void* pinstance_dma);
-uint8_t jhal_tim_base_stop(void* pinstance);
-uint8_t jhal_tim_base_stop_it(void* pinstance);
-uint8_t jhal_tim_base_stop_dma(void* pinstance, void* pinstance_dma);
-
-void jhal_tim_base_period_ellapsed_callback(void* pinstance);
-
-
-#ifdef __cplusplus
-}
-#endif
-
+#ifndef __JHAL_TIM__
+#define __JHAL_TIM__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+#include "jhal_defer.h"
+#include "jhal_probe.h"
+#include "jhal_script.h"
+
+typedef void (*jhal_type_tim_base_period_ellapsed)(void*);
+  
+#define JHAL_TIM_CLOCK_SOURCE_INTERNAL          12U
+#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_1        144U  
+#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_2        32U
+#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_3        225U
+#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_4        113U
+#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_5        89U
+#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_6        94U
+#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_7        33U
+#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_8        117U
+#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_9        11U
+#define JHAL_TIM_CLOCK_SOURCE_EXTERNAL_10       100U
+  
+typedef enum {
+  JHAL_TIM_BASE_TYPE_COUNTER_DOWN  =  31U,
+  JHAL_TIM_BASE_TYPE_COUNTER_UP    =  74U
+} jhal_tim_base_type_counter;
+  
+#if (USE_JHAL_OPS == 1)
+typedef struct jhal_tim_base_ops_struct jhal_tim_base_ops;
+#endif
+
+typedef struct {
+  uint8_t                               num_module;
+  uint8_t                               clock_source;
+  uint32_t                              prescaler; 
+  uint32_t                              clock_prescaler;
+  uint32_t                              period;
+  uint32_t                              preload_value;
+  uint32_t                              counter;
+  jhal_tim_base_type_counter            type_counter;
+  
+  jhal_type_tim_base_period_ellapsed    pfunc_period_ellapsed;
+  void*                                 plib_data;
+  void*                                 puser_data;
+#if (USE_JHAL_OPS == 1)
+  const jhal_tim_base_ops*              pops;
+#endif
+} jhal_tim_base_params;
+
+
+typedef struct {
+  jhal_type_tim_base_period_ellapsed  pfunc_period_ellapsed;
+#if (USE_JHAL_SCRIPT == 1)
+  jhal_script*                        pscript;
+#endif
+} tim_base_callback_instance;
+
+#define JHAL_TIM_BASE_SIZE_STATIC                JHAL_DRIVER_SIZE_STATIC(JHAL_TIM_BASE_SIZE_DRV_STATIC, sizeof(tim_base_callback_instance))
+#define JHAL_TIM_BASE_DECLARE_STATIC(NAME)       JHAL_DECLARE_STATIC_MEM(NAME, JHAL_TIM_BASE_SIZE_STATIC)
+#if (USE_JHAL_MEM_LINKED == 1)
+#define JHAL_TIM_BASE_DECLARE_INSTANCE(NAME)     JHAL_DECLARE_INSTANCE(NAME, JHAL_TIM_BASE_SIZE_STATIC, TIM_BASE)
+JHAL_MEM_SLOTS_DECLARE(TIM_BASE);
+#endif
+
+#if (USE_JHAL_OPS == 1)
+struct jhal_tim_base_ops_struct {
+  uint32_t (*pfunc_size_drv)(void);
+  uint8_t (*pfunc_init)(void* pinstance, jhal_tim_base_params* pparams);
+  uint8_t (*pfunc_deinit)(void* pinstance);
+  uint8_t (*pfunc_start)(void* pinstance);
+  uint8_t (*pfunc_start_it)(void* pinstance);
+  uint8_t (*pfunc_start_dma)(void* pinstance, uint8_t* pdata, uint16_t size, void* pinstance_dma);
+  uint8_t (*pfunc_stop)(void* pinstance);
+  uint8_t (*pfunc_stop_it)(void* pinstance);
+  uint8_t (*pfunc_stop_dma)(void* pinstance, void* pinstance_dma);
+};
+
+extern const jhal_tim_base_ops jhal_tim_base_ops_default;
+
+#define JHAL_TIM_BASE_OPS_DECLARE(NAME, ENV)   const jhal_tim_base_ops NAME = {\
+        JHAL_FUNCTION_NAME(ENV,_tim_base,_size_drv),\
+        JHAL_FUNCTION_NAME(ENV,_tim_base,_init),\
+        JHAL_FUNCTION_NAME(ENV,_tim_base,_deinit),\
+        JHAL_FUNCTION_NAME(ENV,_tim_base,_start),\
+        JHAL_FUNCTION_NAME(ENV,_tim_base,_start_it),\
+        JHAL_FUNCTION_NAME(ENV,_tim_base,_start_dma),\
+        JHAL_FUNCTION_NAME(ENV,_tim_base,_stop),\
+        JHAL_FUNCTION_NAME(ENV,_tim_base,_stop_it),\
+        JHAL_FUNCTION_NAME(ENV,_tim_base,_stop_dma)}
+#define JHAL_TIM_BASE_SIZE_STATIC_BY_ENV(ENV)  JHAL_DRIVER_SIZE_STATIC(JHAL_FUNCTION_NAME(ENV,_tim_base,_size_drv_static), sizeof(tim_base_callback_instance))
+#endif
+
+uint8_t jhal_tim_base_init(void** ppinstance, jhal_tim_base_params* pparams);
+uint8_t jhal_tim_base_init_static(void** ppinstance, jhal_tim_base_params* pparams, void* pmem, uint32_t size_mem);
+uint8_t jhal_tim_base_deinit(void* pinstance);
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_tim_base_get_stats(void* pinstance, jhal_stats* pstats);
+uint8_t jhal_tim_base_reset_stats(void* pinstance);
+#endif
+#if (USE_JHAL_SCRIPT == 1)
+uint8_t jhal_tim_base_script_attach(void* pinstance, jhal_script* pscript);
+#endif
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_tim_base_start(void* pinstance);
+uint8_t jhal_tim_base_start_it(void* pinstance);
+uint8_t jhal_tim_base_start_dma(void* pinstance, uint8_t* pData, uint16_t size, void* pinstance_dma);
+uint8_t jhal_tim_base_stop(void* pinstance);
+uint8_t jhal_tim_base_stop_it(void* pinstance);
+uint8_t jhal_tim_base_stop_dma(void* pinstance, void* pinstance_dma);
+#endif
+
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+  #define jhal_tim_base_init(PPINSTANCE, PPARAMS)    JHAL_MEM_CALL_SITE((jhal_tim_base_init)(PPINSTANCE, PPARAMS))
+#endif
+
+void jhal_tim_base_period_ellapsed_callback(void* pinstance);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#include JHAL_TIM_BASE_INCLUDE_NAME
+
+#if (USE_JHAL_INLINE == 1)
+static inline uint8_t jhal_tim_base_start(void* pinstance)
+{
+  return JHAL_DISPATCH(pinstance, _tim_base, _start)(pinstance);
+}
+
+static inline uint8_t jhal_tim_base_start_it(void* pinstance)
+{
+  return JHAL_DISPATCH(pinstance, _tim_base, _start_it)(pinstance);
+}
+
+static inline uint8_t jhal_tim_base_start_dma(void* pinstance, uint8_t* pData, uint16_t size, void* pinstance_dma)
+{
+  return JHAL_DISPATCH(pinstance, _tim_base, _start_dma)(pinstance, pData, size, pinstance_dma);
+}
+
+static inline uint8_t jhal_tim_base_stop(void* pinstance)
+{
+  return JHAL_DISPATCH(pinstance, _tim_base, _stop)(pinstance);
+}
+
+static inline uint8_t jhal_tim_base_stop_it(void* pinstance)
+{
+  return JHAL_DISPATCH(pinstance, _tim_base, _stop_it)(pinstance);
+}
+
+static inline uint8_t jhal_tim_base_stop_dma(void* pinstance, void* pinstance_dma)
+{
+  return JHAL_DISPATCH(pinstance, _tim_base, _stop_dma)(pinstance, pinstance_dma);
+}
+#endif
+
 #endif
\ No newline at end of file
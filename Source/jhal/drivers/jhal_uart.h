@@ -1,90 +1,276 @@
-#ifndef __JHAL_UART__
-#define __JHAL_UART__
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include "jhal_environment.h"
-
-typedef void (*jhal_type_uart_tx_complete)(void*);
-typedef void (*jhal_type_uart_txrx_complete)(void*, uint8_t* prxdata, uint16_t size);
-typedef void (*jhal_type_uart_rx_complete)(void*, uint8_t* prxdata, uint16_t size);
-  
-typedef enum {
-  JHAL_UART_BAUDRATE_300    = 123U,
-  JHAL_UART_BAUDRATE_600    = 14U,
-  JHAL_UART_BAUDRATE_1200   = 208U,
-  JHAL_UART_BAUDRATE_2400   = 211U,
-  JHAL_UART_BAUDRATE_4800   = 105U,
-  JHAL_UART_BAUDRATE_9600   = 175U,
-  JHAL_UART_BAUDRATE_19200  = 76U,
-  JHAL_UART_BAUDRATE_38400  = 43U,
-  JHAL_UART_BAUDRATE_57600  = 102U,
-  JHAL_UART_BAUDRATE_115200 = 66U,
-  JHAL_UART_BAUDRATE_230400 = 222U,
-  JHAL_UART_BAUDRATE_460800 = 117U,
-  JHAL_UART_BAUDRATE_921600 = 217U
-} jhal_uart_baudrate;
-
-typedef enum {
-  JHAL_UART_DATA_SIZE_5BIT = 35U,
-  JHAL_UART_DATA_SIZE_6BIT = 124U,
-  JHAL_UART_DATA_SIZE_7BIT = 233U,
-  JHAL_UART_DATA_SIZE_8BIT = 67U,
-  JHAL_UART_DATA_SIZE_9BIT = 55U,
-} jhal_uart_data_size;
-
-typedef enum {
-  JHAL_UART_STOP_BITS_1BIT  = 89U,
-  JHAL_UART_STOP_BITS_15BIT = 177U,
-  JHAL_UART_STOP_BITS_2BIT  = 165U
-} jhal_uart_stop_bits;
-
-typedef enum {
-  JHAL_UART_PARITY_NONE  = 90U,
-  JHAL_UART_PARITY_EVEN  = 208U,
-  JHAL_UART_PARITY_ODD   = 22U
-} jhal_uart_parity;
-
-typedef enum {
-  JHAL_UART_HWR_FLOW_CTRL_NOT_USE = 33U,
-  JHAL_UART_HWR_FLOW_CTRL_USE = 67U
-} jhal_uart_hwr_flow_ctrl;
-
-typedef struct {
-  uint8_t                        num_module;
-  jhal_uart_baudrate             baudrate;
-  jhal_uart_data_size            data_size;
-  jhal_uart_stop_bits            stop_bits;
-  jhal_uart_parity               parity;
-  jhal_uart_hwr_flow_ctrl        hwr_flow_ctrl;  
-  
-  jhal_type_uart_tx_complete     pfunc_tx_complete;
-  jhal_type_uart_rx_complete     pfunc_rx_complete;
-  jhal_type_uart_txrx_complete   pfunc_txrx_complete;  
-  void*                          plib_data;
-  void*                          puser_data;
-} jhal_uart_params;
-
-uint8_t jhal_uart_init(void** ppinstance, jhal_uart_params* pparams);
-uint8_t jhal_uart_deinit(void* pinstance);
-uint8_t jhal_uart_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
-uint8_t jhal_uart_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout);
-uint8_t jhal_uart_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
-uint8_t jhal_uart_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size);
-uint8_t jhal_uart_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size);
-uint8_t jhal_uart_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
-uint8_t jhal_uart_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
-uint8_t jhal_uart_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
-uint8_t jhal_uart_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
-
-void jhal_uart_tx_complete_callback(void* pinstance);
-void jhal_uart_rx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size);
-void jhal_uart_txrx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size);
-
-#ifdef __cplusplus
-}
-#endif
-
+#ifndef __JHAL_UART__
+#define __JHAL_UART__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+#include "jhal_os.h"
+#include "jhal_request.h"
+#include "jhal_defer.h"
+#include "jhal_probe.h"
+#include "jhal_buf.h"
+
+#define JHAL_UART_ERROR_PARITY                  1U
+#define JHAL_UART_ERROR_NOISE                   2U
+#define JHAL_UART_ERROR_FRAMING                 3U
+#define JHAL_UART_ERROR_OVERRUN                 4U
+#define JHAL_UART_ERROR_DMA                     5U
+/* A segment of a buf chain failed to start, the rest of the chain is dropped */
+#define JHAL_UART_ERROR_START                   6U
+
+typedef void (*jhal_type_uart_tx_complete)(void*);
+typedef void (*jhal_type_uart_txrx_complete)(void*, uint8_t* prxdata, uint16_t size);
+typedef void (*jhal_type_uart_rx_complete)(void*, uint8_t* prxdata, uint16_t size);
+typedef void (*jhal_type_uart_error)(void*, uint8_t error);
+  
+typedef enum {
+  JHAL_UART_BAUDRATE_300    = 123U,
+  JHAL_UART_BAUDRATE_600    = 14U,
+  JHAL_UART_BAUDRATE_1200   = 208U,
+  JHAL_UART_BAUDRATE_2400   = 211U,
+  JHAL_UART_BAUDRATE_4800   = 105U,
+  JHAL_UART_BAUDRATE_9600   = 175U,
+  JHAL_UART_BAUDRATE_19200  = 76U,
+  JHAL_UART_BAUDRATE_38400  = 43U,
+  JHAL_UART_BAUDRATE_57600  = 102U,
+  JHAL_UART_BAUDRATE_115200 = 66U,
+  JHAL_UART_BAUDRATE_230400 = 222U,
+  JHAL_UART_BAUDRATE_460800 = 117U,
+  JHAL_UART_BAUDRATE_921600 = 217U
+} jhal_uart_baudrate;
+
+typedef enum {
+  JHAL_UART_DATA_SIZE_5BIT = 35U,
+  JHAL_UART_DATA_SIZE_6BIT = 124U,
+  JHAL_UART_DATA_SIZE_7BIT = 233U,
+  JHAL_UART_DATA_SIZE_8BIT = 67U,
+  JHAL_UART_DATA_SIZE_9BIT = 55U,
+} jhal_uart_data_size;
+
+typedef enum {
+  JHAL_UART_STOP_BITS_1BIT  = 89U,
+  JHAL_UART_STOP_BITS_15BIT = 177U,
+  JHAL_UART_STOP_BITS_2BIT  = 165U
+} jhal_uart_stop_bits;
+
+typedef enum {
+  JHAL_UART_PARITY_NONE  = 90U,
+  JHAL_UART_PARITY_EVEN  = 208U,
+  JHAL_UART_PARITY_ODD   = 22U
+} jhal_uart_parity;
+
+typedef enum {
+  JHAL_UART_HWR_FLOW_CTRL_NOT_USE = 33U,
+  JHAL_UART_HWR_FLOW_CTRL_USE = 67U
+} jhal_uart_hwr_flow_ctrl;
+
+#if (USE_JHAL_OPS == 1)
+typedef struct jhal_uart_ops_struct jhal_uart_ops;
+#endif
+
+typedef struct {
+  uint8_t                        num_module;
+  jhal_uart_baudrate             baudrate;
+  jhal_uart_data_size            data_size;
+  jhal_uart_stop_bits            stop_bits;
+  jhal_uart_parity               parity;
+  jhal_uart_hwr_flow_ctrl        hwr_flow_ctrl;  
+  
+  jhal_type_uart_tx_complete     pfunc_tx_complete;
+  jhal_type_uart_rx_complete     pfunc_rx_complete;
+  jhal_type_uart_txrx_complete   pfunc_txrx_complete;  
+  jhal_type_uart_error           pfunc_error;
+  void*                          plib_data;
+  void*                          puser_data;
+#if (USE_JHAL_OPS == 1)
+  const jhal_uart_ops*           pops;
+#endif
+} jhal_uart_params;
+
+typedef struct {
+  jhal_type_uart_tx_complete    pfunc_tx_complete;
+  jhal_type_uart_rx_complete    pfunc_rx_complete;
+  jhal_type_uart_txrx_complete  pfunc_txrx_complete;
+  jhal_type_uart_error          pfunc_error;
+#if (USE_JHAL_OS == 1)
+  jhal_os_blocking              blocking;
+  volatile uint8_t              error;
+#endif
+#if (USE_JHAL_QUEUE == 1)
+  jhal_request_queue*           pqueue;
+#endif
+#if (USE_JHAL_BUF == 1)
+  jhal_buf_tx                   buf_tx;
+  jhal_buf*                     pbuf_rx;
+#endif
+} uart_callback_instance;
+
+#define JHAL_UART_SIZE_STATIC                    JHAL_DRIVER_SIZE_STATIC(JHAL_UART_SIZE_DRV_STATIC, sizeof(uart_callback_instance))
+#define JHAL_UART_DECLARE_STATIC(NAME)           JHAL_DECLARE_STATIC_MEM(NAME, JHAL_UART_SIZE_STATIC)
+#if (USE_JHAL_MEM_LINKED == 1)
+#define JHAL_UART_DECLARE_INSTANCE(NAME)         JHAL_DECLARE_INSTANCE(NAME, JHAL_UART_SIZE_STATIC, UART)
+JHAL_MEM_SLOTS_DECLARE(UART);
+#endif
+
+#if (USE_JHAL_OPS == 1)
+struct jhal_uart_ops_struct {
+  uint32_t (*pfunc_size_drv)(void);
+  uint8_t (*pfunc_init)(void* pinstance, jhal_uart_params* pparams);
+  uint8_t (*pfunc_deinit)(void* pinstance);
+  uint8_t (*pfunc_transmit)(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+  uint8_t (*pfunc_receive)(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+  uint8_t (*pfunc_transmitreceive)(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+  uint8_t (*pfunc_transmit_it)(void* pinstance, uint8_t* ptxdata, uint16_t size);
+  uint8_t (*pfunc_receive_it)(void* pinstance, uint8_t* prxdata, uint16_t size);
+  uint8_t (*pfunc_transmitreceive_it)(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
+  uint8_t (*pfunc_transmit_dma)(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+  uint8_t (*pfunc_receive_dma)(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+  uint8_t (*pfunc_transmitreceive_dma)(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+  uint8_t (*pfunc_abort)(void* pinstance);
+  uint8_t (*pfunc_set_baudrate)(void* pinstance, jhal_uart_baudrate baudrate);
+};
+
+extern const jhal_uart_ops jhal_uart_ops_default;
+
+#define JHAL_UART_OPS_DECLARE(NAME, ENV)   const jhal_uart_ops NAME = {\
+        JHAL_FUNCTION_NAME(ENV,_uart,_size_drv),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_init),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_deinit),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_transmit),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_receive),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_transmitreceive),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_transmit_it),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_receive_it),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_transmitreceive_it),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_transmit_dma),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_receive_dma),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_transmitreceive_dma),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_abort),\
+        JHAL_FUNCTION_NAME(ENV,_uart,_set_baudrate)}
+#define JHAL_UART_SIZE_STATIC_BY_ENV(ENV)  JHAL_DRIVER_SIZE_STATIC(JHAL_FUNCTION_NAME(ENV,_uart,_size_drv_static), sizeof(uart_callback_instance))
+#endif
+
+uint8_t jhal_uart_init(void** ppinstance, jhal_uart_params* pparams);
+uint8_t jhal_uart_init_static(void** ppinstance, jhal_uart_params* pparams, void* pmem, uint32_t size_mem);
+uint8_t jhal_uart_deinit(void* pinstance);
+#if (USE_JHAL_STATS == 1)
+uint8_t jhal_uart_get_stats(void* pinstance, jhal_stats* pstats);
+uint8_t jhal_uart_reset_stats(void* pinstance);
+#endif
+uint8_t jhal_uart_abort(void* pinstance);
+/* Switches an idle instance to another baudrate, the rest of the frame format
+   is kept. Meant for protocols that change the speed on the fly */
+uint8_t jhal_uart_set_baudrate(void* pinstance, jhal_uart_baudrate baudrate);
+#if (USE_JHAL_QUEUE == 1)
+uint8_t jhal_uart_queue_attach(void* pinstance, jhal_request_queue* pqueue);
+#endif
+#if (USE_JHAL_INLINE == 0) || (USE_JHAL_OS == 1)
+uint8_t jhal_uart_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout);
+uint8_t jhal_uart_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+uint8_t jhal_uart_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout);
+#endif
+#if (USE_JHAL_INLINE == 0)
+uint8_t jhal_uart_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size);
+uint8_t jhal_uart_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size);
+uint8_t jhal_uart_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size);
+uint8_t jhal_uart_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma);
+uint8_t jhal_uart_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+uint8_t jhal_uart_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma);
+#endif
+#if (USE_JHAL_BUF == 1)
+uint8_t jhal_uart_transmit_buf(void* pinstance, jhal_buf* pbuf, uint32_t timeout);
+uint8_t jhal_uart_receive_buf(void* pinstance, jhal_buf* pbuf, uint16_t size, uint32_t timeout);
+uint8_t jhal_uart_transmit_buf_it(void* pinstance, jhal_buf* pbuf);
+uint8_t jhal_uart_receive_buf_it(void* pinstance, jhal_buf* pbuf, uint16_t size);
+uint8_t jhal_uart_transmit_buf_dma(void* pinstance, jhal_buf* pbuf, void* pinstance_dma);
+uint8_t jhal_uart_receive_buf_dma(void* pinstance, jhal_buf* pbuf, uint16_t size, void* pinstance_dma);
+#endif
+
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+  #define jhal_uart_init(PPINSTANCE, PPARAMS)    JHAL_MEM_CALL_SITE((jhal_uart_init)(PPINSTANCE, PPARAMS))
+#endif
+
+/* An IT or DMA transfer ends with one of the completions or with the error
+   callback, an error ends both directions of the transfer in progress */
+void jhal_uart_tx_complete_callback(void* pinstance);
+void jhal_uart_rx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size);
+void jhal_uart_txrx_complete_callback(void* pinstance, uint8_t* prxdata, uint16_t size);
+void jhal_uart_error_callback(void* pinstance, uint8_t error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#include JHAL_UART_INCLUDE_NAME
+
+#if (USE_JHAL_INLINE == 1)
+#if (USE_JHAL_OS == 0)
+static inline uint8_t jhal_uart_transmit(void* pinstance, uint8_t* ptxdata, uint16_t size, uint32_t timeout)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, uart_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_TRANSMIT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_TRANSMIT, size, JHAL_DISPATCH(pinstance, _uart, _transmit)(pinstance, ptxdata, size, timeout));
+}
+
+static inline uint8_t jhal_uart_receive(void* pinstance, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, uart_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_RECEIVE, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_RECEIVE, size, JHAL_DISPATCH(pinstance, _uart, _receive)(pinstance, prxdata, size, timeout));
+}
+
+static inline uint8_t jhal_uart_transmitreceive(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, uint32_t timeout)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, uart_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE, size, JHAL_DISPATCH(pinstance, _uart, _transmitreceive)(pinstance, ptxdata, prxdata, size, timeout));
+}
+
+#endif
+
+static inline uint8_t jhal_uart_transmit_it(void* pinstance, uint8_t* ptxdata, uint16_t size)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, uart_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_TRANSMIT_IT, size, JHAL_DISPATCH(pinstance, _uart, _transmit_it)(pinstance, ptxdata, size));
+}
+
+static inline uint8_t jhal_uart_receive_it(void* pinstance, uint8_t* prxdata, uint16_t size)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, uart_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_RECEIVE_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_RECEIVE_IT, size, JHAL_DISPATCH(pinstance, _uart, _receive_it)(pinstance, prxdata, size));
+}
+
+static inline uint8_t jhal_uart_transmitreceive_it(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, uart_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_IT, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_IT, size, JHAL_DISPATCH(pinstance, _uart, _transmitreceive_it)(pinstance, ptxdata, prxdata, size));
+}
+
+static inline uint8_t jhal_uart_transmit_dma(void* pinstance, uint8_t* ptxdata, uint16_t size, void* pinstance_dma)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, uart_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_TRANSMIT_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_TRANSMIT_DMA, size, JHAL_DISPATCH(pinstance, _uart, _transmit_dma)(pinstance, ptxdata, size, pinstance_dma));
+}
+
+static inline uint8_t jhal_uart_receive_dma(void* pinstance, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, uart_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_RECEIVE_DMA, size, JHAL_DISPATCH(pinstance, _uart, _receive_dma)(pinstance, prxdata, size, pinstance_dma));
+}
+
+static inline uint8_t jhal_uart_transmitreceive_dma(void* pinstance, uint8_t* ptxdata, uint8_t* prxdata, uint16_t size, void* pinstance_dma)
+{
+  JHAL_REQUEST_QUEUE_CHECK(pinstance, uart_callback_instance);
+  JHAL_PROBE_BEGIN(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_DMA, size);
+  return JHAL_PROBE_END(JHAL_DRIVER_TYPE_UART, pinstance, JHAL_TRACE_OP_TRANSMITRECEIVE_DMA, size, JHAL_DISPATCH(pinstance, _uart, _transmitreceive_dma)(pinstance, ptxdata, prxdata, size, pinstance_dma));
+}
+#endif
+
 #endif
\ No newline at end of file
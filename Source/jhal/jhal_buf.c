@@ -0,0 +1,265 @@
+#include <string.h>
+#include "jhal_buf.h"
+#include JHAL_TICK_INCLUDE_NAME
+
+#if (USE_JHAL_BUF == 1)
+
+/* Data blocks are kept apart from the descriptors, so a pointer anywhere into
+   a block leads back to its descriptor by plain arithmetic */
+static jhal_buf BufDescriptors[JHAL_BUF_AMOUNT];
+static uint8_t BufData[JHAL_BUF_AMOUNT][JHAL_BUF_SIZE];
+static jhal_buf* pBufFree = NULL;
+static uint16_t BufAmountFree = 0;
+static uint16_t BufAmountTouched = 0;
+
+#define BUF_BLOCK(PBUF)                 BufData[(PBUF) - BufDescriptors]
+
+jhal_buf* jhal_buf_alloc(uint16_t headroom)
+{
+  jhal_buf* pbuf = NULL;
+  
+  if(headroom > JHAL_BUF_SIZE)
+    return NULL;
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  if(pBufFree != NULL)
+  {
+    pbuf = pBufFree;
+    pBufFree = pbuf->pnext;
+    BufAmountFree--;
+  }
+  else if(BufAmountTouched < JHAL_BUF_AMOUNT)
+    pbuf = &BufDescriptors[BufAmountTouched++];
+  JHAL_CRITICAL_EXIT(state);
+  
+  if(pbuf == NULL)
+    return NULL;
+  
+  pbuf->pnext = NULL;
+  pbuf->pdata = &BUF_BLOCK(pbuf)[headroom];
+  pbuf->size = 0;
+  pbuf->refs = 1;
+  
+  return pbuf;
+}
+
+/* Drops one reference of every segment of the chain, a segment goes back
+   to the pool with its last reference */
+void jhal_buf_free(jhal_buf* pbuf)
+{
+  while(pbuf != NULL)
+  {
+    jhal_buf* pnext = pbuf->pnext;
+    
+    uint32_t state = JHAL_CRITICAL_ENTER();
+    if(pbuf->refs && --pbuf->refs == 0)
+    {
+      pbuf->pnext = pBufFree;
+      pBufFree = pbuf;
+      BufAmountFree++;
+    }
+    JHAL_CRITICAL_EXIT(state);
+    
+    pbuf = pnext;
+  }
+}
+
+/* Detaches the chain from the owner slot and frees it, safe against an
+   interrupt releasing the same slot */
+void jhal_buf_release(jhal_buf** ppbuf)
+{
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  jhal_buf* pbuf = *ppbuf;
+  *ppbuf = NULL;
+  JHAL_CRITICAL_EXIT(state);
+  
+  jhal_buf_free(pbuf);
+}
+
+void jhal_buf_ref(jhal_buf* pbuf)
+{
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  for(; pbuf != NULL; pbuf = pbuf->pnext)
+    pbuf->refs++;
+  JHAL_CRITICAL_EXIT(state);
+}
+
+/* Finds the buffer holding pdata, e.g. from the prxdata of a receive callback */
+jhal_buf* jhal_buf_by_data(const uint8_t* pdata)
+{
+  uintptr_t offset = (uintptr_t)pdata - (uintptr_t)BufData;
+  
+  if(offset >= sizeof(BufData))
+    return NULL;
+  
+  return &BufDescriptors[offset / JHAL_BUF_SIZE];
+}
+
+/* Prepends size bytes in the headroom, returns the new start of the data */
+uint8_t* jhal_buf_push(jhal_buf* pbuf, uint16_t size)
+{
+  if(jhal_buf_headroom(pbuf) < size)
+    return NULL;
+  
+  pbuf->pdata -= size;
+  pbuf->size += size;
+  
+  return pbuf->pdata;
+}
+
+/* Strips size bytes from the front, returns the new start of the data */
+uint8_t* jhal_buf_pull(jhal_buf* pbuf, uint16_t size)
+{
+  if(pbuf->size < size)
+    return NULL;
+  
+  pbuf->pdata += size;
+  pbuf->size -= size;
+  
+  return pbuf->pdata;
+}
+
+/* Appends size bytes in the tailroom, returns the start of the appended part */
+uint8_t* jhal_buf_put(jhal_buf* pbuf, uint16_t size)
+{
+  if(jhal_buf_tailroom(pbuf) < size)
+    return NULL;
+  
+  uint8_t* ptail = &pbuf->pdata[pbuf->size];
+  pbuf->size += size;
+  
+  return ptail;
+}
+
+uint8_t jhal_buf_trim(jhal_buf* pbuf, uint16_t size)
+{
+  if(pbuf->size < size)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  pbuf->size -= size;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint16_t jhal_buf_headroom(const jhal_buf* pbuf)
+{
+  return (uint16_t)(pbuf->pdata - BUF_BLOCK(pbuf));
+}
+
+uint16_t jhal_buf_tailroom(const jhal_buf* pbuf)
+{
+  return (uint16_t)(JHAL_BUF_SIZE - jhal_buf_headroom(pbuf) - pbuf->size);
+}
+
+uint32_t jhal_buf_length(const jhal_buf* pbuf)
+{
+  uint32_t length = 0;
+  
+  for(; pbuf != NULL; pbuf = pbuf->pnext)
+    length += pbuf->size;
+  
+  return length;
+}
+
+/* Links pbuf_tail after the last segment of pbuf, the reference of the
+   caller to pbuf_tail passes to the chain */
+void jhal_buf_chain(jhal_buf* pbuf, jhal_buf* pbuf_tail)
+{
+  while(pbuf->pnext != NULL)
+    pbuf = pbuf->pnext;
+  
+  pbuf->pnext = pbuf_tail;
+}
+
+/* Skips empty segments, returns the first segment of the chain holding data */
+jhal_buf* jhal_buf_segment(jhal_buf* pbuf)
+{
+  while(pbuf != NULL && pbuf->size == 0)
+    pbuf = pbuf->pnext;
+  
+  return pbuf;
+}
+
+uint16_t jhal_buf_amount_free(void)
+{
+  return BufAmountFree + (JHAL_BUF_AMOUNT - BufAmountTouched);
+}
+
+/* Takes a reference to the chain and starts its first segment, the caller
+   may free pbuf right after the start */
+uint8_t jhal_buf_tx_start(jhal_buf_tx* ptx, jhal_buf* pbuf, void* pinstance, void* pinstance_dma, jhal_buf_type_start pfunc_start)
+{
+  jhal_buf* psegment = jhal_buf_segment(pbuf);
+  
+  if(psegment == NULL)
+    return JHAL_RES_INVALID_PARAMS;
+  if(ptx->pbuf)
+    return JHAL_RES_ERROR;
+  
+  jhal_buf_ref(pbuf);
+  ptx->psegment = psegment;
+  ptx->pinstance = pinstance;
+  ptx->pinstance_dma = pinstance_dma;
+  ptx->pfunc_start = pfunc_start;
+  ptx->pbuf = pbuf;
+  
+  uint8_t res = pfunc_start(pinstance, psegment->pdata, psegment->size, pinstance_dma);
+  if(res != JHAL_RES_NO_ERRORS)
+    jhal_buf_release(&ptx->pbuf);
+  
+  return res;
+}
+
+/* Called from the tx completion of the driver. Returns JHAL_RES_BUSY while the
+   next segment is on the way, JHAL_RES_NO_ERRORS when the chain is over, or the
+   result of a segment that failed to start. Both of the latter release the chain */
+uint8_t jhal_buf_tx_next(jhal_buf_tx* ptx)
+{
+  jhal_buf* psegment = jhal_buf_segment(ptx->psegment->pnext);
+  uint8_t res = JHAL_RES_NO_ERRORS;
+  
+  if(psegment != NULL)
+  {
+    ptx->psegment = psegment;
+    res = ptx->pfunc_start(ptx->pinstance, psegment->pdata, psegment->size, ptx->pinstance_dma);
+    if(res == JHAL_RES_NO_ERRORS)
+      return JHAL_RES_BUSY;
+  }
+  
+  jhal_buf_release(&ptx->pbuf);
+  
+  return res;
+}
+
+/* Receives size bytes into the tailroom of pbuf, the driver holds a reference
+   to it in the slot ppbuf_rx until the completion */
+uint8_t jhal_buf_rx_start(jhal_buf** ppbuf_rx, jhal_buf* pbuf, uint16_t size, void* pinstance, void* pinstance_dma, jhal_buf_type_start pfunc_start)
+{
+  if(jhal_buf_tailroom(pbuf) < size)
+    return JHAL_RES_INVALID_PARAMS;
+  if(*ppbuf_rx)
+    return JHAL_RES_ERROR;
+  
+  jhal_buf_ref(pbuf);
+  *ppbuf_rx = pbuf;
+  
+  uint8_t res = pfunc_start(pinstance, &pbuf->pdata[pbuf->size], size, pinstance_dma);
+  if(res != JHAL_RES_NO_ERRORS)
+    jhal_buf_release(ppbuf_rx);
+  
+  return res;
+}
+
+/* Appends the received bytes to the data of the buffer and drops the reference
+   of the driver */
+void jhal_buf_rx_complete(jhal_buf** ppbuf_rx, const uint8_t* prxdata, uint16_t size)
+{
+  jhal_buf* pbuf = *ppbuf_rx;
+  
+  if(prxdata == &pbuf->pdata[pbuf->size])
+    pbuf->size += size;
+  
+  jhal_buf_release(ppbuf_rx);
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef __JHAL_BUF__
+#define __JHAL_BUF__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+
+#if (USE_JHAL_BUF == 1)
+
+/* Descriptor of one fixed size block of the buffer pool. Valid data runs from
+   pdata for size bytes, the space before it is the headroom and the space
+   after it is the tailroom. Segments are linked through pnext into one packet */
+typedef struct jhal_buf_struct jhal_buf;
+
+struct jhal_buf_struct {
+  jhal_buf*                     pnext;
+  uint8_t*                      pdata;
+  uint16_t                      size;
+  volatile uint8_t              refs;
+};
+
+/* Starts an IT transfer of one segment, or a DMA one with pinstance_dma */
+typedef uint8_t (*jhal_buf_type_start)(void* pinstance, uint8_t* pdata, uint16_t size, void* pinstance_dma);
+
+/* Chain sent by a driver one segment per tx completion. The driver holds its
+   own reference to the chain in pbuf until the last segment is sent */
+typedef struct {
+  jhal_buf*                     pbuf;
+  jhal_buf*                     psegment;
+  void*                         pinstance;
+  void*                         pinstance_dma;
+  jhal_buf_type_start           pfunc_start;
+} jhal_buf_tx;
+
+jhal_buf* jhal_buf_alloc(uint16_t headroom);
+void jhal_buf_free(jhal_buf* pbuf);
+void jhal_buf_release(jhal_buf** ppbuf);
+void jhal_buf_ref(jhal_buf* pbuf);
+jhal_buf* jhal_buf_by_data(const uint8_t* pdata);
+
+uint8_t* jhal_buf_push(jhal_buf* pbuf, uint16_t size);
+uint8_t* jhal_buf_pull(jhal_buf* pbuf, uint16_t size);
+uint8_t* jhal_buf_put(jhal_buf* pbuf, uint16_t size);
+uint8_t jhal_buf_trim(jhal_buf* pbuf, uint16_t size);
+
+uint16_t jhal_buf_headroom(const jhal_buf* pbuf);
+uint16_t jhal_buf_tailroom(const jhal_buf* pbuf);
+uint32_t jhal_buf_length(const jhal_buf* pbuf);
+void jhal_buf_chain(jhal_buf* pbuf, jhal_buf* pbuf_tail);
+jhal_buf* jhal_buf_segment(jhal_buf* pbuf);
+uint16_t jhal_buf_amount_free(void);
+
+uint8_t jhal_buf_tx_start(jhal_buf_tx* ptx, jhal_buf* pbuf, void* pinstance, void* pinstance_dma, jhal_buf_type_start pfunc_start);
+uint8_t jhal_buf_tx_next(jhal_buf_tx* ptx);
+uint8_t jhal_buf_rx_start(jhal_buf** ppbuf_rx, jhal_buf* pbuf, uint16_t size, void* pinstance, void* pinstance_dma, jhal_buf_type_start pfunc_start);
+void jhal_buf_rx_complete(jhal_buf** ppbuf_rx, const uint8_t* prxdata, uint16_t size);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,106 @@
+#include "jhal_deadline.h"
+#include "jhal_os.h"
+#include "jhal_tick.h"
+
+#if (USE_JHAL_DEADLINE == 1)
+
+#define DEADLINE_US_IN_MS               1000U
+/* A quarter of the wrap of the 32-bit cycle counter */
+#define DEADLINE_CYCLES_SLEEP_MAX       0x40000000ULL
+
+/* The deadlines share the time base of jhal_tick, which follows clock changes */
+uint64_t jhal_time_now_us(void)
+{
+  return jhal_tick_now_us();
+}
+
+jhal_deadline jhal_deadline_in_us(uint32_t timeout_us)
+{
+  if(timeout_us == JHAL_DEADLINE_TIMEOUT_FOREVER)
+    return JHAL_DEADLINE_NEVER;
+  
+  return jhal_time_now_us() + timeout_us;
+}
+
+/* Timeouts of the blocking driver calls are in ms, JHAL_DEADLINE_TIMEOUT_FOREVER
+   matches JHAL_OS_WAIT_FOREVER */
+jhal_deadline jhal_deadline_in_ms(uint32_t timeout_ms)
+{
+  if(timeout_ms == JHAL_DEADLINE_TIMEOUT_FOREVER)
+    return JHAL_DEADLINE_NEVER;
+  
+  return jhal_time_now_us() + (uint64_t)timeout_ms * DEADLINE_US_IN_MS;
+}
+
+uint8_t jhal_deadline_expired(jhal_deadline deadline)
+{
+  return deadline != JHAL_DEADLINE_NEVER && jhal_time_now_us() >= deadline;
+}
+
+uint32_t jhal_deadline_remaining_us(jhal_deadline deadline)
+{
+  if(deadline == JHAL_DEADLINE_NEVER)
+    return JHAL_DEADLINE_TIMEOUT_FOREVER;
+  
+  uint64_t now = jhal_time_now_us();
+  if(now >= deadline)
+    return 0;
+  
+  uint64_t remaining = deadline - now;
+  
+  return remaining < JHAL_DEADLINE_TIMEOUT_FOREVER ? (uint32_t)remaining : JHAL_DEADLINE_TIMEOUT_FOREVER - 1U;
+}
+
+/* Rounded up, so a wait for the remaining time never ends before the deadline */
+uint32_t jhal_deadline_remaining_ms(jhal_deadline deadline)
+{
+  if(deadline == JHAL_DEADLINE_NEVER)
+    return JHAL_DEADLINE_TIMEOUT_FOREVER;
+  
+  uint64_t now = jhal_time_now_us();
+  if(now >= deadline)
+    return 0;
+  
+  uint64_t remaining = (deadline - now + DEADLINE_US_IN_MS - 1U) / DEADLINE_US_IN_MS;
+  
+  return remaining < JHAL_DEADLINE_TIMEOUT_FOREVER ? (uint32_t)remaining : JHAL_DEADLINE_TIMEOUT_FOREVER - 1U;
+}
+
+/* Longest single sleep of a wait. The time base is read again after it, well
+   within half a wrap of the cycle counter, so a long wait cannot lose a wrap */
+uint32_t jhal_deadline_sleep_max_us(void)
+{
+  uint64_t sleep_max_us = jhal_tick_cycles_to_us(DEADLINE_CYCLES_SLEEP_MAX);
+  
+  return sleep_max_us < JHAL_DEADLINE_TIMEOUT_FOREVER ? (uint32_t)sleep_max_us : JHAL_DEADLINE_TIMEOUT_FOREVER - 1U;
+}
+
+/* Waits until pfunc_ready returns non-zero or the deadline passes, NULL waits for
+   the deadline alone. The condition is checked back to back, a task only gives
+   the CPU away for the shortest OS sleep and never past the deadline. This is
+   for conditions nothing signals, a condition completed by an interrupt is
+   waited with jhal_os_deadline_wait */
+uint8_t jhal_deadline_wait(jhal_deadline deadline, jhal_type_deadline_ready pfunc_ready, void* pobject)
+{
+  while(1)
+  {
+    if(pfunc_ready && pfunc_ready(pobject))
+      return JHAL_RES_NO_ERRORS;
+    
+    uint32_t remaining_us = jhal_deadline_remaining_us(deadline);
+    if(!remaining_us)
+      return pfunc_ready ? JHAL_RES_TIMEOUT : JHAL_RES_NO_ERRORS;
+    
+#if (USE_JHAL_OS == 1)
+    if(remaining_us > JHAL_OS_SLEEP_MIN_US && jhal_os_can_block())
+    {
+      uint32_t sleep_us = remaining_us - JHAL_OS_SLEEP_MIN_US;
+      uint32_t sleep_max_us = jhal_deadline_sleep_max_us();
+      
+      jhal_os_sleep_us(pfunc_ready ? JHAL_OS_SLEEP_MIN_US : (sleep_us < sleep_max_us ? sleep_us : sleep_max_us));
+    }
+#endif
+  }
+}
+
+#endif
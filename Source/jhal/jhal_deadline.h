@@ -0,0 +1,40 @@
+#ifndef __JHAL_DEADLINE__
+#define __JHAL_DEADLINE__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+
+#if (USE_JHAL_DEADLINE == 1)
+
+/* Absolute point of the monotonic time in us, jhal_tick_now_us. The time base
+   extends the 32-bit cycle counter of the environment to 64 bits, so it has to be
+   read at least once per wrap of the counter (about 23 s at 180 MHz), any wait or
+   timer interrupt does */
+typedef uint64_t jhal_deadline;
+
+#define JHAL_DEADLINE_NEVER             0xFFFFFFFFFFFFFFFFULL
+#define JHAL_DEADLINE_TIMEOUT_FOREVER   0xFFFFFFFFU
+
+typedef uint8_t (*jhal_type_deadline_ready)(void*);
+
+uint64_t jhal_time_now_us(void);
+
+jhal_deadline jhal_deadline_in_us(uint32_t timeout_us);
+jhal_deadline jhal_deadline_in_ms(uint32_t timeout_ms);
+uint8_t jhal_deadline_expired(jhal_deadline deadline);
+uint32_t jhal_deadline_remaining_us(jhal_deadline deadline);
+uint32_t jhal_deadline_remaining_ms(jhal_deadline deadline);
+
+uint32_t jhal_deadline_sleep_max_us(void);
+uint8_t jhal_deadline_wait(jhal_deadline deadline, jhal_type_deadline_ready pfunc_ready, void* pobject);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,197 @@
+#include <string.h>
+#include "jhal_defer.h"
+#include JHAL_TICK_INCLUDE_NAME
+
+#if (USE_JHAL_DEFER == 1)
+
+/* One ring per level. index_head is written only by the interrupts of the level,
+   index_tail only by the dispatcher, so no lock is needed as long as interrupts
+   that can preempt each other post to different levels. Slots are accessed
+   through volatile pointers to keep the record written before index_head moves */
+typedef struct {
+  jhal_defer_event              events[JHAL_DEFER_QUEUE_SIZE];
+  volatile uint16_t             index_head;
+  volatile uint16_t             index_tail;
+  uint16_t                      amount_peak;
+  uint32_t                      amount_overflows;
+} defer_ring;
+
+static defer_ring DeferRings[JHAL_DEFER_LEVELS];
+
+#if (USE_JHAL_OS == 1)
+static jhal_os_sem DeferSem;
+static uint8_t DeferSemReady = 0;
+#endif
+
+uint8_t jhal_defer_init(void)
+{
+  memset(DeferRings, 0, sizeof(DeferRings));
+  
+#if (USE_JHAL_OS == 1)
+  if(!DeferSemReady)
+  {
+    uint8_t res = jhal_os_sem_init(&DeferSem, 0, 1);
+    if(res != JHAL_RES_NO_ERRORS)
+      return res;
+    
+    DeferSemReady = 1;
+  }
+#endif
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_defer_set_level(void* pinstance, uint8_t level)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  if(!pinstance || !JHAL_CHECK_INSTANCE(pinstance) || (level >= JHAL_DEFER_LEVELS && level != JHAL_DEFER_LEVEL_NONE))
+    return JHAL_RES_INVALID_PARAMS;
+#endif
+  /* Events already queued at the old level stay there and are dispatched as usual */
+  JHAL_DRIVER_BY_INSTANCE(pinstance)->defer_level = level;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* Called from the interrupt. A full ring is counted and reported, the driver
+   then runs the callback in place so no completion is lost */
+uint8_t jhal_defer_post(void* pinstance, jhal_type_defer_dispatch pfunc_dispatch, uint8_t type, uint8_t value, uint8_t* pdata, uint16_t size)
+{
+  uint8_t level = JHAL_DRIVER_BY_INSTANCE(pinstance)->defer_level;
+  
+  if(level >= JHAL_DEFER_LEVELS)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  defer_ring* pring = &DeferRings[level];
+  uint16_t index = pring->index_head;
+  uint16_t amount = (uint16_t)(index - pring->index_tail);
+  
+  if(amount >= JHAL_DEFER_QUEUE_SIZE)
+  {
+    pring->amount_overflows++;
+    return JHAL_RES_ALLOC_ERROR;
+  }
+  
+  volatile jhal_defer_event* pevent = &pring->events[index & (JHAL_DEFER_QUEUE_SIZE - 1)];
+  pevent->pinstance = pinstance;
+  pevent->pfunc_dispatch = pfunc_dispatch;
+  pevent->pdata = pdata;
+  pevent->size = size;
+  pevent->type = type;
+  pevent->value = value;
+  pring->index_head = index + 1;
+  
+  if(++amount > pring->amount_peak)
+    pring->amount_peak = amount;
+  
+#if (USE_JHAL_OS == 1)
+  /* The dispatcher empties the rings before it waits again, so waking it on
+     the first event of a batch is enough */
+  if(amount == 1 && DeferSemReady)
+    jhal_os_sem_give(&DeferSem);
+#endif
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* Called by jhal_driver_free: queued events of a freed instance are dropped,
+   its memory may already belong to a new instance when the dispatcher runs */
+void jhal_defer_cancel(void* pinstance)
+{
+  for(uint8_t i = 0; i < JHAL_DEFER_LEVELS; i++)
+  {
+    defer_ring* pring = &DeferRings[i];
+    uint32_t state = JHAL_CRITICAL_ENTER();
+    
+    for(uint16_t index = pring->index_tail; index != pring->index_head; index++)
+    {
+      volatile jhal_defer_event* pevent = &pring->events[index & (JHAL_DEFER_QUEUE_SIZE - 1)];
+      
+      if(pevent->pinstance == pinstance)
+        pevent->pfunc_dispatch = NULL;
+    }
+    
+    JHAL_CRITICAL_EXIT(state);
+  }
+}
+
+/* Runs up to amount callbacks (0 - until the rings are empty), always from the
+   most urgent non-empty level, so level 0 posted during a batch goes first */
+uint16_t jhal_defer_dispatch(uint16_t amount)
+{
+  uint16_t amount_done = 0;
+  uint8_t level = 0;
+  
+  while(level < JHAL_DEFER_LEVELS && (amount == 0 || amount_done < amount))
+  {
+    defer_ring* pring = &DeferRings[level];
+    uint16_t index = pring->index_tail;
+    
+    if(index == pring->index_head)
+    {
+      level++;
+      continue;
+    }
+    
+    volatile jhal_defer_event* pslot = &pring->events[index & (JHAL_DEFER_QUEUE_SIZE - 1)];
+    jhal_defer_event event;
+    
+    event.pinstance = pslot->pinstance;
+    event.pfunc_dispatch = pslot->pfunc_dispatch;
+    event.pdata = pslot->pdata;
+    event.size = pslot->size;
+    event.type = pslot->type;
+    event.value = pslot->value;
+    pring->index_tail = index + 1;
+    
+    if(event.pfunc_dispatch && JHAL_CHECK_INSTANCE(event.pinstance))
+      event.pfunc_dispatch(&event);
+    
+    amount_done++;
+    level = 0;
+  }
+  
+  return amount_done;
+}
+
+uint16_t jhal_defer_pending(void)
+{
+  uint16_t amount = 0;
+  
+  for(uint8_t i = 0; i < JHAL_DEFER_LEVELS; i++)
+    amount += (uint16_t)(DeferRings[i].index_head - DeferRings[i].index_tail);
+  
+  return amount;
+}
+
+uint8_t jhal_defer_get_stats(jhal_defer_stats* pstats)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  if(!pstats)
+    return JHAL_RES_INVALID_PARAMS;
+#endif
+  for(uint8_t i = 0; i < JHAL_DEFER_LEVELS; i++)
+  {
+    pstats->amount_pending[i] = (uint16_t)(DeferRings[i].index_head - DeferRings[i].index_tail);
+    pstats->amount_peak[i] = DeferRings[i].amount_peak;
+    pstats->amount_overflows[i] = DeferRings[i].amount_overflows;
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+#if (USE_JHAL_OS == 1)
+/* Dispatcher task loop: jhal_defer_wait(JHAL_OS_WAIT_FOREVER) then jhal_defer_dispatch(0) */
+uint8_t jhal_defer_wait(uint32_t timeout)
+{
+  if(!DeferSemReady)
+    return JHAL_RES_ERROR;
+  
+  if(jhal_defer_pending())
+    return JHAL_RES_NO_ERRORS;
+  
+  return jhal_os_sem_take(&DeferSem, timeout);
+}
+#endif
+
+#endif
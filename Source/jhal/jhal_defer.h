@@ -0,0 +1,62 @@
+#ifndef __JHAL_DEFER__
+#define __JHAL_DEFER__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+#include "jhal_os.h"
+
+#if (USE_JHAL_DEFER == 1)
+
+#if (JHAL_DEFER_QUEUE_SIZE & (JHAL_DEFER_QUEUE_SIZE - 1)) || (JHAL_DEFER_QUEUE_SIZE > 0x8000)
+  #error "JHAL_DEFER_QUEUE_SIZE must be a power of two!"
+#endif
+
+#define JHAL_DEFER_LEVEL_NONE                           0xFFU
+
+typedef struct jhal_defer_event_struct jhal_defer_event;
+typedef void (*jhal_type_defer_dispatch)(const jhal_defer_event* pevent);
+
+/* Callback taken out of the interrupt. type, value and size are up to the
+   driver dispatch function, which runs the user callback from the record */
+struct jhal_defer_event_struct {
+  void*                         pinstance;
+  jhal_type_defer_dispatch      pfunc_dispatch;
+  uint8_t*                      pdata;
+  uint16_t                      size;
+  uint8_t                       type;
+  uint8_t                       value;
+};
+
+typedef struct {
+  uint16_t                      amount_pending[JHAL_DEFER_LEVELS];
+  uint16_t                      amount_peak[JHAL_DEFER_LEVELS];
+  uint32_t                      amount_overflows[JHAL_DEFER_LEVELS];
+} jhal_defer_stats;
+
+uint8_t jhal_defer_init(void);
+uint8_t jhal_defer_set_level(void* pinstance, uint8_t level);
+uint8_t jhal_defer_post(void* pinstance, jhal_type_defer_dispatch pfunc_dispatch, uint8_t type, uint8_t value, uint8_t* pdata, uint16_t size);
+void jhal_defer_cancel(void* pinstance);
+uint16_t jhal_defer_dispatch(uint16_t amount);
+uint16_t jhal_defer_pending(void);
+uint8_t jhal_defer_get_stats(jhal_defer_stats* pstats);
+
+#if (USE_JHAL_OS == 1)
+uint8_t jhal_defer_wait(uint32_t timeout);
+#endif
+
+/* Used by the drivers in the callbacks: true when the event went to the queue
+   and the user callback must not run in the interrupt */
+#define JHAL_DEFER_POST(INSTANCE, FUNC, TYPE, VALUE, PDATA, SIZE)  (JHAL_DRIVER_BY_INSTANCE(INSTANCE)->defer_level != JHAL_DEFER_LEVEL_NONE\
+                                                                    && jhal_defer_post((INSTANCE), (FUNC), (TYPE), (VALUE), (PDATA), (SIZE)) == JHAL_RES_NO_ERRORS)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
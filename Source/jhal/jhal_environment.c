@@ -1,109 +1,422 @@
-#include <stdio.h>
-#include "jhal_environment.h"
-
-#define STATIC_MEM_SERVICE_BYTES        5
-
-static uint32_t watermark = 0;
-static uint8_t Mem[JHAL_SIZE_MEM] = {0};
-
-#pragma pack(push, 1)
-struct _instance_list{
-  uint8_t                             invalid;
-  struct _instance_list*              pnext;
-  void*                               pinstance;  
-};
-#pragma pack(pop)
-
-typedef struct _instance_list instance_list;
-
-jhal_driver_instance* jhal_driver_malloc(uint32_t size_instance, uint32_t size_driver)
-{
-    void* alloced_instance = jhal_malloc(sizeof(jhal_driver_instance) + size_instance + size_driver);
-    if(alloced_instance != NULL)
-    {
-        uint32_t address = JHAL_OFFSET(alloced_instance, jhal_driver_instance, pinstance);
-        *((void**)address) = (void*)((uint32_t)alloced_instance + sizeof(alloced_instance));
-        
-        address = JHAL_OFFSET(alloced_instance, jhal_driver_instance, pfuncs_callbacks);
-        *((void**)address) = (void*)((uint32_t)alloced_instance + sizeof(alloced_instance) + size_driver);
-        
-        address = JHAL_OFFSET(alloced_instance, jhal_driver_instance, instance_signature);
-        *((uint32_t*)address) = INSTANCE_SIGNATURE;
-    }
-
-    return (jhal_driver_instance*)alloced_instance;
-}
-
-void jhal_driver_free(void* pinstance)
-{
-    jhal_free(pinstance);
-    JHAL_GET_SIGNATURE(pinstance) = 0;
-}
-
-void* jhal_malloc(uint32_t size)
-{   
-   instance_list* plist = NULL;
-   if(!watermark)
-   {
-     if(watermark + size + STATIC_MEM_SERVICE_BYTES  > JHAL_SIZE_MEM)
-       return NULL;
-     
-     plist = (instance_list*)Mem;
-     plist->pinstance = (void*)&Mem[watermark];
-     watermark += size + STATIC_MEM_SERVICE_BYTES;
-     plist->pnext = NULL;     
-   } else 
-   {
-     plist = (instance_list*)Mem;
-     while(1)
-     {
-       while(!plist->invalid && plist->pnext != NULL)
-         plist = plist->pnext;
-       
-       if(!plist->invalid)
-       {
-         if(watermark + size + STATIC_MEM_SERVICE_BYTES  > JHAL_SIZE_MEM)
-           return NULL;
-                
-         plist->pnext = (instance_list*)&Mem[watermark];
-         plist = plist->pnext;
-         plist->pinstance = (void*)&Mem[watermark];
-         watermark += size + STATIC_MEM_SERVICE_BYTES;
-         plist->pnext = NULL;
-       }else
-       {
-         if(plist->pnext == NULL)
-         {
-           uint32_t prev_size = (uint32_t)&Mem[watermark] - (uint32_t)plist + 1;
-           if((size > prev_size) && (size - prev_size + watermark  > JHAL_SIZE_MEM))
-             return NULL;
-
-           watermark += size - prev_size;
-         }else
-         {
-           if(plist - plist->pnext + 1 >= size)
-             break;
-           else
-             plist = plist->pnext;
-         }
-       }
-     }
-   }
-      
-   plist->invalid = 0;  
-   return plist;
-}
-
-void jhal_free(void* pinstance)
-{
-  instance_list* plist = (instance_list*)Mem;
-  while(plist != NULL)
-  {
-    if(plist == pinstance)
-    {
-      plist->invalid = 1;
-      break;
-    }
-    plist = plist->pnext;
-  }
-}
\ No newline at end of file
+#include <stdio.h>
+#include <string.h>
+#include "jhal_environment.h"
+#include "jhal_defer.h"
+
+#define MEM_POOL_ALIGN(SIZE)            (((SIZE) + sizeof(uint64_t) - 1) / sizeof(uint64_t))
+#define MEM_POOL_BLOCK_SIZE(SIZE)       (MEM_POOL_ALIGN(SIZE) * sizeof(uint64_t))
+#define MEM_POOL_USED_WORDS(AMOUNT)     (((AMOUNT) + 31) / 32)
+
+#if (JHAL_MEM_POOL_CLASSES < 1) || (JHAL_MEM_POOL_CLASSES > 4)
+  #error "JHAL_MEM_POOL_CLASSES must be in range 1..4!"
+#endif
+
+#if (USE_JHAL_MEM_STATS == 1)
+typedef struct {
+  uint32_t                            size_requested;
+  uint8_t                             driver_type;
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+  uint32_t                            line;
+  const char*                         pfile;
+#endif
+} mem_pool_block_info;
+
+  #define MEM_POOL_INFO(NAME)         , NAME, 0, 0, 0
+#else
+  #define MEM_POOL_INFO(NAME)
+#endif
+
+typedef struct {
+  uint32_t                            size_block;
+  uint32_t                            amount_blocks;
+  uint32_t                            amount_touched;
+  uint8_t*                            pmem;
+  void*                               pfree;
+  uint32_t*                           pused;
+#if (USE_JHAL_MEM_STATS == 1)
+  mem_pool_block_info*                pinfo;
+  uint32_t                            amount_used;
+  uint32_t                            amount_peak;
+  uint32_t                            bytes_requested;
+#endif
+} mem_pool_class;
+
+static uint64_t MemClass0[MEM_POOL_ALIGN(JHAL_MEM_POOL_SIZE_CLASS_0) * JHAL_MEM_POOL_AMOUNT_CLASS_0];
+static uint32_t UsedClass0[MEM_POOL_USED_WORDS(JHAL_MEM_POOL_AMOUNT_CLASS_0)];
+#if (USE_JHAL_MEM_STATS == 1)
+static mem_pool_block_info InfoClass0[JHAL_MEM_POOL_AMOUNT_CLASS_0];
+#endif
+#if (JHAL_MEM_POOL_CLASSES > 1)
+  #if (JHAL_MEM_POOL_SIZE_CLASS_1 <= JHAL_MEM_POOL_SIZE_CLASS_0)
+    #error "Sizes of memory pool classes must be ascending!"
+  #endif
+static uint64_t MemClass1[MEM_POOL_ALIGN(JHAL_MEM_POOL_SIZE_CLASS_1) * JHAL_MEM_POOL_AMOUNT_CLASS_1];
+static uint32_t UsedClass1[MEM_POOL_USED_WORDS(JHAL_MEM_POOL_AMOUNT_CLASS_1)];
+  #if (USE_JHAL_MEM_STATS == 1)
+static mem_pool_block_info InfoClass1[JHAL_MEM_POOL_AMOUNT_CLASS_1];
+  #endif
+#endif
+#if (JHAL_MEM_POOL_CLASSES > 2)
+  #if (JHAL_MEM_POOL_SIZE_CLASS_2 <= JHAL_MEM_POOL_SIZE_CLASS_1)
+    #error "Sizes of memory pool classes must be ascending!"
+  #endif
+static uint64_t MemClass2[MEM_POOL_ALIGN(JHAL_MEM_POOL_SIZE_CLASS_2) * JHAL_MEM_POOL_AMOUNT_CLASS_2];
+static uint32_t UsedClass2[MEM_POOL_USED_WORDS(JHAL_MEM_POOL_AMOUNT_CLASS_2)];
+  #if (USE_JHAL_MEM_STATS == 1)
+static mem_pool_block_info InfoClass2[JHAL_MEM_POOL_AMOUNT_CLASS_2];
+  #endif
+#endif
+#if (JHAL_MEM_POOL_CLASSES > 3)
+  #if (JHAL_MEM_POOL_SIZE_CLASS_3 <= JHAL_MEM_POOL_SIZE_CLASS_2)
+    #error "Sizes of memory pool classes must be ascending!"
+  #endif
+static uint64_t MemClass3[MEM_POOL_ALIGN(JHAL_MEM_POOL_SIZE_CLASS_3) * JHAL_MEM_POOL_AMOUNT_CLASS_3];
+static uint32_t UsedClass3[MEM_POOL_USED_WORDS(JHAL_MEM_POOL_AMOUNT_CLASS_3)];
+  #if (USE_JHAL_MEM_STATS == 1)
+static mem_pool_block_info InfoClass3[JHAL_MEM_POOL_AMOUNT_CLASS_3];
+  #endif
+#endif
+
+static mem_pool_class MemPool[JHAL_MEM_POOL_CLASSES] = {
+  {MEM_POOL_BLOCK_SIZE(JHAL_MEM_POOL_SIZE_CLASS_0), JHAL_MEM_POOL_AMOUNT_CLASS_0, 0, (uint8_t*)MemClass0, NULL, UsedClass0 MEM_POOL_INFO(InfoClass0)},
+#if (JHAL_MEM_POOL_CLASSES > 1)
+  {MEM_POOL_BLOCK_SIZE(JHAL_MEM_POOL_SIZE_CLASS_1), JHAL_MEM_POOL_AMOUNT_CLASS_1, 0, (uint8_t*)MemClass1, NULL, UsedClass1 MEM_POOL_INFO(InfoClass1)},
+#endif
+#if (JHAL_MEM_POOL_CLASSES > 2)
+  {MEM_POOL_BLOCK_SIZE(JHAL_MEM_POOL_SIZE_CLASS_2), JHAL_MEM_POOL_AMOUNT_CLASS_2, 0, (uint8_t*)MemClass2, NULL, UsedClass2 MEM_POOL_INFO(InfoClass2)},
+#endif
+#if (JHAL_MEM_POOL_CLASSES > 3)
+  {MEM_POOL_BLOCK_SIZE(JHAL_MEM_POOL_SIZE_CLASS_3), JHAL_MEM_POOL_AMOUNT_CLASS_3, 0, (uint8_t*)MemClass3, NULL, UsedClass3 MEM_POOL_INFO(InfoClass3)},
+#endif
+};
+
+#if (USE_JHAL_MEM_STATS == 1)
+static uint32_t MemBytesUsed = 0;
+static uint32_t MemBytesPeak = 0;
+static uint32_t MemBytesRequested = 0;
+static uint32_t MemBlocksLive = 0;
+static uint32_t MemAllocFailures = 0;
+static uint32_t MemBytesByType[JHAL_DRIVER_TYPE_AMOUNT];
+  #if (USE_JHAL_MEM_CALL_SITE == 1)
+static const char* pMemCallSiteFile = NULL;
+static uint32_t MemCallSiteLine = 0;
+  #endif
+
+static void prv_mem_account_alloc(mem_pool_class* pclass, uint8_t* pblock, uint32_t size, uint8_t driver_type)
+{
+  mem_pool_block_info* pinfo = &pclass->pinfo[(uint32_t)(pblock - pclass->pmem) / pclass->size_block];
+  
+  pinfo->size_requested = size;
+  pinfo->driver_type = driver_type;
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+  pinfo->pfile = pMemCallSiteFile;
+  pinfo->line = MemCallSiteLine;
+  pMemCallSiteFile = NULL;
+  MemCallSiteLine = 0;
+#endif
+  
+  if(++pclass->amount_used > pclass->amount_peak)
+    pclass->amount_peak = pclass->amount_used;
+  pclass->bytes_requested += size;
+  
+  MemBytesUsed += pclass->size_block;
+  if(MemBytesUsed > MemBytesPeak)
+    MemBytesPeak = MemBytesUsed;
+  
+  MemBytesRequested += size;
+  MemBytesByType[driver_type] += pclass->size_block;
+  MemBlocksLive++;
+}
+
+static void prv_mem_account_free(mem_pool_class* pclass, uint8_t* pblock)
+{
+  mem_pool_block_info* pinfo = &pclass->pinfo[(uint32_t)(pblock - pclass->pmem) / pclass->size_block];
+  
+  pclass->amount_used--;
+  pclass->bytes_requested -= pinfo->size_requested;
+  MemBytesUsed -= pclass->size_block;
+  MemBytesRequested -= pinfo->size_requested;
+  MemBytesByType[pinfo->driver_type] -= pclass->size_block;
+  MemBlocksLive--;
+}
+#endif
+
+#if (USE_JHAL_MEM_LINKED == 1)
+/* Declared memory is zeroed at startup and jhal_driver_free clears the
+   signature, so the signature alone tells a taken slot from a free one */
+static uint8_t prv_slot_is_free(const jhal_mem_slot* pslot)
+{
+  return ((jhal_driver_instance*)pslot->pmem)->instance_signature != INSTANCE_SIGNATURE;
+}
+
+uint32_t jhal_mem_slots_free(const jhal_mem_slots* pslots)
+{
+  uint32_t amount = 0;
+  
+  for(const jhal_mem_slot* pslot = pslots->pbegin; pslot < pslots->pend; pslot++)
+  {
+    if(prv_slot_is_free(pslot))
+      amount++;
+  }
+  
+  return amount;
+}
+#endif
+
+static jhal_driver_instance* prv_driver_setup(void* pmem, uint32_t size_instance)
+{
+    jhal_driver_instance* pdriver_instance = (jhal_driver_instance*)pmem;
+    
+    pdriver_instance->pinstance = (uint8_t*)pdriver_instance + sizeof(jhal_driver_instance);
+    pdriver_instance->pfuncs_callbacks = (uint8_t*)pdriver_instance->pinstance + JHAL_ALIGN_SIZE(size_instance);
+    pdriver_instance->instance_signature = INSTANCE_SIGNATURE;
+#if (USE_JHAL_DEFER == 1)
+    pdriver_instance->defer_level = JHAL_DEFER_LEVEL_NONE;
+#endif
+#if (USE_JHAL_STATS == 1)
+    memset(&pdriver_instance->stats, 0, sizeof(jhal_stats_counters));
+#endif
+    
+    return pdriver_instance;
+}
+
+static uint8_t prv_mem_is_used(mem_pool_class* pclass, uint32_t index)
+{
+  return (pclass->pused[index / 32] >> (index % 32)) & 1U;
+}
+
+static void prv_mem_mark(mem_pool_class* pclass, uint8_t* pblock, uint8_t used)
+{
+  uint32_t index = (uint32_t)(pblock - pclass->pmem) / pclass->size_block;
+  
+  if(used)
+    pclass->pused[index / 32] |= 1UL << (index % 32);
+  else
+    pclass->pused[index / 32] &= ~(1UL << (index % 32));
+}
+
+static void* prv_malloc(uint32_t size, uint8_t driver_type)
+{
+  /* Size classes are ascending, so the first class that fits and has a free
+     block is the best fit. An exhausted class falls through to a larger one */
+  for(uint8_t i = 0; i < JHAL_MEM_POOL_CLASSES; i++)
+  {
+    mem_pool_class* pclass = &MemPool[i];
+    uint8_t* pblock = NULL;
+    
+    if(size > pclass->size_block)
+      continue;
+    
+    if(pclass->pfree != NULL)
+    {
+      pblock = (uint8_t*)pclass->pfree;
+      pclass->pfree = *((void**)pblock);
+    }
+    else if(pclass->amount_touched < pclass->amount_blocks)
+      pblock = &pclass->pmem[pclass->size_block * pclass->amount_touched++];
+    else
+      continue;
+    
+    prv_mem_mark(pclass, pblock, 1);
+#if (USE_JHAL_MEM_STATS == 1)
+    prv_mem_account_alloc(pclass, pblock, size, driver_type);
+#else
+    (void)driver_type;
+#endif
+    return pblock;
+  }
+  
+#if (USE_JHAL_MEM_STATS == 1)
+  MemAllocFailures++;
+#endif
+  return NULL;
+}
+
+jhal_driver_instance* jhal_driver_malloc(uint32_t size_instance, uint32_t size_driver, jhal_driver_type driver_type)
+{
+    void* alloced_instance = prv_malloc(JHAL_DRIVER_SIZE_STATIC(size_instance, size_driver), driver_type);
+    if(alloced_instance == NULL)
+      return NULL;
+
+    return prv_driver_setup(alloced_instance, size_instance);
+}
+
+#if (USE_JHAL_MEM_LINKED == 1)
+/* Slots of the driver that were never taken are handed out in order without a
+   search, only a slot given back by a deinit is looked for in the own range */
+jhal_driver_instance* jhal_driver_slot_take(jhal_mem_slots* pslots, uint32_t size_instance, uint32_t size_driver)
+{
+    uint32_t size = JHAL_DRIVER_SIZE_STATIC(size_instance, size_driver);
+    const jhal_mem_slot* pslot = pslots->pnext;
+    
+    if(pslot < pslots->pend && pslot->size_mem >= size)
+    {
+      pslots->pnext++;
+      return prv_driver_setup(pslot->pmem, size_instance);
+    }
+    
+    for(pslot = pslots->pbegin; pslot < pslots->pnext; pslot++)
+    {
+      if(pslot->size_mem >= size && prv_slot_is_free(pslot))
+        return prv_driver_setup(pslot->pmem, size_instance);
+    }
+    
+#if (USE_JHAL_MEM_STATS == 1)
+    MemAllocFailures++;
+#endif
+    return NULL;
+}
+#endif
+
+jhal_driver_instance* jhal_driver_place(void* pmem, uint32_t size_mem, uint32_t size_instance, uint32_t size_driver)
+{
+    /* Caller-provided memory is not owned by the pools, jhal_driver_free only invalidates it */
+    if(pmem == NULL || ((uintptr_t)pmem % sizeof(void*)) || size_mem < JHAL_DRIVER_SIZE_STATIC(size_instance, size_driver))
+      return NULL;
+    
+    return prv_driver_setup(pmem, size_instance);
+}
+
+void jhal_driver_free(void* pinstance)
+{
+    jhal_driver_instance* pdriver_instance = JHAL_DRIVER_BY_INSTANCE(pinstance);
+    
+    pdriver_instance->instance_signature = 0;
+#if (USE_JHAL_DEFER == 1)
+    jhal_defer_cancel(pinstance);
+#endif
+    jhal_free(pdriver_instance);
+}
+
+void* (jhal_malloc)(uint32_t size)
+{
+  return prv_malloc(size, JHAL_DRIVER_TYPE_OTHER);
+}
+
+/* A pointer that is not the start of a used block of a pool (double free,
+   memory of the application, an address inside a block) is ignored, so it
+   cannot corrupt the free list */
+void jhal_free(void* pinstance)
+{
+  uint8_t* pblock = (uint8_t*)pinstance;
+  
+  for(uint8_t i = 0; i < JHAL_MEM_POOL_CLASSES; i++)
+  {
+    mem_pool_class* pclass = &MemPool[i];
+    
+    if(pblock >= pclass->pmem && pblock < &pclass->pmem[pclass->size_block * pclass->amount_blocks])
+    {
+      uint32_t offset = (uint32_t)(pblock - pclass->pmem);
+      
+      if(offset % pclass->size_block || !prv_mem_is_used(pclass, offset / pclass->size_block))
+        break;
+      
+      prv_mem_mark(pclass, pblock, 0);
+#if (USE_JHAL_MEM_STATS == 1)
+      prv_mem_account_free(pclass, pblock);
+#endif
+      *((void**)pblock) = pclass->pfree;
+      pclass->pfree = pblock;
+      break;
+    }
+  }
+}
+
+#if (USE_JHAL_MEM_STATS == 1)
+static uint16_t prv_mem_fragmentation(uint32_t bytes_used, uint32_t bytes_requested)
+{
+  return (uint16_t)((uint64_t)(bytes_used - bytes_requested) * 1000 / bytes_used);
+}
+
+uint8_t jhal_mem_get_stats(jhal_mem_stats* pstats)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  if(!pstats)
+    return JHAL_RES_INVALID_PARAMS;
+#endif
+  memset(pstats, 0, sizeof(jhal_mem_stats));
+  
+  for(uint8_t i = 0; i < JHAL_MEM_POOL_CLASSES; i++)
+  {
+    mem_pool_class* pclass = &MemPool[i];
+    uint32_t amount_free = pclass->amount_blocks - pclass->amount_used;
+    
+    pstats->classes[i].size_block = pclass->size_block;
+    pstats->classes[i].amount_blocks = pclass->amount_blocks;
+    pstats->classes[i].amount_used = pclass->amount_used;
+    pstats->classes[i].amount_peak = pclass->amount_peak;
+    pstats->classes[i].bytes_requested = pclass->bytes_requested;
+    if(pclass->amount_used)
+      pstats->classes[i].fragmentation_permille = prv_mem_fragmentation(pclass->size_block * pclass->amount_used, pclass->bytes_requested);
+    
+    pstats->bytes_total += pclass->size_block * pclass->amount_blocks;
+    pstats->bytes_free += pclass->size_block * amount_free;
+    
+    if(amount_free && pclass->size_block > pstats->largest_free_block)
+      pstats->largest_free_block = pclass->size_block;
+  }
+  
+  pstats->bytes_used = MemBytesUsed;
+  pstats->bytes_peak = MemBytesPeak;
+  pstats->bytes_requested = MemBytesRequested;
+  pstats->blocks_live = MemBlocksLive;
+  pstats->alloc_failures = MemAllocFailures;
+  
+  if(MemBytesUsed)
+    pstats->fragmentation_permille = prv_mem_fragmentation(MemBytesUsed, MemBytesRequested);
+  
+  for(uint8_t i = 0; i < JHAL_DRIVER_TYPE_AMOUNT; i++)
+    pstats->bytes_by_type[i] = MemBytesByType[i];
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_mem_get_block_info(uint32_t index, jhal_mem_block_info* pinfo)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  if(!pinfo)
+    return JHAL_RES_INVALID_PARAMS;
+#endif
+  for(uint8_t i = 0; i < JHAL_MEM_POOL_CLASSES; i++)
+  {
+    mem_pool_class* pclass = &MemPool[i];
+    
+    for(uint32_t j = 0; j < pclass->amount_touched; j++)
+    {
+      if(!prv_mem_is_used(pclass, j) || index--)
+        continue;
+      
+      pinfo->pblock = &pclass->pmem[pclass->size_block * j];
+      pinfo->size_block = pclass->size_block;
+      pinfo->size_requested = pclass->pinfo[j].size_requested;
+      pinfo->driver_type = (jhal_driver_type)pclass->pinfo[j].driver_type;
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+      pinfo->pfile = pclass->pinfo[j].pfile;
+      pinfo->line = pclass->pinfo[j].line;
+#else
+      pinfo->pfile = NULL;
+      pinfo->line = 0;
+#endif
+      return JHAL_RES_NO_ERRORS;
+    }
+  }
+  
+  return JHAL_RES_INVALID_PARAMS;
+}
+
+void jhal_mem_reset_peak(void)
+{
+  MemBytesPeak = MemBytesUsed;
+  
+  for(uint8_t i = 0; i < JHAL_MEM_POOL_CLASSES; i++)
+    MemPool[i].amount_peak = MemPool[i].amount_used;
+}
+
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+void jhal_mem_call_site(const char* pfile, uint32_t line)
+{
+  pMemCallSiteFile = pfile;
+  MemCallSiteLine = line;
+}
+#endif
+#endif
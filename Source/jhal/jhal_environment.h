@@ -1,183 +1,429 @@
-#ifndef __JHAL_ENV__
-#define __JHAL_ENV__
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#include <stdint.h>  
-#include <stdio.h>  
-#include <stddef.h>
-#include "jhal_settings.h"  
-    
-#define JHAL_VERSION                    "0.0"  
-    
-#define JHAL_RES_NO_ERRORS              0U  
-#define JHAL_RES_INVALID_PARAMS         1U  
-#define JHAL_RES_ALLOC_ERROR            2U  
-#define JHAL_RES_NOT_SUPPORTED          3U  
-#define JHAL_RES_TIMEOUT                4U    
-#define JHAL_RES_ERROR                  5U  
-
-#if (JHAL_SIZE_ADD_PARAMS > 0)  
-typedef struct {
-   uint8_t param_amount;
-   uint16_t param_id[JHAL_SIZE_ADD_PARAMS];
-   uint32_t param_value[JHAL_SIZE_ADD_PARAMS];
-} jhal_add_params;
-#endif
-
-typedef struct {
-  void*                 puser_data;
-  uint32_t              instance_signature;
-  void*                 pfuncs_callbacks;
-  void*                 pinstance;
-} jhal_driver_instance;
-
-#define INSTANCE_SIGNATURE              0x523487AC
-
-void* jhal_malloc(uint32_t size);
-void jhal_free(void* pinstance);
-
-jhal_driver_instance* jhal_driver_malloc(uint32_t size_instance, uint32_t size_driver);
-void jhal_driver_free(void* pinstance);
-
-#define JHAL_OFFSET(INSTANCE, TYPE, MEMBER)             ((uint32_t)INSTANCE + offsetof(TYPE, MEMBER))
-
-#define JHAL_MEMBER_BY_INSTANCE(INSTANCE, MEMBER)       (((uint32_t)INSTANCE - offsetof(jhal_driver_instance, pinstance) +\
-                                                        offsetof(jhal_driver_instance, MEMBER))) 
-
-#define JHAL_GET_SIGNATURE(INSTANCE)                    (*((uint32_t*)JHAL_MEMBER_BY_INSTANCE(INSTANCE, instance_signature)))
-#define JHAL_GET_FUNC_CALLBACKS(INSTANCE)               (*((void**)(JHAL_MEMBER_BY_INSTANCE(INSTANCE, pfuncs_callbacks))))
-#define JHAL_GET_USERDATA(INSTANCE)                     (*((void**)(JHAL_MEMBER_BY_INSTANCE(INSTANCE, puser_data))))
-
-#define JHAL_CHECK_INSTANCE(INSTANCE)                   (JHAL_GET_SIGNATURE(INSTANCE) == INSTANCE_SIGNATURE)
-
-#define JHAL_CARCASS_FUNC(INSTANCE, TYPE, MEMBER_TYPE, MEMBER)   (*((MEMBER_TYPE*)((uint32_t)JHAL_GET_FUNC_CALLBACKS(INSTANCE) + offsetof(TYPE, MEMBER))))\
-                                                                 (INSTANCE, JHAL_GET_USERDATA(INSTANCE)
-
-//#define JHAL_CARCASS_FUNC(INSTANCE, TYPE, MEMBER)       (*((MEMBER)*)((uint32_t)JHAL_GET_FUNC_CALLBACKS(INSTANCE) + offsetof(TYPE, MEMBER)))\
-//                                                        (INSTANCE, JHAL_GET_USERDATA(INSTANCE)
-
-#if defined(JHAL_MCU) && defined(JHAL_LIB)
-  #if (JHAL_LIB == 1)
-    #define JHAL_MCU_ENV                        JHAL_MCU
-  #else
-    #define JHAL_BUILD_ENV(MCU_TYPE,LIB_TYPE)   MCU_TYPE ## _ ## LIB_TYPE
-    #define JHAL_BUILD_ENV2(MCU_TYPE,LIB_TYPE)  JHAL_BUILD_ENV(MCU_TYPE,LIB_TYPE)
-    #define JHAL_MCU_ENV                        JHAL_BUILD_ENV2(JHAL_MCU,JHAL_LIB)
-  #endif
-#else
-  #ifndef JHAL_MCU
-    #error "No declaration of define JHAL_MCU!"
-  #endif
-  
-  #ifndef JHAL_LIB
-    #error "No declaration of define JHAL_LIB!"
-  #endif  
-#endif
-  
-#if (JHAL_LIB != 1) 
-  #define JHAL_CREATE_FUNCTION(MCU_TYPE,DRV_TYPE,ACTION)                          env_ ## MCU_TYPE ## DRV_TYPE ## ACTION
-  #define JHAL_CREATE_INCLUDE(MCU_TYPE,DRV_TYPE)                                  env_ ## MCU_TYPE ## DRV_TYPE
-#else
-  #define JHAL_CREATE_FUNCTION(MCU_TYPE,DRV_TYPE,ACTION)                          MCU_TYPE ## DRV_TYPE ## ACTION
-  #define JHAL_CREATE_INCLUDE(MCU_TYPE,DRV_TYPE)                                  MCU_TYPE ## DRV_TYPE  
-#endif
-  
-#define JHAL_FUNCTION_NAME(MCU_TYPE,DRV_TYPE,ACTION)                              JHAL_CREATE_FUNCTION(MCU_TYPE,DRV_TYPE,ACTION)
-#define JHAL_INCLUDE_NAME(MCU_TYPE,DRV_TYPE)                                      JHAL_CREATE_INCLUDE(MCU_TYPE,DRV_TYPE)
-
-#if ( USE_JHAL_ASSERT  == 1)
-  #define JHAL_ENV_INCLUDE_NAME_WITHOUT_QUOTES                                    JHAL_INCLUDE_NAME(JHAL_MCU_ENV,.h)
-  #define JHAL_ENV_INCLUDE_NAME_WITH_QUOTES(INCLUDE_NAME)                         #INCLUDE_NAME
-  #define JHAL_ENV_INCLUDE_NAME_WITH_QUOTES2(INCLUDE_NAME)                        JHAL_ENV_INCLUDE_NAME_WITH_QUOTES(INCLUDE_NAME)
-  #define JHAL_ENV_INCLUDE_NAME                                                   JHAL_ENV_INCLUDE_NAME_WITH_QUOTES2(JHAL_SPI_INCLUDE_NAME_WITHOUT_QUOTES)
-  
-  #define JHAL_ASSERT(CONDITION)                                                  do {if(!(CONDITION))JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_assert)(__FILE__,__LINE__); }while(0)
-#else
-  #define JHAL_ASSERT(CONDITION)                                                  do {}while(0)
-#endif
-
-#define JHAL_INCLUDE_NAME_WITH_QUOTES(INCLUDE_NAME)                               #INCLUDE_NAME
-#define JHAL_INCLUDE_NAME_WITH_QUOTES2(INCLUDE_NAME)                              JHAL_INCLUDE_NAME_WITH_QUOTES(INCLUDE_NAME)
- 
-#define JHAL_TICK_INCLUDE_NAME_WITHOUT_QUOTES                                     JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_tick.h)
-#define JHAL_TICK_INCLUDE_NAME                                                    JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_TICK_INCLUDE_NAME_WITHOUT_QUOTES)
-
-#define JHAL_TICK(AMOUNT_US)                                                      JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_tick)(AMOUNT_US)
-#define JHAL_TICK_INIT                                                            JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_tick_init)
-                                             
-#define JHAL_SPI_INCLUDE_NAME_WITHOUT_QUOTES                                      JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_spi.h)
-#define JHAL_SPI_INCLUDE_NAME                                                     JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_SPI_INCLUDE_NAME_WITHOUT_QUOTES)
-
-#define JHAL_SPI_SIZE_DRV                                                         JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_size_drv)()
-#define JHAL_SPI_INIT(INSTANCE,PARAMS)                                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_init)(INSTANCE,PARAMS)
-#define JHAL_SPI_DEINIT(INSTANCE)                                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_deinit)(INSTANCE)
-#define JHAL_SPI_TRANSMIT(INSTANCE,TXDATA,SIZE,TIMEOUT)                           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_transmit)(INSTANCE,TXDATA,SIZE,TIMEOUT)
-#define JHAL_SPI_RECEIVE(INSTANCE,RXDATA,SIZE,TIMEOUT)                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_receive)(INSTANCE,RXDATA,SIZE,TIMEOUT)
-#define JHAL_SPI_TRANSMITRECEIVE(INSTANCE,TXDATA,RXDATA,SIZE,TIMEOUT)             JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_transmitreceive)(INSTANCE,TXDATA,RXDATA,SIZE,TIMEOUT)
-#define JHAL_SPI_TRANSMIT_IT(INSTANCE,TXDATA,SIZE)                                JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_transmit_it)(INSTANCE,TXDATA,SIZE)
-#define JHAL_SPI_RECEIVE_IT(INSTANCE,RXDATA,SIZE)                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_receive_it)(INSTANCE,RXDATA,SIZE)
-#define JHAL_SPI_TRANSMITRECEIVE_IT(INSTANCE,TXDATA,RXDATA,SIZE)                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_transmitreceive_it)(INSTANCE,TXDATA,RXDATA,SIZE)
-#define JHAL_SPI_TRANSMIT_DMA(INSTANCE,TXDATA,SIZE,INSTANCE_DMA)                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_transmit_dma)(INSTANCE,TXDATA,SIZE,INSTANCE_DMA)
-#define JHAL_SPI_RECEIVE_DMA(INSTANCE,RXDATA,SIZE,INSTANCE_DMA)                   JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_receive_dma)(INSTANCE,RXDATA,SIZE,INSTANCE_DMA)
-#define JHAL_SPI_TRANSMITRECEIVE_DMA(INSTANCE,TXDATA,RXDATA,SIZE,INSTANCE_DMA)    JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_transmitreceive_dma)(INSTANCE,TXDATA,RXDATA,SIZE,INSTANCE_DMA)
-
-
-#define JHAL_GPIO_INCLUDE_NAME_WITHOUT_QUOTES                                     JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_gpio.h)
-#define JHAL_GPIO_INCLUDE_NAME                                                    JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_GPIO_INCLUDE_NAME_WITHOUT_QUOTES)
-
-#define JHAL_GPIO_SIZE_DRV                                                        JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_gpio,_size_drv)()
-#define JHAL_GPIO_INIT(INSTANCE,PARAMS)                                           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_gpio,_init)(INSTANCE,PARAMS)
-#define JHAL_GPIO_DEINIT(INSTANCE)                                                JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_gpio,_deinit)(INSTANCE)
-#define JHAL_GPIO_SET(INSTANCE,PIN,VALUE)                                         JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_gpio,_set)(INSTANCE,PIN,VALUE)
-#define JHAL_GPIO_GET(INSTANCE,PIN,VALUE)                                         JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_gpio,_get)(INSTANCE,PIN,VALUE)
-
-#define JHAL_UART_INCLUDE_NAME_WITHOUT_QUOTES                                     JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_uart.h)
-#define JHAL_UART_INCLUDE_NAME                                                    JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_UART_INCLUDE_NAME_WITHOUT_QUOTES)
-
-#define JHAL_UART_SIZE_DRV                                                        JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_size_drv)()
-#define JHAL_UART_INIT(INSTANCE,PARAMS)                                           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_init)(INSTANCE,PARAMS)
-#define JHAL_UART_DEINIT(INSTANCE)                                                JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_deinit)(INSTANCE)
-#define JHAL_UART_TRANSMIT(INSTANCE,TXDATA,SIZE,TIMEOUT)                          JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_transmit)(INSTANCE,TXDATA,SIZE,TIMEOUT)
-#define JHAL_UART_RECEIVE(INSTANCE,RXDATA,SIZE,TIMEOUT)                           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_receive)(INSTANCE,RXDATA,SIZE,TIMEOUT)
-#define JHAL_UART_TRANSMITRECEIVE(INSTANCE,TXDATA,RXDATA,SIZE,TIMEOUT)            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_transmitreceive)(INSTANCE,TXDATA,RXDATA,SIZE,TIMEOUT)
-#define JHAL_UART_TRANSMIT_IT(INSTANCE,TXDATA,SIZE)                               JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_transmit_it)(INSTANCE,TXDATA,SIZE)
-#define JHAL_UART_RECEIVE_IT(INSTANCE,RXDATA,SIZE)                                JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_receive_it)(INSTANCE,RXDATA,SIZE)
-#define JHAL_UART_TRANSMITRECEIVE_IT(INSTANCE,TXDATA,RXDATA,SIZE)                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_transmitreceive_it)(INSTANCE,TXDATA,RXDATA,SIZE)
-#define JHAL_UART_TRANSMIT_DMA(INSTANCE,TXDATA,SIZE,INSTANCE_DMA)                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_transmit_dma)(INSTANCE,TXDATA,SIZE,INSTANCE_DMA)
-#define JHAL_UART_RECEIVE_DMA(INSTANCE,RXDATA,SIZE,INSTANCE_DMA)                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_receive_dma)(INSTANCE,RXDATA,SIZE,INSTANCE_DMA)
-#define JHAL_UART_TRANSMITRECEIVE_DMA(INSTANCE,TXDATA,RXDATA,SIZE,INSTANCE_DMA)   JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_transmitreceive_dma)(INSTANCE,TXDATA,RXDATA,SIZE,INSTANCE_DMA)
-
-
-#define JHAL_DMA_INCLUDE_NAME_WITHOUT_QUOTES                                      JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_dma.h)
-#define JHAL_DMA_INCLUDE_NAME                                                     JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_DMA_INCLUDE_NAME_WITHOUT_QUOTES)
-
-#define JHAL_DMA_SIZE_DRV                                                         JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_size_drv)()
-#define JHAL_DMA_INIT(INSTANCE,PARAMS)                                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_init)(INSTANCE,PARAMS)
-#define JHAL_DMA_DEINIT(INSTANCE)                                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_deinit)(INSTANCE)
-#define JHAL_DMA_START(INSTANCE,SRCADDRESS,DSTADDRESS,SIZE)                       JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_start)(INSTANCE,SRCADDRESS,DSTADDRESS,SIZE)
-#define JHAL_DMA_STOP(INSTANCE)                                                   JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_stop)(INSTANCE)
-#define JHAL_DMA_START_IT(INSTANCE,SRCADDRESS,DSTADDRESS,SIZE)                    JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_start_it)(INSTANCE,SRCADDRESS,DSTADDRESS,SIZE)
-#define JHAL_DMA_STOP_IT(INSTANCE)                                                JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_stop_it)(INSTANCE)
-
-
-#define JHAL_TIM_BASE_INCLUDE_NAME_WITHOUT_QUOTES                                 JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_tim_base.h)
-#define JHAL_TIM_BASE_INCLUDE_NAME                                                JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_TIM_BASE_INCLUDE_NAME_WITHOUT_QUOTES)
-
-#define JHAL_TIM_BASE_SIZE_DRV                                                    JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_size_drv)()
-#define JHAL_TIM_BASE_INIT(INSTANCE,PARAMS)                                       JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_init)(INSTANCE,PARAMS)
-#define JHAL_TIM_BASE_DEINIT(INSTANCE)                                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_deinit)(INSTANCE)
-#define JHAL_TIM_BASE_START(INSTANCE)                                             JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_start)(INSTANCE)
-#define JHAL_TIM_BASE_STOP(INSTANCE)                                              JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_stop)(INSTANCE)
-#define JHAL_TIM_BASE_START_IT(INSTANCE)                                          JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_start_it)(INSTANCE)
-#define JHAL_TIM_BASE_STOP_IT(INSTANCE)                                           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_stop_it)(INSTANCE)
-#define JHAL_TIM_BASE_START_DMA(INSTANCE,PDATA,SIZE,INSTANCE_DMA)                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_start_dma)(INSTANCE,PDATA,SIZE,INSTANCE_DMA)
-#define JHAL_TIM_BASE_STOP_DMA(INSTANCE,INSTANCE_DMA)                             JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_stop_dma)(INSTANCE,INSTANCE_DMA)
-
-#ifdef __cplusplus
-}
-#endif
-
+#ifndef __JHAL_ENV__
+#define __JHAL_ENV__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>  
+#include <stdio.h>  
+#include <stddef.h>
+#include "jhal_settings.h"  
+    
+#define JHAL_VERSION                    "0.0"  
+    
+#define JHAL_RES_NO_ERRORS              0U  
+#define JHAL_RES_INVALID_PARAMS         1U  
+#define JHAL_RES_ALLOC_ERROR            2U  
+#define JHAL_RES_NOT_SUPPORTED          3U  
+#define JHAL_RES_TIMEOUT                4U    
+#define JHAL_RES_ERROR                  5U  
+#define JHAL_RES_BUSY                   6U  
+
+#if (JHAL_SIZE_ADD_PARAMS > 0)  
+typedef struct {
+   uint8_t param_amount;
+   uint16_t param_id[JHAL_SIZE_ADD_PARAMS];
+   uint32_t param_value[JHAL_SIZE_ADD_PARAMS];
+} jhal_add_params;
+#endif
+
+#if (USE_JHAL_STATS == 1)
+#define JHAL_STATS_RESULTS              8U
+#define JHAL_STATS_DIRECTIONS           2U
+
+/* Calls update the first group, completion interrupts the second one. Both
+   are written from interrupts as well (queues, buffers and scripts start
+   transfers from completions), so every update is done with the interrupts
+   masked. Starts are stamped per direction, a transmit completion does not
+   end the latency of a receive running at the same time */
+typedef struct {
+  uint32_t              operations;
+  uint32_t              results[JHAL_STATS_RESULTS];
+  uint64_t              bytes;
+  uint64_t              cycles_call;
+  uint32_t              cycles_call_max;
+  uint32_t              timestamp_start[JHAL_STATS_DIRECTIONS];
+  uint32_t              starts[JHAL_STATS_DIRECTIONS];
+  
+  uint32_t              starts_seen[JHAL_STATS_DIRECTIONS];
+  uint32_t              completions;
+  uint32_t              events;
+  uint64_t              cycles_complete;
+  uint32_t              cycles_complete_max;
+} jhal_stats_counters;
+#endif
+
+typedef struct {
+  void*                 puser_data;
+  uint32_t              instance_signature;
+  void*                 pfuncs_callbacks;
+  void*                 pinstance;
+#if (USE_JHAL_OPS == 1)
+  const void*           pops;
+#endif
+#if (USE_JHAL_DEFER == 1)
+  uint8_t               defer_level;
+#endif
+#if (USE_JHAL_STATS == 1)
+  jhal_stats_counters   stats;
+#endif
+} jhal_driver_instance;
+
+#define INSTANCE_SIGNATURE              0x523487AC
+
+typedef enum {
+  JHAL_DRIVER_TYPE_OTHER                = 0U,
+  JHAL_DRIVER_TYPE_GPIO                 = 1U,
+  JHAL_DRIVER_TYPE_SPI                  = 2U,
+  JHAL_DRIVER_TYPE_UART                 = 3U,
+  JHAL_DRIVER_TYPE_DMA                  = 4U,
+  JHAL_DRIVER_TYPE_TIM_BASE             = 5U,
+  JHAL_DRIVER_TYPE_CRC                  = 6U,
+  JHAL_DRIVER_TYPE_I2C                  = 7U,
+  JHAL_DRIVER_TYPE_ADC                  = 8U,
+  JHAL_DRIVER_TYPE_ONEWIRE              = 9U,
+  JHAL_DRIVER_TYPE_FLASH                = 10U,
+  JHAL_DRIVER_TYPE_AMOUNT               = 11U
+} jhal_driver_type;
+
+void* jhal_malloc(uint32_t size);
+void jhal_free(void* pinstance);
+
+jhal_driver_instance* jhal_driver_malloc(uint32_t size_instance, uint32_t size_driver, jhal_driver_type driver_type);
+jhal_driver_instance* jhal_driver_place(void* pmem, uint32_t size_mem, uint32_t size_instance, uint32_t size_driver);
+void jhal_driver_free(void* pinstance);
+
+#if (USE_JHAL_MEM_STATS == 1)
+typedef struct {
+  uint32_t              size_block;
+  uint32_t              amount_blocks;
+  uint32_t              amount_used;
+  uint32_t              amount_peak;
+  uint32_t              bytes_requested;
+  uint16_t              fragmentation_permille;
+} jhal_mem_class_stats;
+
+/* fragmentation_permille is the share of the used blocks that the requests
+   leave unused, a request takes the whole block of its class. Free blocks of
+   a class all have the same size, so they are not fragmented: an empty pool
+   reports 0 and an init that fails has exhausted the classes that fit it */
+
+typedef struct {
+  uint32_t              bytes_total;
+  uint32_t              bytes_used;
+  uint32_t              bytes_peak;
+  uint32_t              bytes_requested;
+  uint32_t              bytes_free;
+  uint32_t              largest_free_block;
+  uint32_t              blocks_live;
+  uint32_t              alloc_failures;
+  uint16_t              fragmentation_permille;
+  uint32_t              bytes_by_type[JHAL_DRIVER_TYPE_AMOUNT];
+  jhal_mem_class_stats  classes[JHAL_MEM_POOL_CLASSES];
+} jhal_mem_stats;
+
+typedef struct {
+  void*                 pblock;
+  uint32_t              size_block;
+  uint32_t              size_requested;
+  jhal_driver_type      driver_type;
+  const char*           pfile;
+  uint32_t              line;
+} jhal_mem_block_info;
+
+uint8_t jhal_mem_get_stats(jhal_mem_stats* pstats);
+uint8_t jhal_mem_get_block_info(uint32_t index, jhal_mem_block_info* pinfo);
+void jhal_mem_reset_peak(void);
+
+#if (USE_JHAL_MEM_CALL_SITE == 1)
+void jhal_mem_call_site(const char* pfile, uint32_t line);
+
+#define JHAL_MEM_CALL_SITE(CALL)                        (jhal_mem_call_site(__FILE__, __LINE__), (CALL))
+#define jhal_malloc(SIZE)                               JHAL_MEM_CALL_SITE((jhal_malloc)(SIZE))
+#endif
+#elif (USE_JHAL_MEM_CALL_SITE == 1)
+  #error "USE_JHAL_MEM_CALL_SITE requires USE_JHAL_MEM_STATS!"
+#endif
+
+#define JHAL_ALIGN_SIZE(SIZE)                           (((SIZE) + sizeof(void*) - 1) & ~(sizeof(void*) - 1))
+#define JHAL_DRIVER_SIZE_STATIC(SIZE_INSTANCE, SIZE_DRIVER)  (sizeof(jhal_driver_instance) + JHAL_ALIGN_SIZE(SIZE_INSTANCE) + (SIZE_DRIVER))
+#define JHAL_DECLARE_STATIC_MEM(NAME, SIZE)             static uint64_t NAME[((SIZE) + sizeof(uint64_t) - 1) / sizeof(uint64_t)]
+
+#if (USE_JHAL_MEM_LINKED == 1)
+/* Record of one declared instance. The linker gathers the records of the
+   declarations of a driver into its own jhal_slots_<TAG> section, so the memory
+   for drivers is exactly what the application declares and a lack of RAM is
+   reported by the link */
+typedef struct {
+  uint64_t*             pmem;
+  uint32_t              size_mem;
+} jhal_mem_slot;
+
+/* Slots of one driver, bound to the section of the driver by the link. Slots
+   are taken in the order of pnext, a slot is only searched for when one was
+   given back by a deinit */
+typedef struct {
+  const jhal_mem_slot*  pbegin;
+  const jhal_mem_slot*  pend;
+  const jhal_mem_slot*  pnext;
+} jhal_mem_slots;
+
+/* The tag is only ever pasted, never passed further, so tags like CRC or ADC
+   that the CMSIS headers define as macros are not expanded */
+#define JHAL_MEM_STR_(X)                                #X
+#define JHAL_MEM_STR(X)                                 JHAL_MEM_STR_(X)
+
+#if defined(__ICCARM__)
+  #define JHAL_MEM_PRAGMA_(X)                           _Pragma(#X)
+  #define JHAL_MEM_PRAGMA(X)                            JHAL_MEM_PRAGMA_(X)
+  #define JHAL_MEM_SLOT_DEFINE(NAME, SECTION)           __root const jhal_mem_slot NAME @ JHAL_MEM_STR(SECTION)
+  #define JHAL_MEM_SLOTS_RANGE(NAME, SECTION)           JHAL_MEM_PRAGMA(section = JHAL_MEM_STR(SECTION))\
+                                                        jhal_mem_slots NAME = {(const jhal_mem_slot*)__section_begin(JHAL_MEM_STR(SECTION)),\
+                                                                               (const jhal_mem_slot*)__section_end(JHAL_MEM_STR(SECTION)),\
+                                                                               (const jhal_mem_slot*)__section_begin(JHAL_MEM_STR(SECTION))}
+#else
+  #define JHAL_MEM_SLOT_DEFINE(NAME, SECTION)           const jhal_mem_slot NAME __attribute__((section(JHAL_MEM_STR(SECTION)), used))
+  #define JHAL_MEM_SLOTS_RANGE(NAME, START, STOP)       extern const jhal_mem_slot START[];\
+                                                        extern const jhal_mem_slot STOP[];\
+                                                        jhal_mem_slots NAME = {START, STOP, START}
+#endif
+
+/* Defined by each driver. The bounds of the section are not weak, so a build
+   that inits a driver without declaring any instance of it fails to link, an
+   unused driver is dropped with its bounds by --gc-sections */
+#define JHAL_MEM_SLOTS(TAG)                             (&JhalMemSlots ## TAG)
+#define JHAL_MEM_SLOTS_DECLARE(TAG)                     extern jhal_mem_slots JhalMemSlots ## TAG
+#if defined(__ICCARM__)
+  #define JHAL_MEM_SLOTS_DEFINE(TAG)                    JHAL_MEM_SLOTS_RANGE(JhalMemSlots ## TAG, jhal_slots_ ## TAG)
+#else
+  #define JHAL_MEM_SLOTS_DEFINE(TAG)                    JHAL_MEM_SLOTS_RANGE(JhalMemSlots ## TAG, __start_jhal_slots_ ## TAG, __stop_jhal_slots_ ## TAG)
+#endif
+
+#define JHAL_DECLARE_INSTANCE(NAME, SIZE, TAG)          JHAL_DECLARE_STATIC_MEM(NAME ## _mem, SIZE);\
+                                                        JHAL_MEM_SLOT_DEFINE(NAME, jhal_slots_ ## TAG) = {NAME ## _mem, sizeof(NAME ## _mem)}
+
+jhal_driver_instance* jhal_driver_slot_take(jhal_mem_slots* pslots, uint32_t size_instance, uint32_t size_driver);
+uint32_t jhal_mem_slots_free(const jhal_mem_slots* pslots);
+
+#define JHAL_DRIVER_MALLOC(SIZE_INSTANCE, SIZE_DRIVER, TAG)  jhal_driver_slot_take(&JhalMemSlots ## TAG, SIZE_INSTANCE, SIZE_DRIVER)
+#else
+#define JHAL_DRIVER_MALLOC(SIZE_INSTANCE, SIZE_DRIVER, TAG)  jhal_driver_malloc(SIZE_INSTANCE, SIZE_DRIVER, JHAL_DRIVER_TYPE_ ## TAG)
+#endif
+
+#define JHAL_DRIVER_BY_INSTANCE(INSTANCE)               ((jhal_driver_instance*)((uint8_t*)(INSTANCE) - sizeof(jhal_driver_instance)))
+
+#define JHAL_GET_SIGNATURE(INSTANCE)                    (JHAL_DRIVER_BY_INSTANCE(INSTANCE)->instance_signature)
+#define JHAL_GET_FUNC_CALLBACKS(INSTANCE)               (JHAL_DRIVER_BY_INSTANCE(INSTANCE)->pfuncs_callbacks)
+#define JHAL_GET_USERDATA(INSTANCE)                     (JHAL_DRIVER_BY_INSTANCE(INSTANCE)->puser_data)
+#define JHAL_GET_CALLBACKS(INSTANCE, TYPE)              ((TYPE*)JHAL_GET_FUNC_CALLBACKS(INSTANCE))
+
+#define JHAL_CHECK_INSTANCE(INSTANCE)                   (JHAL_GET_SIGNATURE(INSTANCE) == INSTANCE_SIGNATURE)
+
+#define JHAL_CARCASS_FUNC(INSTANCE, TYPE, MEMBER_TYPE, MEMBER)   (JHAL_GET_CALLBACKS(INSTANCE, TYPE)->MEMBER)\
+                                                                 (INSTANCE, JHAL_GET_USERDATA(INSTANCE)
+
+//#define JHAL_CARCASS_FUNC(INSTANCE, TYPE, MEMBER)       (*((MEMBER)*)((uint32_t)JHAL_GET_FUNC_CALLBACKS(INSTANCE) + offsetof(TYPE, MEMBER)))\
+//                                                        (INSTANCE, JHAL_GET_USERDATA(INSTANCE)
+
+#if defined(JHAL_MCU) && defined(JHAL_LIB)
+  #if (JHAL_LIB == 1)
+    #define JHAL_MCU_ENV                        JHAL_MCU
+  #else
+    #define JHAL_BUILD_ENV(MCU_TYPE,LIB_TYPE)   MCU_TYPE ## _ ## LIB_TYPE
+    #define JHAL_BUILD_ENV2(MCU_TYPE,LIB_TYPE)  JHAL_BUILD_ENV(MCU_TYPE,LIB_TYPE)
+    #define JHAL_MCU_ENV                        JHAL_BUILD_ENV2(JHAL_MCU,JHAL_LIB)
+  #endif
+#else
+  #ifndef JHAL_MCU
+    #error "No declaration of define JHAL_MCU!"
+  #endif
+  
+  #ifndef JHAL_LIB
+    #error "No declaration of define JHAL_LIB!"
+  #endif  
+#endif
+  
+#if (JHAL_LIB != 1) 
+  #define JHAL_CREATE_FUNCTION(MCU_TYPE,DRV_TYPE,ACTION)                          env_ ## MCU_TYPE ## DRV_TYPE ## ACTION
+  #define JHAL_CREATE_INCLUDE(MCU_TYPE,DRV_TYPE)                                  env_ ## MCU_TYPE ## DRV_TYPE
+#else
+  #define JHAL_CREATE_FUNCTION(MCU_TYPE,DRV_TYPE,ACTION)                          MCU_TYPE ## DRV_TYPE ## ACTION
+  #define JHAL_CREATE_INCLUDE(MCU_TYPE,DRV_TYPE)                                  MCU_TYPE ## DRV_TYPE  
+#endif
+  
+#define JHAL_FUNCTION_NAME(MCU_TYPE,DRV_TYPE,ACTION)                              JHAL_CREATE_FUNCTION(MCU_TYPE,DRV_TYPE,ACTION)
+#define JHAL_INCLUDE_NAME(MCU_TYPE,DRV_TYPE)                                      JHAL_CREATE_INCLUDE(MCU_TYPE,DRV_TYPE)
+
+#if (USE_JHAL_OPS == 1)
+  #define JHAL_GET_OPS(INSTANCE, TYPE)                                            ((const TYPE*)JHAL_DRIVER_BY_INSTANCE(INSTANCE)->pops)
+  #define JHAL_OPS_BY_PARAMS(PARAMS, DRV_TYPE)                                    ((PARAMS)->pops ? (PARAMS)->pops : &jhal ## DRV_TYPE ## _ops_default)
+  #define JHAL_DISPATCH(INSTANCE, DRV_TYPE, ACTION)                               (JHAL_GET_OPS(INSTANCE, jhal ## DRV_TYPE ## _ops)->pfunc ## ACTION)
+  #define JHAL_SIZE_DRV_BY_PARAMS(PARAMS, DRV_TYPE)                               (JHAL_OPS_BY_PARAMS(PARAMS, DRV_TYPE)->pfunc_size_drv())
+#else
+  #define JHAL_DISPATCH(INSTANCE, DRV_TYPE, ACTION)                               JHAL_FUNCTION_NAME(JHAL_MCU_ENV,DRV_TYPE,ACTION)
+  #define JHAL_SIZE_DRV_BY_PARAMS(PARAMS, DRV_TYPE)                               JHAL_FUNCTION_NAME(JHAL_MCU_ENV,DRV_TYPE,_size_drv)()
+#endif
+
+#if ( USE_JHAL_ASSERT  == 1)
+  #define JHAL_ENV_INCLUDE_NAME_WITHOUT_QUOTES                                    JHAL_INCLUDE_NAME(JHAL_MCU_ENV,.h)
+  #define JHAL_ENV_INCLUDE_NAME_WITH_QUOTES(INCLUDE_NAME)                         #INCLUDE_NAME
+  #define JHAL_ENV_INCLUDE_NAME_WITH_QUOTES2(INCLUDE_NAME)                        JHAL_ENV_INCLUDE_NAME_WITH_QUOTES(INCLUDE_NAME)
+  #define JHAL_ENV_INCLUDE_NAME                                                   JHAL_ENV_INCLUDE_NAME_WITH_QUOTES2(JHAL_SPI_INCLUDE_NAME_WITHOUT_QUOTES)
+  
+  #define JHAL_ASSERT(CONDITION)                                                  do {if(!(CONDITION))JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_assert)(__FILE__,__LINE__); }while(0)
+#else
+  #define JHAL_ASSERT(CONDITION)                                                  do {}while(0)
+#endif
+
+#define JHAL_INCLUDE_NAME_WITH_QUOTES(INCLUDE_NAME)                               #INCLUDE_NAME
+#define JHAL_INCLUDE_NAME_WITH_QUOTES2(INCLUDE_NAME)                              JHAL_INCLUDE_NAME_WITH_QUOTES(INCLUDE_NAME)
+ 
+#define JHAL_TICK_INCLUDE_NAME_WITHOUT_QUOTES                                     JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_tick.h)
+#define JHAL_TICK_INCLUDE_NAME                                                    JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_TICK_INCLUDE_NAME_WITHOUT_QUOTES)
+
+#define JHAL_TICK(AMOUNT_US)                                                      JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_tick)(AMOUNT_US)
+#define JHAL_TICK_INIT                                                            JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_tick_init)
+#define JHAL_TICK_CYCLES()                                                        JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_tick_cycles)()
+#define JHAL_TICK_CYCLES_HZ()                                                     JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_tick_cycles_hz)()
+#define JHAL_TICK_CYCLES64                                                        JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_tick_cycles64)
+#define JHAL_CRITICAL_ENTER()                                                     JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_critical_enter)()
+#define JHAL_CRITICAL_EXIT(STATE)                                                 JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_critical_exit)(STATE)
+                                             
+#define JHAL_SPI_INCLUDE_NAME_WITHOUT_QUOTES                                      JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_spi.h)
+#define JHAL_SPI_INCLUDE_NAME                                                     JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_SPI_INCLUDE_NAME_WITHOUT_QUOTES)
+
+#define JHAL_SPI_SIZE_DRV                                                         JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_size_drv)()
+#define JHAL_SPI_SIZE_DRV_STATIC                                                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_size_drv_static)
+#define JHAL_SPI_INIT(INSTANCE,PARAMS)                                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_init)(INSTANCE,PARAMS)
+#define JHAL_SPI_DEINIT(INSTANCE)                                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_deinit)(INSTANCE)
+#define JHAL_SPI_TRANSMIT(INSTANCE,TXDATA,SIZE,TIMEOUT)                           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_transmit)(INSTANCE,TXDATA,SIZE,TIMEOUT)
+#define JHAL_SPI_RECEIVE(INSTANCE,RXDATA,SIZE,TIMEOUT)                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_receive)(INSTANCE,RXDATA,SIZE,TIMEOUT)
+#define JHAL_SPI_TRANSMITRECEIVE(INSTANCE,TXDATA,RXDATA,SIZE,TIMEOUT)             JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_transmitreceive)(INSTANCE,TXDATA,RXDATA,SIZE,TIMEOUT)
+#define JHAL_SPI_TRANSMIT_IT(INSTANCE,TXDATA,SIZE)                                JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_transmit_it)(INSTANCE,TXDATA,SIZE)
+#define JHAL_SPI_RECEIVE_IT(INSTANCE,RXDATA,SIZE)                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_receive_it)(INSTANCE,RXDATA,SIZE)
+#define JHAL_SPI_TRANSMITRECEIVE_IT(INSTANCE,TXDATA,RXDATA,SIZE)                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_transmitreceive_it)(INSTANCE,TXDATA,RXDATA,SIZE)
+#define JHAL_SPI_TRANSMIT_DMA(INSTANCE,TXDATA,SIZE,INSTANCE_DMA)                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_transmit_dma)(INSTANCE,TXDATA,SIZE,INSTANCE_DMA)
+#define JHAL_SPI_RECEIVE_DMA(INSTANCE,RXDATA,SIZE,INSTANCE_DMA)                   JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_receive_dma)(INSTANCE,RXDATA,SIZE,INSTANCE_DMA)
+#define JHAL_SPI_TRANSMITRECEIVE_DMA(INSTANCE,TXDATA,RXDATA,SIZE,INSTANCE_DMA)    JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_transmitreceive_dma)(INSTANCE,TXDATA,RXDATA,SIZE,INSTANCE_DMA)
+#define JHAL_SPI_ABORT(INSTANCE)                                                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_spi,_abort)(INSTANCE)
+
+
+#define JHAL_GPIO_INCLUDE_NAME_WITHOUT_QUOTES                                     JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_gpio.h)
+#define JHAL_GPIO_INCLUDE_NAME                                                    JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_GPIO_INCLUDE_NAME_WITHOUT_QUOTES)
+
+#define JHAL_GPIO_SIZE_DRV                                                        JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_gpio,_size_drv)()
+#define JHAL_GPIO_SIZE_DRV_STATIC                                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_gpio,_size_drv_static)
+#define JHAL_GPIO_INIT(INSTANCE,PARAMS)                                           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_gpio,_init)(INSTANCE,PARAMS)
+#define JHAL_GPIO_DEINIT(INSTANCE)                                                JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_gpio,_deinit)(INSTANCE)
+#define JHAL_GPIO_SET(INSTANCE,PIN,VALUE)                                         JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_gpio,_set)(INSTANCE,PIN,VALUE)
+#define JHAL_GPIO_GET(INSTANCE,PIN,VALUE)                                         JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_gpio,_get)(INSTANCE,PIN,VALUE)
+
+#define JHAL_UART_INCLUDE_NAME_WITHOUT_QUOTES                                     JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_uart.h)
+#define JHAL_UART_INCLUDE_NAME                                                    JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_UART_INCLUDE_NAME_WITHOUT_QUOTES)
+
+#define JHAL_UART_SIZE_DRV                                                        JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_size_drv)()
+#define JHAL_UART_SIZE_DRV_STATIC                                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_size_drv_static)
+#define JHAL_UART_INIT(INSTANCE,PARAMS)                                           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_init)(INSTANCE,PARAMS)
+#define JHAL_UART_DEINIT(INSTANCE)                                                JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_deinit)(INSTANCE)
+#define JHAL_UART_TRANSMIT(INSTANCE,TXDATA,SIZE,TIMEOUT)                          JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_transmit)(INSTANCE,TXDATA,SIZE,TIMEOUT)
+#define JHAL_UART_RECEIVE(INSTANCE,RXDATA,SIZE,TIMEOUT)                           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_receive)(INSTANCE,RXDATA,SIZE,TIMEOUT)
+#define JHAL_UART_TRANSMITRECEIVE(INSTANCE,TXDATA,RXDATA,SIZE,TIMEOUT)            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_transmitreceive)(INSTANCE,TXDATA,RXDATA,SIZE,TIMEOUT)
+#define JHAL_UART_TRANSMIT_IT(INSTANCE,TXDATA,SIZE)                               JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_transmit_it)(INSTANCE,TXDATA,SIZE)
+#define JHAL_UART_RECEIVE_IT(INSTANCE,RXDATA,SIZE)                                JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_receive_it)(INSTANCE,RXDATA,SIZE)
+#define JHAL_UART_TRANSMITRECEIVE_IT(INSTANCE,TXDATA,RXDATA,SIZE)                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_transmitreceive_it)(INSTANCE,TXDATA,RXDATA,SIZE)
+#define JHAL_UART_TRANSMIT_DMA(INSTANCE,TXDATA,SIZE,INSTANCE_DMA)                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_transmit_dma)(INSTANCE,TXDATA,SIZE,INSTANCE_DMA)
+#define JHAL_UART_RECEIVE_DMA(INSTANCE,RXDATA,SIZE,INSTANCE_DMA)                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_receive_dma)(INSTANCE,RXDATA,SIZE,INSTANCE_DMA)
+#define JHAL_UART_TRANSMITRECEIVE_DMA(INSTANCE,TXDATA,RXDATA,SIZE,INSTANCE_DMA)   JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_transmitreceive_dma)(INSTANCE,TXDATA,RXDATA,SIZE,INSTANCE_DMA)
+#define JHAL_UART_ABORT(INSTANCE)                                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_abort)(INSTANCE)
+#define JHAL_UART_SET_BAUDRATE(INSTANCE,BAUDRATE)                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_uart,_set_baudrate)(INSTANCE,BAUDRATE)
+
+
+#define JHAL_DMA_INCLUDE_NAME_WITHOUT_QUOTES                                      JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_dma.h)
+#define JHAL_DMA_INCLUDE_NAME                                                     JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_DMA_INCLUDE_NAME_WITHOUT_QUOTES)
+
+#define JHAL_DMA_SIZE_DRV                                                         JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_size_drv)()
+#define JHAL_DMA_SIZE_DRV_STATIC                                                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_size_drv_static)
+#define JHAL_DMA_INIT(INSTANCE,PARAMS)                                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_init)(INSTANCE,PARAMS)
+#define JHAL_DMA_DEINIT(INSTANCE)                                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_deinit)(INSTANCE)
+#define JHAL_DMA_START(INSTANCE,SRCADDRESS,DSTADDRESS,SIZE)                       JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_start)(INSTANCE,SRCADDRESS,DSTADDRESS,SIZE)
+#define JHAL_DMA_STOP(INSTANCE)                                                   JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_stop)(INSTANCE)
+#define JHAL_DMA_START_IT(INSTANCE,SRCADDRESS,DSTADDRESS,SIZE)                    JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_start_it)(INSTANCE,SRCADDRESS,DSTADDRESS,SIZE)
+#define JHAL_DMA_STOP_IT(INSTANCE)                                                JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_dma,_stop_it)(INSTANCE)
+
+
+#define JHAL_TIM_BASE_INCLUDE_NAME_WITHOUT_QUOTES                                 JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_tim_base.h)
+#define JHAL_TIM_BASE_INCLUDE_NAME                                                JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_TIM_BASE_INCLUDE_NAME_WITHOUT_QUOTES)
+
+#define JHAL_TIM_BASE_SIZE_DRV                                                    JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_size_drv)()
+#define JHAL_TIM_BASE_SIZE_DRV_STATIC                                             JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_size_drv_static)
+#define JHAL_TIM_BASE_INIT(INSTANCE,PARAMS)                                       JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_init)(INSTANCE,PARAMS)
+#define JHAL_TIM_BASE_DEINIT(INSTANCE)                                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_deinit)(INSTANCE)
+#define JHAL_TIM_BASE_START(INSTANCE)                                             JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_start)(INSTANCE)
+#define JHAL_TIM_BASE_STOP(INSTANCE)                                              JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_stop)(INSTANCE)
+#define JHAL_TIM_BASE_START_IT(INSTANCE)                                          JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_start_it)(INSTANCE)
+#define JHAL_TIM_BASE_STOP_IT(INSTANCE)                                           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_stop_it)(INSTANCE)
+#define JHAL_TIM_BASE_START_DMA(INSTANCE,PDATA,SIZE,INSTANCE_DMA)                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_start_dma)(INSTANCE,PDATA,SIZE,INSTANCE_DMA)
+#define JHAL_TIM_BASE_STOP_DMA(INSTANCE,INSTANCE_DMA)                             JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_tim_base,_stop_dma)(INSTANCE,INSTANCE_DMA)
+
+
+#define JHAL_CRC_INCLUDE_NAME_WITHOUT_QUOTES                                      JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_crc.h)
+#define JHAL_CRC_INCLUDE_NAME                                                     JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_CRC_INCLUDE_NAME_WITHOUT_QUOTES)
+
+#define JHAL_CRC_SIZE_DRV                                                         JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_crc,_size_drv)()
+#define JHAL_CRC_SIZE_DRV_STATIC                                                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_crc,_size_drv_static)
+#define JHAL_CRC_INIT(INSTANCE,PARAMS)                                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_crc,_init)(INSTANCE,PARAMS)
+#define JHAL_CRC_DEINIT(INSTANCE)                                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_crc,_deinit)(INSTANCE)
+#define JHAL_CRC_ACCUMULATE(INSTANCE,PDATA,SIZE,PSTATE)                           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_crc,_accumulate)(INSTANCE,PDATA,SIZE,PSTATE)
+
+
+#define JHAL_I2C_INCLUDE_NAME_WITHOUT_QUOTES                                      JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_i2c.h)
+#define JHAL_I2C_INCLUDE_NAME                                                     JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_I2C_INCLUDE_NAME_WITHOUT_QUOTES)
+
+#define JHAL_I2C_SIZE_DRV                                                         JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_size_drv)()
+#define JHAL_I2C_SIZE_DRV_STATIC                                                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_size_drv_static)
+#define JHAL_I2C_INIT(INSTANCE,PARAMS)                                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_init)(INSTANCE,PARAMS)
+#define JHAL_I2C_DEINIT(INSTANCE)                                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_deinit)(INSTANCE)
+#define JHAL_I2C_TRANSMIT(INSTANCE,ADDRESS,TXDATA,SIZE,TIMEOUT)                   JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_transmit)(INSTANCE,ADDRESS,TXDATA,SIZE,TIMEOUT)
+#define JHAL_I2C_RECEIVE(INSTANCE,ADDRESS,RXDATA,SIZE,TIMEOUT)                    JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_receive)(INSTANCE,ADDRESS,RXDATA,SIZE,TIMEOUT)
+#define JHAL_I2C_WRITE_READ(INSTANCE,ADDRESS,TXDATA,SIZE_TX,RXDATA,SIZE_RX,TIMEOUT)  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_write_read)(INSTANCE,ADDRESS,TXDATA,SIZE_TX,RXDATA,SIZE_RX,TIMEOUT)
+#define JHAL_I2C_TRANSMIT_IT(INSTANCE,ADDRESS,TXDATA,SIZE)                        JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_transmit_it)(INSTANCE,ADDRESS,TXDATA,SIZE)
+#define JHAL_I2C_RECEIVE_IT(INSTANCE,ADDRESS,RXDATA,SIZE)                         JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_receive_it)(INSTANCE,ADDRESS,RXDATA,SIZE)
+#define JHAL_I2C_WRITE_READ_IT(INSTANCE,ADDRESS,TXDATA,SIZE_TX,RXDATA,SIZE_RX)    JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_write_read_it)(INSTANCE,ADDRESS,TXDATA,SIZE_TX,RXDATA,SIZE_RX)
+#define JHAL_I2C_TRANSMIT_DMA(INSTANCE,ADDRESS,TXDATA,SIZE,INSTANCE_DMA)          JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_transmit_dma)(INSTANCE,ADDRESS,TXDATA,SIZE,INSTANCE_DMA)
+#define JHAL_I2C_RECEIVE_DMA(INSTANCE,ADDRESS,RXDATA,SIZE,INSTANCE_DMA)           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_receive_dma)(INSTANCE,ADDRESS,RXDATA,SIZE,INSTANCE_DMA)
+#define JHAL_I2C_WRITE_READ_DMA(INSTANCE,ADDRESS,TXDATA,SIZE_TX,RXDATA,SIZE_RX,INSTANCE_DMA)  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_write_read_dma)(INSTANCE,ADDRESS,TXDATA,SIZE_TX,RXDATA,SIZE_RX,INSTANCE_DMA)
+#define JHAL_I2C_ABORT(INSTANCE)                                                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_i2c,_abort)(INSTANCE)
+
+#define JHAL_ADC_INCLUDE_NAME_WITHOUT_QUOTES                                      JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_adc.h)
+#define JHAL_ADC_INCLUDE_NAME                                                     JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_ADC_INCLUDE_NAME_WITHOUT_QUOTES)
+
+#define JHAL_ADC_SIZE_DRV                                                         JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_adc,_size_drv)()
+#define JHAL_ADC_SIZE_DRV_STATIC                                                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_adc,_size_drv_static)
+#define JHAL_ADC_INIT(INSTANCE,PARAMS)                                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_adc,_init)(INSTANCE,PARAMS)
+#define JHAL_ADC_DEINIT(INSTANCE)                                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_adc,_deinit)(INSTANCE)
+#define JHAL_ADC_CONVERT(INSTANCE,PVALUES,TIMEOUT)                                JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_adc,_convert)(INSTANCE,PVALUES,TIMEOUT)
+#define JHAL_ADC_CONVERT_IT(INSTANCE,PVALUES)                                     JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_adc,_convert_it)(INSTANCE,PVALUES)
+#define JHAL_ADC_START_DMA(INSTANCE,PBUFFER,SIZE,INSTANCE_DMA)                    JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_adc,_start_dma)(INSTANCE,PBUFFER,SIZE,INSTANCE_DMA)
+#define JHAL_ADC_STOP(INSTANCE)                                                   JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_adc,_stop)(INSTANCE)
+
+#define JHAL_FLASH_INCLUDE_NAME_WITHOUT_QUOTES                                JHAL_INCLUDE_NAME(JHAL_MCU_ENV,_flash.h)
+#define JHAL_FLASH_INCLUDE_NAME                                               JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_FLASH_INCLUDE_NAME_WITHOUT_QUOTES)
+
+#define JHAL_FLASH_SIZE_DRV                                                   JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_flash,_size_drv)()
+#define JHAL_FLASH_SIZE_DRV_STATIC                                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_flash,_size_drv_static)
+#define JHAL_FLASH_INIT(INSTANCE,PARAMS)                                      JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_flash,_init)(INSTANCE,PARAMS)
+#define JHAL_FLASH_DEINIT(INSTANCE)                                           JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_flash,_deinit)(INSTANCE)
+#define JHAL_FLASH_GET_INFO(INSTANCE,PINFO)                                   JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_flash,_get_info)(INSTANCE,PINFO)
+#define JHAL_FLASH_GET_SECTOR(INSTANCE,ADDRESS,PSTART,PSIZE)                  JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_flash,_get_sector)(INSTANCE,ADDRESS,PSTART,PSIZE)
+#define JHAL_FLASH_READ(INSTANCE,ADDRESS,PDATA,SIZE)                          JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_flash,_read)(INSTANCE,ADDRESS,PDATA,SIZE)
+#define JHAL_FLASH_ERASE(INSTANCE,ADDRESS,TIMEOUT)                            JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_flash,_erase)(INSTANCE,ADDRESS,TIMEOUT)
+#define JHAL_FLASH_ERASE_IT(INSTANCE,ADDRESS)                                 JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_flash,_erase_it)(INSTANCE,ADDRESS)
+#define JHAL_FLASH_PROGRAM(INSTANCE,ADDRESS,PDATA,SIZE,TIMEOUT)               JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_flash,_program)(INSTANCE,ADDRESS,PDATA,SIZE,TIMEOUT)
+#define JHAL_FLASH_PROGRAM_IT(INSTANCE,ADDRESS,PDATA,SIZE)                    JHAL_FUNCTION_NAME(JHAL_MCU_ENV,_flash,_program_it)(INSTANCE,ADDRESS,PDATA,SIZE)
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,109 @@
+#include "jhal_os.h"
+
+#if (USE_JHAL_OS == 1)
+
+uint8_t jhal_os_blocking_init(jhal_os_blocking* pblocking)
+{
+  pblocking->waiting = 0;
+  
+  uint8_t res = jhal_os_mutex_init(&pblocking->lock);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  res = jhal_os_sem_init(&pblocking->complete, 0, 1);
+  if(res != JHAL_RES_NO_ERRORS)
+    jhal_os_mutex_deinit(&pblocking->lock);
+  
+  return res;
+}
+
+uint8_t jhal_os_blocking_deinit(jhal_os_blocking* pblocking)
+{
+  pblocking->waiting = 0;
+  jhal_os_sem_deinit(&pblocking->complete);
+  
+  return jhal_os_mutex_deinit(&pblocking->lock);
+}
+
+/* With USE_JHAL_DEADLINE the timeout of the call is turned into one deadline here,
+   waiting for the lock and for the completion share it instead of taking it twice */
+uint8_t jhal_os_blocking_begin(jhal_os_blocking* pblocking, uint32_t timeout)
+{
+#if (USE_JHAL_DEADLINE == 1)
+  pblocking->deadline = jhal_deadline_in_ms(timeout);
+#endif
+  uint8_t res = jhal_os_mutex_lock(&pblocking->lock, timeout);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  /* A completion racing with the timeout of the previous call may have left a count */
+  jhal_os_sem_take(&pblocking->complete, JHAL_OS_NO_WAIT);
+  pblocking->waiting = 1;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_blocking_wait(jhal_os_blocking* pblocking, uint32_t timeout)
+{
+  uint8_t res = jhal_os_sem_take(&pblocking->complete, jhal_os_blocking_remaining(pblocking, timeout));
+  pblocking->waiting = 0;
+  
+  return res;
+}
+
+void jhal_os_blocking_end(jhal_os_blocking* pblocking)
+{
+  pblocking->waiting = 0;
+  jhal_os_mutex_unlock(&pblocking->lock);
+}
+
+/* Part of the timeout of the call left after the time spent in the call so far */
+uint32_t jhal_os_blocking_remaining(jhal_os_blocking* pblocking, uint32_t timeout)
+{
+#if (USE_JHAL_DEADLINE == 1)
+  (void)timeout;
+  return jhal_deadline_remaining_ms(pblocking->deadline);
+#else
+  (void)pblocking;
+  return timeout;
+#endif
+}
+
+/* Returns 1 if the completion belongs to a blocking call, the user callback
+   must not be called then */
+uint8_t jhal_os_blocking_complete(jhal_os_blocking* pblocking)
+{
+  if(!pblocking->waiting)
+    return 0;
+  
+  pblocking->waiting = 0;
+  jhal_os_sem_give(&pblocking->complete);
+  
+  return 1;
+}
+
+#if (USE_JHAL_DEADLINE == 1)
+/* A wait outside of a task falls back to the polling one. Each take is capped
+   like a sleep of jhal_deadline_wait, so the time base is read often enough */
+uint8_t jhal_os_deadline_wait(jhal_deadline deadline, jhal_type_deadline_ready pfunc_ready, void* pobject, jhal_os_sem* psignal)
+{
+  if(!jhal_os_can_block())
+    return jhal_deadline_wait(deadline, pfunc_ready, pobject);
+  
+  uint32_t take_max = jhal_deadline_sleep_max_us() / 1000U;
+  
+  while(1)
+  {
+    if(pfunc_ready(pobject))
+      return JHAL_RES_NO_ERRORS;
+    
+    uint32_t remaining = jhal_deadline_remaining_ms(deadline);
+    if(!remaining)
+      return JHAL_RES_TIMEOUT;
+    
+    jhal_os_sem_take(psignal, remaining < take_max ? remaining : take_max);
+  }
+}
+#endif
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef __JHAL_OS__
+#define __JHAL_OS__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+#include "jhal_deadline.h"
+
+#if (USE_JHAL_OS == 1)
+
+/* The port is selected the same way as the environment: JHAL_OS=freertos picks
+   os/jhal_os_freertos.h, JHAL_OS=pthread picks os/jhal_os_pthread.h. The port header
+   defines jhal_os_sem, jhal_os_mutex, jhal_os_event and JHAL_OS_SLEEP_MIN_US */
+#ifndef JHAL_OS
+  #error "No declaration of define JHAL_OS!"
+#endif
+
+#define JHAL_OS_CREATE_INCLUDE(OS_TYPE)                 jhal_os_ ## OS_TYPE.h
+#define JHAL_OS_CREATE_INCLUDE2(OS_TYPE)                JHAL_OS_CREATE_INCLUDE(OS_TYPE)
+#define JHAL_OS_INCLUDE_NAME                            JHAL_INCLUDE_NAME_WITH_QUOTES2(JHAL_OS_CREATE_INCLUDE2(JHAL_OS))
+
+#include JHAL_OS_INCLUDE_NAME
+
+#define JHAL_OS_NO_WAIT                                 0U
+#define JHAL_OS_WAIT_FOREVER                            0xFFFFFFFFU
+
+/* Timeouts are in ms like the timeouts of the blocking driver calls. give, set and
+   the blocking completion may be called from interrupts, everything else only from tasks */
+uint8_t jhal_os_can_block(void);
+void jhal_os_isr_enter(void);
+void jhal_os_isr_exit(void);
+uint8_t jhal_os_sleep_us(uint32_t amount_us);
+
+uint8_t jhal_os_sem_init(jhal_os_sem* psem, uint32_t count_initial, uint32_t count_max);
+uint8_t jhal_os_sem_deinit(jhal_os_sem* psem);
+uint8_t jhal_os_sem_take(jhal_os_sem* psem, uint32_t timeout);
+uint8_t jhal_os_sem_give(jhal_os_sem* psem);
+
+uint8_t jhal_os_mutex_init(jhal_os_mutex* pmutex);
+uint8_t jhal_os_mutex_deinit(jhal_os_mutex* pmutex);
+uint8_t jhal_os_mutex_lock(jhal_os_mutex* pmutex, uint32_t timeout);
+uint8_t jhal_os_mutex_unlock(jhal_os_mutex* pmutex);
+
+uint8_t jhal_os_event_init(jhal_os_event* pevent);
+uint8_t jhal_os_event_deinit(jhal_os_event* pevent);
+uint8_t jhal_os_event_set(jhal_os_event* pevent, uint32_t bits);
+uint8_t jhal_os_event_clear(jhal_os_event* pevent, uint32_t bits);
+uint8_t jhal_os_event_wait(jhal_os_event* pevent, uint32_t bits, uint8_t wait_all, uint32_t timeout, uint32_t* pbits);
+
+/* Completion of a transfer started by a blocking driver call. The mutex serializes
+   tasks sharing one instance, the semaphore is given from the completion interrupt */
+typedef struct {
+  jhal_os_mutex                 lock;
+  jhal_os_sem                   complete;
+  volatile uint8_t              waiting;
+#if (USE_JHAL_DEADLINE == 1)
+  jhal_deadline                 deadline;
+#endif
+} jhal_os_blocking;
+
+uint8_t jhal_os_blocking_init(jhal_os_blocking* pblocking);
+uint8_t jhal_os_blocking_deinit(jhal_os_blocking* pblocking);
+uint8_t jhal_os_blocking_begin(jhal_os_blocking* pblocking, uint32_t timeout);
+uint8_t jhal_os_blocking_wait(jhal_os_blocking* pblocking, uint32_t timeout);
+void jhal_os_blocking_end(jhal_os_blocking* pblocking);
+uint32_t jhal_os_blocking_remaining(jhal_os_blocking* pblocking, uint32_t timeout);
+uint8_t jhal_os_blocking_complete(jhal_os_blocking* pblocking);
+
+#if (USE_JHAL_DEADLINE == 1)
+/* jhal_deadline_wait for a condition that an interrupt completes: the task
+   blocks on psignal, which the completion gives, and checks pfunc_ready on
+   every wake, so a stale give does not end the wait early */
+uint8_t jhal_os_deadline_wait(jhal_deadline deadline, jhal_type_deadline_ready pfunc_ready, void* pobject, jhal_os_sem* psignal);
+#endif
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef __JHAL_PROBE__
+#define __JHAL_PROBE__
+
+#include "jhal_trace.h"
+#include "jhal_stats.h"
+
+/* Hooks of the driver wrappers, each one feeds the trace ring and the
+   instance counters and compiles to nothing when both are off */
+#define JHAL_PROBE_BEGIN(DRIVER, INSTANCE, OP, SIZE)                    do { JHAL_TRACE_BEGIN(DRIVER, INSTANCE, OP, SIZE);\
+                                                                             JHAL_STATS_BEGIN(INSTANCE, OP); } while(0)
+#define JHAL_PROBE_END(DRIVER, INSTANCE, OP, SIZE, RESULT)              JHAL_STATS_END(INSTANCE, OP, SIZE, JHAL_TRACE_END(DRIVER, INSTANCE, OP, SIZE, RESULT))
+#define JHAL_PROBE_EVENT(DRIVER, INSTANCE, OP, SIZE)                    do { JHAL_TRACE_EVENT(DRIVER, INSTANCE, OP, SIZE);\
+                                                                             JHAL_STATS_EVENT(INSTANCE, OP, SIZE); } while(0)
+
+#endif
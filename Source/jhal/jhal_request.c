@@ -0,0 +1,135 @@
+#include <string.h>
+#include "jhal_request.h"
+#include JHAL_TICK_INCLUDE_NAME
+
+#if (USE_JHAL_QUEUE == 1)
+
+/* Starts waiting requests until one is in flight. Runs with interrupts masked or
+   from the completion interrupt. A request completing inside pfunc_start (a
+   synchronous backend) only advances the ring, the loop here starts the next one */
+static void prv_queue_run(jhal_request_queue* pqueue)
+{
+  if(pqueue->starting)
+    return;
+  
+  pqueue->starting = 1;
+  
+  while(!pqueue->busy && pqueue->index_active != pqueue->index_submit)
+  {
+    jhal_request* prequest = &pqueue->prequests[pqueue->index_active & pqueue->mask];
+    
+    pqueue->busy = 1;
+    uint8_t res = pqueue->pfunc_start(pqueue->pinstance, prequest);
+    
+    if(res != JHAL_RES_NO_ERRORS)
+    {
+      pqueue->busy = 0;
+      prequest->result = res;
+      pqueue->index_active++;
+      
+      if(pqueue->pfunc_complete)
+        pqueue->pfunc_complete(pqueue->puser_data, prequest);
+    }
+  }
+  
+  pqueue->starting = 0;
+}
+
+uint8_t jhal_request_queue_init(jhal_request_queue* pqueue, jhal_request* prequests, uint16_t amount, jhal_type_request_complete pfunc_complete, void* puser_data)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  if(!pqueue || !prequests || !amount || (amount & (amount - 1)) || amount > 0x8000U)
+    return JHAL_RES_INVALID_PARAMS;
+#endif
+  memset(pqueue, 0, sizeof(jhal_request_queue));
+  pqueue->prequests = prequests;
+  pqueue->mask = amount - 1;
+  pqueue->pfunc_complete = pfunc_complete;
+  pqueue->puser_data = puser_data;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_request_queue_bind(jhal_request_queue* pqueue, void* pinstance, jhal_type_request_start pfunc_start)
+{
+  if(pinstance != NULL && pqueue->pinstance != NULL && pqueue->pinstance != pinstance)
+    return JHAL_RES_ERROR;
+  
+  pqueue->pinstance = pinstance;
+  pqueue->pfunc_start = pfunc_start;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* Returns the amount of requests taken, the rest did not fit in the ring */
+uint16_t jhal_request_submit(jhal_request_queue* pqueue, const jhal_request* prequests, uint16_t amount)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  if(!pqueue || !pqueue->pfunc_start || !prequests)
+    return 0;
+#endif
+  uint16_t index = pqueue->index_submit;
+  uint16_t amount_free = (uint16_t)(pqueue->mask + 1 - (uint16_t)(index - pqueue->index_drain));
+  
+  if(amount > amount_free)
+    amount = amount_free;
+  
+  for(uint16_t i = 0; i < amount; i++)
+  {
+    pqueue->prequests[(uint16_t)(index + i) & pqueue->mask] = prequests[i];
+    pqueue->prequests[(uint16_t)(index + i) & pqueue->mask].result = JHAL_RES_NO_ERRORS;
+  }
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  pqueue->index_submit = index + amount;
+  prv_queue_run(pqueue);
+  JHAL_CRITICAL_EXIT(state);
+  
+  return amount;
+}
+
+uint16_t jhal_request_drain(jhal_request_queue* pqueue, jhal_request* prequests, uint16_t amount)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  if(!pqueue || !prequests)
+    return 0;
+#endif
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  uint16_t index_active = pqueue->index_active;
+  JHAL_CRITICAL_EXIT(state);
+  
+  uint16_t drained = 0;
+  
+  while(drained < amount && pqueue->index_drain != index_active)
+  {
+    prequests[drained++] = pqueue->prequests[pqueue->index_drain & pqueue->mask];
+    pqueue->index_drain++;
+  }
+  
+  return drained;
+}
+
+uint16_t jhal_request_pending(jhal_request_queue* pqueue)
+{
+  return (uint16_t)(pqueue->index_submit - pqueue->index_active);
+}
+
+void jhal_request_queue_complete(jhal_request_queue* pqueue, uint8_t result)
+{
+  /* A completion with nothing in flight is stale, the slot is not ours to finish */
+  if(!pqueue->busy)
+    return;
+  
+  jhal_request* prequest = &pqueue->prequests[pqueue->index_active & pqueue->mask];
+  
+  prequest->result = result;
+  pqueue->busy = 0;
+  pqueue->index_active++;
+  
+  if(pqueue->pfunc_complete)
+    pqueue->pfunc_complete(pqueue->puser_data, prequest);
+  
+  prv_queue_run(pqueue);
+}
+
+#endif
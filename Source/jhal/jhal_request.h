@@ -0,0 +1,76 @@
+#ifndef __JHAL_REQUEST__
+#define __JHAL_REQUEST__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+
+#if (USE_JHAL_QUEUE == 1)
+
+#define JHAL_REQUEST_OPERATION_TX                       1U
+#define JHAL_REQUEST_OPERATION_RX                       2U
+#define JHAL_REQUEST_OPERATION_TXRX                     3U
+#define JHAL_REQUEST_OPERATION_WRITE_READ               4U
+
+/* For DMA ptxdata is the source and prxdata the destination of TXRX.
+   pinstance_dma selects the DMA variant of SPI and UART transfers, NULL - IT.
+   address and size_tx are taken by I2C only: WRITE_READ writes size_tx bytes
+   of ptxdata and reads size bytes to prxdata after a repeated start */
+typedef struct {
+  uint8_t                       operation;
+  uint8_t                       result;
+  uint16_t                      address;
+  uint32_t                      size;
+  uint16_t                      size_tx;
+  uint8_t*                      ptxdata;
+  uint8_t*                      prxdata;
+  void*                         pinstance_dma;
+  void*                         ptag;
+} jhal_request;
+
+typedef uint8_t (*jhal_type_request_start)(void* pinstance, jhal_request* prequest);
+typedef void (*jhal_type_request_complete)(void* puser_data, jhal_request* prequest);
+
+/* One ring of caller-owned slots. Slots from index_drain to index_active are
+   completed, from index_active to index_submit are waiting or in flight.
+   Indexes run free and are masked, so the amount of slots is a power of two */
+typedef struct {
+  jhal_request*                 prequests;
+  uint16_t                      mask;
+  volatile uint16_t             index_submit;
+  volatile uint16_t             index_active;
+  volatile uint16_t             index_drain;
+  volatile uint8_t              busy;
+  volatile uint8_t              starting;
+  void*                         pinstance;
+  jhal_type_request_start       pfunc_start;
+  jhal_type_request_complete    pfunc_complete;
+  void*                         puser_data;
+} jhal_request_queue;
+
+uint8_t jhal_request_queue_init(jhal_request_queue* pqueue, jhal_request* prequests, uint16_t amount, jhal_type_request_complete pfunc_complete, void* puser_data);
+uint8_t jhal_request_queue_bind(jhal_request_queue* pqueue, void* pinstance, jhal_type_request_start pfunc_start);
+uint16_t jhal_request_submit(jhal_request_queue* pqueue, const jhal_request* prequests, uint16_t amount);
+uint16_t jhal_request_drain(jhal_request_queue* pqueue, jhal_request* prequests, uint16_t amount);
+uint16_t jhal_request_pending(jhal_request_queue* pqueue);
+
+/* Called by the drivers from the completion interrupt of the active request */
+void jhal_request_queue_complete(jhal_request_queue* pqueue, uint8_t result);
+
+/* Direct transfers on an instance with an attached queue would take over the
+   completion of the request in flight, so the drivers refuse them */
+#define JHAL_REQUEST_QUEUE_CHECK(INSTANCE, TYPE)        do {if(JHAL_GET_CALLBACKS(INSTANCE, TYPE)->pqueue) return JHAL_RES_BUSY;} while(0)
+
+#else
+
+#define JHAL_REQUEST_QUEUE_CHECK(INSTANCE, TYPE)
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
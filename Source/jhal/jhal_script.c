@@ -0,0 +1,271 @@
+#include "jhal_script.h"
+
+#if (USE_JHAL_SCRIPT == 1)
+
+#include "jhal_spi.h"
+#include "jhal_gpio.h"
+#include "jhal_tim_base.h"
+#include "jhal_tick.h"
+
+/* Chip select is active low, GPIO steps serve devices with other polarity */
+#define SCRIPT_CS_LEVEL(ASSERT)         ((ASSERT) ? 0U : 1U)
+
+static void prv_script_finish(jhal_script* pscript, uint8_t result)
+{
+  if(pscript->cs_asserted)
+  {
+    jhal_gpio_set(pscript->pinstance_gpio, pscript->pins_cs, SCRIPT_CS_LEVEL(0));
+    pscript->cs_asserted = 0;
+  }
+  
+  jhal_spi_script_attach(pscript->pinstance_spi, NULL);
+  if(pscript->pinstance_tim)
+    jhal_tim_base_script_attach(pscript->pinstance_tim, NULL);
+  
+  pscript->running = 0;
+  
+  if(pscript->pfunc_complete)
+    pscript->pfunc_complete(pscript->puser_data, pscript, result);
+}
+
+static uint8_t prv_script_rx_fits(jhal_script* pscript, const jhal_script_step* pstep)
+{
+  return pscript->prxdata && (uint32_t)pstep->offset + pstep->size <= pscript->size_rxdata;
+}
+
+/* Timer periods of a wait step, 0 when there is no timer to wait on */
+static uint16_t prv_script_periods(jhal_script* pscript, const jhal_script_step* pstep)
+{
+  if(!pscript->pinstance_tim)
+    return 0;
+  if(pstep->op == JHAL_SCRIPT_OP_WAIT_PERIODS)
+    return pstep->size;
+  if(!pscript->period_us || !pstep->size)
+    return 0;
+  
+  return (uint16_t)(((uint32_t)pstep->size + pscript->period_us - 1U) / pscript->period_us);
+}
+
+/* Runs one step. A transfer or a wait moves index_step on before its start and
+   leaves waiting set until its completion */
+static void prv_script_step(jhal_script* pscript)
+{
+  const jhal_script_step* pstep = &pscript->psteps[pscript->index_step];
+  uint8_t res = JHAL_RES_NO_ERRORS;
+  uint8_t started = 0;
+  
+  switch(pstep->op)
+  {
+    case JHAL_SCRIPT_OP_END:
+      prv_script_finish(pscript, JHAL_RES_NO_ERRORS);
+      return;
+    case JHAL_SCRIPT_OP_CS:
+      res = jhal_gpio_set(pscript->pinstance_gpio, pscript->pins_cs, SCRIPT_CS_LEVEL(pstep->value));
+      pscript->cs_asserted = pstep->value;
+      break;
+    case JHAL_SCRIPT_OP_GPIO:
+      res = jhal_gpio_set(pscript->pinstance_gpio, pstep->pins, pstep->value);
+      break;
+    case JHAL_SCRIPT_OP_DELAY_US:
+      pscript->amount_periods = prv_script_periods(pscript, pstep);
+      if(!pscript->amount_periods)
+      {
+        jhal_tick(pstep->size);
+        break;
+      }
+      started = 1;
+      pscript->index_step++;
+      pscript->waiting = 1;
+      res = jhal_tim_base_start_it(pscript->pinstance_tim);
+      break;
+    case JHAL_SCRIPT_OP_TX:
+      started = 1;
+      pscript->index_step++;
+      pscript->waiting = 1;
+      res = jhal_spi_transmit_it(pscript->pinstance_spi, (uint8_t*)pstep->ptxdata, pstep->size);
+      break;
+    case JHAL_SCRIPT_OP_RX:
+      if(!prv_script_rx_fits(pscript, pstep))
+      {
+        res = JHAL_RES_INVALID_PARAMS;
+        break;
+      }
+      started = 1;
+      pscript->index_step++;
+      pscript->waiting = 1;
+      res = jhal_spi_receive_it(pscript->pinstance_spi, &pscript->prxdata[pstep->offset], pstep->size);
+      break;
+    case JHAL_SCRIPT_OP_TXRX:
+      if(!prv_script_rx_fits(pscript, pstep))
+      {
+        res = JHAL_RES_INVALID_PARAMS;
+        break;
+      }
+      started = 1;
+      pscript->index_step++;
+      pscript->waiting = 1;
+      res = jhal_spi_transmitreceive_it(pscript->pinstance_spi, (uint8_t*)pstep->ptxdata, &pscript->prxdata[pstep->offset], pstep->size);
+      break;
+    case JHAL_SCRIPT_OP_WAIT_PERIODS:
+      pscript->amount_periods = prv_script_periods(pscript, pstep);
+      if(!pscript->amount_periods)
+      {
+        res = JHAL_RES_INVALID_PARAMS;
+        break;
+      }
+      started = 1;
+      pscript->index_step++;
+      pscript->waiting = 1;
+      res = jhal_tim_base_start_it(pscript->pinstance_tim);
+      break;
+    case JHAL_SCRIPT_OP_RETRY:
+      if(!pscript->prxdata || pstep->offset >= pscript->size_rxdata || pstep->value > pscript->index_step)
+      {
+        res = JHAL_RES_INVALID_PARAMS;
+        break;
+      }
+      if((pscript->prxdata[pstep->offset] & pstep->mask) == pstep->expect)
+      {
+        pscript->amount_attempts = 0;
+        break;
+      }
+      if(++pscript->amount_attempts >= pstep->size)
+      {
+        res = JHAL_RES_TIMEOUT;
+        break;
+      }
+      pscript->index_step -= pstep->value;
+      return;
+    default:
+      res = JHAL_RES_INVALID_PARAMS;
+      break;
+  }
+  
+  if(started)
+  {
+    if(res == JHAL_RES_NO_ERRORS)
+      return;
+    
+    pscript->waiting = 0;
+    pscript->index_step--;
+  }
+  
+  if(res != JHAL_RES_NO_ERRORS)
+  {
+    prv_script_finish(pscript, res);
+    return;
+  }
+  
+  pscript->index_step++;
+}
+
+/* Runs the synchronous steps in place and returns once a transfer or a wait is
+   started, its completion interrupt carries on from the next step. A completion
+   coming in while the steps run, e.g. from an env finishing the transfer inside
+   the start call, only clears waiting and the loop here goes on, so the stack
+   does not grow with the steps. The check is repeated after the loop is left
+   for a completion that came in just before */
+static void prv_script_run(jhal_script* pscript)
+{
+  if(pscript->stepping)
+    return;
+  
+  do
+  {
+    pscript->stepping = 1;
+    
+    while(pscript->running && !pscript->waiting)
+      prv_script_step(pscript);
+    
+    pscript->stepping = 0;
+  } while(pscript->running && !pscript->waiting);
+}
+
+uint8_t jhal_script_start(jhal_script* pscript)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  if(!pscript || !pscript->psteps || !pscript->pinstance_spi)
+    return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(pscript->running)
+    return JHAL_RES_ERROR;
+  
+  uint8_t res = jhal_spi_script_attach(pscript->pinstance_spi, pscript);
+  if(res != JHAL_RES_NO_ERRORS)
+    return res;
+  
+  if(pscript->pinstance_tim)
+  {
+    res = jhal_tim_base_script_attach(pscript->pinstance_tim, pscript);
+    if(res != JHAL_RES_NO_ERRORS)
+    {
+      jhal_spi_script_attach(pscript->pinstance_spi, NULL);
+      return res;
+    }
+  }
+  
+  pscript->index_step = 0;
+  pscript->amount_attempts = 0;
+  pscript->cs_asserted = 0;
+  pscript->waiting = 0;
+  pscript->running = 1;
+  
+  prv_script_run(pscript);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_script_abort(jhal_script* pscript)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  if(!pscript)
+    return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!pscript->running)
+    return JHAL_RES_NO_ERRORS;
+  
+  jhal_spi_script_attach(pscript->pinstance_spi, NULL);
+  jhal_spi_abort(pscript->pinstance_spi);
+  if(pscript->pinstance_tim)
+    jhal_tim_base_stop_it(pscript->pinstance_tim);
+  
+  prv_script_finish(pscript, JHAL_RES_ERROR);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_script_busy(jhal_script* pscript)
+{
+  return pscript->running;
+}
+
+/* Called by the spi driver for the completion of the transfer of a step */
+void jhal_script_step_complete(jhal_script* pscript)
+{
+  if(!pscript->running)
+    return;
+  
+  pscript->waiting = 0;
+  prv_script_run(pscript);
+}
+
+/* Called by the timer driver, a wait step ends after its amount of periods */
+void jhal_script_period_ellapsed(jhal_script* pscript)
+{
+  if(!pscript->running || !pscript->amount_periods || --pscript->amount_periods)
+    return;
+  
+  jhal_tim_base_stop_it(pscript->pinstance_tim);
+  pscript->waiting = 0;
+  prv_script_run(pscript);
+}
+
+/* Called by the spi driver when the transfer of a step ended with an error,
+   the script stops there with result */
+void jhal_script_step_failed(jhal_script* pscript, uint8_t result)
+{
+  if(pscript->running)
+    prv_script_finish(pscript, result);
+}
+
+#endif
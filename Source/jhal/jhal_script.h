@@ -0,0 +1,96 @@
+#ifndef __JHAL_SCRIPT__
+#define __JHAL_SCRIPT__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+
+#if (USE_JHAL_SCRIPT == 1)
+
+/* A script is a const array of bus steps run from the completion interrupts of
+   the spi instance (and of the timer for waits) without going back to the
+   application between steps. Only the end of the script is reported */
+typedef enum {
+  JHAL_SCRIPT_OP_END            = 0U,
+  JHAL_SCRIPT_OP_CS             = 1U,
+  JHAL_SCRIPT_OP_TX             = 2U,
+  JHAL_SCRIPT_OP_RX             = 3U,
+  JHAL_SCRIPT_OP_TXRX           = 4U,
+  JHAL_SCRIPT_OP_DELAY_US       = 5U,
+  JHAL_SCRIPT_OP_WAIT_PERIODS   = 6U,
+  JHAL_SCRIPT_OP_GPIO           = 7U,
+  JHAL_SCRIPT_OP_RETRY          = 8U
+} jhal_script_op;
+
+/* size     - bytes of TX/RX/TXRX, us of DELAY_US, periods of WAIT_PERIODS, attempts of RETRY
+   offset   - place in the rx area for RX/TXRX, status byte checked by RETRY
+   value    - 1 asserts and 0 releases the chip select of CS, level of GPIO, steps back of RETRY */
+typedef struct {
+  uint8_t                       op;
+  uint8_t                       value;
+  uint16_t                      size;
+  uint16_t                      offset;
+  uint8_t                       mask;
+  uint8_t                       expect;
+  const uint8_t*                ptxdata;
+  uint64_t                      pins;
+} jhal_script_step;
+
+#define JHAL_SCRIPT_END()                                       {JHAL_SCRIPT_OP_END, 0, 0, 0, 0, 0, NULL, 0}
+#define JHAL_SCRIPT_CS(ASSERT)                                  {JHAL_SCRIPT_OP_CS, (ASSERT), 0, 0, 0, 0, NULL, 0}
+#define JHAL_SCRIPT_TX(PTXDATA, SIZE)                           {JHAL_SCRIPT_OP_TX, 0, (SIZE), 0, 0, 0, (PTXDATA), 0}
+#define JHAL_SCRIPT_RX(OFFSET, SIZE)                            {JHAL_SCRIPT_OP_RX, 0, (SIZE), (OFFSET), 0, 0, NULL, 0}
+#define JHAL_SCRIPT_TXRX(PTXDATA, OFFSET, SIZE)                 {JHAL_SCRIPT_OP_TXRX, 0, (SIZE), (OFFSET), 0, 0, (PTXDATA), 0}
+#define JHAL_SCRIPT_DELAY_US(AMOUNT_US)                         {JHAL_SCRIPT_OP_DELAY_US, 0, (AMOUNT_US), 0, 0, 0, NULL, 0}
+#define JHAL_SCRIPT_WAIT_PERIODS(AMOUNT)                        {JHAL_SCRIPT_OP_WAIT_PERIODS, 0, (AMOUNT), 0, 0, 0, NULL, 0}
+#define JHAL_SCRIPT_GPIO(PINS, VALUE)                           {JHAL_SCRIPT_OP_GPIO, (VALUE), 0, 0, 0, 0, NULL, (PINS)}
+#define JHAL_SCRIPT_RETRY(OFFSET, MASK, EXPECT, BACK, ATTEMPTS) {JHAL_SCRIPT_OP_RETRY, (BACK), (ATTEMPTS), (OFFSET), (MASK), (EXPECT), NULL, 0}
+
+typedef struct jhal_script_struct jhal_script;
+
+/* result is JHAL_RES_TIMEOUT when a RETRY step ran out of attempts and
+   JHAL_RES_ERROR when a transfer ended with an error of the spi instance,
+   index_step points to the step the script stopped at */
+typedef void (*jhal_type_script_complete)(void* puser_data, jhal_script* pscript, uint8_t result);
+
+/* period_us is the period of pinstance_tim, DELAY_US waits on the timer for the
+   amount rounded up to whole periods. Without them the delay spins in place,
+   i.e. in the completion interrupt of the previous step */
+struct jhal_script_struct {
+  const jhal_script_step*       psteps;
+  void*                         pinstance_spi;
+  void*                         pinstance_gpio;
+  void*                         pinstance_tim;
+  uint32_t                      period_us;
+  uint64_t                      pins_cs;
+  uint8_t*                      prxdata;
+  uint16_t                      size_rxdata;
+  jhal_type_script_complete     pfunc_complete;
+  void*                         puser_data;
+  
+  volatile uint16_t             index_step;
+  uint16_t                      amount_attempts;
+  uint16_t                      amount_periods;
+  uint8_t                       cs_asserted;
+  volatile uint8_t              running;
+  volatile uint8_t              waiting;
+  volatile uint8_t              stepping;
+};
+
+uint8_t jhal_script_start(jhal_script* pscript);
+uint8_t jhal_script_abort(jhal_script* pscript);
+uint8_t jhal_script_busy(jhal_script* pscript);
+
+void jhal_script_step_complete(jhal_script* pscript);
+void jhal_script_step_failed(jhal_script* pscript, uint8_t result);
+void jhal_script_period_ellapsed(jhal_script* pscript);
+
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
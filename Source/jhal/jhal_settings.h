@@ -1,23 +1,62 @@
-#ifndef __JHAL_SETTINGS__
-#define __JHAL_SETTINGS__
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#define USE_JHAL_ASSERT                 0  
-#define USE_JHAL_OS                     0  
-  
-#define JHAL_LEVEL_PROTECT_LOW          0  
-#define JHAL_LEVEL_PROTECT_MIDDLE       1
-#define JHAL_LEVEL_PROTECT_HIGH         2
-  
-#define JHAL_LEVEL_PROTECT              JHAL_LEVEL_PROTECT_HIGH      
-#define JHAL_SIZE_ADD_PARAMS            5
-#define JHAL_SIZE_MEM                   128    
-  
-#ifdef __cplusplus
-}
-#endif
-
+#ifndef __JHAL_SETTINGS__
+#define __JHAL_SETTINGS__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define USE_JHAL_ASSERT                 0  
+#define USE_JHAL_OS                     0  
+#define USE_JHAL_INLINE                 0
+#define USE_JHAL_OPS                    0
+#define USE_JHAL_QUEUE                  0
+#define USE_JHAL_DEFER                  0
+#define USE_JHAL_TRACE                  0
+#define USE_JHAL_STATS                  0
+#define USE_JHAL_BUF                    0
+#define USE_JHAL_DEADLINE               0
+#define USE_JHAL_SCRIPT                 0
+  
+#define JHAL_LEVEL_PROTECT_LOW          0  
+#define JHAL_LEVEL_PROTECT_MIDDLE       1
+#define JHAL_LEVEL_PROTECT_HIGH         2
+  
+#define JHAL_LEVEL_PROTECT              JHAL_LEVEL_PROTECT_HIGH      
+#define JHAL_SIZE_ADD_PARAMS            5
+
+#define JHAL_MEM_POOL_CLASSES           3
+#define JHAL_MEM_POOL_SIZE_CLASS_0      32
+#define JHAL_MEM_POOL_AMOUNT_CLASS_0    8
+#define JHAL_MEM_POOL_SIZE_CLASS_1      64
+#define JHAL_MEM_POOL_AMOUNT_CLASS_1    4
+#define JHAL_MEM_POOL_SIZE_CLASS_2      128
+#define JHAL_MEM_POOL_AMOUNT_CLASS_2    2
+#define JHAL_MEM_POOL_SIZE_CLASS_3      0
+#define JHAL_MEM_POOL_AMOUNT_CLASS_3    0
+
+#define USE_JHAL_MEM_STATS              0
+#define USE_JHAL_MEM_CALL_SITE          0
+#define USE_JHAL_MEM_LINKED             0
+
+#define JHAL_DEFER_LEVELS               2
+#define JHAL_DEFER_QUEUE_SIZE           16
+
+#define JHAL_TRACE_SIZE                 256
+
+#define JHAL_BUF_AMOUNT                 8
+#define JHAL_BUF_SIZE                   128
+
+#define JHAL_CRC_SLICES                 8
+
+#define JHAL_ADC_DECIMATION_OUTPUTS     8
+
+#define JHAL_ONEWIRE_CHUNK_SIZE         9
+
+#define JHAL_FLASH_BUFFER_SIZE          32
+#define JHAL_FLASH_BUFFERS              2
+  
+#ifdef __cplusplus
+}
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,136 @@
+#include <string.h>
+#include "jhal_stats.h"
+#include JHAL_TICK_INCLUDE_NAME
+
+#if (USE_JHAL_STATS == 1)
+
+/* Counter updates below use masks instead of branches, so the cost of a
+   probe does not depend on the result of the operation */
+#define STATS_MASK(CONDITION)           (0U - (uint32_t)(CONDITION))
+#define STATS_MAX(A, B)                 ((A) ^ (((A) ^ (B)) & STATS_MASK((A) < (B))))
+
+#define STATS_OP_ASYNC(OP)              (((uint32_t)(OP) - JHAL_TRACE_OP_TRANSMIT_IT <= JHAL_TRACE_OP_TRANSMITRECEIVE_DMA - JHAL_TRACE_OP_TRANSMIT_IT)\
+                                         | ((OP) == JHAL_TRACE_OP_START_IT) | ((OP) == JHAL_TRACE_OP_RESET_IT)\
+                                         | ((OP) == JHAL_TRACE_OP_ERASE_IT))
+#define STATS_OP_COMPLETE(OP)           ((uint32_t)(OP) - JHAL_TRACE_OP_TX_COMPLETE <= JHAL_TRACE_OP_TRANSFER_COMPLETE - JHAL_TRACE_OP_TX_COMPLETE)
+
+/* Plain transmits end with TX complete, everything else (receive, full duplex,
+   DMA, conversions, bus resets) is timed on the second direction */
+#define STATS_DIRECTION(OP)             (1U - (((OP) == JHAL_TRACE_OP_TRANSMIT) | ((OP) == JHAL_TRACE_OP_TRANSMIT_IT)\
+                                               | ((OP) == JHAL_TRACE_OP_TRANSMIT_DMA) | ((OP) == JHAL_TRACE_OP_TX_COMPLETE)))
+
+uint8_t jhal_stats_get(void* pinstance, jhal_stats* pstats)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  if(!pinstance || !pstats)
+    return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  jhal_stats_counters counters;
+  
+  /* The 64-bit counters are not written atomically, copy them with the interrupts masked */
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  counters = JHAL_DRIVER_BY_INSTANCE(pinstance)->stats;
+  JHAL_CRITICAL_EXIT(state);
+  
+  pstats->operations = counters.operations;
+  pstats->completions = counters.completions;
+  pstats->events = counters.events;
+  pstats->timeouts = counters.results[JHAL_RES_TIMEOUT];
+  pstats->errors = counters.operations - counters.results[JHAL_RES_NO_ERRORS];
+  memcpy(pstats->results, counters.results, sizeof(pstats->results));
+  pstats->bytes = counters.bytes;
+  pstats->cycles_busy = counters.cycles_call + counters.cycles_complete;
+  pstats->cycles_latency_max = STATS_MAX(counters.cycles_call_max, counters.cycles_complete_max);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_stats_reset(void* pinstance)
+{
+#if (JHAL_LEVEL_PROTECT > JHAL_LEVEL_PROTECT_LOW)
+  if(!pinstance)
+    return JHAL_RES_INVALID_PARAMS;
+#endif
+  if(!JHAL_CHECK_INSTANCE(pinstance))
+    return JHAL_RES_INVALID_PARAMS;
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  memset(&JHAL_DRIVER_BY_INSTANCE(pinstance)->stats, 0, sizeof(jhal_stats_counters));
+  JHAL_CRITICAL_EXIT(state);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+void jhal_stats_begin(void* pinstance, uint8_t op)
+{
+  jhal_stats_counters* pstats = &JHAL_DRIVER_BY_INSTANCE(pinstance)->stats;
+  uint32_t direction = STATS_DIRECTION(op);
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  pstats->timestamp_start[direction] = JHAL_TICK_CYCLES();
+  pstats->starts[direction]++;
+  JHAL_CRITICAL_EXIT(state);
+}
+
+/* Blocking calls are busy until they return, IT and DMA starts until their completion */
+uint8_t jhal_stats_end(void* pinstance, uint8_t op, uint32_t size, uint8_t result)
+{
+  jhal_stats_counters* pstats = &JHAL_DRIVER_BY_INSTANCE(pinstance)->stats;
+  uint32_t direction = STATS_DIRECTION(op);
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  uint32_t cycles = (JHAL_TICK_CYCLES() - pstats->timestamp_start[direction]) & ~STATS_MASK(STATS_OP_ASYNC(op));
+  
+  pstats->operations++;
+  pstats->results[result & (JHAL_STATS_RESULTS - 1)]++;
+  pstats->bytes += size & STATS_MASK(result == JHAL_RES_NO_ERRORS);
+  pstats->cycles_call += cycles;
+  pstats->cycles_call_max = STATS_MAX(pstats->cycles_call_max, cycles);
+  JHAL_CRITICAL_EXIT(state);
+  
+  return result;
+}
+
+/* A queued request owns the instance until it completes (direct transfers are
+   refused meanwhile), so both directions are stamped and either completion ends it */
+void jhal_stats_request(void* pinstance, uint32_t size)
+{
+  jhal_stats_counters* pstats = &JHAL_DRIVER_BY_INSTANCE(pinstance)->stats;
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  uint32_t timestamp = JHAL_TICK_CYCLES();
+  
+  pstats->timestamp_start[0] = timestamp;
+  pstats->timestamp_start[1] = timestamp;
+  pstats->starts[0]++;
+  pstats->starts[1]++;
+  pstats->operations++;
+  pstats->results[JHAL_RES_NO_ERRORS]++;
+  pstats->bytes += size;
+  JHAL_CRITICAL_EXIT(state);
+}
+
+/* Completion latency is measured only when a start happened since the previous
+   completion, repeated completions of a circular transfer are just counted */
+void jhal_stats_event(void* pinstance, uint8_t op)
+{
+  jhal_stats_counters* pstats = &JHAL_DRIVER_BY_INSTANCE(pinstance)->stats;
+  uint32_t complete = STATS_OP_COMPLETE(op);
+  uint32_t direction = STATS_DIRECTION(op);
+  
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  uint32_t starts = pstats->starts[direction];
+  uint32_t cycles = (JHAL_TICK_CYCLES() - pstats->timestamp_start[direction]) & STATS_MASK(complete & (starts != pstats->starts_seen[direction]));
+  
+  pstats->events++;
+  pstats->completions += complete;
+  pstats->starts_seen[direction] ^= (pstats->starts_seen[direction] ^ starts) & STATS_MASK(complete);
+  pstats->cycles_complete += cycles;
+  pstats->cycles_complete_max = STATS_MAX(pstats->cycles_complete_max, cycles);
+  JHAL_CRITICAL_EXIT(state);
+}
+
+#endif
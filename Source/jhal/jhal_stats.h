@@ -0,0 +1,50 @@
+#ifndef __JHAL_STATS__
+#define __JHAL_STATS__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+#include "jhal_trace.h"
+
+#if (USE_JHAL_STATS == 1)
+
+/* Snapshot of the counters of one instance. Cycles are counted by
+   JHAL_TICK_CYCLES, results[] are the calls by JHAL_RES_* code */
+typedef struct {
+  uint32_t                      operations;
+  uint32_t                      completions;
+  uint32_t                      events;
+  uint32_t                      timeouts;
+  uint32_t                      errors;
+  uint32_t                      results[JHAL_STATS_RESULTS];
+  uint64_t                      bytes;
+  uint64_t                      cycles_busy;
+  uint32_t                      cycles_latency_max;
+} jhal_stats;
+
+uint8_t jhal_stats_get(void* pinstance, jhal_stats* pstats);
+uint8_t jhal_stats_reset(void* pinstance);
+
+void jhal_stats_begin(void* pinstance, uint8_t op);
+uint8_t jhal_stats_end(void* pinstance, uint8_t op, uint32_t size, uint8_t result);
+void jhal_stats_request(void* pinstance, uint32_t size);
+void jhal_stats_event(void* pinstance, uint8_t op);
+
+/* OP is a constant at every call site, so the request check folds at compile time */
+#define JHAL_STATS_BEGIN(INSTANCE, OP)                                  jhal_stats_begin((INSTANCE), (OP))
+#define JHAL_STATS_END(INSTANCE, OP, SIZE, RESULT)                      jhal_stats_end((INSTANCE), (OP), (SIZE), (RESULT))
+#define JHAL_STATS_EVENT(INSTANCE, OP, SIZE)                            ((OP) == JHAL_TRACE_OP_REQUEST ? jhal_stats_request((INSTANCE), (SIZE))\
+                                                                                                       : jhal_stats_event((INSTANCE), (OP)))
+#else
+#define JHAL_STATS_BEGIN(INSTANCE, OP)                                  ((void)0)
+#define JHAL_STATS_END(INSTANCE, OP, SIZE, RESULT)                      (RESULT)
+#define JHAL_STATS_EVENT(INSTANCE, OP, SIZE)                            ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
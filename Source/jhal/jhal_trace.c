@@ -0,0 +1,94 @@
+#include <string.h>
+#include "jhal_trace.h"
+#include JHAL_TICK_INCLUDE_NAME
+
+#if (USE_JHAL_TRACE == 1)
+
+/* Flight recorder: the ring always overwrites the oldest record, the free
+   running index tells the decoder how many records were lost */
+static jhal_trace_record TraceRing[JHAL_TRACE_SIZE];
+static volatile uint32_t TraceIndex = 0;
+static volatile uint8_t TraceEnabled = 0;
+static uint32_t TraceCyclesHz = 0;
+
+void jhal_trace_init(uint32_t cycles_hz)
+{
+  TraceEnabled = 0;
+  memset(TraceRing, 0, sizeof(TraceRing));
+  TraceIndex = 0;
+  TraceCyclesHz = cycles_hz;
+  TraceEnabled = 1;
+}
+
+void jhal_trace_start(void)
+{
+  TraceEnabled = 1;
+}
+
+void jhal_trace_stop(void)
+{
+  TraceEnabled = 0;
+}
+
+void jhal_trace_emit(uint8_t driver, const void* pinstance, uint8_t op, uint8_t phase, uint32_t size, uint8_t result)
+{
+  if(!TraceEnabled)
+    return;
+  
+  /* The slot and the timestamp are taken together, so records of preempting
+     interrupts keep the ring in timestamp order */
+  uint32_t state = JHAL_CRITICAL_ENTER();
+  uint32_t index = TraceIndex++;
+  uint32_t timestamp = JHAL_TICK_CYCLES();
+  JHAL_CRITICAL_EXIT(state);
+  
+  jhal_trace_record* precord = &TraceRing[index & (JHAL_TRACE_SIZE - 1)];
+  precord->timestamp = timestamp;
+  precord->instance = (uint32_t)(uintptr_t)pinstance;
+  precord->size = size > 0xFFFFU ? 0xFFFFU : (uint16_t)size;
+  precord->driver = driver;
+  precord->op = op;
+  precord->phase = phase;
+  precord->result = result;
+  precord->sequence = (uint16_t)index;
+}
+
+uint8_t jhal_trace_result(uint8_t driver, const void* pinstance, uint8_t op, uint32_t size, uint8_t result)
+{
+  jhal_trace_emit(driver, pinstance, op, JHAL_TRACE_PHASE_END, size, result);
+  
+  return result;
+}
+
+/* Writes the header and the records through pfunc_write, tracing is paused
+   meanwhile. Returns the amount of records written */
+uint32_t jhal_trace_dump(jhal_type_trace_write pfunc_write, void* puser_data)
+{
+  if(!pfunc_write)
+    return 0;
+  
+  uint8_t enabled = TraceEnabled;
+  TraceEnabled = 0;
+  
+  jhal_trace_header header;
+  uint32_t index = TraceIndex;
+  uint32_t amount = index < JHAL_TRACE_SIZE ? index : JHAL_TRACE_SIZE;
+  
+  header.magic = JHAL_TRACE_MAGIC;
+  header.version = JHAL_TRACE_VERSION;
+  header.size_record = sizeof(jhal_trace_record);
+  header.cycles_hz = TraceCyclesHz;
+  header.index = index;
+  header.amount = amount;
+  header.reserved = 0;
+  pfunc_write(puser_data, (const uint8_t*)&header, sizeof(header));
+  
+  for(uint32_t i = index - amount; i != index; i++)
+    pfunc_write(puser_data, (const uint8_t*)&TraceRing[i & (JHAL_TRACE_SIZE - 1)], sizeof(jhal_trace_record));
+  
+  TraceEnabled = enabled;
+  
+  return amount;
+}
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef __JHAL_TRACE__
+#define __JHAL_TRACE__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "jhal_environment.h"
+
+#define JHAL_TRACE_PHASE_BEGIN                          0U
+#define JHAL_TRACE_PHASE_END                            1U
+#define JHAL_TRACE_PHASE_EVENT                          2U
+
+typedef enum {
+  JHAL_TRACE_OP_TRANSMIT                = 1U,
+  JHAL_TRACE_OP_RECEIVE                 = 2U,
+  JHAL_TRACE_OP_TRANSMITRECEIVE         = 3U,
+  JHAL_TRACE_OP_TRANSMIT_IT             = 4U,
+  JHAL_TRACE_OP_RECEIVE_IT              = 5U,
+  JHAL_TRACE_OP_TRANSMITRECEIVE_IT      = 6U,
+  JHAL_TRACE_OP_TRANSMIT_DMA            = 7U,
+  JHAL_TRACE_OP_RECEIVE_DMA             = 8U,
+  JHAL_TRACE_OP_TRANSMITRECEIVE_DMA     = 9U,
+  JHAL_TRACE_OP_START                   = 10U,
+  JHAL_TRACE_OP_STOP                    = 11U,
+  JHAL_TRACE_OP_START_IT                = 12U,
+  JHAL_TRACE_OP_STOP_IT                 = 13U,
+  JHAL_TRACE_OP_ABORT                   = 14U,
+  JHAL_TRACE_OP_REQUEST                 = 15U,
+  JHAL_TRACE_OP_TX_COMPLETE             = 16U,
+  JHAL_TRACE_OP_RX_COMPLETE             = 17U,
+  JHAL_TRACE_OP_TXRX_COMPLETE           = 18U,
+  JHAL_TRACE_OP_TRANSFER_COMPLETE       = 19U,
+  JHAL_TRACE_OP_INPUT                   = 20U,
+  JHAL_TRACE_OP_PERIOD_ELLAPSED         = 21U,
+  JHAL_TRACE_OP_CALCULATE               = 22U,
+  JHAL_TRACE_OP_ERROR                   = 23U,
+  JHAL_TRACE_OP_HALF_COMPLETE           = 24U,
+  JHAL_TRACE_OP_RESET                   = 25U,
+  JHAL_TRACE_OP_RESET_IT                = 26U,
+  JHAL_TRACE_OP_ERASE                   = 27U,
+  JHAL_TRACE_OP_ERASE_IT                = 28U,
+  JHAL_TRACE_OP_USER                    = 255U
+} jhal_trace_op;
+
+/* Dump layout, little endian: jhal_trace_header followed by amount records
+   from the oldest to the newest. instance is the low word of the instance
+   address, for JHAL_TRACE_OP_USER it holds the marker id */
+#define JHAL_TRACE_MAGIC                                0x4352544AU
+#define JHAL_TRACE_VERSION                              1U
+
+typedef struct {
+  uint32_t                      magic;
+  uint16_t                      version;
+  uint16_t                      size_record;
+  uint32_t                      cycles_hz;
+  uint32_t                      index;
+  uint32_t                      amount;
+  uint32_t                      reserved;
+} jhal_trace_header;
+
+typedef struct {
+  uint32_t                      timestamp;
+  uint32_t                      instance;
+  uint16_t                      size;
+  uint8_t                       driver;
+  uint8_t                       op;
+  uint8_t                       phase;
+  uint8_t                       result;
+  uint16_t                      sequence;
+} jhal_trace_record;
+
+typedef void (*jhal_type_trace_write)(void* puser_data, const uint8_t* pdata, uint32_t size);
+
+#if (USE_JHAL_TRACE == 1)
+
+#if (JHAL_TRACE_SIZE & (JHAL_TRACE_SIZE - 1)) || (JHAL_TRACE_SIZE == 0)
+  #error "JHAL_TRACE_SIZE must be a power of two!"
+#endif
+
+void jhal_trace_init(uint32_t cycles_hz);
+void jhal_trace_start(void);
+void jhal_trace_stop(void);
+void jhal_trace_emit(uint8_t driver, const void* pinstance, uint8_t op, uint8_t phase, uint32_t size, uint8_t result);
+uint8_t jhal_trace_result(uint8_t driver, const void* pinstance, uint8_t op, uint32_t size, uint8_t result);
+uint32_t jhal_trace_dump(jhal_type_trace_write pfunc_write, void* puser_data);
+
+#define JHAL_TRACE_BEGIN(DRIVER, INSTANCE, OP, SIZE)                    jhal_trace_emit((DRIVER), (INSTANCE), (OP), JHAL_TRACE_PHASE_BEGIN, (SIZE), 0)
+#define JHAL_TRACE_END(DRIVER, INSTANCE, OP, SIZE, RESULT)              jhal_trace_result((DRIVER), (INSTANCE), (OP), (SIZE), (RESULT))
+#define JHAL_TRACE_EVENT(DRIVER, INSTANCE, OP, SIZE)                    jhal_trace_emit((DRIVER), (INSTANCE), (OP), JHAL_TRACE_PHASE_EVENT, (SIZE), 0)
+#define JHAL_TRACE_USER(ID, VALUE)                                      jhal_trace_emit(JHAL_DRIVER_TYPE_OTHER, (const void*)(uintptr_t)(ID), JHAL_TRACE_OP_USER, JHAL_TRACE_PHASE_EVENT, (VALUE), 0)
+#else
+#define JHAL_TRACE_BEGIN(DRIVER, INSTANCE, OP, SIZE)                    ((void)0)
+#define JHAL_TRACE_END(DRIVER, INSTANCE, OP, SIZE, RESULT)              (RESULT)
+#define JHAL_TRACE_EVENT(DRIVER, INSTANCE, OP, SIZE)                    ((void)0)
+#define JHAL_TRACE_USER(ID, VALUE)                                      ((void)0)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
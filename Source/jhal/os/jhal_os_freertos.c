@@ -0,0 +1,159 @@
+#include "jhal_os.h"
+
+#if (USE_JHAL_OS == 1)
+#include "task.h"
+
+static TickType_t prv_ticks(uint32_t timeout)
+{
+  if(timeout == JHAL_OS_WAIT_FOREVER)
+    return portMAX_DELAY;
+  
+  /* Round up, a timeout shorter than the tick period must not turn into no wait */
+  return (TickType_t)(((uint64_t)timeout * configTICK_RATE_HZ + 999U) / 1000U);
+}
+
+static uint8_t prv_in_isr(void)
+{
+  return xPortIsInsideInterrupt() == pdTRUE;
+}
+
+uint8_t jhal_os_can_block(void)
+{
+  return xTaskGetSchedulerState() == taskSCHEDULER_RUNNING && !prv_in_isr();
+}
+
+/* The Cortex-M ports know the interrupt context from IPSR */
+void jhal_os_isr_enter(void)
+{
+}
+
+void jhal_os_isr_exit(void)
+{
+}
+
+uint8_t jhal_os_sleep_us(uint32_t amount_us)
+{
+  vTaskDelay((TickType_t)(((uint64_t)amount_us * configTICK_RATE_HZ + 999999U) / 1000000U));
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_sem_init(jhal_os_sem* psem, uint32_t count_initial, uint32_t count_max)
+{
+  if(!count_max || count_initial > count_max)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  psem->handle = xSemaphoreCreateCountingStatic(count_max, count_initial, &psem->storage);
+  
+  return psem->handle ? JHAL_RES_NO_ERRORS : JHAL_RES_ALLOC_ERROR;
+}
+
+uint8_t jhal_os_sem_deinit(jhal_os_sem* psem)
+{
+  vSemaphoreDelete(psem->handle);
+  psem->handle = NULL;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_sem_take(jhal_os_sem* psem, uint32_t timeout)
+{
+  return xSemaphoreTake(psem->handle, prv_ticks(timeout)) == pdTRUE ? JHAL_RES_NO_ERRORS : JHAL_RES_TIMEOUT;
+}
+
+uint8_t jhal_os_sem_give(jhal_os_sem* psem)
+{
+  BaseType_t res;
+  
+  if(prv_in_isr())
+  {
+    BaseType_t woken = pdFALSE;
+    res = xSemaphoreGiveFromISR(psem->handle, &woken);
+    portYIELD_FROM_ISR(woken);
+  }
+  else
+    res = xSemaphoreGive(psem->handle);
+  
+  return res == pdTRUE ? JHAL_RES_NO_ERRORS : JHAL_RES_ERROR;
+}
+
+uint8_t jhal_os_mutex_init(jhal_os_mutex* pmutex)
+{
+  pmutex->handle = xSemaphoreCreateMutexStatic(&pmutex->storage);
+  
+  return pmutex->handle ? JHAL_RES_NO_ERRORS : JHAL_RES_ALLOC_ERROR;
+}
+
+uint8_t jhal_os_mutex_deinit(jhal_os_mutex* pmutex)
+{
+  vSemaphoreDelete(pmutex->handle);
+  pmutex->handle = NULL;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_mutex_lock(jhal_os_mutex* pmutex, uint32_t timeout)
+{
+  return xSemaphoreTake(pmutex->handle, prv_ticks(timeout)) == pdTRUE ? JHAL_RES_NO_ERRORS : JHAL_RES_TIMEOUT;
+}
+
+uint8_t jhal_os_mutex_unlock(jhal_os_mutex* pmutex)
+{
+  return xSemaphoreGive(pmutex->handle) == pdTRUE ? JHAL_RES_NO_ERRORS : JHAL_RES_ERROR;
+}
+
+uint8_t jhal_os_event_init(jhal_os_event* pevent)
+{
+  pevent->handle = xEventGroupCreateStatic(&pevent->storage);
+  
+  return pevent->handle ? JHAL_RES_NO_ERRORS : JHAL_RES_ALLOC_ERROR;
+}
+
+uint8_t jhal_os_event_deinit(jhal_os_event* pevent)
+{
+  vEventGroupDelete(pevent->handle);
+  pevent->handle = NULL;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_event_set(jhal_os_event* pevent, uint32_t bits)
+{
+  if(prv_in_isr())
+  {
+    BaseType_t woken = pdFALSE;
+    BaseType_t res = xEventGroupSetBitsFromISR(pevent->handle, (EventBits_t)bits, &woken);
+    portYIELD_FROM_ISR(woken);
+    
+    return res == pdPASS ? JHAL_RES_NO_ERRORS : JHAL_RES_ERROR;
+  }
+  
+  xEventGroupSetBits(pevent->handle, (EventBits_t)bits);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_event_clear(jhal_os_event* pevent, uint32_t bits)
+{
+  if(prv_in_isr())
+    return xEventGroupClearBitsFromISR(pevent->handle, (EventBits_t)bits) == pdPASS ? JHAL_RES_NO_ERRORS : JHAL_RES_ERROR;
+  
+  xEventGroupClearBits(pevent->handle, (EventBits_t)bits);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+/* The awaited bits are cleared on success, pbits gets the bits which were set */
+uint8_t jhal_os_event_wait(jhal_os_event* pevent, uint32_t bits, uint8_t wait_all, uint32_t timeout, uint32_t* pbits)
+{
+  EventBits_t set = xEventGroupWaitBits(pevent->handle, (EventBits_t)bits, pdTRUE, wait_all ? pdTRUE : pdFALSE, prv_ticks(timeout));
+  
+  if(pbits)
+    *pbits = (uint32_t)set;
+  
+  set &= (EventBits_t)bits;
+  
+  return (wait_all ? (set == (EventBits_t)bits) : (set != 0)) ? JHAL_RES_NO_ERRORS : JHAL_RES_TIMEOUT;
+}
+
+#endif
@@ -0,0 +1,29 @@
+#ifndef __JHAL_OS_FREERTOS__
+#define __JHAL_OS_FREERTOS__
+
+/* Objects are created statically inside the jhal instances, so the port needs
+   configSUPPORT_STATIC_ALLOCATION. jhal_os_event_set from interrupts goes through
+   the timer task and needs configUSE_TIMERS and INCLUDE_xTimerPendFunctionCall */
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+#include "event_groups.h"
+
+#define JHAL_OS_SLEEP_MIN_US                            (1000000U / configTICK_RATE_HZ)
+
+typedef struct {
+  SemaphoreHandle_t             handle;
+  StaticSemaphore_t             storage;
+} jhal_os_sem;
+
+typedef struct {
+  SemaphoreHandle_t             handle;
+  StaticSemaphore_t             storage;
+} jhal_os_mutex;
+
+typedef struct {
+  EventGroupHandle_t            handle;
+  StaticEventGroup_t            storage;
+} jhal_os_event;
+
+#endif
@@ -0,0 +1,270 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+#include <errno.h>
+#include "jhal_os.h"
+
+#if (USE_JHAL_OS == 1)
+
+#define OS_NS_IN_US                     1000ULL
+#define OS_NS_IN_MS                     1000000ULL
+#define OS_NS_IN_S                      1000000000ULL
+
+static _Thread_local uint8_t InIsr = 0;
+
+static void prv_cond_init(pthread_mutex_t* plock, pthread_cond_t* pcond)
+{
+  pthread_condattr_t cond_attr;
+  pthread_condattr_init(&cond_attr);
+  pthread_condattr_setclock(&cond_attr, CLOCK_MONOTONIC);
+  pthread_cond_init(pcond, &cond_attr);
+  pthread_condattr_destroy(&cond_attr);
+  
+  pthread_mutex_init(plock, NULL);
+}
+
+static void prv_cond_deinit(pthread_mutex_t* plock, pthread_cond_t* pcond)
+{
+  pthread_cond_destroy(pcond);
+  pthread_mutex_destroy(plock);
+}
+
+static void prv_deadline(struct timespec* pdeadline, uint32_t timeout)
+{
+  clock_gettime(CLOCK_MONOTONIC, pdeadline);
+  
+  uint64_t deadline_ns = (uint64_t)pdeadline->tv_sec * OS_NS_IN_S + pdeadline->tv_nsec + timeout * OS_NS_IN_MS;
+  pdeadline->tv_sec = deadline_ns / OS_NS_IN_S;
+  pdeadline->tv_nsec = deadline_ns % OS_NS_IN_S;
+}
+
+/* Waits on pcond with plock held until pfunc_ready is true, returns with plock held */
+static uint8_t prv_cond_wait(pthread_mutex_t* plock, pthread_cond_t* pcond, uint8_t (*pfunc_ready)(void*), void* pobject, uint32_t timeout)
+{
+  struct timespec deadline;
+  
+  if(timeout != JHAL_OS_WAIT_FOREVER)
+    prv_deadline(&deadline, timeout);
+  
+  while(!pfunc_ready(pobject))
+  {
+    if(timeout == JHAL_OS_NO_WAIT)
+      return JHAL_RES_TIMEOUT;
+    
+    if(timeout == JHAL_OS_WAIT_FOREVER)
+      pthread_cond_wait(pcond, plock);
+    else if(pthread_cond_timedwait(pcond, plock, &deadline) == ETIMEDOUT && !pfunc_ready(pobject))
+      return JHAL_RES_TIMEOUT;
+  }
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_can_block(void)
+{
+  return !InIsr;
+}
+
+void jhal_os_isr_enter(void)
+{
+  InIsr++;
+}
+
+void jhal_os_isr_exit(void)
+{
+  InIsr--;
+}
+
+uint8_t jhal_os_sleep_us(uint32_t amount_us)
+{
+  struct timespec delay;
+  delay.tv_sec = amount_us / 1000000U;
+  delay.tv_nsec = (amount_us % 1000000U) * OS_NS_IN_US;
+  
+  while(nanosleep(&delay, &delay) && errno == EINTR);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_sem_init(jhal_os_sem* psem, uint32_t count_initial, uint32_t count_max)
+{
+  if(!count_max || count_initial > count_max)
+    return JHAL_RES_INVALID_PARAMS;
+  
+  prv_cond_init(&psem->lock, &psem->cond);
+  psem->count = count_initial;
+  psem->count_max = count_max;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_sem_deinit(jhal_os_sem* psem)
+{
+  prv_cond_deinit(&psem->lock, &psem->cond);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_sem_ready(void* pobject)
+{
+  return ((jhal_os_sem*)pobject)->count != 0;
+}
+
+uint8_t jhal_os_sem_take(jhal_os_sem* psem, uint32_t timeout)
+{
+  pthread_mutex_lock(&psem->lock);
+  
+  uint8_t res = prv_cond_wait(&psem->lock, &psem->cond, prv_sem_ready, psem, timeout);
+  if(res == JHAL_RES_NO_ERRORS)
+    psem->count--;
+  
+  pthread_mutex_unlock(&psem->lock);
+  
+  return res;
+}
+
+uint8_t jhal_os_sem_give(jhal_os_sem* psem)
+{
+  uint8_t res = JHAL_RES_NO_ERRORS;
+  
+  pthread_mutex_lock(&psem->lock);
+  
+  if(psem->count < psem->count_max)
+  {
+    psem->count++;
+    pthread_cond_signal(&psem->cond);
+  }
+  else
+    res = JHAL_RES_ERROR;
+  
+  pthread_mutex_unlock(&psem->lock);
+  
+  return res;
+}
+
+/* Built on a condition variable instead of pthread_mutex_timedlock, which has
+   no monotonic clock variant */
+uint8_t jhal_os_mutex_init(jhal_os_mutex* pmutex)
+{
+  prv_cond_init(&pmutex->lock, &pmutex->cond);
+  pmutex->locked = 0;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_mutex_deinit(jhal_os_mutex* pmutex)
+{
+  prv_cond_deinit(&pmutex->lock, &pmutex->cond);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+static uint8_t prv_mutex_ready(void* pobject)
+{
+  return !((jhal_os_mutex*)pobject)->locked;
+}
+
+uint8_t jhal_os_mutex_lock(jhal_os_mutex* pmutex, uint32_t timeout)
+{
+  pthread_mutex_lock(&pmutex->lock);
+  
+  uint8_t res = prv_cond_wait(&pmutex->lock, &pmutex->cond, prv_mutex_ready, pmutex, timeout);
+  if(res == JHAL_RES_NO_ERRORS)
+  {
+    pmutex->locked = 1;
+    pmutex->owner = pthread_self();
+  }
+  
+  pthread_mutex_unlock(&pmutex->lock);
+  
+  return res;
+}
+
+uint8_t jhal_os_mutex_unlock(jhal_os_mutex* pmutex)
+{
+  uint8_t res = JHAL_RES_NO_ERRORS;
+  
+  pthread_mutex_lock(&pmutex->lock);
+  
+  if(pmutex->locked && pthread_equal(pmutex->owner, pthread_self()))
+  {
+    pmutex->locked = 0;
+    pthread_cond_signal(&pmutex->cond);
+  }
+  else
+    res = JHAL_RES_ERROR;
+  
+  pthread_mutex_unlock(&pmutex->lock);
+  
+  return res;
+}
+
+uint8_t jhal_os_event_init(jhal_os_event* pevent)
+{
+  prv_cond_init(&pevent->lock, &pevent->cond);
+  pevent->bits = 0;
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_event_deinit(jhal_os_event* pevent)
+{
+  prv_cond_deinit(&pevent->lock, &pevent->cond);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_event_set(jhal_os_event* pevent, uint32_t bits)
+{
+  pthread_mutex_lock(&pevent->lock);
+  pevent->bits |= bits;
+  pthread_cond_broadcast(&pevent->cond);
+  pthread_mutex_unlock(&pevent->lock);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+uint8_t jhal_os_event_clear(jhal_os_event* pevent, uint32_t bits)
+{
+  pthread_mutex_lock(&pevent->lock);
+  pevent->bits &= ~bits;
+  pthread_mutex_unlock(&pevent->lock);
+  
+  return JHAL_RES_NO_ERRORS;
+}
+
+typedef struct {
+  jhal_os_event*                pevent;
+  uint32_t                      bits;
+  uint8_t                       wait_all;
+} os_event_condition;
+
+static uint8_t prv_event_ready(void* pobject)
+{
+  os_event_condition* pcondition = (os_event_condition*)pobject;
+  uint32_t bits = pcondition->pevent->bits & pcondition->bits;
+  
+  return pcondition->wait_all ? (bits == pcondition->bits) : (bits != 0);
+}
+
+/* The awaited bits are cleared on success, pbits gets the bits which were set */
+uint8_t jhal_os_event_wait(jhal_os_event* pevent, uint32_t bits, uint8_t wait_all, uint32_t timeout, uint32_t* pbits)
+{
+  os_event_condition condition = {pevent, bits, wait_all};
+  
+  pthread_mutex_lock(&pevent->lock);
+  
+  uint8_t res = prv_cond_wait(&pevent->lock, &pevent->cond, prv_event_ready, &condition, timeout);
+  
+  if(pbits)
+    *pbits = pevent->bits;
+  
+  if(res == JHAL_RES_NO_ERRORS)
+    pevent->bits &= ~bits;
+  
+  pthread_mutex_unlock(&pevent->lock);
+  
+  return res;
+}
+
+#endif
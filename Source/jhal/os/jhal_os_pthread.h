@@ -0,0 +1,32 @@
+#ifndef __JHAL_OS_PTHREAD__
+#define __JHAL_OS_PTHREAD__
+
+/* Port for host builds, interrupts are simulated by threads which must call
+   jhal_os_isr_enter/jhal_os_isr_exit around handlers */
+
+#include <stdint.h>
+#include <pthread.h>
+
+#define JHAL_OS_SLEEP_MIN_US                            50U
+
+typedef struct {
+  pthread_mutex_t               lock;
+  pthread_cond_t                cond;
+  uint32_t                      count;
+  uint32_t                      count_max;
+} jhal_os_sem;
+
+typedef struct {
+  pthread_mutex_t               lock;
+  pthread_cond_t                cond;
+  uint8_t                       locked;
+  pthread_t                     owner;
+} jhal_os_mutex;
+
+typedef struct {
+  pthread_mutex_t               lock;
+  pthread_cond_t                cond;
+  uint32_t                      bits;
+} jhal_os_event;
+
+#endif